@@ -137,7 +137,13 @@ public:
 	typedef map<int, CRef<CBlastNode> > TRegisteredNodes;
 	typedef map<int, double> TActiveNodes;
 	typedef map<int, CRef<CBlastNodeMsg> > TFormatQueue;
-	void RegisterNode(CBlastNode * node, CBlastNodeMailbox * mailbox);
+	typedef map<int, CBlastNode *> TPendingNodes;
+	/// Register a chunk with the master node
+	/// @param node The chunk to run
+	/// @param mailbox Mailbox the chunk posts its messages to
+	/// @param est_length Estimated number of query residues in the chunk,
+	///                   used to start costlier chunks first (0 if unknown)
+	void RegisterNode(CBlastNode * node, CBlastNodeMailbox * mailbox, Int8 est_length = 0);
 	int GetNumNodes() { return m_RegisteredNodes.size();}
 	int IsFull();
 	void Shutdown() { m_MaxNumNodes = -1; }
@@ -151,12 +157,33 @@ public:
 	}
 	void FormatResults();
 	CConditionVariable & GetBuzzer() {return m_NewEvent;}
-	~CBlastMasterNode() {}
+	~CBlastMasterNode();
 	int GetNumOfQueries() { return m_NumQueries; }
 	Int8 GetQueriesLength() { return m_QueriesLength; }
 	int GetNumErrStatus() { return m_NumErrStatus; }
+	/// Total predicted and actual run time (in seconds) of the chunks for
+	/// which a prediction was made
+	double GetPredictedRunTime() { return m_PredictedRunTime; }
+	double GetActualRunTime() { return m_ActualRunTime; }
+	/// Bytes of formatted output currently held in memory, waiting for
+	/// earlier chunks to complete
+	Int8 GetBufferedBytes() { return m_BufferedBytes; }
 private:
+	/// Output of a completed chunk that cannot be written yet
+	struct SOutputSegment {
+		CBlastNodeMsg::EMsgType msg_type;
+		int status;
+		int num_queries;
+		Int8 queries_length;
+		string output;      ///< Output held in memory, or
+		string file_name;   ///< file the output was spilled to
+	};
+	typedef map<int, SOutputSegment> TOutputSegments;
+
 	void x_WaitForNewEvent();
+	void x_StartPendingNodes();
+	void x_BufferResults();
+	void x_WriteSegment(int chunk_num, SOutputSegment & segment);
 
 	CNcbiOstream & m_OutputStream;
 	int m_MaxNumThreads;
@@ -167,10 +194,30 @@ private:
 	TRegisteredNodes m_RegisteredNodes;
 	TActiveNodes m_ActiveNodes;
 	TFormatQueue m_FormatQueue;
+	TPendingNodes m_PendingNodes;
 	CConditionVariable m_NewEvent;
 	int m_NumErrStatus;
 	int m_NumQueries;
 	Int8 m_QueriesLength;
+	/// Number of chunks registered beyond those running
+	int m_LookAhead;
+	int m_NumWaiting;
+	/// Estimated query residues and predicted run time per chunk
+	map<int, Int8> m_EstLengths;
+	map<int, double> m_PredictedTimes;
+	/// Throughput model: residues and run time of completed chunks
+	Int8 m_CompletedLength;
+	double m_CompletedTime;
+	double m_PredictedRunTime;
+	double m_ActualRunTime;
+	/// Completed chunks released early, in memory up to m_MaxBufferedBytes
+	/// and in temporary files beyond that
+	TOutputSegments m_OutputSegments;
+	Int8 m_BufferedBytes;
+	Int8 m_MaxBufferedBytes;
+	/// Directory for the temporary files (BLAST_MT_OUTPUT_SPILL_DIR), or
+	/// empty for the system default
+	string m_SpillDir;
 };
 
 
@@ -179,14 +226,34 @@ class NCBI_XBLAST_EXPORT CBlastNodeInputReader : public CStreamLineReader
 public:
 
 	CBlastNodeInputReader(CNcbiIstream& is, int batch_size, int est_avg_len) :
-		CStreamLineReader(is), m_QueryBatchSize(batch_size), m_EstAvgQueryLength(est_avg_len), m_QueryCount(0) {}
+		CStreamLineReader(is), m_QueryBatchSize(batch_size), m_EstAvgQueryLength(est_avg_len), m_QueryCount(0),
+		m_BatchLength(0), m_HasPendingQuery(false), m_PendingLength(0), m_PendingCount(0) {}
 
+	/// Read the next batch of queries. A query at least as long as the
+	/// batch size is always placed in a batch of its own.
 	int GetQueryBatch(string & queries, int & query_no);
 
+	/// Input is exhausted, including any query read ahead.
+	/// Unlike AtEOF(), which only tells whether the stream has been read
+	/// to the end, this is false while a query read ahead of the last
+	/// batch has not been returned by GetQueryBatch() yet.
+	bool AtEndOfQueries(void) const { return !m_HasPendingQuery && AtEOF(); }
+
+	/// Estimated number of residues in the last batch read
+	int GetBatchLength() { return m_BatchLength; }
+
 private:
+	bool x_ReadQuery();
+
 	const int m_QueryBatchSize;
 	const int m_EstAvgQueryLength;
 	int m_QueryCount;
+	int m_BatchLength;
+	/// Query read ahead of the current batch
+	bool m_HasPendingQuery;
+	string m_PendingQuery;
+	int m_PendingLength;
+	int m_PendingCount;
 };
 
 END_SCOPE(blast)
@@ -89,6 +89,29 @@ public:
     
     /// Executes the search
     CRef<CSearchResultSet> Run();
+
+    /// Executes only the preliminary stage of the search. Run() is
+    /// equivalent to RunPreliminarySearch() followed by RunTraceback();
+    /// calling them separately lets an application run the traceback of
+    /// one query batch while the preliminary stage of the next one is in
+    /// progress.
+    void RunPreliminarySearch();
+
+    /// Executes the traceback stage of a search whose preliminary stage was
+    /// run by RunPreliminarySearch().
+    /// The preliminary stage switches the CSeqDB it searches in and out of
+    /// multi-threaded mode, so a traceback must not read from a CSeqDB
+    /// while the preliminary stage of another search uses it. To run the
+    /// traceback concurrently with such a search, pass an adapter for the
+    /// same database that opened its own CSeqDB (see
+    /// CSearchDatabase::CloneWithOwnSeqDb); subject sequences and their
+    /// information are then read through it.
+    /// @param tback_db_adapter adapter to read the subjects from, or NULL
+    /// to use the one of the preliminary stage [in]
+    /// @return the search results, same as Run()
+    CRef<CSearchResultSet>
+    RunTraceback(CRef<CLocalDbAdapter> tback_db_adapter =
+                 CRef<CLocalDbAdapter>());
     
     /// Set a function callback to be invoked by the CORE of BLAST to allow
     /// interrupting a BLAST search in progress.
@@ -118,6 +141,19 @@ public:
     }
 
 private:
+    /// Value of m_PrelimStatus before RunPreliminarySearch is called
+    static const int kPrelimSearchNotRun = -1;
+
+    /// Run the traceback stage
+    /// @param tback_db_adapter adapter to read the subjects from, or NULL
+    /// to use the one of the preliminary stage [in]
+    CRef<CSearchResultSet>
+    x_RunTraceback(CRef<CLocalDbAdapter> tback_db_adapter);
+
+    /// Stage timing structure in the search diagnostics, NULL if there is
+    /// none
+    BlastStageTimes* x_GetStageTimes();
+
     /// Query factory from which to obtain the query sequence data
     CRef<IQueryFactory> m_QueryFactory;
     
@@ -137,6 +173,10 @@ private:
     /// Local DB adaptor (if one was) passed to constructor.
     CRef<CLocalDbAdapter> m_LocalDbAdapter;
 
+    /// DB adaptor passed to RunTraceback, which owns the BlastSeqSrc used
+    /// by the traceback stage
+    CRef<CLocalDbAdapter> m_TbackDbAdapter;
+
     /// User-specified IBlastSeqInfoSrc implementation
     /// (may be used for non-standard databases, etc.)
     CRef<IBlastSeqInfoSrc> m_SeqInfoSrc;
@@ -147,6 +187,9 @@ private:
     // current batch number
     std::string m_batch_num_str;
 
+    /// Result of checking the internal data before the preliminary stage
+    int m_PrelimStatus;
+
     friend class ::CBlastFilterTest;
     friend class CBl2Seq;
 };
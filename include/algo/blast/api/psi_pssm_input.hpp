@@ -38,6 +38,7 @@
 #include <algo/blast/api/blast_aux.hpp>
 #include <algo/blast/api/pssm_input.hpp>
 #include <objmgr/scope.hpp>
+#include <objects/seq/seq_id_handle.hpp>
 
 /// Forward declaration for unit test classes
 class CPssmCreateTestFixture;
@@ -151,6 +152,53 @@ private:
     double	m_ImpalaScaleFactor;
 };
 
+/// Rows of the multiple sequence alignment built by CPsiBlastInputData, kept
+/// between PSI-BLAST iterations. The row of a subject sequence whose included
+/// alignments have not changed since the previous iteration is copied from
+/// here rather than rebuilt, which would require fetching the subject
+/// sequence data from the scope again.
+class NCBI_XBLAST_EXPORT CPsiBlastMsaCache : public CObject
+{
+public:
+    /// Constructor
+    CPsiBlastMsaCache() : m_QueryLength(0), m_NumReusedRows(0) {}
+
+    /// Discard all cached rows
+    void Clear() {
+        m_Rows.clear();
+        m_QueryLength = 0;
+        m_NumReusedRows = 0;
+    }
+
+    /// Number of rows cached
+    size_t GetNumRows() const { return m_Rows.size(); }
+
+    /// Number of rows the last multiple sequence alignment built copied from
+    /// this cache instead of building them
+    size_t GetNumReusedRows() const { return m_NumReusedRows; }
+
+private:
+    /// A row of the multiple sequence alignment
+    struct SRow {
+        /// Segments and coordinates of the alignments the row was built from
+        vector<TSignedSeqPos>   m_Signature;
+        /// Contents of the row
+        vector<PSIMsaCell>      m_Cells;
+    };
+    /// Rows indexed by the subject sequence identifier
+    typedef map<objects::CSeq_id_Handle, SRow> TRows;
+
+    /// Rows of the last multiple sequence alignment built
+    TRows           m_Rows;
+    /// Length of the query of the last multiple sequence alignment built
+    unsigned int    m_QueryLength;
+    /// Number of rows of the last multiple sequence alignment built which
+    /// were copied from this cache
+    size_t          m_NumReusedRows;
+
+    friend class CPsiBlastInputData;
+};
+
 /// This class is a concrete strategy for IPssmInputData, and it
 /// implements the traditional PSI-BLAST algorithm for building a multiple
 /// sequence alignment from a list of pairwise alignments using the C++ object
@@ -227,6 +275,14 @@ public:
         return m_QueryBioseq;
     }
 
+    /// Reuse the rows of the multiple sequence alignment built in a previous
+    /// PSI-BLAST iteration; the cache is updated with the rows built by
+    /// Process(). Must be called before Process().
+    /// @param cache rows of the previous multiple sequence alignment [in|out]
+    void SetMsaCache(CRef<CPsiBlastMsaCache> cache) {
+        m_MsaCache = cache;
+    }
+
 private:
 
     /// Pointer to query sequence
@@ -253,6 +309,8 @@ private:
     int                             m_GapExtension;
     /// Query as CBioseq for PSSM
     CRef<objects::CBioseq>          m_QueryBioseq;
+    /// Rows of the multiple sequence alignment of the previous iteration
+    CRef<CPsiBlastMsaCache>         m_MsaCache;
 
     /////////////////////////// Auxiliary functions ///////////////////////////
 
@@ -299,7 +357,8 @@ private:
     /// debugging only) [in]
     /// @param bit_score bit score for this sequence aligned with the query
     /// (used for debugging only) [in]
-    void x_ProcessDenseg(const objects::CDense_seg& denseg, 
+    /// @return false if the subject sequence data could not be retrieved
+    bool x_ProcessDenseg(const objects::CDense_seg& denseg, 
                          unsigned int msa_index,
                          double evalue, double bit_score);
 
@@ -55,6 +55,7 @@ BEGIN_SCOPE(blast)
 
 // Forward declarations
 class IQueryFactory;
+class CPsiBlastMsaCache;
 
 /// Runs a single iteration of the PSI-BLAST algorithm on a BLAST database
 /// @code
@@ -149,6 +150,11 @@ private:
  * @param opts_handle PSI-BLAST options [in]
  * @param diagnostics_req Optional requests for diagnostics data from the PSSM
  * engine [in]
+ * @param num_threads Number of threads the PSSM engine may use [in]
+ * @param msa_cache Optional rows of the multiple sequence alignment built in
+ * the previous iteration, to be reused for the subject sequences whose
+ * alignments did not change; updated with the rows of this alignment
+ * (e.g.: CPsiBlastIterationState::GetMsaCache()) [in|out]
  * @todo add overloaded function which takes a blast::SSeqLoc
  */
 NCBI_XBLAST_EXPORT
@@ -158,7 +164,9 @@ PsiBlastComputePssmFromAlignment(const objects::CBioseq& query,
                                  CRef<objects::CScope> database_scope,
                                  const CPSIBlastOptionsHandle& opts_handle,
                                  CConstRef<CBlastAncillaryData> ancillary_data,
-                                 PSIDiagnosticsRequest* diagnostics_req = 0);
+                                 PSIDiagnosticsRequest* diagnostics_req = 0,
+                                 size_t num_threads = 1,
+                                 CPsiBlastMsaCache* msa_cache = 0);
 
 END_SCOPE(blast)
 END_NCBI_SCOPE
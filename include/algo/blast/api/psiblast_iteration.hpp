@@ -54,8 +54,9 @@ END_SCOPE(objects)
 
 BEGIN_SCOPE(blast)
 
-// Forward declaration
+// Forward declarations
 class CPSIBlastOptionsHandle;
+class CPsiBlastMsaCache;
 
 /// Represents the iteration state in PSI-BLAST
 class NCBI_XBLAST_EXPORT CPsiBlastIterationState
@@ -112,6 +113,10 @@ public:
     /// Return the number of the current iteration
     unsigned int GetIterationNumber() const;
 
+    /// Rows of the multiple sequence alignment built to compute the PSSM of
+    /// the previous iteration, which can be reused to compute the next one
+    CPsiBlastMsaCache& GetMsaCache();
+
 private:
     // No value semantics
 
@@ -133,6 +138,9 @@ private:
     /// Identifiers for sequences found in the current iteration
     TSeqIds             m_CurrentData;
 
+    /// Rows of the multiple sequence alignment of the previous iteration
+    CRef<CPsiBlastMsaCache> m_MsaCache;
+
     /// After the iteration state object has converged or exhausted its
     /// iterations, it shouldn't be modified, so it throws a CBlastException 
     /// if this happens
@@ -188,6 +188,11 @@ public:
     /// Obtain a reference to the database
     CRef<CSeqDB> GetSeqDb() const;
 
+    /// Make a copy of this object which opens the database again rather
+    /// than sharing this object's CSeqDB, e.g. for a search stage that runs
+    /// concurrently with another one on the same database
+    CRef<CSearchDatabase> CloneWithOwnSeqDb() const;
+
 private:
     string          m_DbName;                   ///< database name
     EMoleculeType   m_MolType;                  ///< molecule type
@@ -108,6 +108,10 @@ NCBI_XBLAST_EXPORT
 void Blast_MatrixInfoFree(Blast_MatrixInfo ** ss);
 
 
+/** A cache of recently computed composition-adjusted score matrices
+ * (@sa Blast_CompositionWorkspaceInitMatrixCache) */
+typedef struct Blast_AdjustedMatrixCache Blast_AdjustedMatrixCache;
+
 /** Work arrays used to perform composition-based matrix adjustment */
 typedef struct Blast_CompositionWorkspace {
     double ** mat_b;       /**< joint probabilities for the matrix in
@@ -118,6 +122,8 @@ typedef struct Blast_CompositionWorkspace {
                                            of the first sequence */
     double * second_standard_freq;    /**< background frequency vector of
                                            the second sequence */
+    Blast_AdjustedMatrixCache * matrix_cache; /**< recently adjusted
+                                                   matrices, or NULL */
 } Blast_CompositionWorkspace;
 
 
@@ -134,6 +140,24 @@ int Blast_CompositionWorkspaceInit(Blast_CompositionWorkspace * NRrecord,
                                    const char *matrixName);
 
 
+/**
+ * Have Blast_AdjustScores remember the last num_entries score matrices
+ * it computed with this workspace. When it is called again with the
+ * same query and subject compositions and lengths, the stored matrix is
+ * returned instead of being recomputed; the result is the same as
+ * without the cache. Only square (non position-based) matrices are
+ * cached. A workspace with a cache must not be shared between threads.
+ *
+ * @param NRrecord     the workspace [in][out]
+ * @param num_entries  number of matrices to keep [in]
+ * @param alphsize     the size of the alphabet [in]
+ * @return 0 on success, -1 if out of memory
+ */
+NCBI_XBLAST_EXPORT
+int Blast_CompositionWorkspaceInitMatrixCache(
+        Blast_CompositionWorkspace * NRrecord, int num_entries, int alphsize);
+
+
 /** Free memory associated with a record of type
  * Blast_CompositionWorkspace. */
 NCBI_XBLAST_EXPORT
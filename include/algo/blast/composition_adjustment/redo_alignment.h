@@ -307,6 +307,38 @@ new_xdrop_align_type(BlastCompo_Alignment **palign,
 typedef void free_align_traceback_type(void * traceback_data);
 
 
+/**
+ * Function type: compute the score and right-hand endpoints of the
+ * locally optimal Smith-Waterman alignment, e.g. with vectorized
+ * code.  The results must be those Blast_SmithWatermanScoreOnly would
+ * compute with no forbidden ranges.
+ *
+ * @param *score            the score of the optimal alignment
+ * @param *matchSeqEnd      the right-hand endpoint of the alignment in
+ *                          the database sequence
+ * @param *queryEnd         the right-hand endpoint of the alignment
+ *                          in the query sequence
+ * @param subject_data      the database sequence data
+ * @param subject_length    length of the database sequence
+ * @param query_data        the query sequence data
+ * @param query_length      length of the query
+ * @param matrix            amino-acid scoring matrix
+ * @param alphsize          number of columns of matrix
+ * @param gapOpen           penalty for opening a gap
+ * @param gapExtend         penalty for extending a gap by one amino acid
+ * @param positionSpecific  determines whether matrix is position
+ *                          specific or not
+ * @return 0 on success, or -1 if nothing was computed, in which case
+ *         Blast_SmithWatermanScoreOnly is used
+ */
+typedef int
+sw_score_only_type(int *score, int *matchSeqEnd, int *queryEnd,
+                   const Uint1 * subject_data, int subject_length,
+                   const Uint1 * query_data, int query_length,
+                   int **matrix, int alphsize, int gapOpen,
+                   int gapExtend, int positionSpecific);
+
+
 /** Callbacks used by Blast_RedoOneMatch and
  * Blast_RedoOneMatchSmithWaterman routines */
 typedef struct Blast_RedoAlignCallbacks {
@@ -320,6 +352,8 @@ typedef struct Blast_RedoAlignCallbacks {
     new_xdrop_align_type * new_xdrop_align;
     /** @sa free_align_traceback_type */
     free_align_traceback_type * free_align_traceback;
+    /** @sa sw_score_only_type; may be NULL */
+    sw_score_only_type * sw_score_only;
 } Blast_RedoAlignCallbacks;
 
 
@@ -78,11 +78,29 @@ typedef struct BlastGappedStats {
                             e-value threshold. */
 } BlastGappedStats;
 
+/** Structure containing counts of writes to the HSP stream shared by the
+ * preliminary search threads */
+typedef struct BlastHSPStreamStats {
+   Int8 hsp_lists_written; /**< Number of HSP lists written to the stream */
+   Int8 lock_acquisitions; /**< Number of times the stream lock was taken */
+   Int8 lock_contentions; /**< Number of lock acquisitions that had to wait
+                             for another thread to release the lock */
+} BlastHSPStreamStats;
+
+/** Structure containing the wall clock time spent in each stage of a BLAST
+ * search */
+typedef struct BlastStageTimes {
+   double prelim_search; /**< Seconds spent in the preliminary stage */
+   double traceback; /**< Seconds spent in the traceback stage */
+} BlastStageTimes;
+
 /** Return statistics from the BLAST search */
 typedef struct BlastDiagnostics {
    BlastUngappedStats* ungapped_stat; /**< Ungapped extension counts */
    BlastGappedStats* gapped_stat; /**< Gapped extension counts */
    BlastRawCutoffs* cutoffs; /**< Various raw values for the cutoffs */
+   BlastHSPStreamStats* hsp_stream_stat; /**< HSP stream write counts */
+   BlastStageTimes* stage_times; /**< Time spent in each search stage */
    MT_LOCK mt_lock; /**< Mutex for updating diagnostics data in a 
                        multi-threaded search. */
 } BlastDiagnostics;
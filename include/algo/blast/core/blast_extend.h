@@ -109,6 +109,12 @@ typedef struct BLAST_DiagHash {
 typedef struct Blast_ExtendWord {
    BLAST_DiagTable* diag_table; /**< Diagonal array and related parameters */
    BLAST_DiagHash* hash_table; /**< Hash table and related parameters */ 
+   Int2* aa_profile; /**< Int16 score profile of the query used by the
+                          batched protein ungapped extension; 32 columns per
+                          query position plus a trailing all-zero row. Built
+                          on first use, NULL if not in use */
+   Int4** aa_profile_matrix; /**< Matrix aa_profile was built from */
+   const Uint1* aa_profile_query; /**< Query aa_profile was built from */
 } Blast_ExtendWord;
 
 /** Initializes the word extension structure
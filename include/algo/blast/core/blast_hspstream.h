@@ -42,6 +42,7 @@
 #include <algo/blast/core/blast_hits.h>
 #include <algo/blast/core/blast_hspfilter.h>
 #include <algo/blast/core/spliced_hits.h>
+#include <algo/blast/core/blast_diagnostics.h>
 #include <connect/ncbi_core.h>
 
 #ifdef __cplusplus
@@ -212,6 +213,25 @@ extern const int kBlastHSPStream_Eof;
 NCBI_XBLAST_EXPORT
 int BlastHSPStreamWrite(BlastHSPStream* hsp_stream, BlastHSPList** hsp_list);
 
+/** Write several HSP lists to the HSP stream, taking the stream lock only
+ * once for the whole batch. The lists are passed to the writer in the order
+ * given, so the results are the same as if each list had been written with
+ * BlastHSPStreamWrite.
+ * @param hsp_stream The BlastHSPStream object [in]
+ * @param hsp_lists Array of HSP lists to write. The HSP stream takes
+ * ownership of every list written successfully and sets its entry to NULL;
+ * on error, the entries not yet written are left for the caller to free
+ * [in] [out]
+ * @param num_hsp_lists Number of entries in hsp_lists [in]
+ * @param stats If not NULL, updated with the number of lists written and
+ * with the number of lock acquisitions and contentions [in] [out]
+ * @return kBlastHSPStream_Success on success, otherwise kBlastHSPStream_Error
+ */
+NCBI_XBLAST_EXPORT
+int BlastHSPStreamBatchWrite(BlastHSPStream* hsp_stream,
+                             BlastHSPList** hsp_lists, Int4 num_hsp_lists,
+                             BlastHSPStreamStats* stats);
+
 /** Invokes the user-specified read function for this BlastHSPStream
  * implementation.
  * @param hsp_stream The BlastHSPStream object [in]
@@ -544,6 +544,12 @@ typedef struct PSIBlastOptions {
      */
     Boolean ignore_unaligned_positions;
 
+    /** Number of threads the PSSM engine may use to purge the multiple
+     * sequence alignment and to compute the sequence weights and frequency
+     * ratios. The resulting PSSM does not depend on this value.
+     */
+    Int4 num_threads;
+
 } PSIBlastOptions;
 
 
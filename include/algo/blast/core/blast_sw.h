@@ -86,6 +86,61 @@ void SmithWatermanScoreWithTraceback(EBlastProgramType program_number,
                                      BlastGapAlignStruct *gap_align,
                                      Int4 start_shift, Int4 cutoff);
 
+/** Compute the score of the best local alignment between two
+ *  protein sequences. When the build supports it, a striped SIMD
+ *  kernel is used; it falls back to the scalar recurrence if the
+ *  score does not fit in its lanes, so the result is always the same.
+ * @param A The first sequence (the query, if gap_align is
+ *          position-based) [in]
+ * @param a_size Length of the first sequence [in]
+ * @param B The second sequence [in]
+ * @param b_size Length of the second sequence [in]
+ * @param gap_open Gap open penalty [in]
+ * @param gap_extend Gap extension penalty [in]
+ * @param gap_align Auxiliary data for gapped alignment
+ *             (used for score matrix info) [in]
+ * @param allow_simd If FALSE, always use the scalar code [in]
+ * @return The score of the best local alignment between A and B
+ */
+NCBI_XBLAST_EXPORT
+Int4 SmithWatermanScoreOnly(const Uint1 *A, Int4 a_size,
+                            const Uint1 *B, Int4 b_size,
+                            Int4 gap_open, Int4 gap_extend,
+                            BlastGapAlignStruct *gap_align,
+                            Boolean allow_simd);
+
+/** Compute the score and end of the best local alignment between two
+ *  protein sequences with the striped SIMD kernel only. Unlike
+ *  SmithWatermanScoreOnly, the score matrix need not be symmetric,
+ *  so this can be used with composition-adjusted matrices. Where
+ *  several cells attain the best score, the end reported is the one
+ *  with the smallest query position, then the smallest subject
+ *  position, as in Blast_SmithWatermanScoreOnly.
+ * @param query The query sequence [in]
+ * @param query_length Length of the query [in]
+ * @param subject The subject sequence [in]
+ * @param subject_length Length of the subject [in]
+ * @param gap_open Gap open penalty [in]
+ * @param gap_extend Gap extension penalty [in]
+ * @param matrix Score matrix with BLASTAA_SIZE columns, indexed by
+ *               [query letter][subject letter], or by
+ *               [query position][subject letter] if position_based [in]
+ * @param position_based TRUE if matrix is a PSSM [in]
+ * @param query_end Query position where the alignment ends, or NULL
+ *                  if not needed [out]
+ * @param subject_end Subject position where the alignment ends [out]
+ * @return The score of the best local alignment, or -1 if the kernel
+ *         is not available in this build or can not be used for these
+ *         sequences and scores
+ */
+NCBI_XBLAST_EXPORT
+Int4 SmithWatermanScoreOnlyStriped(const Uint1 *query, Int4 query_length,
+                                   const Uint1 *subject,
+                                   Int4 subject_length,
+                                   Int4 gap_open, Int4 gap_extend,
+                                   Int4 **matrix, Boolean position_based,
+                                   Int4 *query_end, Int4 *subject_end);
+
 /** Performs score-only Smith-Waterman gapped alignment of the subject
  * sequence with all contexts in the query.
  * @param program_number Type of BLAST program [in]
@@ -0,0 +1,130 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/** @file lookup_cache.h
+ * On-disk cache of finalized lookup tables, so that repeated searches
+ * with the same queries and options can skip lookup table construction.
+ *
+ * A cache file holds one lookup table, identified by a key computed from
+ * everything that went into building it (query residues, lookup segments,
+ * lookup table and filtering options, and for proteins the score matrix
+ * or PSSM). The file starts with a fixed header and a copy of the query
+ * residues and lookup table options, which are compared with those of
+ * the search so that a key collision cannot load the wrong table. These
+ * are followed by the scalar fields of the table and then its backbone,
+ * overflow and presence vector arrays, each starting on an 8-byte
+ * boundary. Files are written
+ * in native byte order and are rejected on a machine with a different
+ * byte order or structure layout.
+ *
+ * Supported tables are the small and standard nucleotide tables, the
+ * megablast table and the protein table. Tables built with database word
+ * filtering (which includes the hashed nucleotide table used for mapping)
+ * depend on the database as well as the query and are never cached.
+ */
+
+#ifndef ALGO_BLAST_CORE__LOOKUP_CACHE__H
+#define ALGO_BLAST_CORE__LOOKUP_CACHE__H
+
+#include <algo/blast/core/ncbi_std.h>
+#include <algo/blast/core/blast_def.h>
+#include <algo/blast/core/blast_options.h>
+#include <algo/blast/core/blast_stat.h>
+#include <algo/blast/core/lookup_wrap.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Determine whether a lookup table built with the given options can be
+ * stored in and loaded from a lookup table cache file.
+ * @param lookup_options Lookup table options [in]
+ * @return TRUE if the table can be cached
+ */
+NCBI_XBLAST_EXPORT
+Boolean LookupTableCacheSupported(const LookupTableOptions* lookup_options);
+
+/** Compute the key identifying a lookup table built from the given
+ * inputs. Two calls return the same key only if LookupTableWrapInit
+ * would build the same lookup table from their arguments.
+ * @param query The query sequence [in]
+ * @param lookup_options Lookup table options [in]
+ * @param query_options Query setup (filtering) options [in]
+ * @param lookup_segments Locations on the query used for lookup table
+ *                        construction [in]
+ * @param sbp Scoring block containing the matrix or PSSM [in]
+ * @return 64-bit key for the lookup table
+ */
+NCBI_XBLAST_EXPORT
+Uint8 LookupTableCacheKey(const BLAST_SequenceBlk* query,
+                          const LookupTableOptions* lookup_options,
+                          const QuerySetUpOptions* query_options,
+                          const BlastSeqLoc* lookup_segments,
+                          const BlastScoreBlk* sbp);
+
+/** Write a finalized lookup table to a cache file.
+ * @param lookup_wrap The lookup table [in]
+ * @param key Key computed by LookupTableCacheKey for this table [in]
+ * @param query The query the table was built from [in]
+ * @param lookup_options Lookup table options the table was built
+ *                       with [in]
+ * @param file_name Name of the file to create [in]
+ * @return 0 on success, -1 if the table type is not supported or the
+ *         file could not be written
+ */
+NCBI_XBLAST_EXPORT
+Int2 LookupTableWrapSave(const LookupTableWrap* lookup_wrap, Uint8 key,
+                         const BLAST_SequenceBlk* query,
+                         const LookupTableOptions* lookup_options,
+                         const char* file_name);
+
+/** Load a lookup table from a cache file. The table is equivalent to
+ * the one LookupTableWrapInit would have built; in particular, the
+ * query is prepared for scanning exactly as during construction.
+ * @param file_name Name of the cache file [in]
+ * @param key Key computed by LookupTableCacheKey for the current
+ *            search; the file is rejected if it was saved with a
+ *            different key [in]
+ * @param query The query sequence; the file is rejected unless it was
+ *              saved for the same residues [in]
+ * @param lookup_options Lookup table options of the current search;
+ *                       the file is rejected unless it was saved with
+ *                       the same options [in]
+ * @param lookup_wrap_ptr The loaded lookup table [out]
+ * @return 0 on success, nonzero if the file is missing, stale or
+ *         corrupt (in which case *lookup_wrap_ptr is set to NULL)
+ */
+NCBI_XBLAST_EXPORT
+Int2 LookupTableWrapLoad(const char* file_name, Uint8 key,
+                         BLAST_SequenceBlk* query,
+                         const LookupTableOptions* lookup_options,
+                         LookupTableWrap** lookup_wrap_ptr);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* !ALGO_BLAST_CORE__LOOKUP_CACHE__H */
@@ -91,6 +91,117 @@ Int2 BlastNaWordFinder(BLAST_SequenceBlk* subject,
                        BlastUngappedStats* ungapped_stats);
 
 
+/** A batch of short nucleotide subject sequences, stored one after the
+ * other in a single packed buffer so that the lookup table is scanned
+ * for all of them in one pass. Each subject starts on a byte boundary,
+ * so the aligned scanning routines can be used and find exactly the
+ * words they would find in the subject on its own. The word hits are
+ * kept, per subject, until the subject is extended with
+ * BlastNaWordFinderBatch.
+ */
+typedef struct BlastNaSubjectBatch {
+    Uint1* sequence;       /**< Packed (ncbi2na) residues of all subjects */
+    Int4 sequence_bytes;   /**< Bytes of sequence in use */
+    Int4 max_bytes;        /**< Bytes allocated for sequence */
+    Int4 num_subjects;     /**< Number of subjects in the batch */
+    Int4 max_subjects;     /**< Maximum number of subjects in the batch */
+    Int4* oids;            /**< Ordinal id of each subject */
+    Int4* starts;          /**< Offset of each subject in sequence, in
+                                bases */
+    Int4* lengths;         /**< Length of each subject */
+    BlastOffsetPair* hits; /**< Word hits of all subjects; subject offsets
+                                are relative to the start of the subject */
+    Int4 num_hits;         /**< Number of word hits */
+    Int4 max_hits;         /**< Number of word hits allocated */
+    Int4* hit_starts;      /**< Index of the first hit of each subject;
+                                hits of subject i end at hit_starts[i+1] */
+} BlastNaSubjectBatch;
+
+/** Allocate a subject batch.
+ * @param max_subjects Maximum number of subjects in the batch [in]
+ * @param max_residues Maximum total length of the subjects [in]
+ * @return The new batch, or NULL if out of memory
+ */
+NCBI_XBLAST_EXPORT
+BlastNaSubjectBatch* BlastNaSubjectBatchNew(Int4 max_subjects,
+                                            Int4 max_residues);
+
+/** Deallocate a subject batch.
+ * @param batch The batch to free [in]
+ * @return NULL
+ */
+NCBI_XBLAST_EXPORT
+BlastNaSubjectBatch* BlastNaSubjectBatchFree(BlastNaSubjectBatch* batch);
+
+/** Remove all subjects and word hits from a batch.
+ * @param batch The batch to reset [in][out]
+ */
+NCBI_XBLAST_EXPORT
+void BlastNaSubjectBatchReset(BlastNaSubjectBatch* batch);
+
+/** Copy an unmasked packed subject sequence into a batch.
+ * @param batch The batch [in][out]
+ * @param subject The subject sequence, in ncbi2na encoding [in]
+ * @return TRUE if the subject was added, FALSE if the batch is full
+ */
+NCBI_XBLAST_EXPORT
+Boolean BlastNaSubjectBatchAdd(BlastNaSubjectBatch* batch,
+                               const BLAST_SequenceBlk* subject);
+
+/** Fill a sequence block describing one subject of a batch. The block
+ * points into the batch and owns no memory.
+ * @param batch The batch [in]
+ * @param index Index of the subject in the batch [in]
+ * @param subject The sequence block to fill [out]
+ */
+NCBI_XBLAST_EXPORT
+void BlastNaSubjectBatchGetSubject(const BlastNaSubjectBatch* batch,
+                                   Int4 index, BLAST_SequenceBlk* subject);
+
+/** Scan all subjects of a batch for word hits, with the same scanning
+ * routine BlastNaWordFinder would use for an unmasked subject.
+ * @param batch The batch; its word hits are replaced [in][out]
+ * @param lookup_wrap Pointer to the (wrapper) lookup table structure [in]
+ * @param offset_pairs Array for storing query and subject offsets [in]
+ * @param max_hits size of offset arrays [in]
+ * @return 0 on success, -1 if out of memory
+ */
+NCBI_XBLAST_EXPORT
+Int2 BlastNaSubjectBatchScan(BlastNaSubjectBatch* batch,
+                             LookupTableWrap* lookup_wrap,
+                             BlastOffsetPair* offset_pairs,
+                             Int4 max_hits);
+
+/** Perform ungapped extensions of the word hits found for one subject
+ * of a batch by BlastNaSubjectBatchScan. The results are those of
+ * BlastNaWordFinder on the subject alone.
+ * @param subject The subject sequence, as filled by
+ *        BlastNaSubjectBatchGetSubject [in]
+ * @param query The query sequence [in]
+ * @param query_info concatenated query information [in]
+ * @param lookup_wrap Pointer to the (wrapper) lookup table structure [in]
+ * @param matrix The scoring matrix [in]
+ * @param word_params Parameters for the initial word extension [in]
+ * @param ewp Structure needed for initial word information maintenance [in]
+ * @param batch The scanned batch [in]
+ * @param index Index of the subject in the batch [in]
+ * @param init_hitlist Structure to hold all hits information. Has to be 
+ *        allocated up front [out]
+ * @param ungapped_stats Various hit counts. Not filled if NULL [out]
+ */
+NCBI_XBLAST_EXPORT
+Int2 BlastNaWordFinderBatch(BLAST_SequenceBlk* subject,
+                            BLAST_SequenceBlk* query,
+                            BlastQueryInfo* query_info,
+                            LookupTableWrap* lookup_wrap,
+                            Int4** matrix,
+                            const BlastInitialWordParameters* word_params,
+                            Blast_ExtendWord* ewp,
+                            const BlastNaSubjectBatch* batch,
+                            Int4 index,
+                            BlastInitHitList* init_hitlist,
+                            BlastUngappedStats* ungapped_stats);
+
 /** Choose the best routine to use for creating ungapped alignments
  * @param lookup_wrap Lookup table that influences routine choice [in][out]
  */
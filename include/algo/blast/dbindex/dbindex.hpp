@@ -754,6 +754,36 @@ class NCBI_XBLAST_EXPORT CDbIndex : public CObject
           */
         static CRef< CDbIndex > Load( const std::string & fname, bool nomap = false );
 
+        /** Ways of mapping index volumes into memory.
+
+            Index volumes are always mapped read-only and shared, so
+            processes searching the same volume share one copy in the
+            page cache. The mode is a comma separated list of the flag
+            names below, read from the BLASTDB_INDEX_MAP_MODE environment
+            variable or, failing that, from INDEX_MAP_MODE in the [BLAST]
+            section of the configuration file.
+        */
+        enum EMapModeFlags {
+            fMapHugePage = (1 << 0),    /**< Ask for transparent huge pages
+                                             ("hugepage"). */
+            fMapPopulate = (1 << 1),    /**< Pre-fault the whole volume when
+                                             it is loaded ("populate"). */
+            fMapLock     = (1 << 2)     /**< Lock the volume in memory while
+                                             it is loaded ("lock"). */
+        };
+        typedef int TMapMode;           /**< Combination of EMapModeFlags. */
+
+        /** Parse a mapping mode string.
+            @param mode [I]     comma separated list of flag names
+            @return the mapping mode flags
+        */
+        static TMapMode ParseMapMode( const std::string & mode );
+
+        /** Get the mapping mode from the environment or configuration file.
+            @return the mapping mode flags
+        */
+        static TMapMode GetMapMode();
+
         /** Search the index.
 
           @param query          [I]     the query sequence in BLASTNA format
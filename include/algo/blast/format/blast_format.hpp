@@ -375,6 +375,10 @@ private:
 
     CRef<blast::CSearchDatabase> m_SearchDb;
 
+    /// Subject information for tabular output, read directly from the
+    /// BLAST database (empty if not applicable)
+    CRef<align_format::CBlastTabularSubjectCache> m_TabularSubjectCache;
+
     /// Queries are required for XML format only
     CRef<blast::CBlastQueryVector> m_AccumulatedQueries;
     /// Accumulated results to display in XML format 
@@ -481,6 +485,10 @@ private:
     void x_PrintStructuredReport(const blast::CSearchResults& results,
                                  CConstRef<blast::CBlastQueryVector> queries);
 
+   /// Create the subject cache for tabular output, if the subjects come
+   /// from a local BLAST database
+   void x_InitTabularSubjectCache(void);
+
    /// Prints Tabular report for one query
    /// @param results Results for one query or Phi-blast iteration [in]
    /// @param itr_num Iteration number for PSI-BLAST [in]
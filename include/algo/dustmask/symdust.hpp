@@ -168,6 +168,28 @@ class NCBI_XALGODUSTMASK_EXPORT CSymDustMasker
         std::unique_ptr< TMaskList > operator()( const sequence_type & seq,
                                                size_type start, size_type stop );
 
+        /**
+            \brief Mask a sequence held in a contiguous buffer.
+
+            The result is the same as for a sequence_type holding the
+            same data, but without the per-base cost of sequence_type
+            iterators.
+
+            \param seq the sequence in IUPACNA encoding
+            \return list of masked intervals
+         */
+        std::unique_ptr< TMaskList > operator()( const std::string & seq );
+
+        /**
+            \brief Mask a part of the sequence held in a contiguous buffer.
+            \param seq the sequence in IUPACNA encoding
+            \param start beginning position of the subsequence to mask
+            \param stop ending position of the subsequence to mask
+            \return list of masked intervals
+         */
+        std::unique_ptr< TMaskList > operator()( const std::string & seq,
+                                               size_type start, size_type stop );
+
         /**
             \brief Mask a sequence and return result as a sequence of CSeq_loc
                    objects.
@@ -193,6 +215,45 @@ class NCBI_XALGODUSTMASK_EXPORT CSymDustMasker
         /**\internal Sequence iterator type. */
         typedef sequence_type::const_iterator seq_citer_type;
 
+        /** \internal
+            \brief Iterator over a contiguous IUPACNA buffer providing the
+                   part of the seq_citer_type interface used by the masker.
+         */
+        class buffer_citer_type
+        {
+            public:
+
+                /** \internal
+                    \brief Object constructor.
+                    \param seq the sequence buffer
+                    \param pos initial position
+                 */
+                buffer_citer_type( const std::string & seq, size_type pos )
+                    : seq_( seq.data() ), pos_( pos )
+                {}
+
+                char operator*() const { return seq_[pos_]; }   /**<\internal Get the current base. */
+                buffer_citer_type & operator++() { ++pos_; return *this; } /**<\internal Advance by one base. */
+                void SetPos( size_type pos ) { pos_ = pos; }    /**<\internal Set the current position. */
+                size_type GetPos() const { return pos_; }       /**<\internal Get the current position. */
+
+            private:
+
+                const char * seq_;  /**<\internal Start of the buffer. */
+                size_type pos_;     /**<\internal Current position. */
+        };
+
+        /** \internal
+            \brief Mask a part of a sequence.
+            \param seq the sequence to mask
+            \param start beginning position of the subsequence to mask
+            \param stop ending position of the subsequence to mask
+            \return list of masked intervals
+         */
+        template< typename TSeq, typename TIter >
+        std::unique_ptr< TMaskList > x_Mask( const TSeq & seq, 
+                                           size_type start, size_type stop );
+
         /** \internal
             \brief Class representing the set of triplets in a window.
          */
@@ -77,6 +77,17 @@ public:
      **/
     TMaskList * operator()(const objects::CSeqVector & data);
 
+    /**
+     **\brief Function performing the actual filtering.
+     **
+     ** May be called on several threads at once.
+     **
+     **\param data sequence data in NCBISTDAA format, one residue per byte
+     **\return pointer to a list of filtered regions
+     **
+     **/
+    TMaskList * operator()(const string & data) const;
+
 private:
     struct SegParameters* m_SegParameters; ///< Parameters to SEG algorithm
 };
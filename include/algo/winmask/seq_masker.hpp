@@ -186,7 +186,9 @@ public:
      **\brief Sequence masking operator.
      **
      ** seq_masker objects are function objects with. Main
-     ** processing is done by () operator.
+     ** processing is done by () operator. The operator keeps no
+     ** state in the object, so several threads may mask different
+     ** sequences with the same object at once.
      **
      **\param data the original sequence data in iupacna format
      **\return pointer to the list of masked intervals
@@ -216,10 +218,12 @@ private:
          **\param unit_size the unit size in bases
          **\param data the original sequence data in iupacna format
          **\param owner back pointer to the seq_masker instance
+         **\param score score function object to compute avg with
          **
          **/
         mitem( Uint4 start, Uint4 end, Uint1 unit_size, 
-               const objects::CSeqVector & data, const CSeqMasker & owner );
+               const objects::CSeqVector & data, const CSeqMasker & owner,
+               CSeqMaskerScore & score );
     };
 
     friend struct CSeqMasker::mitem;
@@ -275,21 +279,6 @@ private:
      **/
     CRef< CSeqMaskerIstat > ustat;
 
-    /**\internal
-     **\brief Score function object to use for extensions.
-     **/
-    CSeqMaskerScore * score;
-
-    /**\internal
-     **\brief Score function object to use for merging.
-     **/
-    CSeqMaskerScore * score_p3;
-
-    /**\internal
-     **\brief Score function object to use for triggering masking.
-     **/
-    CSeqMaskerScore * trigger_score;
-
     /**\internal
      **\brief The window size in bases.
      **/
@@ -353,6 +342,12 @@ private:
         eTrigger_Min        /**< Using min score of k unit in the window. */
     } trigger;
 
+    /**\internal
+     **\brief Number of units in a window that must score above the
+     **       threshold to trigger masking, if the trigger is "min".
+     **/
+    Uint1 tmin_count;
+
     /**\internal
      **\brief Flag indicating the use of discontiguous units.
      **/
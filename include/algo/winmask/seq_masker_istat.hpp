@@ -104,7 +104,7 @@ public:
             ambig_unit( 0 ),
             opt_data_( 0, 0 ),
             fmt_gen_algo_ver( CSeqMaskerOstat::StatAlgoVersion )
-    { total_ = 0; }
+    {}
 
     /**
         **\brief Object destructor.
@@ -117,10 +117,7 @@ public:
         **\return the count of the unit
         **/
     Uint4 operator[]( Uint4 unit ) const
-    { 
-        ++total_;
-        return at( unit ); 
-    }
+    { return at( unit ); }
 
     /**
         **\brief Get the unit size.
@@ -165,8 +162,6 @@ public:
         fmt_gen_algo_ver = v;
     }
 
-    mutable Uint8 total_;
-
 protected:
 
     /**
@@ -193,6 +193,21 @@ public:
 
 protected:
 
+    /**
+     **\brief Get a base of the sequence data.
+     **
+     ** The data is copied out of the sequence vector a block at a time,
+     ** which costs much less than a CSeqVector::operator[] per base.
+     **
+     **\param pos position of the base in the sequence
+     **\return the base in iupacna format, or 0 past the end of the data
+     **/
+    char GetBase( TSeqPos pos ) const
+    {
+        if( pos - buf_start >= buf.size() ) FillBuffer( pos );
+        return pos - buf_start < buf.size() ? buf[pos - buf_start] : 0;
+    }
+
     const objects::CSeqVector& data;        /**< The sequence data in iupacna format. */
     bool state;             /**< true, if the end of the sequence has not been reached. */
     Uint1 unit_size;            /**< The unit size. */
@@ -208,6 +223,16 @@ protected:
 
 private:
 
+    /**\internal
+     **\brief Copy the block of sequence data starting at the given
+     **       position into the buffer.
+     **\param pos the start of the block
+     **/
+    void FillBuffer( TSeqPos pos ) const;
+
+    mutable string buf;         /**<\internal Block of sequence data in iupacna format. */
+    mutable TSeqPos buf_start;  /**<\internal Position of the block in the sequence. */
+
     /**\internal
      **\brief Fill the array of units for a window that starts
      **       at the given position.
@@ -113,6 +113,7 @@ public:
      **\param use_ba use bit array optimization for optimized binary
      **              unit counts format
      **\param metadata the metadata string
+     **\param num_threads number of threads used to count n-mers
      **
      **/
     CWinMaskCountsGenerator( const string & input,
@@ -130,7 +131,8 @@ public:
                              const CWinMaskUtil::CIdSet * ids,
                              const CWinMaskUtil::CIdSet * exclude_ids,
                              bool use_ba,
-                             string const & metadata );
+                             string const & metadata,
+                             Uint4 num_threads = 1 );
 
     /**
      **\brief Constructor.
@@ -161,6 +163,7 @@ public:
      **\param use_ba use bit array optimization for optimized binary
      **              unit counts format
      **\param metadata the metadata string
+     **\param num_threads number of threads used to count n-mers
      **
      **/
     CWinMaskCountsGenerator( const string & input,
@@ -178,7 +181,8 @@ public:
                              const CWinMaskUtil::CIdSet * ids,
                              const CWinMaskUtil::CIdSet * exclude_ids,
                              bool use_ba,
-                             string const & metadata );
+                             string const & metadata,
+                             Uint4 num_threads = 1 );
 
     /**
      **\brief Object destructor.
@@ -209,6 +213,27 @@ private:
                   const vector< string > & input,
                   bool do_output );
 
+    /**\internal
+     **\brief Add the n-mers of a batch of sequences to the counts for
+     **       a given prefix.
+     **
+     ** With more than one thread the sequences are cut into blocks. Each
+     ** thread sorts the n-mers of its blocks into per-shard buffers, then
+     ** each shard of counts is updated by a single thread.
+     **
+     **\param batch sequence data in IUPACNA encoding
+     **\param prefix the prefix shifted into the n-mer prefix position
+     **\param prefix_mask mask selecting the prefix bits of an n-mer
+     **\param suffix_size the suffix length in base pairs
+     **\param suffix_mask mask selecting the suffix bits of an n-mer
+     **\param counts counts table for the prefix
+     **
+     **/
+    void count_batch( const vector< string > & batch,
+                      Uint4 prefix, Uint4 prefix_mask,
+                      Uint1 suffix_size, Uint4 suffix_mask,
+                      vector< Uint4 > & counts ) const;
+
     /**\internal
      **\brief Return the total length of all sequences in a
      **       fasta file.
@@ -240,6 +265,9 @@ private:
     const CWinMaskUtil::CIdSet * exclude_ids; /**<\internal set of ids to ignore */
 
     string infmt;                   /**<\internal input format */
+
+    Uint4 num_threads;              /**<\internal number of threads used to count n-mers */
+    vector< Uint4 > saved_counts;   /**<\internal counts kept from the first pass when there is a single prefix */
 };
 
 END_NCBI_SCOPE
@@ -0,0 +1,30 @@
+#include <objects/biblio/Affil.hpp>
+#include <objects/biblio/ArticleId.hpp>
+#include <objects/biblio/ArticleIdSet.hpp>
+#include <objects/biblio/Auth_list.hpp>
+#include <objects/biblio/Author.hpp>
+#include <objects/biblio/CitRetract.hpp>
+#include <objects/biblio/Cit_art.hpp>
+#include <objects/biblio/Cit_book.hpp>
+#include <objects/biblio/Cit_gen.hpp>
+#include <objects/biblio/Cit_jour.hpp>
+#include <objects/biblio/Cit_let.hpp>
+#include <objects/biblio/Cit_pat.hpp>
+#include <objects/biblio/Cit_proc.hpp>
+#include <objects/biblio/Cit_sub.hpp>
+#include <objects/biblio/DOI.hpp>
+#include <objects/biblio/Id_pat.hpp>
+#include <objects/biblio/Imprint.hpp>
+#include <objects/biblio/MedlineUID.hpp>
+#include <objects/biblio/Meeting.hpp>
+#include <objects/biblio/PII.hpp>
+#include <objects/biblio/Patent_priority.hpp>
+#include <objects/biblio/PmPid.hpp>
+#include <objects/biblio/PmcID.hpp>
+#include <objects/biblio/PmcPid.hpp>
+#include <objects/biblio/PubMedId.hpp>
+#include <objects/biblio/PubStatus.hpp>
+#include <objects/biblio/PubStatusDate.hpp>
+#include <objects/biblio/PubStatusDateSet.hpp>
+#include <objects/biblio/Title.hpp>
+#include <objects/biblio/NCBI_Biblio_module.hpp>
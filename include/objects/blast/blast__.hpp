@@ -0,0 +1,63 @@
+#include <objects/blast/Blas_get_searc_resul_reply.hpp>
+#include <objects/blast/Blas_get_searc_resul_reque.hpp>
+#include <objects/blast/Blas_get_searc_statu_reply.hpp>
+#include <objects/blast/Blas_get_searc_statu_reque.hpp>
+#include <objects/blast/Blas_get_searc_strat_reply.hpp>
+#include <objects/blast/Blas_get_searc_strat_reque.hpp>
+#include <objects/blast/Blas_get_windo_taxid_reply.hpp>
+#include <objects/blast/Blast4_alignment_for_query.hpp>
+#include <objects/blast/Blast4_archive.hpp>
+#include <objects/blast/Blast4_cutoff.hpp>
+#include <objects/blast/Blast4_database.hpp>
+#include <objects/blast/Blast4_database_info.hpp>
+#include <objects/blast/Blast4_error.hpp>
+#include <objects/blast/Blast4_error_code.hpp>
+#include <objects/blast/Blast4_error_flags.hpp>
+#include <objects/blast/Blast4_finish_params_reply.hpp>
+#include <objects/blast/Blast4_frame_type.hpp>
+#include <objects/blast/Blast4_get_databa_ex_reply.hpp>
+#include <objects/blast/Blast4_get_databases_reply.hpp>
+#include <objects/blast/Blast4_get_matrices_reply.hpp>
+#include <objects/blast/Blast4_get_parameter_reply.hpp>
+#include <objects/blast/Blast4_get_paramsets_reply.hpp>
+#include <objects/blast/Blast4_get_programs_reply.hpp>
+#include <objects/blast/Blast4_get_queries_reply.hpp>
+#include <objects/blast/Blast4_get_seq_parts_reply.hpp>
+#include <objects/blast/Blast4_get_sequenc_request.hpp>
+#include <objects/blast/Blast4_get_sequences_reply.hpp>
+#include <objects/blast/Blast4_ka_block.hpp>
+#include <objects/blast/Blast4_mask.hpp>
+#include <objects/blast/Blast4_matrix_id.hpp>
+#include <objects/blast/Blast4_parameter.hpp>
+#include <objects/blast/Blast4_parameter_info.hpp>
+#include <objects/blast/Blast4_parameters.hpp>
+#include <objects/blast/Blast4_phi_alignments.hpp>
+#include <objects/blast/Blast4_program_info.hpp>
+#include <objects/blast/Blast4_queries.hpp>
+#include <objects/blast/Blast4_queue_search_reply.hpp>
+#include <objects/blast/Blast4_queue_search_reques.hpp>
+#include <objects/blast/Blast4_range.hpp>
+#include <objects/blast/Blast4_reply.hpp>
+#include <objects/blast/Blast4_reply_body.hpp>
+#include <objects/blast/Blast4_request.hpp>
+#include <objects/blast/Blast4_request_body.hpp>
+#include <objects/blast/Blast4_residue_type.hpp>
+#include <objects/blast/Blast4_result_types.hpp>
+#include <objects/blast/Blast4_seq_part_data.hpp>
+#include <objects/blast/Blast4_seqtech.hpp>
+#include <objects/blast/Blast4_simple_alignment.hpp>
+#include <objects/blast/Blast4_simple_results.hpp>
+#include <objects/blast/Blast4_strand_type.hpp>
+#include <objects/blast/Blast4_subject.hpp>
+#include <objects/blast/Blast4_task_info.hpp>
+#include <objects/blast/Blast4_value.hpp>
+#include <objects/blast/Blast_finish_params_reques.hpp>
+#include <objects/blast/Blast_get_databa_ex_reques.hpp>
+#include <objects/blast/Blast_get_proto_info_reply.hpp>
+#include <objects/blast/Blast_get_proto_info_reque.hpp>
+#include <objects/blast/Blast_get_reque_info_reply.hpp>
+#include <objects/blast/Blast_get_reque_info_reque.hpp>
+#include <objects/blast/Blast_get_searc_info_reply.hpp>
+#include <objects/blast/Blast_get_searc_info_reque.hpp>
+#include <objects/blast/Blast_get_seq_parts_reques.hpp>
+#include <objects/blast/NCBI_Blast4_module.hpp>
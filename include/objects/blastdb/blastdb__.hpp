@@ -0,0 +1,7 @@
+#include <objects/blastdb/Blast_db_mask_info.hpp>
+#include <objects/blastdb/Blast_db_metadata.hpp>
+#include <objects/blastdb/Blast_def_line.hpp>
+#include <objects/blastdb/Blast_def_line_set.hpp>
+#include <objects/blastdb/Blast_filter_program.hpp>
+#include <objects/blastdb/Blast_mask_list.hpp>
+#include <objects/blastdb/NCBI_BlastDL_module.hpp>
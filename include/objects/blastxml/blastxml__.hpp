@@ -0,0 +1,7 @@
+#include <objects/blastxml/BlastOutput.hpp>
+#include <objects/blastxml/Hit.hpp>
+#include <objects/blastxml/Hsp.hpp>
+#include <objects/blastxml/Iteration.hpp>
+#include <objects/blastxml/Parameters.hpp>
+#include <objects/blastxml/Statistics.hpp>
+#include <objects/blastxml/NCBI_BlastOutput_module.hpp>
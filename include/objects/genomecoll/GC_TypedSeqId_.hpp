@@ -0,0 +1,236 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file GC_TypedSeqId_.hpp
+/// Data storage class.
+///
+/// This file was generated by application DATATOOL
+/// using the following specifications:
+/// 'genome_collection.asn'.
+///
+/// ATTENTION:
+///   Don't edit or commit this file into CVS as this file will
+///   be overridden (by DATATOOL) without warning!
+
+#ifndef OBJECTS_GENOMECOLL_GC_TYPEDSEQID_BASE_HPP
+#define OBJECTS_GENOMECOLL_GC_TYPEDSEQID_BASE_HPP
+
+// standard includes
+#include <serial/serialbase.hpp>
+BEGIN_NCBI_SCOPE
+
+#ifndef BEGIN_objects_SCOPE
+#  define BEGIN_objects_SCOPE BEGIN_SCOPE(objects)
+#  define END_objects_SCOPE END_SCOPE(objects)
+#endif
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// forward declarations
+class CGC_External_Seqid;
+class CGC_SeqIdAlias;
+class CSeq_id;
+
+
+// generated classes
+
+/////////////////////////////////////////////////////////////////////////////
+class NCBI_GENOME_COLLECTION_EXPORT CGC_TypedSeqId_Base : public CSerialObject
+{
+    typedef CSerialObject Tparent;
+public:
+    // constructor
+    CGC_TypedSeqId_Base(void);
+    // destructor
+    virtual ~CGC_TypedSeqId_Base(void);
+
+    // type info
+    DECLARE_INTERNAL_TYPE_INFO();
+
+
+    /// Choice variants.
+    enum E_Choice {
+        e_not_set = 0,  ///< No variant selected
+        e_Genbank,
+        e_Refseq,
+        e_Private,
+        e_External
+    };
+    /// Maximum+1 value of the choice variant enumerator.
+    enum E_ChoiceStopper {
+        e_MaxChoice = 5 ///< == e_External+1
+    };
+
+    /// Reset the whole object
+    virtual void Reset(void);
+
+    /// Reset the selection (set it to e_not_set).
+    virtual void ResetSelection(void);
+
+    /// Which variant is currently selected.
+    E_Choice Which(void) const;
+
+    /// Verify selection, throw exception if it differs from the expected.
+    void CheckSelected(E_Choice index) const;
+
+    /// Throw 'InvalidSelection' exception.
+    NCBI_NORETURN void ThrowInvalidSelection(E_Choice index) const;
+
+    /// Retrieve selection name (for diagnostic purposes).
+    static string SelectionName(E_Choice index);
+
+    /// Select the requested variant if needed.
+    void Select(E_Choice index, EResetVariant reset = eDoResetVariant);
+    /// Select the requested variant if needed,
+    /// allocating CObject variants from memory pool.
+    void Select(E_Choice index,
+                EResetVariant reset,
+                CObjectMemoryPool* pool);
+
+    // types
+    typedef CGC_SeqIdAlias TGenbank;
+    typedef CGC_SeqIdAlias TRefseq;
+    typedef CSeq_id TPrivate;
+    typedef CGC_External_Seqid TExternal;
+
+    // getters
+    // setters
+
+    // typedef CGC_SeqIdAlias TGenbank
+    bool IsGenbank(void) const;
+    const TGenbank& GetGenbank(void) const;
+    TGenbank& SetGenbank(void);
+    void SetGenbank(TGenbank& value);
+
+    // typedef CGC_SeqIdAlias TRefseq
+    bool IsRefseq(void) const;
+    const TRefseq& GetRefseq(void) const;
+    TRefseq& SetRefseq(void);
+    void SetRefseq(TRefseq& value);
+
+    // typedef CSeq_id TPrivate
+    bool IsPrivate(void) const;
+    const TPrivate& GetPrivate(void) const;
+    TPrivate& SetPrivate(void);
+    void SetPrivate(TPrivate& value);
+
+    // typedef CGC_External_Seqid TExternal
+    bool IsExternal(void) const;
+    const TExternal& GetExternal(void) const;
+    TExternal& SetExternal(void);
+    void SetExternal(TExternal& value);
+
+
+private:
+    // copy constructor and assignment operator
+    CGC_TypedSeqId_Base(const CGC_TypedSeqId_Base& );
+    CGC_TypedSeqId_Base& operator=(const CGC_TypedSeqId_Base& );
+    // choice state
+    E_Choice m_choice;
+    // helper methods
+    void DoSelect(E_Choice index, CObjectMemoryPool* pool = 0);
+
+    static const char* const sm_SelectionNames[];
+    // data
+    NCBI_NS_NCBI::CSerialObject *m_object;
+};
+
+
+
+
+
+
+///////////////////////////////////////////////////////////
+///////////////////// inline methods //////////////////////
+///////////////////////////////////////////////////////////
+inline
+CGC_TypedSeqId_Base::E_Choice CGC_TypedSeqId_Base::Which(void) const
+{
+    return m_choice;
+}
+
+inline
+void CGC_TypedSeqId_Base::CheckSelected(E_Choice index) const
+{
+    if ( m_choice != index )
+        ThrowInvalidSelection(index);
+}
+
+inline
+void CGC_TypedSeqId_Base::Select(E_Choice index, NCBI_NS_NCBI::EResetVariant reset, NCBI_NS_NCBI::CObjectMemoryPool* pool)
+{
+    if ( reset == NCBI_NS_NCBI::eDoResetVariant || m_choice != index ) {
+        if ( m_choice != e_not_set )
+            ResetSelection();
+        DoSelect(index, pool);
+    }
+}
+
+inline
+void CGC_TypedSeqId_Base::Select(E_Choice index, NCBI_NS_NCBI::EResetVariant reset)
+{
+    Select(index, reset, 0);
+}
+
+inline
+bool CGC_TypedSeqId_Base::IsGenbank(void) const
+{
+    return m_choice == e_Genbank;
+}
+
+inline
+bool CGC_TypedSeqId_Base::IsRefseq(void) const
+{
+    return m_choice == e_Refseq;
+}
+
+inline
+bool CGC_TypedSeqId_Base::IsPrivate(void) const
+{
+    return m_choice == e_Private;
+}
+
+inline
+bool CGC_TypedSeqId_Base::IsExternal(void) const
+{
+    return m_choice == e_External;
+}
+
+///////////////////////////////////////////////////////////
+////////////////// end of inline methods //////////////////
+///////////////////////////////////////////////////////////
+
+
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_GENOMECOLL_GC_TYPEDSEQID_BASE_HPP
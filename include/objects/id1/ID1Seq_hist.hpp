@@ -0,0 +1,87 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file ID1Seq_hist.hpp
+/// User-defined methods of the data storage class.
+///
+/// This file was originally generated by application DATATOOL
+/// using the following specifications:
+/// 'id1.asn'.
+///
+/// New methods or data members can be added to it if needed.
+/// See also: ID1Seq_hist_.hpp
+
+
+#ifndef OBJECTS_ID1_ID1SEQ_HIST_HPP
+#define OBJECTS_ID1_ID1SEQ_HIST_HPP
+
+
+// generated includes
+#include <objects/id1/ID1Seq_hist_.hpp>
+
+// generated classes
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+/////////////////////////////////////////////////////////////////////////////
+class NCBI_ID1_EXPORT CID1Seq_hist : public CID1Seq_hist_Base
+{
+    typedef CID1Seq_hist_Base Tparent;
+public:
+    // constructor
+    CID1Seq_hist(void);
+    // destructor
+    ~CID1Seq_hist(void);
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CID1Seq_hist(const CID1Seq_hist& value);
+    CID1Seq_hist& operator=(const CID1Seq_hist& value);
+
+};
+
+/////////////////// CID1Seq_hist inline methods
+
+// constructor
+inline
+CID1Seq_hist::CID1Seq_hist(void)
+{
+}
+
+
+/////////////////// end of CID1Seq_hist inline methods
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_ID1_ID1SEQ_HIST_HPP
+/* Original file checksum: lines: 86, chars: 2430, CRC32: 7beabcee */
@@ -0,0 +1,28 @@
+#include <objects/id2/ID2S_Reply_Get_Chunk.hpp>
+#include <objects/id2/ID2S_Reply_Get_Split_Info.hpp>
+#include <objects/id2/ID2S_Request_Get_Chunks.hpp>
+#include <objects/id2/ID2_Blob_Id.hpp>
+#include <objects/id2/ID2_Blob_Seq_id.hpp>
+#include <objects/id2/ID2_Blob_Seq_ids.hpp>
+#include <objects/id2/ID2_Blob_State.hpp>
+#include <objects/id2/ID2_Error.hpp>
+#include <objects/id2/ID2_Get_Blob_Details.hpp>
+#include <objects/id2/ID2_Param.hpp>
+#include <objects/id2/ID2_Params.hpp>
+#include <objects/id2/ID2_Reply.hpp>
+#include <objects/id2/ID2_Reply_Data.hpp>
+#include <objects/id2/ID2_Reply_Get_Blob.hpp>
+#include <objects/id2/ID2_Reply_Get_Blob_Id.hpp>
+#include <objects/id2/ID2_Reply_Get_Blob_Seq_ids.hpp>
+#include <objects/id2/ID2_Reply_Get_Package.hpp>
+#include <objects/id2/ID2_Reply_Get_Seq_id.hpp>
+#include <objects/id2/ID2_Reply_ReGet_Blob.hpp>
+#include <objects/id2/ID2_Request.hpp>
+#include <objects/id2/ID2_Request_Get_Blob_Id.hpp>
+#include <objects/id2/ID2_Request_Get_Blob_Info.hpp>
+#include <objects/id2/ID2_Request_Get_Packages.hpp>
+#include <objects/id2/ID2_Request_Get_Seq_id.hpp>
+#include <objects/id2/ID2_Request_Packet.hpp>
+#include <objects/id2/ID2_Request_ReGet_Blob.hpp>
+#include <objects/id2/ID2_Seq_id.hpp>
+#include <objects/id2/NCBI_ID2Access_module.hpp>
@@ -0,0 +1,221 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file Title_msg_list_.hpp
+/// Data storage class.
+///
+/// This file was generated by application DATATOOL
+/// using the following specifications:
+/// 'mla.asn'.
+///
+/// ATTENTION:
+///   Don't edit or commit this file into CVS as this file will
+///   be overridden (by DATATOOL) without warning!
+
+#ifndef OBJECTS_MLA_TITLE_MSG_LIST_BASE_HPP
+#define OBJECTS_MLA_TITLE_MSG_LIST_BASE_HPP
+
+// standard includes
+#include <serial/serialbase.hpp>
+
+// generated includes
+#include <list>
+
+BEGIN_NCBI_SCOPE
+
+#ifndef BEGIN_objects_SCOPE
+#  define BEGIN_objects_SCOPE BEGIN_SCOPE(objects)
+#  define END_objects_SCOPE END_SCOPE(objects)
+#endif
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// forward declarations
+class CTitle_msg;
+
+
+// generated classes
+
+/////////////////////////////////////////////////////////////////////////////
+class NCBI_MLA_EXPORT CTitle_msg_list_Base : public CSerialObject
+{
+    typedef CSerialObject Tparent;
+public:
+    // constructor
+    CTitle_msg_list_Base(void);
+    // destructor
+    virtual ~CTitle_msg_list_Base(void);
+
+    // type info
+    DECLARE_INTERNAL_TYPE_INFO();
+
+    // types
+    typedef int TNum;
+    typedef list< CRef< CTitle_msg > > TTitles;
+
+    // member index
+    enum class E_memberIndex {
+        e__allMandatory = 0,
+        e_num,
+        e_titles
+    };
+    typedef Tparent::CMemberIndex<E_memberIndex, 3> TmemberIndex;
+
+    // getters
+    // setters
+
+    /// number of titles
+    /// mandatory
+    /// typedef int TNum
+    ///  Check whether the Num data member has been assigned a value.
+    bool IsSetNum(void) const;
+    /// Check whether it is safe or not to call GetNum method.
+    bool CanGetNum(void) const;
+    void ResetNum(void);
+    TNum GetNum(void) const;
+    void SetNum(TNum value);
+    TNum& SetNum(void);
+
+    /// mandatory
+    /// typedef list< CRef< CTitle_msg > > TTitles
+    ///  Check whether the Titles data member has been assigned a value.
+    bool IsSetTitles(void) const;
+    /// Check whether it is safe or not to call GetTitles method.
+    bool CanGetTitles(void) const;
+    void ResetTitles(void);
+    const TTitles& GetTitles(void) const;
+    TTitles& SetTitles(void);
+
+    /// Reset the whole object
+    virtual void Reset(void);
+
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CTitle_msg_list_Base(const CTitle_msg_list_Base&);
+    CTitle_msg_list_Base& operator=(const CTitle_msg_list_Base&);
+
+    // data
+    Uint4 m_set_State[1];
+    int m_Num;
+    list< CRef< CTitle_msg > > m_Titles;
+};
+
+
+
+
+
+
+///////////////////////////////////////////////////////////
+///////////////////// inline methods //////////////////////
+///////////////////////////////////////////////////////////
+inline
+bool CTitle_msg_list_Base::IsSetNum(void) const
+{
+    return ((m_set_State[0] & 0x3) != 0);
+}
+
+inline
+bool CTitle_msg_list_Base::CanGetNum(void) const
+{
+    return IsSetNum();
+}
+
+inline
+void CTitle_msg_list_Base::ResetNum(void)
+{
+    m_Num = 0;
+    m_set_State[0] &= ~0x3;
+}
+
+inline
+CTitle_msg_list_Base::TNum CTitle_msg_list_Base::GetNum(void) const
+{
+    if (!CanGetNum()) {
+        ThrowUnassigned(0);
+    }
+    return m_Num;
+}
+
+inline
+void CTitle_msg_list_Base::SetNum(CTitle_msg_list_Base::TNum value)
+{
+    m_Num = value;
+    m_set_State[0] |= 0x3;
+}
+
+inline
+CTitle_msg_list_Base::TNum& CTitle_msg_list_Base::SetNum(void)
+{
+#ifdef _DEBUG
+    if (!IsSetNum()) {
+        memset(&m_Num,UnassignedByte(),sizeof(m_Num));
+    }
+#endif
+    m_set_State[0] |= 0x1;
+    return m_Num;
+}
+
+inline
+bool CTitle_msg_list_Base::IsSetTitles(void) const
+{
+    return ((m_set_State[0] & 0xc) != 0);
+}
+
+inline
+bool CTitle_msg_list_Base::CanGetTitles(void) const
+{
+    return true;
+}
+
+inline
+const CTitle_msg_list_Base::TTitles& CTitle_msg_list_Base::GetTitles(void) const
+{
+    return m_Titles;
+}
+
+inline
+CTitle_msg_list_Base::TTitles& CTitle_msg_list_Base::SetTitles(void)
+{
+    m_set_State[0] |= 0x4;
+    return m_Titles;
+}
+
+///////////////////////////////////////////////////////////
+////////////////// end of inline methods //////////////////
+///////////////////////////////////////////////////////////
+
+
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_MLA_TITLE_MSG_LIST_BASE_HPP
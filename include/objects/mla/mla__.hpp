@@ -0,0 +1,7 @@
+#include <objects/mla/Error_val.hpp>
+#include <objects/mla/Mla_back.hpp>
+#include <objects/mla/Mla_request.hpp>
+#include <objects/mla/Title_msg.hpp>
+#include <objects/mla/Title_msg_list.hpp>
+#include <objects/mla/Title_type.hpp>
+#include <objects/mla/NCBI_MedArchive_module.hpp>
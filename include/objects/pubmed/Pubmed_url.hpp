@@ -0,0 +1,87 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file Pubmed_url.hpp
+/// User-defined methods of the data storage class.
+///
+/// This file was originally generated by application DATATOOL
+/// using the following specifications:
+/// 'pubmed.asn'.
+///
+/// New methods or data members can be added to it if needed.
+/// See also: Pubmed_url_.hpp
+
+
+#ifndef OBJECTS_PUBMED_PUBMED_URL_HPP
+#define OBJECTS_PUBMED_PUBMED_URL_HPP
+
+
+// generated includes
+#include <objects/pubmed/Pubmed_url_.hpp>
+
+// generated classes
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+/////////////////////////////////////////////////////////////////////////////
+class NCBI_PUBMED_EXPORT CPubmed_url : public CPubmed_url_Base
+{
+    typedef CPubmed_url_Base Tparent;
+public:
+    // constructor
+    CPubmed_url(void);
+    // destructor
+    ~CPubmed_url(void);
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CPubmed_url(const CPubmed_url& value);
+    CPubmed_url& operator=(const CPubmed_url& value);
+
+};
+
+/////////////////// CPubmed_url inline methods
+
+// constructor
+inline
+CPubmed_url::CPubmed_url(void)
+{
+}
+
+
+/////////////////// end of CPubmed_url inline methods
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_PUBMED_PUBMED_URL_HPP
+/* Original file checksum: lines: 86, chars: 2429, CRC32: 256778fe */
@@ -0,0 +1,80 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file GIBB_mol_.hpp
+/// Data storage class.
+///
+/// This file was generated by application DATATOOL
+/// using the following specifications:
+/// 'seq.asn'.
+///
+/// ATTENTION:
+///   Don't edit or commit this file into CVS as this file will
+///   be overridden (by DATATOOL) without warning!
+
+#ifndef OBJECTS_SEQ_GIBB_MOL_BASE_HPP
+#define OBJECTS_SEQ_GIBB_MOL_BASE_HPP
+
+// standard includes
+#include <serial/serialbase.hpp>
+BEGIN_NCBI_SCOPE
+
+#ifndef BEGIN_objects_SCOPE
+#  define BEGIN_objects_SCOPE BEGIN_SCOPE(objects)
+#  define END_objects_SCOPE END_SCOPE(objects)
+#endif
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+/// type of molecule represented
+enum EGIBB_mol {
+    eGIBB_mol_unknown       =   0,
+    eGIBB_mol_genomic       =   1,
+    eGIBB_mol_pre_mRNA      =   2,  ///< precursor RNA of any sort really
+    eGIBB_mol_mRNA          =   3,
+    eGIBB_mol_rRNA          =   4,
+    eGIBB_mol_tRNA          =   5,
+    eGIBB_mol_snRNA         =   6,
+    eGIBB_mol_scRNA         =   7,
+    eGIBB_mol_peptide       =   8,
+    eGIBB_mol_other_genetic =   9,  ///< other genetic material
+    eGIBB_mol_genomic_mRNA  =  10,  ///< reported a mix of genomic and cdna sequence
+    eGIBB_mol_other         = 255
+};
+
+/// Access to EGIBB_mol's attributes (values, names) as defined in spec
+NCBI_SEQ_EXPORT const NCBI_NS_NCBI::CEnumeratedTypeValues* ENUM_METHOD_NAME(EGIBB_mol)(void);
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_SEQ_GIBB_MOL_BASE_HPP
@@ -0,0 +1,19 @@
+#include <objects/seqalign/Dense_diag.hpp>
+#include <objects/seqalign/Dense_seg.hpp>
+#include <objects/seqalign/Packed_seg.hpp>
+#include <objects/seqalign/Product_pos.hpp>
+#include <objects/seqalign/Prot_pos.hpp>
+#include <objects/seqalign/Score.hpp>
+#include <objects/seqalign/Score_set.hpp>
+#include <objects/seqalign/Seq_align.hpp>
+#include <objects/seqalign/Seq_align_set.hpp>
+#include <objects/seqalign/Sparse_align.hpp>
+#include <objects/seqalign/Sparse_seg.hpp>
+#include <objects/seqalign/Sparse_seg_ext.hpp>
+#include <objects/seqalign/Splice_site.hpp>
+#include <objects/seqalign/Spliced_exon.hpp>
+#include <objects/seqalign/Spliced_exon_chunk.hpp>
+#include <objects/seqalign/Spliced_seg.hpp>
+#include <objects/seqalign/Spliced_seg_modifier.hpp>
+#include <objects/seqalign/Std_seg.hpp>
+#include <objects/seqalign/NCBI_Seqalign_module.hpp>
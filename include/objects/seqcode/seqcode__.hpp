@@ -0,0 +1,5 @@
+#include <objects/seqcode/Seq_code_set.hpp>
+#include <objects/seqcode/Seq_code_table.hpp>
+#include <objects/seqcode/Seq_code_type.hpp>
+#include <objects/seqcode/Seq_map_table.hpp>
+#include <objects/seqcode/NCBI_SeqCode_module.hpp>
@@ -0,0 +1,87 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file SeqEdit_Cmd_RemoveAnnot.hpp
+/// User-defined methods of the data storage class.
+///
+/// This file was originally generated by application DATATOOL
+/// using the following specifications:
+/// 'seqedit.asn'.
+///
+/// New methods or data members can be added to it if needed.
+/// See also: SeqEdit_Cmd_RemoveAnnot_.hpp
+
+
+#ifndef OBJECTS_SEQEDIT_SEQEDIT_CMD_REMOVEANNOT_HPP
+#define OBJECTS_SEQEDIT_SEQEDIT_CMD_REMOVEANNOT_HPP
+
+
+// generated includes
+#include <objects/seqedit/SeqEdit_Cmd_RemoveAnnot_.hpp>
+
+// generated classes
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+/////////////////////////////////////////////////////////////////////////////
+class NCBI_SEQEDIT_EXPORT CSeqEdit_Cmd_RemoveAnnot : public CSeqEdit_Cmd_RemoveAnnot_Base
+{
+    typedef CSeqEdit_Cmd_RemoveAnnot_Base Tparent;
+public:
+    // constructor
+    CSeqEdit_Cmd_RemoveAnnot(void);
+    // destructor
+    ~CSeqEdit_Cmd_RemoveAnnot(void);
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CSeqEdit_Cmd_RemoveAnnot(const CSeqEdit_Cmd_RemoveAnnot& value);
+    CSeqEdit_Cmd_RemoveAnnot& operator=(const CSeqEdit_Cmd_RemoveAnnot& value);
+
+};
+
+/////////////////// CSeqEdit_Cmd_RemoveAnnot inline methods
+
+// constructor
+inline
+CSeqEdit_Cmd_RemoveAnnot::CSeqEdit_Cmd_RemoveAnnot(void)
+{
+}
+
+
+/////////////////// end of CSeqEdit_Cmd_RemoveAnnot inline methods
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_SEQEDIT_SEQEDIT_CMD_REMOVEANNOT_HPP
+/* Original file checksum: lines: 86, chars: 2682, CRC32: 4a1c66 */
@@ -0,0 +1,24 @@
+#include <objects/seqedit/SeqEdit_Cmd.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_AddAnnot.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_AddDesc.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_AddDescr.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_AddId.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_AttachAnnot.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_AttachSeq.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_AttachSeqEntry.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_AttachSet.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_ChangeSeqAttr.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_ChangeSetAttr.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_RemoveAnnot.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_RemoveDesc.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_RemoveId.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_RemoveSeqEntry.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_ReplaceAnnot.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_ResetDescr.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_ResetIds.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_ResetSeqAttr.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_ResetSeqEntry.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_ResetSetAttr.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_SetDescr.hpp>
+#include <objects/seqedit/SeqEdit_Id.hpp>
+#include <objects/seqedit/NCBI_SeqEdit_module.hpp>
@@ -0,0 +1,5 @@
+#include <objects/seqres/Byte_graph.hpp>
+#include <objects/seqres/Int_graph.hpp>
+#include <objects/seqres/Real_graph.hpp>
+#include <objects/seqres/Seq_graph.hpp>
+#include <objects/seqres/NCBI_Seqres_module.hpp>
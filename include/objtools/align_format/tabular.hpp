@@ -49,6 +49,65 @@ BEGIN_NCBI_SCOPE
 BEGIN_SCOPE(align_format)
 
 
+/// Per-OID cache of the subject sequence information needed for tabular
+/// output, read directly from a BLAST database instead of through the
+/// object manager and the BLAST database data loader.
+class NCBI_ALIGN_FORMAT_EXPORT CBlastTabularSubjectCache : public CObject
+{
+public:
+    /// Subject information for one database sequence
+    struct SSubjectInfo : public CObject
+    {
+        int oid;                 ///< Ordinal id in the database
+        TSeqPos length;          ///< Sequence length
+        /// Deflines of the sequence, after membership and id filtering
+        CRef<objects::CBlast_def_line_set> deflines;
+        /// Label of the Seq-id this entry was looked up with
+        string target_id;
+        /// Seq-ids of the defline containing the target Seq-id, which are
+        /// the ids the data loader gives the subject Bioseq
+        list<CRef<objects::CSeq_id> > bioseq_ids;
+        /// First token of the title of the defline containing the target
+        /// Seq-id; substituted for artificial (BL_ORD_ID) Seq-ids
+        string title_token;
+    };
+
+    /// Default maximum number of cached sequences
+    static const size_t kDefaultMaxEntries = 10000;
+
+    /// Constructor
+    /// @param seqdb Database the subject sequences come from; it must be the
+    /// one registered with the BLAST database data loader [in]
+    /// @param max_entries Maximum number of sequences to cache; the cache is
+    /// emptied when this is exceeded [in]
+    CBlastTabularSubjectCache(CRef<CSeqDB> seqdb,
+                              size_t max_entries = kDefaultMaxEntries);
+
+    /// Look up a subject sequence
+    /// @param id Subject Seq-id, as found in the Seq-align [in]
+    /// @return Subject information, or NULL if the subject is not in the
+    /// database or cannot be formatted identically to the object manager
+    /// path (the caller should then fall back to that path)
+    CConstRef<SSubjectInfo> GetSubjectInfo(const objects::CSeq_id& id);
+
+    /// Does the database contain nucleotide sequences?
+    bool IsNucleotide() const {
+        return m_SeqDB->GetSequenceType() == CSeqDB::eNucleotide;
+    }
+
+private:
+    /// Read the subject information for an OID from the database
+    CRef<SSubjectInfo> x_ReadSubjectInfo(int oid, const objects::CSeq_id& id);
+
+    /// Database the subject sequences come from
+    CRef<CSeqDB> m_SeqDB;
+    /// Maximum number of cached sequences
+    size_t m_MaxEntries;
+    /// Cached subject information, by OID
+    map<int, CRef<SSubjectInfo> > m_Cache;
+};
+
+
 /// Class containing information needed for tabular formatting of BLAST 
 /// results.
 class NCBI_ALIGN_FORMAT_EXPORT CBlastTabularInfo : public CObject 
@@ -188,6 +247,16 @@ public:
     /// @param query range [in]
     void SetQueryRange(TSeqRange & q_range) { m_QueryRange = q_range;}
 
+    /// Read subject ids, lengths, titles and taxonomy from a BLAST database
+    /// through a cache instead of retrieving the subject Bioseqs from the
+    /// scope. Subjects the cache cannot serve are still retrieved from the
+    /// scope, as are the subject sequences themselves when an output field
+    /// needs them.
+    /// @param cache Subject cache for the searched database [in]
+    void SetSubjectCache(CRef<CBlastTabularSubjectCache> cache) {
+        m_SubjectCache = cache;
+    }
+
 protected:
     bool x_IsFieldRequested(ETabularField field);
     /// Add a field to the list of fields to show, if it is not yet present in
@@ -304,6 +373,12 @@ protected:
     void x_SetTaxInfo(const objects::CBioseq_Handle & handle, const CRef<objects::CBlast_def_line_set> & bdlRef);
     void x_SetTaxInfoAll(const objects::CBioseq_Handle & handle, const CRef<objects::CBlast_def_line_set> & bdlRef);
     void x_SetSubjectIds(const objects::CBioseq_Handle& bh, const CRef<objects::CBlast_def_line_set> & bdlRef);
+    /// Set the subject fields from the subject cache
+    /// @return false if the subject cache cannot serve this subject
+    bool x_SetSubjectFromCache(const objects::CSeq_id& subject_id,
+                               bool set_subject_id, bool set_subject_ids,
+                               bool set_tax_info, bool set_tax_info_all,
+                               bool set_title);
     void x_SetQueryCovSubject(const objects::CSeq_align & align);
     void x_SetQueryCovUniqSubject(const objects::CSeq_align & align);
     void x_SetQueryCovSeqalign(const CSeq_align & align, int query_len);
@@ -369,6 +444,9 @@ private:
 
     TSeqRange m_QueryRange;
     string m_CustomDelim;
+
+    /// Source of subject information bypassing the scope, if set
+    CRef<CBlastTabularSubjectCache> m_SubjectCache;
 };
 
 
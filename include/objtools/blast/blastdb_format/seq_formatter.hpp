@@ -76,6 +76,13 @@ public:
     virtual void DumpAll(const CBlastDB_FormatterConfig & config) = 0;
     virtual ~CBlastDB_Formatter() {}
 
+    /// Create a formatter with the same settings as this one which
+    /// reads from another database handle and writes to another stream
+    /// @param blastdb BLAST database from which to retrieve the data [in]
+    /// @param out output stream to write the data [in]
+    /// @return new formatter, or NULL if this formatter cannot be copied
+    virtual CBlastDB_Formatter * Clone(CSeqDB& blastdb, CNcbiOstream& out) const { return NULL; }
+
 private:
     /// Prohibit copy constructor
     CBlastDB_Formatter(const CBlastDB_Formatter& rhs);
@@ -96,6 +103,7 @@ public:
 
     int Write(CSeqDB::TOID oid, const CBlastDB_FormatterConfig & config, string target_id = kEmptyStr);
     void DumpAll(const CBlastDB_FormatterConfig & config);
+    CBlastDB_Formatter * Clone(CSeqDB& blastdb, CNcbiOstream& out) const;
 
 private:
     /// Fields not in defline
@@ -151,6 +159,8 @@ public:
     /// Retun 0 if Sucess otherwise -1
     int Write(CSeqDB::TOID oid, const CBlastDB_FormatterConfig & config, string target_id = kEmptyStr);
 
+    CBlastDB_Formatter * Clone(CSeqDB& blastdb, CNcbiOstream& out) const;
+
 private:
 
     /// The BLAST database from which to extract data
@@ -178,6 +188,8 @@ public:
     /// Retun 0 if Sucess otherwise -1
     int Write(CSeqDB::TOID oid, const CBlastDB_FormatterConfig & config, string target_id = kEmptyStr);
 
+    CBlastDB_Formatter * Clone(CSeqDB& blastdb, CNcbiOstream& out) const;
+
 private:
 
     /// The BLAST database from which to extract data
@@ -191,6 +203,70 @@ private:
 
 };
 
+/// One sequence to be written by CBlastDB_ParallelWriter
+struct SBlastDB_FormatRequest {
+    SBlastDB_FormatRequest(CSeqDB::TOID oid = 0,
+                           const CBlastDB_FormatterConfig & config = CBlastDB_FormatterConfig(),
+                           const string & target_id = kEmptyStr)
+        : m_Oid(oid), m_Config(config), m_TargetId(target_id) {}
+
+    /// OID of the sequence to write
+    CSeqDB::TOID m_Oid;
+    /// Configuration to write it with
+    CBlastDB_FormatterConfig m_Config;
+    /// Target id passed to CBlastDB_Formatter::Write
+    string m_TargetId;
+};
+
+/// Writes sequences with several threads, in the order requested
+///
+/// The requests are split into chunks.  Each thread opens its own
+/// handle to the database, formats a chunk into a private buffer
+/// with a clone of the formatter, and the buffers are written to the
+/// output stream in chunk order, so the output is identical to that
+/// of the formatter used on one thread.  With one thread, or if the
+/// formatter cannot be cloned, the formatter is used directly.
+class NCBI_BLASTDB_FORMAT_EXPORT CBlastDB_ParallelWriter
+{
+public:
+    /// Constructor
+    /// @param fmt formatter to use, and to clone for each thread [in]
+    /// @param blastdb BLAST database used by fmt [in]
+    /// @param out output stream fmt writes to [in]
+    /// @param num_threads number of threads to use [in]
+    CBlastDB_ParallelWriter(CBlastDB_Formatter & fmt, CSeqDB & blastdb,
+                            CNcbiOstream & out, int num_threads = 1);
+
+    /// Write the requested sequences in order
+    void Write(const vector<SBlastDB_FormatRequest> & requests);
+
+    /// Write all sequences in the database
+    void DumpAll(const CBlastDB_FormatterConfig & config);
+
+private:
+    CBlastDB_Formatter & m_Formatter;
+    CSeqDB & m_BlastDb;
+    CNcbiOstream & m_Out;
+    int m_NumThreads;
+
+    /// Format items [begin, end) of either the request list or, if it
+    /// is NULL, the OID space of db
+    void x_FormatItems(CBlastDB_Formatter & fmt, CSeqDB & db,
+                       const vector<SBlastDB_FormatRequest> * requests,
+                       const CBlastDB_FormatterConfig * config,
+                       int begin, int end);
+
+    /// Format num_items items in chunks on m_NumThreads threads
+    void x_Run(const vector<SBlastDB_FormatRequest> * requests,
+               const CBlastDB_FormatterConfig * config,
+               int num_items);
+
+    /// Prohibit copy constructor
+    CBlastDB_ParallelWriter(const CBlastDB_ParallelWriter& rhs);
+    /// Prohibit assignment operator
+    CBlastDB_ParallelWriter& operator=(const CBlastDB_ParallelWriter& rhs);
+};
+
 END_NCBI_SCOPE
 
 #endif /* OBJTOOLS_BLASTDB_FORMAT___SEQ_FORMATTER__HPP */
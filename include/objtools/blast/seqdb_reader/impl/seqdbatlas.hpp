@@ -55,6 +55,7 @@
 #include <map>
 #include <set>
 #include <mutex>
+#include <condition_variable>
 
 BEGIN_NCBI_SCOPE
 
@@ -537,6 +538,82 @@ public:
 
     CMemoryFile* GetMemoryFile(const string& fileName);
 
+    /// Ways of mapping sequence volumes.
+    ///
+    /// The mode is a comma separated list of these flags, read from the
+    /// BLASTDB_ATLAS_MODE environment variable or, failing that, from
+    /// ATLAS_MODE in the [BLAST] section of the configuration file.  It
+    /// only applies to sequence (.psq and .nsq) files; the default is to
+    /// map them as any other file.
+    enum EMapModeFlags {
+        /// Advise the kernel that volumes are read sequentially
+        /// ("sequential")
+        fMapSequential = (1 << 0),
+        /// Ask for transparent huge pages ("hugepage")
+        fMapHugePage   = (1 << 1),
+        /// Pre-fault whole volumes when they are first opened ("populate")
+        fMapPopulate   = (1 << 2),
+        /// Pre-fault volumes with their pages interleaved over all NUMA
+        /// nodes ("interleave")
+        fMapInterleave = (1 << 3),
+        /// Keep a copy of each volume in the memory of every NUMA node and
+        /// have each thread read the copy local to it ("replicate")
+        fMapReplicate  = (1 << 4)
+    };
+    typedef int TMapMode;
+
+    /// Parse a mapping mode string.
+    /// @param mode Comma separated list of mapping mode flag names
+    /// @return The mapping mode flags
+    static TMapMode ParseMapMode(const string & mode);
+
+    /// Parse a NUMA node list such as "0-1,3".
+    ///
+    /// The mapping modes distribute memory over the nodes listed in the
+    /// BLASTDB_ATLAS_NODES environment variable or, by default, over the
+    /// nodes that have memory.
+    /// @param nodes Node list in the format of the kernel's sysfs files
+    /// @return The node numbers in increasing order, without duplicates
+    static vector<int> ParseNodeList(const string & nodes);
+
+    /// Get the NUMA nodes memory is distributed over.
+    const vector<int> & GetNumaNodes() const
+    {
+        return m_Nodes;
+    }
+
+    /// Get the mapping mode used for sequence volumes.
+    TMapMode GetMapMode() const
+    {
+        return m_MapMode;
+    }
+
+    /// Mapping counters for one NUMA node.
+    struct SNodeMapStats {
+        /// Bytes of sequence volumes resident on the node
+        Uint8 bytes_mapped;
+        /// Page faults taken while populating those bytes
+        Uint8 page_faults;
+    };
+
+    /// Get the mapping counters for volumes pre-faulted or replicated by
+    /// the mapping mode, indexed by NUMA node.
+    vector<SNodeMapStats> GetNodeMapStats();
+
+    /// Get the per NUMA node copies of a mapped file.
+    ///
+    /// Nodes without a copy of their own, such as nodes without memory,
+    /// are given the copy on the first node memory is distributed over.
+    /// @param file A file returned by GetMemoryFile()
+    /// @return An array of pointers to the copies indexed by node, or NULL
+    ///         if the file is not replicated
+    const char * const * GetReplicas(CMemoryFile * file);
+
+    /// Get the NUMA node of the CPU the calling thread runs on.
+    ///
+    /// The node is looked up once per thread and cached.
+    static int GetCurrentNumaNode();
+
     enum EFilesCount{
         eFileCounterNoChange,
         eFileCounterIncrement,
@@ -569,7 +646,7 @@ private:
 
     class CAtlasMappedFile : public CMemoryFile {
     public:
-    	CAtlasMappedFile(const string & filename): CMemoryFile(filename),m_Count(1){
+    	CAtlasMappedFile(const string & filename): CMemoryFile(filename),m_Count(1),m_Ready(true){
     		const string exts="hd|hi|nd|ni|pd|pi|si|sd|ti|td";
     		string ext = filename.substr(filename.length()-2);
     		if (exts.find(ext) != NPOS) {
@@ -579,12 +656,26 @@ private:
     			m_isIsam = false;
     		}
     	}
-    	~CAtlasMappedFile() {
-    		_ASSERT(m_Count == 0);
-    	}
+    	~CAtlasMappedFile();
     	int m_Count;
     	bool m_isIsam;
+    	/// False while the mapping mode is being applied
+    	bool m_Ready;
+    	/// Copies of the file, one per NUMA node (fMapReplicate only)
+    	vector<char*> m_Replicas;
+    	/// Copy to use on each NUMA node, indexed by node
+    	vector<const char*> m_ReplicaByNode;
     };
+
+    /// Apply the mapping mode to a newly mapped sequence volume.
+    ///
+    /// Called without holding m_FileMemMapMutex, as populating or copying
+    /// a volume takes long.
+    /// @param file The file to apply the mode to
+    /// @param stats Mapping counters per NUMA node to add to [in|out]
+    void x_ApplyMapMode(CAtlasMappedFile & file,
+                        vector<SNodeMapStats> & stats);
+
     /// Private method to prevent copy construction.
     CSeqDBAtlas(const CSeqDBAtlas &);
    
@@ -604,12 +695,24 @@ private:
     Uint8 m_MaxFileSize;
 
     std::mutex m_FileMemMapMutex;
+    /// Signalled when a file's mapping mode has been applied.
+    std::condition_variable m_FileReadyCond;
     map<string, unique_ptr<CAtlasMappedFile> > m_FileMemMap;
     int m_OpenedFilesCount;
     int m_MaxOpenedFilesCount;
 
     /// BlastDB search path.
     const string m_SearchPath;
+
+    /// Mapping mode for sequence volumes.
+    TMapMode m_MapMode;
+
+    /// NUMA nodes memory is distributed over.
+    vector<int> m_Nodes;
+
+    /// Mapping counters indexed by NUMA node, protected by
+    /// m_FileMemMapMutex.
+    vector<SNodeMapStats> m_NodeStats;
 };
 
 
@@ -675,6 +778,7 @@ public:
     CSeqDBFileMemMap(class CSeqDBAtlas & atlas, const string filename)
         : m_Atlas(atlas),
           m_DataPtr (NULL),
+          m_Replicas (NULL),
           m_MappedFile( NULL),
           m_Mapped(false)
     {
@@ -684,6 +788,7 @@ public:
     CSeqDBFileMemMap(class CSeqDBAtlas & atlas)
         : m_Atlas(atlas),
           m_DataPtr (NULL),
+          m_Replicas (NULL),
           m_MappedFile( NULL),
           m_Mapped(false)
     {
@@ -726,6 +831,7 @@ public:
         }
 
         m_DataPtr = (char *)(m_MappedFile->GetPtr());
+        m_Replicas = m_Atlas.GetReplicas(m_MappedFile);
     }
 
     
@@ -757,11 +863,14 @@ public:
             Init(fname);                        
         }
 
-        return(const char *)(m_DataPtr + offset);    
+        return GetFileDataPtr(offset);
     }
 
     const char *GetFileDataPtr(TIndx offset)                    
     {
+        if (m_Replicas) {
+            return m_Replicas[CSeqDBAtlas::GetCurrentNumaNode()] + offset;
+        }
         return(const char *)(m_DataPtr + offset);    
     }
 
@@ -770,6 +879,9 @@ private:
      /// Points to the beginning of the data area.
     const char * m_DataPtr;
 
+    /// Per NUMA node copies of the data area, or NULL.
+    const char * const * m_Replicas;
+
     string m_Filename;
 
     CMemoryFile *m_MappedFile;
@@ -0,0 +1,161 @@
+#ifndef OBJTOOLS_READERS_SEQDB__SEQDBCACHE_HPP
+#define OBJTOOLS_READERS_SEQDB__SEQDBCACHE_HPP
+
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file seqdbcache.hpp
+/// Process-wide cache of decoded subject sequences.
+///
+/// Defines classes:
+///     CSeqDBSubjectCache
+///
+/// Implemented for: UNIX, MS-Windows
+
+#include <corelib/ncbiobj.hpp>
+#include <corelib/ncbimtx.hpp>
+#include <atomic>
+#include <memory>
+
+BEGIN_NCBI_SCOPE
+
+/// CSeqDBSubjectCache
+///
+/// Holds nucleotide sequences of one database, decoded into one of the
+/// one-letter-per-byte encodings, for sharing between all CSeqDB objects
+/// opened on that database in a process.  Each search (or each node of a
+/// split-by-queries search) otherwise decodes the same subjects again.
+///
+/// Sequences are stored once and never modified while the cache exists,
+/// so readers use them without locking.  A cache lives as long as some
+/// CSeqDB object uses it; the last one to go frees its memory.  Residues are packed into large blocks, each
+/// sequence starting on a 16-byte boundary, with an array of data
+/// pointers and an array of lengths indexed by OID.  A sequence decoded
+/// with sentinel bytes keeps them.  Once the process-wide memory limit
+/// is reached no more sequences are added and callers decode as before.
+///
+/// The memory limit is read from the BLASTDB_SUBJECT_CACHE_MB environment
+/// variable or, failing that, from SUBJECT_CACHE_MB in the [BLAST] section
+/// of the configuration file; the cache is disabled if it is not set.
+
+class CSeqDBSubjectCache : public CObject {
+public:
+    /// Get the cache for a database.
+    ///
+    /// @param key
+    ///   Identifies the database and the encoding of the sequences. [in]
+    /// @param num_oids
+    ///   Number of OIDs in the database. [in]
+    /// @return
+    ///   The cache shared by all callers with the same key, or NULL if
+    ///   caching is disabled.
+    static CRef<CSeqDBSubjectCache> GetCache(const string & key, int num_oids);
+
+    /// Drop a reference obtained from GetCache, freeing the cache if no
+    /// other user is left.
+    ///
+    /// @param cache
+    ///   The reference to drop; reset on return. [in|out]
+    static void Release(CRef<CSeqDBSubjectCache> & cache);
+
+    /// Destructor.
+    ~CSeqDBSubjectCache();
+
+    /// Set the process-wide memory limit, overriding the configuration.
+    /// @param bytes Limit in bytes; 0 disables caching of new databases.
+    static void SetMemoryLimit(Int8 bytes);
+
+    /// Get the process-wide memory limit in bytes.
+    static Int8 GetMemoryLimit();
+
+    /// Get the process-wide counters.
+    /// @param hits Number of lookups served from a cache [out]
+    /// @param misses Number of lookups that were not [out]
+    /// @param bytes Memory used by all caches [out]
+    static void GetStats(Int8 & hits, Int8 & misses, Int8 & bytes);
+
+    /// Look up a sequence.
+    /// @param oid The OID of the sequence. [in]
+    /// @param buffer Set to the cached data, if found. [out]
+    /// @return The sequence length, or -1 if it is not cached.
+    int Find(int oid, const char ** buffer) const;
+
+    /// Add a decoded sequence.
+    /// @param oid The OID of the sequence. [in]
+    /// @param data The decoded data, including any sentinel bytes. [in]
+    /// @param data_length Number of bytes of data. [in]
+    /// @param length The sequence length. [in]
+    /// @return The cached copy of the data, or NULL if the memory limit
+    ///   has been reached.
+    const char * Insert(int oid, const char * data, int data_length, int length);
+
+    /// Check whether the memory limit stopped an insertion.
+    bool IsFull() const
+    {
+        return m_Full;
+    }
+
+private:
+    /// Constructor.
+    CSeqDBSubjectCache(int num_oids);
+
+    /// Prevent copy construction.
+    CSeqDBSubjectCache(const CSeqDBSubjectCache &);
+
+    /// Prevent copy assignment.
+    CSeqDBSubjectCache & operator=(const CSeqDBSubjectCache &);
+
+    /// Number of OIDs in the database.
+    int m_NumOIDs;
+
+    /// Cached data per OID, NULL if not cached.
+    unique_ptr<std::atomic<const char *>[]> m_Data;
+
+    /// Sequence length per OID, valid once the data pointer is set.
+    unique_ptr<int[]> m_Lengths;
+
+    /// Storage blocks for the cached data.
+    vector< unique_ptr<char[]> > m_Blocks;
+
+    /// Total size of the storage blocks, counted in the process-wide
+    /// memory use.
+    Int8 m_BlockBytes;
+
+    /// Set once an insertion fails for lack of memory.
+    std::atomic<bool> m_Full;
+
+    /// Next free byte and end of the current block.
+    char * m_Free;
+    char * m_End;
+
+    /// Serializes insertions.
+    CFastMutex m_Mutex;
+};
+
+END_NCBI_SCOPE
+
+#endif // OBJTOOLS_READERS_SEQDB__SEQDBCACHE_HPP
@@ -314,8 +314,43 @@ public:
                       vector<TOid>   & oids,
                       bool             adjusted,
                       bool           & version_check);
-                      
-                      
+
+
+
+    /// Batched numeric identifier translation
+    ///
+    /// Each GI, TI or PIG in the list is translated to an OID, or to
+    /// -1 if it is not found.  The identifiers are sorted once and
+    /// the ISAM pages are then visited in file order, so each page is
+    /// read at most once for the whole batch, and the decoded index
+    /// samples are kept for the lifetime of this object.
+    ///
+    /// @param ids
+    ///   The identifiers to look up, in any order. [in]
+    /// @param oids
+    ///   The OID for each identifier, or -1. [out]
+    void IdsToOids(const vector<Int8> & ids,
+                   vector<TOid>       & oids);
+
+    /// Batched string translation
+    ///
+    /// This is equivalent to calling StringToOids() for each element
+    /// of accs, but each of the key forms tried by StringToOids() is
+    /// resolved for all remaining accessions in one sorted sweep of
+    /// the ISAM pages.
+    ///
+    /// @param accs
+    ///   The strings to look up. [in]
+    /// @param adjusted
+    ///   Whether simplification adjusted each string. [in]
+    /// @param version_check
+    ///   If each version can be stripped [in] and if it was [out].
+    /// @param oids
+    ///   The returned oids for each string. [out]
+    void StringsToOids(const vector<string>   & accs,
+                       const vector<bool>     & adjusted,
+                       vector<bool>           & version_check,
+                       vector< vector<TOid> > & oids);
 
     /// Seq-id translation
     ///
@@ -1017,7 +1052,51 @@ private:
                     TIndx             SampleNum2,
                     const char     ** beginp,
                     const char     ** endp);
-                    
+
+    /// One page of a string ISAM data file, decoded into memory.
+    struct SIsamStringPage {
+        SIsamStringPage() : m_SampleNum(-1) {}
+
+        /// The index of the sample that starts this page.
+        int m_SampleNum;
+
+        /// The lowercased keys found on the page, in file order.
+        vector<string> m_Keys;
+
+        /// The value stored with each key.
+        vector<string> m_Values;
+    };
+
+    /// Decode the index samples into memory.
+    ///
+    /// The sample keys (lowercased for string indices) are read once
+    /// and kept for the lifetime of this object, so that batched
+    /// lookups can find pages with an in-memory binary search.
+    void x_LoadSamples();
+
+    /// Decode one page of a string ISAM data file.
+    ///
+    /// Nothing is done if the page is already the one held in page.
+    ///
+    /// @param sample_num
+    ///   The index of the sample that starts the page.
+    /// @param page
+    ///   The decoded page. [in|out]
+    void x_DecodeStringPage(int               sample_num,
+                            SIsamStringPage & page);
+
+    /// Batched exact key search of a string ISAM file.
+    ///
+    /// Each term is matched case-insensitively against the keys of
+    /// the file, as x_StringSearch() would.  The terms are sorted once
+    /// and the pages are then decoded in file order.
+    ///
+    /// @param terms
+    ///   The keys to look up. [in]
+    /// @param values_out
+    ///   The values of all entries matching each term. [out]
+    void x_StringSearchBatch(const vector<string>     & terms,
+                             vector< vector<string> > & values_out);
 
     /// Test a sample key value from a numeric index.
     ///
@@ -1250,6 +1329,21 @@ private:
     /// size of the numeric key-data pair
     int m_TermSize;
 
+    /// Protects the decoded sample cache.
+    CFastMutex m_SampleLock;
+
+    /// True once x_LoadSamples() has filled the sample cache.
+    bool m_SamplesLoaded;
+
+    /// Decoded sample keys of a numeric index.
+    vector<Int8> m_NumericSamples;
+
+    /// Decoded, lowercased sample keys of a string index.
+    vector<string> m_StringSamples;
+
+    /// Data file offset of each page of a string index.
+    vector<TIndx> m_PageOffsets;
+
     Uint8 x_GetNumericKey(const void *p) {
         if (m_LongId)
             return((Uint8) SeqDB_GetStdOrd((Uint8 *)p));
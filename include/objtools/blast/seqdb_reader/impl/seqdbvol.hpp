@@ -558,6 +558,22 @@ public:
                          vector<int>          & oids,
                          CSeqDBLockHold       & locked) const;
 
+    /// Find OIDs for a batch of accessions or formatted Seq-ids.
+    ///
+    /// The result for each string is the same as AccessionToOids()
+    /// would return, but the identifiers of each ISAM type are looked
+    /// up together in one sorted pass over that ISAM file.
+    ///
+    /// @param accs
+    ///   The accessions or formatted Seq-ids to search for. [in]
+    /// @param oids
+    ///   The OIDs found for each string. [out]
+    /// @param locked
+    ///   The lock holder object for this thread. [in]
+    void AccessionsToOids(const vector<string>  & accs,
+                          vector< vector<int> > & oids,
+                          CSeqDBLockHold        & locked) const;
+
     /// Find OIDs for the specified Seq-id.
     ///
     /// The Seq-id will be formatted and the resulting string will be
@@ -771,6 +771,44 @@ public:
                            TSequenceRanges  * partial_ranges,
                            TSequenceRanges  * masks = NULL) const;
 
+    /// Get a pointer to decoded nucleotide sequence data from the
+    /// subject cache.
+    ///
+    /// Decoded sequences are kept in a read-only cache shared by all
+    /// CSeqDB objects opened on the same database in this process, so
+    /// repeated searches against the database decode each sequence
+    /// once.  The returned data must not be modified and is not
+    /// returned with RetSequence.  The cache is enabled by setting a
+    /// memory limit with SetSubjectCacheLimit(), the
+    /// BLASTDB_SUBJECT_CACHE_MB environment variable or SUBJECT_CACHE_MB
+    /// in the [BLAST] section of the configuration file.
+    ///
+    /// @param oid
+    ///   The ordinal id of the sequence.
+    /// @param buffer
+    ///   A returned pointer to the data in the sequence.
+    /// @param nucl_code
+    ///   The NA encoding, kSeqDBNuclNcbiNA8 or kSeqDBNuclBlastNA8.
+    /// @return
+    ///   The sequence length, or -1 if this is a protein database, the
+    ///   cache is disabled or its memory limit has been reached.
+    int GetCachedAmbigSeq(int oid, const char ** buffer, int nucl_code) const;
+
+    /// Set the memory limit of the subject cache.
+    /// @param bytes
+    ///   Limit for all databases in the process; 0 disables the cache
+    ///   for databases not yet using it.
+    static void SetSubjectCacheLimit(Int8 bytes);
+
+    /// Get the subject cache counters for the process.
+    /// @param hits
+    ///   Number of sequences served from the cache. [out]
+    /// @param misses
+    ///   Number of sequences that had to be decoded. [out]
+    /// @param bytes
+    ///   Memory used by the cache. [out]
+    static void GetSubjectCacheStats(Int8 & hits, Int8 & misses, Int8 & bytes);
+
     /// Returns any resources associated with the sequence.
     ///
     /// Calls to GetSequence (but not GetBioseq())
@@ -398,6 +398,14 @@ public:
     /// @param max_file_size Maximum file size in bytes.
     void SetMaxFileSize(Uint8 max_file_size);
 
+    /// Set the number of threads used to prepare sequences.
+    ///
+    /// Sequences are still read and written in order, so the database
+    /// produced is the same for any number of threads.
+    ///
+    /// @param num_threads Number of threads to use.
+    void SetNumThreads(int num_threads);
+
     /// Define a masking algorithm.
     ///
     /// The returned integer ID will be defined as corresponding to the
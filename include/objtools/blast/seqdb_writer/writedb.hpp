@@ -346,6 +346,16 @@ public:
     /// @param letters Maximum letters to pack in one volume. [in]
     void SetMaxVolumeLetters(Uint8 letters);
 
+    /// Set the number of threads used to prepare sequences.
+    ///
+    /// With more than one thread, sequences are converted to the
+    /// on-disk format in parallel batches and then written in the
+    /// order they were added; the database produced does not depend
+    /// on the number of threads.  The default is one thread.
+    ///
+    /// @param num_threads Number of threads to use. [in]
+    void SetNumThreads(int num_threads);
+
     /// Extract Deflines From Bioseq.
     ///
     /// Deflines are extracted from the CBioseq and returned to the
@@ -308,6 +308,18 @@ private:
     /// Free no longer needed array and string memory.
     void x_Free();
     
+    /// Spill the keys to a run file if they exceed the memory budget.
+    void x_CheckSortMemory();
+    
+    /// Sort the keys held in memory and write them to a run file.
+    ///
+    /// Keys that do not fit in the memory budget are sorted in runs;
+    /// the runs are merged when the index is flushed.
+    void x_SpillRun();
+    
+    /// Remove the run files.
+    void x_RemoveRuns();
+    
     // Configuration
     
     EIsamType m_Type;         ///< Type of identifier indexed here.
@@ -360,6 +372,20 @@ private:
     int                     m_Oid;  
     /// Keep track of string seqids associated with current value of m_Oid
     set<string>             m_OidStringData;
+    
+    // External sort
+    
+    /// Memory budget for keys held in memory, in bytes.
+    Uint8                   m_SortMemory;
+    
+    /// Approximate memory used by m_StringSort, in bytes.
+    Uint8                   m_StringBytes;
+    
+    /// Number of keys (including duplicates) spilled to run files.
+    int                     m_NumSpilled;
+    
+    /// Temporary files holding sorted runs of keys.
+    vector<string>          m_Runs;
 };
 
 /// CWriteDB_IsamData class
@@ -0,0 +1,83 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file EGQueryResult.hpp
+/// User-defined methods of the data storage class.
+///
+/// This file was originally generated by application DATATOOL
+/// using the following specifications:
+/// 'egquery.dtd'.
+///
+/// New methods or data members can be added to it if needed.
+/// See also: EGQueryResult_.hpp
+
+
+#ifndef egquery__OBJTOOLS_EUTILS_EGQUERY_EGQUERYRESULT_HPP
+#define egquery__OBJTOOLS_EUTILS_EGQUERY_EGQUERYRESULT_HPP
+
+
+// generated includes
+#include <objtools/eutils/egquery/EGQueryResult_.hpp>
+
+// generated classes
+
+BEGIN_egquery_SCOPE // namespace egquery::
+
+/////////////////////////////////////////////////////////////////////////////
+class NCBI_EUTILS_EXPORT CEGQueryResult : public CEGQueryResult_Base
+{
+    typedef CEGQueryResult_Base Tparent;
+public:
+    // constructor
+    CEGQueryResult(void);
+    // destructor
+    ~CEGQueryResult(void);
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CEGQueryResult(const CEGQueryResult& value);
+    CEGQueryResult& operator=(const CEGQueryResult& value);
+
+};
+
+/////////////////// CEGQueryResult inline methods
+
+// constructor
+inline
+CEGQueryResult::CEGQueryResult(void)
+{
+}
+
+
+/////////////////// end of CEGQueryResult inline methods
+
+
+END_egquery_SCOPE // namespace egquery::
+
+
+#endif // egquery__OBJTOOLS_EUTILS_EGQUERY_EGQUERYRESULT_HPP
+/* Original file checksum: lines: 82, chars: 2508, CRC32: b3d64302 */
@@ -0,0 +1,4 @@
+#include <objtools/eutils/egquery/EGQueryResult.hpp>
+#include <objtools/eutils/egquery/Result.hpp>
+#include <objtools/eutils/egquery/ResultItem.hpp>
+#include <objtools/eutils/egquery/egquery_module.hpp>
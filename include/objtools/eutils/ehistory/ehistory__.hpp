@@ -0,0 +1,3 @@
+#include <objtools/eutils/ehistory/EHistoryItem.hpp>
+#include <objtools/eutils/ehistory/EHistoryResult.hpp>
+#include <objtools/eutils/ehistory/ehistory_module.hpp>
@@ -0,0 +1,156 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file FieldList_.hpp
+/// Data storage class.
+///
+/// This file was generated by application DATATOOL
+/// using the following specifications:
+/// 'einfo.dtd'.
+///
+/// ATTENTION:
+///   Don't edit or commit this file into CVS as this file will
+///   be overridden (by DATATOOL) without warning!
+
+#ifndef einfo__OBJTOOLS_EUTILS_EINFO_FIELDLIST_BASE_HPP
+#define einfo__OBJTOOLS_EUTILS_EINFO_FIELDLIST_BASE_HPP
+
+// standard includes
+#include <serial/serialbase.hpp>
+
+// generated includes
+#include <list>
+
+#ifndef BEGIN_einfo_SCOPE
+#  define BEGIN_einfo_SCOPE BEGIN_SCOPE(einfo)
+#  define END_einfo_SCOPE END_SCOPE(einfo)
+#endif
+BEGIN_einfo_SCOPE // namespace einfo::
+
+
+// forward declarations
+class CField;
+
+
+// generated classes
+
+/////////////////////////////////////////////////////////////////////////////
+class NCBI_EUTILS_EXPORT CFieldList_Base : public NCBI_NS_NCBI::CSerialObject
+{
+    typedef NCBI_NS_NCBI::CSerialObject Tparent;
+public:
+    // constructor
+    CFieldList_Base(void);
+    // destructor
+    virtual ~CFieldList_Base(void);
+
+    // type info
+    DECLARE_INTERNAL_TYPE_INFO();
+
+    // types
+    typedef CField C_E;
+    typedef NCBI_NS_STD::list< NCBI_NS_NCBI::CRef< CField > > TField;
+
+    // member index
+    enum class E_memberIndex {
+        e__allMandatory = 0,
+        e_Field
+    };
+    typedef Tparent::CMemberIndex<E_memberIndex, 2> TmemberIndex;
+
+    // getters
+    // setters
+
+    /// optional
+    /// typedef NCBI_NS_STD::list< NCBI_NS_NCBI::CRef< CField > > TField
+    ///  Check whether the Field data member has been assigned a value.
+    bool IsSetField(void) const;
+    /// Check whether it is safe or not to call GetField method.
+    bool CanGetField(void) const;
+    void ResetField(void);
+    const TField& GetField(void) const;
+    TField& SetField(void);
+
+    /// Reset the whole object
+    virtual void Reset(void);
+
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CFieldList_Base(const CFieldList_Base&);
+    CFieldList_Base& operator=(const CFieldList_Base&);
+
+    // data
+    Uint4 m_set_State[1];
+    NCBI_NS_STD::list< NCBI_NS_NCBI::CRef< CField > > m_Field;
+};
+
+
+
+
+
+
+///////////////////////////////////////////////////////////
+///////////////////// inline methods //////////////////////
+///////////////////////////////////////////////////////////
+inline
+bool CFieldList_Base::IsSetField(void) const
+{
+    return ((m_set_State[0] & 0x3) != 0);
+}
+
+inline
+bool CFieldList_Base::CanGetField(void) const
+{
+    return true;
+}
+
+inline
+const CFieldList_Base::TField& CFieldList_Base::GetField(void) const
+{
+    return m_Field;
+}
+
+inline
+CFieldList_Base::TField& CFieldList_Base::SetField(void)
+{
+    m_set_State[0] |= 0x1;
+    return m_Field;
+}
+
+///////////////////////////////////////////////////////////
+////////////////// end of inline methods //////////////////
+///////////////////////////////////////////////////////////
+
+
+
+
+
+END_einfo_SCOPE // namespace einfo::
+
+
+#endif // einfo__OBJTOOLS_EUTILS_EINFO_FIELDLIST_BASE_HPP
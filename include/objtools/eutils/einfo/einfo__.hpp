@@ -0,0 +1,8 @@
+#include <objtools/eutils/einfo/DbInfo.hpp>
+#include <objtools/eutils/einfo/DbList.hpp>
+#include <objtools/eutils/einfo/EInfoResult.hpp>
+#include <objtools/eutils/einfo/Field.hpp>
+#include <objtools/eutils/einfo/FieldList.hpp>
+#include <objtools/eutils/einfo/Link.hpp>
+#include <objtools/eutils/einfo/LinkList.hpp>
+#include <objtools/eutils/einfo/einfo_module.hpp>
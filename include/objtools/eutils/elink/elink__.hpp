@@ -0,0 +1,18 @@
+#include <objtools/eutils/elink/ELinkResult.hpp>
+#include <objtools/eutils/elink/FirstChars.hpp>
+#include <objtools/eutils/elink/IconUrl.hpp>
+#include <objtools/eutils/elink/Id.hpp>
+#include <objtools/eutils/elink/IdCheckList.hpp>
+#include <objtools/eutils/elink/IdLinkSet.hpp>
+#include <objtools/eutils/elink/IdList.hpp>
+#include <objtools/eutils/elink/IdUrlList.hpp>
+#include <objtools/eutils/elink/IdUrlSet.hpp>
+#include <objtools/eutils/elink/Link.hpp>
+#include <objtools/eutils/elink/LinkInfo.hpp>
+#include <objtools/eutils/elink/LinkSet.hpp>
+#include <objtools/eutils/elink/LinkSetDb.hpp>
+#include <objtools/eutils/elink/LinkSetDbHistory.hpp>
+#include <objtools/eutils/elink/ObjUrl.hpp>
+#include <objtools/eutils/elink/Provider.hpp>
+#include <objtools/eutils/elink/Url.hpp>
+#include <objtools/eutils/elink/elink_module.hpp>
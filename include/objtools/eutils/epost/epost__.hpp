@@ -0,0 +1,3 @@
+#include <objtools/eutils/epost/EPostResult.hpp>
+#include <objtools/eutils/epost/InvalidIdList.hpp>
+#include <objtools/eutils/epost/epost_module.hpp>
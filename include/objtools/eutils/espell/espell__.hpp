@@ -0,0 +1,3 @@
+#include <objtools/eutils/espell/ESpellResult.hpp>
+#include <objtools/eutils/espell/SpelledQuery.hpp>
+#include <objtools/eutils/espell/espell_module.hpp>
@@ -0,0 +1,4 @@
+#include <objtools/eutils/esummary/DocSum.hpp>
+#include <objtools/eutils/esummary/ESummaryResult.hpp>
+#include <objtools/eutils/esummary/Item.hpp>
+#include <objtools/eutils/esummary/esummary_module.hpp>
@@ -0,0 +1,2 @@
+#include <objtools/eutils/uilist/IdList.hpp>
+#include <objtools/eutils/uilist/uilist_module.hpp>
@@ -0,0 +1,184 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   Header file for CMaskBatch class.
+ *
+ */
+
+#ifndef CMASK_BATCH_H
+#define CMASK_BATCH_H
+
+#include <corelib/ncbiobj.hpp>
+#include <objmgr/scope.hpp>
+#include <objmgr/bioseq_handle.hpp>
+#include <objmgr/seq_vector.hpp>
+
+#include <objtools/seqmasks_io/mask_writer.hpp>
+
+BEGIN_NCBI_SCOPE
+
+/**
+ **\brief Base class for masking the sequences of a masker application
+ **       on several threads.
+ **
+ ** The sequences passed to Add() are collected into batches. Each
+ ** batch is masked on an OpenMP team, and the masks are written in
+ ** input order, so the output does not depend on the number of
+ ** threads. A derived class computes the mask of one sequence.
+ **
+ **/
+class NCBI_XOBJREAD_EXPORT CMaskBatch
+{
+public:
+
+    /**
+     **\brief Type representing the masked intervals of a sequence.
+     **
+     **/
+    typedef CMaskWriter::TMaskList TMaskList;
+
+    /**
+     **\brief A sequence waiting to be masked and written.
+     **
+     **/
+    struct SSeq
+    {
+        CRef< objects::CScope > scope;  /**< Scope holding the sequence. */
+        objects::CBioseq_Handle bsh;    /**< The sequence. */
+        objects::CSeqVector seq;        /**< The sequence data. */
+        string data;                    /**< Copy of the sequence data,
+                                             if the batch keeps one. */
+        unique_ptr< TMaskList > mask;   /**< The result. */
+    };
+
+    /**
+     **\brief Object constructor.
+     **
+     **\param writer the writer the masks are printed with
+     **\param parsed_id bioseq ids were parsed by the reader
+     **\param num_threads number of threads to mask sequences on
+     **\param copy_data copy the sequence data out of the object
+     **                 manager before a batch is masked
+     **\param letters_per_thread letters collected per thread before
+     **                          a batch is masked
+     **\param seqs_per_thread sequences collected per thread before
+     **                       a batch is masked
+     **
+     **/
+    CMaskBatch( CMaskWriter & writer,
+                bool parsed_id,
+                int num_threads,
+                bool copy_data,
+                Uint8 letters_per_thread = kLettersPerThread,
+                size_t seqs_per_thread = kSeqsPerThread );
+
+    /**
+     **\brief Object destructor.
+     **
+     **/
+    virtual ~CMaskBatch() {}
+
+    /**
+     **\brief Queue a sequence for masking.
+     **
+     ** The queued sequences are masked and written once the batch
+     ** is full, or right away when masking on one thread.
+     **
+     **\param scope the scope holding the sequence
+     **\param bsh the sequence
+     **\param seq the sequence data in the encoding Mask() expects
+     **
+     **/
+    void Add( CRef< objects::CScope > scope,
+              const objects::CBioseq_Handle & bsh,
+              const objects::CSeqVector & seq );
+
+    /**
+     **\brief Mask and write the queued sequences.
+     **
+     **/
+    void Flush();
+
+    /**
+     **\brief Number of threads sequences are masked on.
+     **
+     ** This is 1 if the library was built without OpenMP.
+     **
+     **/
+    int GetNumThreads() const { return m_NumThreads; }
+
+    /**
+     **\brief Total number of positions masked so far.
+     **
+     **/
+    Uint8 GetNumMasked() const { return m_NumMasked; }
+
+    /**
+     **\brief Default number of letters collected per thread.
+     **
+     **/
+    static const Uint8 kLettersPerThread = 16 * 1024 * 1024;
+
+    /**
+     **\brief Default number of sequences collected per thread.
+     **
+     **/
+    static const size_t kSeqsPerThread = 256;
+
+protected:
+
+    /**
+     **\brief Compute the mask of one sequence.
+     **
+     ** Called from several threads at once, for different sequences.
+     **
+     **\param seq the sequence; its data member is only set if the
+     **           batch copies the sequence data
+     **\return the list of masked intervals
+     **
+     **/
+    virtual TMaskList * Mask( const SSeq & seq ) const = 0;
+
+private:
+
+    /**\internal Prohibit copying. */
+    CMaskBatch( const CMaskBatch & );
+    CMaskBatch & operator=( const CMaskBatch & );
+
+    CMaskWriter & m_Writer;    /**< Masks are printed with this writer. */
+    bool m_ParsedId;            /**< Bioseq ids were parsed by the reader. */
+    int m_NumThreads;           /**< Number of threads to mask on. */
+    bool m_CopyData;            /**< Copy out the sequence data. */
+    Uint8 m_MaxLetters;         /**< Letters in a full batch. */
+    size_t m_MaxSeqs;           /**< Sequences in a full batch. */
+    vector< SSeq > m_Seqs;      /**< The sequences of the current batch. */
+    Uint8 m_NumLetters;         /**< Letters in the current batch. */
+    Uint8 m_NumMasked;          /**< Positions masked so far. */
+};
+
+END_NCBI_SCOPE
+
+#endif
@@ -279,6 +279,7 @@ CPSIBlastOptions::DebugDump(CDebugDumpContext ddc, unsigned int /*depth*/) const
     ddc.Log("use_best_alignment", m_Ptr->use_best_alignment);
     ddc.Log("nsg_compatibility_mode", m_Ptr->nsg_compatibility_mode);
     ddc.Log("impala_scaling_factor", m_Ptr->impala_scaling_factor);
+    ddc.Log("num_threads", m_Ptr->num_threads);
 }
 
 void
@@ -118,22 +118,64 @@ CBlastNode::SetDataLoaderPrefix()
 	}
 }
 
+/// Default limit on formatted output held in memory by the master node
+static const Int8 kDefaultMaxBufferedMB = 512;
+
 CBlastMasterNode::CBlastMasterNode(CNcbiOstream & out_stream, int num_threads):
 		m_OutputStream(out_stream), m_MaxNumThreads(num_threads), m_MaxNumNodes(num_threads + 2),
-		m_NumErrStatus(0), m_NumQueries(0), m_QueriesLength(0)
+		m_NumErrStatus(0), m_NumQueries(0), m_QueriesLength(0), m_LookAhead(max(2, num_threads)),
+		m_NumWaiting(0), m_CompletedLength(0), m_CompletedTime(0.0),
+		m_PredictedRunTime(0.0), m_ActualRunTime(0.0), m_BufferedBytes(0),
+		m_MaxBufferedBytes(kDefaultMaxBufferedMB * 1024 * 1024)
 {
+	m_MaxNumNodes = num_threads + m_LookAhead;
+	char * buffer_env = getenv("BLAST_MT_OUTPUT_BUFFER_MB");
+	if (buffer_env) {
+		Int8 mb = NStr::StringToInt8(buffer_env, NStr::fConvErr_NoThrow |
+		                             NStr::fAllowLeadingSpaces |
+		                             NStr::fAllowTrailingSpaces);
+		if (mb > 0 && mb <= kMax_I8 / (1024 * 1024)) {
+			m_MaxBufferedBytes = mb * 1024 * 1024;
+		}
+		else {
+			ERR_POST(Warning << "Ignoring invalid BLAST_MT_OUTPUT_BUFFER_MB value '"
+			         << buffer_env << "', using " << kDefaultMaxBufferedMB << " MB");
+		}
+	}
+	char * spill_dir_env = getenv("BLAST_MT_OUTPUT_SPILL_DIR");
+	if (spill_dir_env) {
+		if (CDir(spill_dir_env).Exists()) {
+			m_SpillDir = spill_dir_env;
+		}
+		else {
+			ERR_POST(Warning << "Ignoring BLAST_MT_OUTPUT_SPILL_DIR '" << spill_dir_env
+			         << "', which is not a directory");
+		}
+	}
 	m_StopWatch.Start();
 }
 
+CBlastMasterNode::~CBlastMasterNode()
+{
+	NON_CONST_ITERATE(TOutputSegments, itr, m_OutputSegments) {
+		if (!itr->second.file_name.empty()) {
+			CFile(itr->second.file_name).Remove();
+		}
+	}
+}
+
 void
 CBlastMasterNode::x_WaitForNewEvent()
 {
+	// Mailboxes signal without holding m_Mutex, so a chunk that completes
+	// just before the wait starts goes unnoticed; look again periodically
+	static const unsigned int kMaxWaitNanoSec = 100 * 1000 * 1000;
 	CFastMutexGuard guard(m_Mutex);
-	m_NewEvent.WaitForSignal(m_Mutex);
+	m_NewEvent.WaitForSignal(m_Mutex, CDeadline(0, kMaxWaitNanoSec));
 }
 
 void
-CBlastMasterNode::RegisterNode(CBlastNode * node, CBlastNodeMailbox * mailbox)
+CBlastMasterNode::RegisterNode(CBlastNode * node, CBlastNodeMailbox * mailbox, Int8 est_length)
 {
 	if(node == NULL) {
 		 NCBI_THROW(CBlastException, eInvalidArgument, "Empty Node" );
@@ -153,6 +195,40 @@ CBlastMasterNode::RegisterNode(CBlastNode * node, CBlastNodeMailbox * mailbox)
 		}
 		m_PostOffice[node_num]= mailbox;
 		m_RegisteredNodes[node_num] = node;
+		m_EstLengths[node_num] = est_length;
+		// Chunks may start out of order, but results are formatted in
+		// chunk order
+		m_FormatQueue[node_num] = CRef<CBlastNodeMsg>();
+		m_NumWaiting++;
+	}
+}
+
+void CBlastMasterNode::x_StartPendingNodes()
+{
+	while (((int) m_ActiveNodes.size() < m_MaxNumThreads) && !m_PendingNodes.empty()) {
+		// Start the costliest chunk among those close to the oldest waiting
+		// one, so long chunks do not run alone at the end of the search and
+		// no chunk is held back indefinitely
+		TPendingNodes::iterator next = m_PendingNodes.begin();
+		const int kWindowEnd = next->first + m_MaxNumThreads + m_LookAhead;
+		for (TPendingNodes::iterator itr = next; itr != m_PendingNodes.end() && itr->first < kWindowEnd; ++itr) {
+			if (m_EstLengths[itr->first] > m_EstLengths[next->first]) {
+				next = itr;
+			}
+		}
+
+		int chunk_num = next->first;
+		CBlastNode * n = next->second;
+		m_PendingNodes.erase(next);
+		m_NumWaiting--;
+
+		double start_time = m_StopWatch.Elapsed();
+		n->Run();
+		m_ActiveNodes[chunk_num] = start_time;
+		if ((m_CompletedLength > 0) && (m_EstLengths[chunk_num] > 0)) {
+			m_PredictedTimes[chunk_num] = m_EstLengths[chunk_num] * m_CompletedTime / m_CompletedLength;
+		}
+		INFO_POST("Starting Chunk # " << chunk_num << " " << n->GetNodeIdStr());
 	}
 }
 
@@ -166,29 +242,12 @@ bool CBlastMasterNode::Processing()
 				switch (msg->GetMsgType()) {
 					case CBlastNodeMsg::eRunRequest:
 					{
-						if ((int) m_ActiveNodes.size() < m_MaxNumThreads) {
-							CBlastNode * n = (CBlastNode *) msg->GetMsgBody();
-							if(n != NULL) {
-								double start_time = m_StopWatch.Elapsed();
-								n->Run();
-								pair< int, double > p(chunk_num, start_time);
-								m_ActiveNodes.insert(p);
-								CRef<CBlastNodeMsg> empty_msg;
-								pair<int,CRef<CBlastNodeMsg> > m(chunk_num, empty_msg);
-								m_FormatQueue.insert(m);
-								INFO_POST("Starting Chunk # " << chunk_num << " " << n->GetNodeIdStr());
-							}
-							else {
-		 						NCBI_THROW(CBlastException, eCoreBlastError, "Invalid mailbox node number" );
-							}
+						CBlastNode * n = (CBlastNode *) msg->GetMsgBody();
+						if(n != NULL) {
+							m_PendingNodes[chunk_num] = n;
 						}
 						else {
-							itr->second->UnreadMsg(msg);
-							FormatResults();
-							if (IsFull()) {
-								x_WaitForNewEvent();
-							}
-							return true;
+	 						NCBI_THROW(CBlastException, eCoreBlastError, "Invalid mailbox node number" );
 						}
 						break;
 					}
@@ -199,7 +258,23 @@ bool CBlastMasterNode::Processing()
 						double diff = m_StopWatch.Elapsed() - m_ActiveNodes[itr->first];
 						m_ActiveNodes.erase(chunk_num);
 						CTimeSpan s(diff);
-						INFO_POST("Chunk #" << chunk_num << " completed in " << s.AsSmartString());
+						map<int, double>::iterator p = m_PredictedTimes.find(chunk_num);
+						if (p != m_PredictedTimes.end()) {
+							CTimeSpan ps(p->second);
+							INFO_POST("Chunk #" << chunk_num << " completed in " << s.AsSmartString()
+							          << " (predicted " << ps.AsSmartString() << ")");
+							m_PredictedRunTime += p->second;
+							m_ActualRunTime += diff;
+							m_PredictedTimes.erase(p);
+						}
+						else {
+							INFO_POST("Chunk #" << chunk_num << " completed in " << s.AsSmartString());
+						}
+						if (msg->GetMsgType() == CBlastNodeMsg::ePostResult) {
+							m_CompletedLength += m_EstLengths[chunk_num];
+							m_CompletedTime += diff;
+						}
+						m_EstLengths.erase(chunk_num);
 						break;
 					}
 					case CBlastNodeMsg::ePostLog:
@@ -215,7 +290,17 @@ bool CBlastMasterNode::Processing()
 			}
 		}
 	}
+	x_StartPendingNodes();
 	FormatResults();
+	x_BufferResults();
+	if (!m_PendingNodes.empty() && IsFull()) {
+		x_WaitForNewEvent();
+		return true;
+	}
+	if (!IsActive() && (m_ActualRunTime > 0)) {
+		CTimeSpan ps(m_PredictedRunTime), as(m_ActualRunTime);
+		INFO_POST("Predicted chunk run time " << ps.AsSmartString() << ", actual " << as.AsSmartString());
+	}
 	return IsActive();
 }
 
@@ -228,6 +313,13 @@ void CBlastMasterNode::FormatResults()
 		if(msg.Empty()) {
 			break;
 		}
+		TOutputSegments::iterator seg = m_OutputSegments.find(itr->first);
+		if (seg != m_OutputSegments.end()) {
+			x_WriteSegment(seg->first, seg->second);
+			m_OutputSegments.erase(seg);
+			itr++;
+			continue;
+		}
 		CBlastNode * n = (CBlastNode *) msg->GetMsgBody();
 		if(n == NULL) {
 			string err_msg = "Empty formatting msg for chunk num # " + NStr::IntToString(itr->first);
@@ -258,15 +350,92 @@ void CBlastMasterNode::FormatResults()
 	}
 }
 
-int CBlastMasterNode::IsFull()
+void CBlastMasterNode::x_BufferResults()
+{
+	// Chunks that completed ahead of an earlier one hand over their output
+	// and are released, so a slow chunk does not keep every later chunk
+	// (with its scope and results) alive
+	NON_CONST_ITERATE(TFormatQueue, itr, m_FormatQueue) {
+		CRef<CBlastNodeMsg> msg(itr->second);
+		if (msg.Empty() || (m_OutputSegments.find(itr->first) != m_OutputSegments.end())) {
+			continue;
+		}
+		CBlastNode * n = (CBlastNode *) msg->GetMsgBody();
+		if(n == NULL) {
+			string err_msg = "Empty formatting msg for chunk num # " + NStr::IntToString(itr->first);
+ 			NCBI_THROW(CBlastException, eCoreBlastError, err_msg);
+		}
+		SOutputSegment & segment = m_OutputSegments[itr->first];
+		segment.msg_type = msg->GetMsgType();
+		segment.status = n->GetStatus();
+		segment.num_queries = n->GetNumOfQueries();
+		segment.queries_length = n->GetQueriesLength();
+		if (segment.msg_type == CBlastNodeMsg::ePostResult) {
+			CNcbiOstrstream os;
+			n->GetBlastResults(os);
+			segment.output = CNcbiOstrstreamToString(os);
+			if (m_BufferedBytes + (Int8) segment.output.size() > m_MaxBufferedBytes) {
+				segment.file_name = CFile::GetTmpNameEx(m_SpillDir, "blast_chunk_", CFile::eTmpFileCreate);
+				if (segment.file_name.empty()) {
+					NCBI_THROW(CBlastException, eCoreBlastError,
+					           "Failed to create a file for the output of chunk # " +
+					           NStr::IntToString(itr->first));
+				}
+				CNcbiOfstream out(segment.file_name.c_str(), IOS_BASE::out | IOS_BASE::binary);
+				out.write(segment.output.data(), segment.output.size());
+				out.close();
+				if (!out) {
+					NCBI_THROW(CBlastException, eCoreBlastError,
+					           "Failed to write output of chunk # " + NStr::IntToString(itr->first) +
+					           " to " + segment.file_name);
+				}
+				// clear() would keep the capacity
+				string().swap(segment.output);
+				INFO_POST("Chunk #" << itr->first << " output spilled to " << segment.file_name);
+			}
+			else {
+				m_BufferedBytes += segment.output.size();
+			}
+		}
+		int node_num = n->GetNodeNum();
+		n->Detach();
+		m_PostOffice.erase(node_num);
+		m_RegisteredNodes.erase(node_num);
+	}
+}
+
+void CBlastMasterNode::x_WriteSegment(int chunk_num, SOutputSegment & segment)
 {
-	TRegisteredNodes::reverse_iterator rr = m_RegisteredNodes.rbegin();
-	TActiveNodes::reverse_iterator ra = m_ActiveNodes.rbegin();
-	unsigned int in_buffer = m_MaxNumThreads;
-	if ((!m_RegisteredNodes.empty()) && (!m_ActiveNodes.empty())) {
-		in_buffer = rr->first - ra->first;
+	if (segment.msg_type == CBlastNodeMsg::ePostResult) {
+		if (segment.file_name.empty()) {
+			m_OutputStream.write(segment.output.data(), segment.output.size());
+			m_BufferedBytes -= segment.output.size();
+		}
+		else {
+			CNcbiIfstream in(segment.file_name.c_str(), IOS_BASE::in | IOS_BASE::binary);
+			if (in.peek() != EOF) {
+				m_OutputStream << in.rdbuf();
+			}
+			in.close();
+			CFile(segment.file_name).Remove();
+		}
+	}
+	else if (segment.msg_type == CBlastNodeMsg::eErrorExit) {
+		m_NumErrStatus++;
+		ERR_POST("Chunk # " << chunk_num << " exit with error (" << segment.status << ")");
+	}
+	else {
+ 		NCBI_THROW(CBlastException, eCoreBlastError, "Invalid msg type");
 	}
-	return ((int) (m_ActiveNodes.size() + in_buffer) >=   m_MaxNumNodes);
+	m_NumQueries += segment.num_queries;
+	m_QueriesLength += segment.queries_length;
+}
+
+int CBlastMasterNode::IsFull()
+{
+	// Completed chunks waiting for an earlier one count too, so a slow chunk
+	// cannot make the output held back grow without bound
+	return ((int) (m_ActiveNodes.size() + m_NumWaiting + m_OutputSegments.size()) >= m_MaxNumNodes);
 }
 
 
@@ -281,14 +450,13 @@ bool s_IsSeqID(string & line)
     return false;
 }
 
-int
-CBlastNodeInputReader::GetQueryBatch(string & queries, int & query_no)
+bool
+CBlastNodeInputReader::x_ReadQuery()
 {
 	CNcbiOstrstream ss;
-	int q_size = 0;
-	int q_count = 0;
-	queries.clear();
-	query_no = -1;
+	bool found = false;
+	m_PendingLength = 0;
+	m_PendingCount = 0;
 
     while ( !AtEOF()) {
        	string line = NStr::TruncateSpaces_Unsafe(*++(*this), NStr::eTrunc_Begin);
@@ -301,22 +469,50 @@ CBlastNodeInputReader::GetQueryBatch(string & queries, int & query_no)
 	    }
 	    bool isId = s_IsSeqID(line);
 	    if ( isId || ( c == '>' )) {
-	    	if (q_size >= m_QueryBatchSize) {
+	    	if (found) {
 	    		UngetLine();
 	    		break;
 	    	}
-	    	q_count ++;
+	    	m_PendingCount = 1;
 	    }
+	    found = true;
 	    if (c != '>') {
-	    	q_size += isId? m_EstAvgQueryLength : line.size();
+	    	m_PendingLength += isId? m_EstAvgQueryLength : line.size();
 	    }
      	ss << line << endl;
     }
     ss.flush();
+    m_PendingQuery = ss.str();
+    m_HasPendingQuery = found;
+    return found;
+}
+
+int
+CBlastNodeInputReader::GetQueryBatch(string & queries, int & query_no)
+{
+	CNcbiOstrstream ss;
+	int q_size = 0;
+	int q_count = 0;
+	queries.clear();
+	query_no = -1;
+	m_BatchLength = 0;
+
+	while (m_HasPendingQuery || x_ReadQuery()) {
+		if ((q_count > 0) &&
+		    ((q_size >= m_QueryBatchSize) || (m_PendingLength >= m_QueryBatchSize))) {
+			break;
+		}
+		ss << m_PendingQuery;
+		q_size += m_PendingLength;
+		q_count += m_PendingCount;
+		m_HasPendingQuery = false;
+	}
+    ss.flush();
     if (q_count > 0){
     	queries = ss.str();
     	query_no = m_QueryCount +1;
     	m_QueryCount +=q_count;
+    	m_BatchLength = q_size;
     }
     return q_count;
 }
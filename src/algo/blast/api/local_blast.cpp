@@ -112,7 +112,8 @@ CLocalBlast::CLocalBlast(CRef<IQueryFactory> qf,
   m_Opts            (const_cast<CBlastOptions*>(&opts_handle->GetOptions())),
   m_InternalData    (0),
   m_PrelimSearch    (new CBlastPrelimSearch(qf, m_Opts, dbinfo)),
-  m_TbackSearch     (0)
+  m_TbackSearch     (0),
+  m_PrelimStatus    (kPrelimSearchNotRun)
 {}
 
 CLocalBlast::CLocalBlast(CRef<IQueryFactory> qf,
@@ -123,7 +124,8 @@ CLocalBlast::CLocalBlast(CRef<IQueryFactory> qf,
   m_InternalData    (0),
   m_PrelimSearch    (new CBlastPrelimSearch(qf, m_Opts, db)),
   m_TbackSearch     (0),
-  m_LocalDbAdapter  (db.GetNonNullPointer())
+  m_LocalDbAdapter  (db.GetNonNullPointer()),
+  m_PrelimStatus    (kPrelimSearchNotRun)
 {}
 
 CLocalBlast::CLocalBlast(CRef<IQueryFactory> qf,
@@ -136,7 +138,8 @@ CLocalBlast::CLocalBlast(CRef<IQueryFactory> qf,
   m_PrelimSearch    (new CBlastPrelimSearch(qf, m_Opts, seqsrc,
                                             CRef<CPssmWithParameters>())),
   m_TbackSearch     (0),
-  m_SeqInfoSrc      (seqInfoSrc)
+  m_SeqInfoSrc      (seqInfoSrc),
+  m_PrelimStatus    (kPrelimSearchNotRun)
 {}
 
 /** FIXME: this should be removed as soon as we safely can
@@ -165,6 +168,13 @@ s_InitSeqInfoSrc(const BlastSeqSrc* seqsrc)
     
 CRef<CSearchResultSet>
 CLocalBlast::Run()
+{
+    RunPreliminarySearch();
+    return x_RunTraceback(CRef<CLocalDbAdapter>());
+}
+
+void
+CLocalBlast::RunPreliminarySearch()
 {
     _ASSERT(m_QueryFactory);
     _ASSERT(m_PrelimSearch);
@@ -174,8 +184,49 @@ CLocalBlast::Run()
     // filtered query regions should be masked in the BLAST_SequenceBlk
     // already.
 
-    int status = m_PrelimSearch->CheckInternalData();
-    if (status != 0)
+    m_PrelimStatus = m_PrelimSearch->CheckInternalData();
+    if (m_PrelimStatus != 0)
+    {
+         // Search is not run, RunTraceback returns an empty result set
+         return;
+    }
+    
+    BLAST_PROF_MARK2( m_batch_num_str + string("_BLAST.SETUP.STOP") );    
+    BLAST_PROF_MARK2( m_batch_num_str + string("_BLAST.PRE.START") );    
+    CStopWatch sw(CStopWatch::eStart);
+	try {
+	    m_PrelimSearch->SetNumberOfThreads(GetNumberOfThreads());
+	    m_InternalData = m_PrelimSearch->Run();
+	} catch( CIndexedDbException & ) {
+	    throw;
+	} catch (CBlastException & e) {
+		if(e.GetErrCode() == CBlastException::eCoreBlastError) {
+			throw;
+		}
+	}catch (...) {
+	}
+
+    //_ASSERT(m_InternalData);
+    if (BlastStageTimes* times = x_GetStageTimes()) {
+        times->prelim_search = sw.Elapsed();
+    }
+    BLAST_PROF_MARK2( m_batch_num_str + string("_BLAST.PRE.STOP") );    
+}
+
+CRef<CSearchResultSet>
+CLocalBlast::RunTraceback(CRef<CLocalDbAdapter> tback_db_adapter)
+{
+    if (m_PrelimStatus == kPrelimSearchNotRun) {
+        NCBI_THROW(CBlastException, eInvalidArgument,
+                   "RunPreliminarySearch must be called before RunTraceback");
+    }
+    return x_RunTraceback(tback_db_adapter);
+}
+
+CRef<CSearchResultSet>
+CLocalBlast::x_RunTraceback(CRef<CLocalDbAdapter> tback_db_adapter)
+{
+    if (m_PrelimStatus != 0)
     {
          // Search was not run, but we send back an empty CSearchResultSet.
          CRef<ILocalQueryData> local_query_data = m_QueryFactory->MakeLocalQueryData(m_Opts);
@@ -223,24 +274,19 @@ CLocalBlast::Run()
          CRef<CSearchResultSet> result_set(new CSearchResultSet(seqid_vec, sa_vec, msg_vec, ancill_vec, 0, res_type));
          return result_set;
     }
-    
-    BLAST_PROF_MARK2( m_batch_num_str + string("_BLAST.SETUP.STOP") );    
-    BLAST_PROF_MARK2( m_batch_num_str + string("_BLAST.PRE.START") );    
-	try {
-	    m_PrelimSearch->SetNumberOfThreads(GetNumberOfThreads());
-	    m_InternalData = m_PrelimSearch->Run();
-	} catch( CIndexedDbException & ) {
-	    throw;
-	} catch (CBlastException & e) {
-		if(e.GetErrCode() == CBlastException::eCoreBlastError) {
-			throw;
-		}
-	}catch (...) {
-	}
 
-    //_ASSERT(m_InternalData);
-    BLAST_PROF_MARK2( m_batch_num_str + string("_BLAST.PRE.STOP") );    
     BLAST_PROF_MARK2( m_batch_num_str + string("_BLAST.TB.START") );    
+    CStopWatch sw(CStopWatch::eStart);
+
+    // The preliminary stage of another search may be running on the
+    // CSeqDB of m_LocalDbAdapter, so read the subjects through the
+    // adapter given for the traceback, which has its own
+    CRef<CLocalDbAdapter> db_adapter(m_LocalDbAdapter);
+    if (tback_db_adapter.NotEmpty() && m_InternalData.NotEmpty()) {
+        m_TbackDbAdapter = db_adapter = tback_db_adapter;
+        m_InternalData->m_SeqSrc.Reset(
+            new TBlastSeqSrc(db_adapter->MakeSeqSrc(), 0));
+    }
     
     TSearchMessages search_msgs = m_PrelimSearch->GetSearchMessages();
     
@@ -251,14 +297,14 @@ CLocalBlast::Run()
         // Use the SeqInfoSrc provided by the user during construction
         seqinfo_src = m_SeqInfoSrc;
     }
-    else if (m_LocalDbAdapter.NotEmpty()) {
+    else if (db_adapter.NotEmpty()) {
         // This path is preferred because it preserves the GI list
         // limitation if there is one.  DBs with both internal OID
         // filtering and user GI list filtering will not do complete
         // filtering during the traceback stage, which can cause
         // 'Unknown defline' errors during formatting.
         
-        seqinfo_src.Reset(m_LocalDbAdapter->MakeSeqInfoSrc());
+        seqinfo_src.Reset(db_adapter->MakeSeqInfoSrc());
     } else {
         seqinfo_src.Reset(s_InitSeqInfoSrc(m_InternalData->m_SeqSrc->GetPointer()));
     }
@@ -276,11 +322,24 @@ CLocalBlast::Run()
     CRef<CSearchResultSet> retval = m_TbackSearch->Run();
     retval->SetFilteredQueryRegions(m_PrelimSearch->GetFilteredQueryRegions());
     m_Messages = m_TbackSearch->GetSearchMessages();
+    if (BlastStageTimes* times = x_GetStageTimes()) {
+        times->traceback = sw.Elapsed();
+    }
 
     BLAST_PROF_MARK2( m_batch_num_str + string("_BLAST.TB.STOP") );    
     return retval;
 }
 
+BlastStageTimes*
+CLocalBlast::x_GetStageTimes()
+{
+    if (m_InternalData.Empty() || m_InternalData->m_Diagnostics.Empty()) {
+        return NULL;
+    }
+    BlastDiagnostics* diag = m_InternalData->m_Diagnostics->GetPointer();
+    return diag ? diag->stage_times : NULL;
+}
+
 Int4 CLocalBlast::GetNumExtensions()
 {
     Int4 retv = 0;
@@ -41,6 +41,7 @@
  */
 
 #include <corelib/ncbithr.hpp>                  // for CThread
+#include <corelib/ncbitime.hpp>                 // for CStopWatch
 #include <algo/blast/api/setup_factory.hpp>
 #include "blast_memento_priv.hpp"
 
@@ -110,7 +111,8 @@ class CPrelimSearchThread : public CThread
 public:
     CPrelimSearchThread(SInternalData& internal_data,
                         const CBlastOptionsMemento* opts_memento)
-        : m_InternalData(internal_data), m_OptsMemento(opts_memento)
+        : m_InternalData(internal_data), m_OptsMemento(opts_memento),
+          m_BusyTime(0.0)
     {
         // The following fields need to be copied to ensure MT-safety
         BlastSeqSrc* seqsrc =
@@ -130,19 +132,28 @@ public:
         m_InternalData.m_QueryInfo = queryInfo;
     }
 
+    /// Returns the wall-clock time (in seconds) this thread spent
+    /// searching; only meaningful after the thread has been joined
+    double GetBusyTime() const { return m_BusyTime; }
+
 protected:
     virtual ~CPrelimSearchThread(void) {
         BlastQueryInfoFree(m_InternalData.m_QueryInfo);
     }
 
     virtual void* Main(void) {
-        return (void*)
-            ((intptr_t) CPrelimSearchRunner(m_InternalData, m_OptsMemento)());
+        CStopWatch sw(CStopWatch::eStart);
+        intptr_t retval =
+            (intptr_t) CPrelimSearchRunner(m_InternalData, m_OptsMemento)();
+        m_BusyTime = sw.Elapsed();
+        return (void*) retval;
     }
 
 private:
     SInternalData m_InternalData;
     const CBlastOptionsMemento* m_OptsMemento;
+    /// Time spent in Main, set when the search finishes
+    double m_BusyTime;
 };
 
 END_SCOPE(blast)
@@ -187,6 +187,20 @@ CBlastPrelimSearch::x_LaunchMultiThreadedSearch(SInternalData& internal_data)
 
     BlastSeqSrcSetNumberOfThreads(m_InternalData->m_SeqSrc->GetPointer(), 0);
 
+    // Report how evenly the database was spread over the threads: a thread
+    // is idle from the moment it runs out of chunks until the slowest one
+    // finishes.
+    double max_busy = 0.0;
+    ITERATE(TBlastThreads, thread, the_threads) {
+        max_busy = max(max_busy, (*thread)->GetBusyTime());
+    }
+    ITERATE(TBlastThreads, thread, the_threads) {
+        _TRACE("Preliminary search thread "
+               << (thread - the_threads.begin()) << ": busy "
+               << (*thread)->GetBusyTime() << "s, idle "
+               << (max_busy - (*thread)->GetBusyTime()) << "s");
+    }
+
     if (retv) {
           NCBI_THROW(CBlastException, eCoreBlastError,
                                    BlastErrorCode2String((Int2)retv));
@@ -296,33 +296,105 @@ CPsiBlastInputData::x_ExtractAlignmentData()
     // Index into multiple sequence alignment structure, query sequence 
     // already processed
     unsigned int msa_index = kQueryIndex + 1;  
-    
-    CSeq_id* last_sid=NULL;
-        
-    // For each HSP...
-    ITERATE(CSeq_align_set::Tdata, itr, m_SeqAlignSet->Get()) {
-
-        double bit_score;
-        double evalue = GetLowestEvalue((*itr)->GetScore(), &bit_score);
-        CSeq_id* current_sid = const_cast<CSeq_id*> (&(*itr)->GetSeq_id(1));
-
-        // Increment msa_index (if appropriate) after all CDense_seg for a given target 
-        // sequence have been processed.
-        if (last_sid && !current_sid->Match(*last_sid)) {
-            msa_index++;
+
+    // Rows built by this call, which replace the contents of m_MsaCache
+    CPsiBlastMsaCache::TRows rows;
+    size_t num_reused_rows = 0;
+#ifndef DEBUG_PSSM_ENGINE
+    const bool kReuseRows = m_MsaCache.NotEmpty() &&
+        m_MsaCache->m_QueryLength == GetQueryLength();
+#else
+    // m_Msa->seqinfo is only populated when the rows are built
+    const bool kReuseRows = false;
+#endif
+
+    CSeq_align_set::Tdata::const_iterator itr = m_SeqAlignSet->Get().begin();
+    const CSeq_align_set::Tdata::const_iterator kEnd =
+        m_SeqAlignSet->Get().end();
+
+    // For each target sequence...
+    while (itr != kEnd) {
+
+        const CSeq_id* last_sid = &(*itr)->GetSeq_id(1);
+        vector< CConstRef<CSeq_align> > included;
+        vector<TSignedSeqPos> signature;
+
+        // ... collect its HSPs below the e-value inclusion threshold
+        for ( ; itr != kEnd; ++itr) {
+            const CSeq_id& current_sid = (*itr)->GetSeq_id(1);
+            if ( !current_sid.Match(*last_sid) ) {
+                break;
+            }
+            last_sid = &current_sid;
+
+            if (GetLowestEvalue((*itr)->GetScore()) < 
+                m_Opts.inclusion_ethresh) {
+                const CDense_seg& seg = (*itr)->GetSegs().GetDenseg();
+                included.push_back(*itr);
+                signature.push_back(seg.GetNumseg());
+                signature.insert(signature.end(), seg.GetStarts().begin(),
+                                 seg.GetStarts().end());
+                signature.insert(signature.end(), seg.GetLens().begin(),
+                                 seg.GetLens().end());
+            }
         }
 
-        // ... below the e-value inclusion threshold
-        if (evalue < m_Opts.inclusion_ethresh) {
+        if ( !included.empty() ) {
             _ASSERT(msa_index < GetNumAlignedSequences() + 1);
-            const CDense_seg& seg = (*itr)->GetSegs().GetDenseg();
-            x_ProcessDenseg(seg, msa_index, evalue, bit_score);
+            const CSeq_id_Handle kSubject =
+                CSeq_id_Handle::GetHandle(*last_sid);
+            PSIMsaCell* row = m_Msa->data[msa_index];
+            CPsiBlastMsaCache::TRows::iterator cached;
+            if (kReuseRows && 
+                (cached = m_MsaCache->m_Rows.find(kSubject)) != 
+                    m_MsaCache->m_Rows.end() &&
+                cached->second.m_Signature == signature) {
+
+                // The same alignments were included in the previous
+                // iteration
+                copy(cached->second.m_Cells.begin(),
+                     cached->second.m_Cells.end(), row);
+                num_reused_rows++;
+                if (rows.find(kSubject) == rows.end()) {
+                    rows[kSubject].m_Signature.swap(signature);
+                    rows[kSubject].m_Cells.swap(cached->second.m_Cells);
+                    cached->second.m_Signature.clear();
+                }
+
+            } else {
+
+                bool complete = true;
+                ITERATE(vector< CConstRef<CSeq_align> >, hsp, included) {
+                    double bit_score;
+                    double evalue = GetLowestEvalue((*hsp)->GetScore(),
+                                                    &bit_score);
+                    const CDense_seg& seg = (*hsp)->GetSegs().GetDenseg();
+                    if ( !x_ProcessDenseg(seg, msa_index, evalue,
+                                          bit_score) ) {
+                        complete = false;
+                    }
+                }
+                // Rows of sequences which could not be retrieved are not
+                // kept, so that retrieving them is attempted again
+                if (m_MsaCache.NotEmpty() && complete &&
+                    rows.find(kSubject) == rows.end()) {
+                    rows[kSubject].m_Signature.swap(signature);
+                    rows[kSubject].m_Cells.assign(row,
+                                                  row + GetQueryLength());
+                }
+            }
         }
-        last_sid = current_sid;
+        msa_index++;
+    }
+
+    if (m_MsaCache.NotEmpty()) {
+        m_MsaCache->m_Rows.swap(rows);
+        m_MsaCache->m_QueryLength = GetQueryLength();
+        m_MsaCache->m_NumReusedRows = num_reused_rows;
     }
 }
 
-void
+bool
 CPsiBlastInputData::x_ProcessDenseg(const objects::CDense_seg& denseg, 
                                     unsigned int msa_index,
                                     double evalue,
@@ -352,7 +424,7 @@ CPsiBlastInputData::x_ProcessDenseg(const objects::CDense_seg& denseg,
             m_Msa->data[msa_index][i].letter = m_Query[i];
             m_Msa->data[msa_index][i].is_aligned = true;
         }
-        return;
+        return false;
     }
 
 #ifdef DEBUG_PSSM_ENGINE
@@ -406,6 +478,7 @@ CPsiBlastInputData::x_ProcessDenseg(const objects::CDense_seg& denseg,
 
     }
 
+    return true;
 }
 
 void
@@ -104,13 +104,16 @@ PsiBlastComputePssmFromAlignment(const objects::CBioseq& query,
                                  CRef<objects::CScope> database_scope,
                                  const CPSIBlastOptionsHandle& opts_handle,
                                  CConstRef<CBlastAncillaryData> ancillary_data,
-                                 PSIDiagnosticsRequest* diagnostics_request)
+                                 PSIDiagnosticsRequest* diagnostics_request,
+                                 size_t num_threads,
+                                 CPsiBlastMsaCache* msa_cache)
 {
     // Extract PSSM engine options from options handle
     CPSIBlastOptions opts;
     PSIBlastOptionsNew(&opts);
     opts->pseudo_count = opts_handle.GetPseudoCount();
     opts->inclusion_ethresh = opts_handle.GetInclusionThreshold();
+    opts->num_threads = (Int4) max(num_threads, (size_t) 1);
 
     string query_descr = NcbiEmptyString;
  
@@ -140,6 +143,9 @@ PsiBlastComputePssmFromAlignment(const objects::CBioseq& query,
                              opts_handle.GetGapExtensionCost(),
                              diagnostics_request, 
                              query_descr);
+    if (msa_cache) {
+        input.SetMsaCache(CRef<CPsiBlastMsaCache>(msa_cache));
+    }
 
     CPssmEngine engine(&input);
     engine.SetUngappedStatisticalParams(ancillary_data);
@@ -35,6 +35,7 @@
 #include <algo/blast/api/blast_exception.hpp>
 #include <algo/blast/api/psiblast_iteration.hpp>
 #include <algo/blast/api/psiblast_options.hpp>
+#include <algo/blast/api/psi_pssm_input.hpp>
 #include <objects/seqalign/Seq_align_set.hpp>
 #include "psiblast_aux_priv.hpp"
 
@@ -48,7 +49,8 @@ USING_SCOPE(objects);
 BEGIN_SCOPE(blast)
 
 CPsiBlastIterationState::CPsiBlastIterationState(unsigned int num_iterations)
-    : m_TotalNumIterationsToDo(num_iterations), m_IterationsDone(0)
+    : m_TotalNumIterationsToDo(num_iterations), m_IterationsDone(0),
+      m_MsaCache(new CPsiBlastMsaCache)
 {}
 
 CPsiBlastIterationState::~CPsiBlastIterationState()
@@ -131,6 +133,12 @@ CPsiBlastIterationState::GetIterationNumber() const
     return m_IterationsDone+1;
 }
 
+CPsiBlastMsaCache&
+CPsiBlastIterationState::GetMsaCache()
+{
+    return *m_MsaCache;
+}
+
 void 
 CPsiBlastIterationState::GetSeqIds(CConstRef<objects::CSeq_align_set> seqalign, 
                                    CConstRef<CPSIBlastOptionsHandle> opts, 
@@ -63,6 +63,7 @@ struct SSeqDB_SeqSrc_Data {
           mask_algo_id(id),
           mask_type(type),
           copied(false),
+          cached(false),
           isProtein(seqdb->GetSequenceType() == CSeqDB::eProtein)
     {
     }
@@ -94,6 +95,8 @@ struct SSeqDB_SeqSrc_Data {
     int mask_algo_id;
     ESubjectMaskingType mask_type;
     bool copied;
+    /// The sequence was served from the shared subject cache.
+    bool cached;
     bool isProtein;
 
 #if ((!defined(NCBI_COMPILER_WORKSHOP) || (NCBI_COMPILER_VERSION  > 550)) && \
@@ -343,7 +346,17 @@ s_SeqDbGetSequence(void* seqdb_handle, BlastSeqSrcGetSeqArg* args)
 
     const char *buf;
     len = 0;
-    if (datap->copied) {
+    datap->cached = false;
+    if (datap->copied && !datap->isProtein && args->ranges == NULL &&
+        datap->mask_type != eHardSubjMasking) {
+        // Decoded subjects are shared read-only between searches
+        len = seqdb.GetCachedAmbigSeq(oid, &buf, has_sentinel_byte);
+        datap->cached = (len >= 0);
+    }
+    if (datap->cached) {
+        /* buf points into the cache */
+    }
+    else if (datap->copied) {
     	if ( datap->isProtein || args->ranges == NULL){
           len = seqdb.GetAmbigSeqAlloc(oid,
                                  const_cast<char **>(&buf),
@@ -391,6 +404,9 @@ s_SeqDbGetSequence(void* seqdb_handle, BlastSeqSrcGetSeqArg* args)
     */
     if (!datap->copied) args->seq->sequence_allocated = TRUE;
 
+    /* Cached data is laid out as if copied, but must never be freed. */
+    if (datap->cached) args->seq->sequence_start_allocated = FALSE;
+
     args->seq->oid = oid;
 
 #if ((!defined(NCBI_COMPILER_WORKSHOP) || (NCBI_COMPILER_VERSION  > 550)) && \
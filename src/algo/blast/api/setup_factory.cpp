@@ -48,6 +48,7 @@
 #include <objects/seqloc/Seq_interval.hpp>
 #include <objects/seqalign/seqalign__.hpp>
 #include <serial/iterator.hpp>
+#include <corelib/ncbifile.hpp>
 
 // CORE BLAST includes
 #include <algo/blast/core/blast_setup.h>
@@ -56,6 +57,7 @@
 #include <algo/blast/core/hspfilter_besthit.h>
 #include <algo/blast/core/hspfilter_culling.h>
 #include <algo/blast/core/hspfilter_mapper.h>
+#include <algo/blast/core/lookup_cache.h>
 
 #include <sstream>
 #include "../core/jumper.h"
@@ -196,6 +198,19 @@ CSetupFactory::CreateScoreBlock(const CBlastOptionsMemento* opts_memento,
     return retval;
 }
 
+/// Returns the directory in which finalized lookup tables are cached between
+/// searches, or an empty string if lookup table caching is disabled. Set the
+/// BLAST_LOOKUP_CACHE environment variable to an existing directory to
+/// enable it.
+static string s_GetLookupTableCacheDir()
+{
+    const char* dir = getenv("BLAST_LOOKUP_CACHE");
+    if (dir == NULL || *dir == '\0' || !CDir(dir).Exists()) {
+        return kEmptyStr;
+    }
+    return dir;
+}
+
 LookupTableWrap*
 CSetupFactory::CreateLookupTable(CRef<ILocalQueryData> query_data,
                                  const CBlastOptionsMemento* opts_memento,
@@ -211,29 +226,64 @@ CSetupFactory::CreateLookupTable(CRef<ILocalQueryData> query_data,
 
     BlastSeqLoc * lookup_segments = lookup_segments_wrap->getLocs();
 
-    Int2 status = LookupTableWrapInit_MT(queries,
-                                         opts_memento->m_LutOpts,
-                                         opts_memento->m_QueryOpts,
-                                         lookup_segments,
-                                         score_blk,
-                                         &retval,
-                                         rps_info ? (*rps_info)() : 0,
-                                         &blast_msg,
-                                         seqsrc,
-                                         num_threads);
-    if (status != 0) {
-         TSearchMessages search_messages;
-         Blast_Message2TSearchMessages(blast_msg.Get(), 
-                                           query_data->GetQueryInfo(), 
-                                           search_messages);
-         string msg;
-         if (search_messages.HasMessages()) {
-              msg = search_messages.ToString();
-         } else {
-              msg = "LookupTableWrapInit failed (" + 
-                   NStr::IntToString(status) + " error code)";
-         }
-         NCBI_THROW(CBlastException, eCoreBlastError, msg);
+    // Try the lookup table cache first; a missing, stale or unreadable
+    // file just means the table is built as usual
+    const string kCacheDir = s_GetLookupTableCacheDir();
+    string cache_file;
+    Uint8 cache_key = 0;
+    if ( !kCacheDir.empty() &&
+         LookupTableCacheSupported(opts_memento->m_LutOpts) ) {
+        cache_key = LookupTableCacheKey(queries, opts_memento->m_LutOpts,
+                                        opts_memento->m_QueryOpts,
+                                        lookup_segments, score_blk);
+        cache_file = CDirEntry::ConcatPath(kCacheDir,
+                        NStr::UInt8ToString(cache_key, 0, 16) + ".lut");
+        LookupTableWrapLoad(cache_file.c_str(), cache_key, queries,
+                            opts_memento->m_LutOpts, &retval);
+    }
+
+    Int2 status = 0;
+    if ( !retval ) {
+        status = LookupTableWrapInit_MT(queries,
+                                        opts_memento->m_LutOpts,
+                                        opts_memento->m_QueryOpts,
+                                        lookup_segments,
+                                        score_blk,
+                                        &retval,
+                                        rps_info ? (*rps_info)() : 0,
+                                        &blast_msg,
+                                        seqsrc,
+                                        num_threads);
+        if (status != 0) {
+             TSearchMessages search_messages;
+             Blast_Message2TSearchMessages(blast_msg.Get(), 
+                                               query_data->GetQueryInfo(), 
+                                               search_messages);
+             string msg;
+             if (search_messages.HasMessages()) {
+                  msg = search_messages.ToString();
+             } else {
+                  msg = "LookupTableWrapInit failed (" + 
+                       NStr::IntToString(status) + " error code)";
+             }
+             NCBI_THROW(CBlastException, eCoreBlastError, msg);
+        }
+
+        // Save through a temporary file so that concurrent searches never
+        // see a partially written table
+        if ( !cache_file.empty() ) {
+            const string kTmpFile =
+                CFile::GetTmpNameEx(kCacheDir, "lut", CFile::eTmpFileCreate);
+            if ( !kTmpFile.empty() ) {
+                if (LookupTableWrapSave(retval, cache_key, queries,
+                                        opts_memento->m_LutOpts,
+                                        kTmpFile.c_str()) != 0 ||
+                    !CFile(kTmpFile).Rename(cache_file,
+                                            CDirEntry::fRF_Overwrite)) {
+                    CFile(kTmpFile).Remove();
+                }
+            }
+        }
     }
 
     // For PHI BLAST, save information about pattern occurrences in query in
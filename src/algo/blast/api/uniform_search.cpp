@@ -247,6 +247,15 @@ CSearchDatabase::GetSeqDb() const
     return m_SeqDb;
 }
 
+CRef<CSearchDatabase>
+CSearchDatabase::CloneWithOwnSeqDb() const
+{
+    CRef<CSearchDatabase> retval(new CSearchDatabase(*this));
+    retval->m_SeqDb.Reset();
+    retval->m_DbInitialized = false;
+    return retval;
+}
+
 void 
 CSearchDatabase::x_InitializeDb() const
 {
@@ -1248,6 +1248,128 @@ Blast_GetCompositionRange(int * pleft, int * pright,
 }
 
 
+/** A score matrix computed by Blast_AdjustScores, together with the
+ * arguments it was computed from */
+typedef struct SAdjustedMatrix {
+    unsigned long last_used;   /**< cache clock value at the last use;
+                                    zero if the entry is empty */
+    unsigned int hash;         /**< hash of the compositions and lengths */
+    Blast_AminoAcidComposition query_composition;   /**< query
+                                                         composition */
+    Blast_AminoAcidComposition subject_composition; /**< subject
+                                                         composition */
+    int queryLength;           /**< length of the query */
+    int subjectLength;         /**< length of the subject */
+    const Blast_MatrixInfo * matrixInfo;    /**< underlying matrix */
+    ECompoAdjustModes composition_adjust_mode; /**< adjustment mode */
+    int RE_pseudocounts;       /**< pseudocounts for RE adjustment */
+    double (*calc_lambda)(double *,int,int,double); /**< lambda function */
+    int compositionTestIndex;  /**< unified p-value rule */
+    int ** matrix;             /**< the adjusted matrix */
+    EMatrixAdjustRule matrix_adjust_rule; /**< rule actually used */
+    double pvalueForThisPair;  /**< composition p-value */
+    double ratioToPassBack;    /**< lambda ratio */
+} SAdjustedMatrix;
+
+
+/** Least recently used cache of adjusted score matrices */
+struct Blast_AdjustedMatrixCache {
+    int num_entries;           /**< number of entries */
+    int alphsize;              /**< size of the alphabet */
+    unsigned long clock;       /**< incremented on every lookup */
+    SAdjustedMatrix * entries; /**< cached matrices */
+};
+
+
+/** Free a Blast_AdjustedMatrixCache and set *pcache to NULL */
+static void
+s_AdjustedMatrixCacheFree(Blast_AdjustedMatrixCache ** pcache)
+{
+    Blast_AdjustedMatrixCache * cache = *pcache;
+
+    if (cache != NULL) {
+        int i;
+        if (cache->entries != NULL) {
+            for (i = 0;  i < cache->num_entries;  i++) {
+                Nlm_Int4MatrixFree(&cache->entries[i].matrix);
+            }
+            free(cache->entries);
+        }
+        free(cache);
+    }
+    *pcache = NULL;
+}
+
+
+/* Documented in composition_adjustment.h. */
+int
+Blast_CompositionWorkspaceInitMatrixCache(
+        Blast_CompositionWorkspace * NRrecord, int num_entries, int alphsize)
+{
+    Blast_AdjustedMatrixCache * cache;
+    int i;
+
+    s_AdjustedMatrixCacheFree(&NRrecord->matrix_cache);
+    cache = (Blast_AdjustedMatrixCache *)
+        calloc(1, sizeof(Blast_AdjustedMatrixCache));
+    if (cache == NULL) return -1;
+    cache->num_entries = num_entries;
+    cache->alphsize = alphsize;
+    cache->entries =
+        (SAdjustedMatrix *) calloc(num_entries, sizeof(SAdjustedMatrix));
+    if (cache->entries == NULL) goto error_return;
+    for (i = 0;  i < num_entries;  i++) {
+        cache->entries[i].matrix = Nlm_Int4MatrixNew(alphsize, alphsize);
+        if (cache->entries[i].matrix == NULL) goto error_return;
+    }
+    NRrecord->matrix_cache = cache;
+    return 0;
+error_return:
+    s_AdjustedMatrixCacheFree(&cache);
+    return -1;
+}
+
+
+/** Hash the parts of a pair of compositions that determine an adjusted
+ * matrix (FNV-1a) */
+static unsigned int
+s_CompositionPairHash(const Blast_AminoAcidComposition * query_composition,
+                      int queryLength,
+                      const Blast_AminoAcidComposition * subject_composition,
+                      int subjectLength, int alphsize)
+{
+    unsigned int hash = 2166136261U;
+    const unsigned char * bytes;
+    size_t i;
+
+    bytes = (const unsigned char *) subject_composition->prob;
+    for (i = 0;  i < alphsize * sizeof(double);  i++) {
+        hash = (hash ^ bytes[i]) * 16777619U;
+    }
+    bytes = (const unsigned char *) query_composition->prob;
+    for (i = 0;  i < alphsize * sizeof(double);  i++) {
+        hash = (hash ^ bytes[i]) * 16777619U;
+    }
+    hash = (hash ^ (unsigned int) queryLength) * 16777619U;
+    hash = (hash ^ (unsigned int) subjectLength) * 16777619U;
+    hash = (hash ^ (unsigned int) subject_composition->numTrueAminoAcids)
+        * 16777619U;
+
+    return hash;
+}
+
+
+/** Return TRUE if two compositions are identical in the first alphsize
+ * letters */
+static Boolean
+s_SameComposition(const Blast_AminoAcidComposition * a,
+                  const Blast_AminoAcidComposition * b, int alphsize)
+{
+    return a->numTrueAminoAcids == b->numTrueAminoAcids &&
+        0 == memcmp(a->prob, b->prob, alphsize * sizeof(double));
+}
+
+
 /* Documented in composition_adjustment.h. */
 void
 Blast_CompositionWorkspaceFree(Blast_CompositionWorkspace ** pNRrecord)
@@ -1260,6 +1382,7 @@ Blast_CompositionWorkspaceFree(Blast_CompositionWorkspace ** pNRrecord)
 
         Nlm_DenseMatrixFree(&NRrecord->mat_final);
         Nlm_DenseMatrixFree(&NRrecord->mat_b);
+        s_AdjustedMatrixCacheFree(&NRrecord->matrix_cache);
 
         free(NRrecord);
     }
@@ -1282,6 +1405,7 @@ Blast_CompositionWorkspace * Blast_CompositionWorkspaceNew(void)
     NRrecord->second_standard_freq     = NULL;
     NRrecord->mat_final                = NULL;
     NRrecord->mat_b                    = NULL;
+    NRrecord->matrix_cache             = NULL;
 
     NRrecord->first_standard_freq =
         (double *) malloc(COMPO_NUM_TRUE_AA * sizeof(double));
@@ -1409,9 +1533,10 @@ Blast_CompositionMatrixAdj(int ** matrix,
 }
 
 
-/* Documented in composition_adjustment.h. */
-int
-Blast_AdjustScores(int ** matrix,
+/** Compute a compositionally adjusted scoring matrix; the arguments are
+ * those of Blast_AdjustScores. */
+static int
+s_AdjustScores(int ** matrix,
                    const Blast_AminoAcidComposition * query_composition,
                    int queryLength,
                    const Blast_AminoAcidComposition * subject_composition,
@@ -1529,3 +1654,99 @@ Blast_AdjustScores(int ** matrix,
                                        calc_lambda,
                                        (compositionTestIndex > 0));
 }
+
+
+/* Documented in composition_adjustment.h. */
+int
+Blast_AdjustScores(int ** matrix,
+                   const Blast_AminoAcidComposition * query_composition,
+                   int queryLength,
+                   const Blast_AminoAcidComposition * subject_composition,
+                   int subjectLength,
+                   const Blast_MatrixInfo * matrixInfo,
+                   ECompoAdjustModes composition_adjust_mode,
+                   int RE_pseudocounts,
+                   Blast_CompositionWorkspace *NRrecord,
+                   EMatrixAdjustRule *matrix_adjust_rule,
+                   double calc_lambda(double *,int,int,double),
+                   double *pvalueForThisPair,
+                   int compositionTestIndex,
+                   double *ratioToPassBack)
+{
+    const int alphsize = matrixInfo->cols;
+    Blast_AdjustedMatrixCache * cache =
+        NRrecord != NULL ? NRrecord->matrix_cache : NULL;
+    SAdjustedMatrix * entry = NULL;
+    unsigned int hash = 0;
+    int i, status;
+
+    if (cache != NULL && !matrixInfo->positionBased &&
+        cache->alphsize == alphsize && matrixInfo->rows == alphsize) {
+        SAdjustedMatrix * oldest = &cache->entries[0];
+
+        hash = s_CompositionPairHash(query_composition, queryLength,
+                                     subject_composition, subjectLength,
+                                     alphsize);
+        cache->clock++;
+        for (i = 0;  i < cache->num_entries;  i++) {
+            SAdjustedMatrix * e = &cache->entries[i];
+            if (e->last_used != 0 && e->hash == hash &&
+                e->queryLength == queryLength &&
+                e->subjectLength == subjectLength &&
+                e->matrixInfo == matrixInfo &&
+                e->composition_adjust_mode == composition_adjust_mode &&
+                e->RE_pseudocounts == RE_pseudocounts &&
+                e->calc_lambda == calc_lambda &&
+                e->compositionTestIndex == compositionTestIndex &&
+                s_SameComposition(&e->subject_composition,
+                                  subject_composition, alphsize) &&
+                s_SameComposition(&e->query_composition,
+                                  query_composition, alphsize)) {
+                int j;
+                for (j = 0;  j < alphsize;  j++) {
+                    memcpy(matrix[j], e->matrix[j], alphsize * sizeof(int));
+                }
+                *matrix_adjust_rule = e->matrix_adjust_rule;
+                if (compositionTestIndex > 0) {
+                    *pvalueForThisPair = e->pvalueForThisPair;
+                }
+                *ratioToPassBack = e->ratioToPassBack;
+                e->last_used = cache->clock;
+                return 0;
+            }
+            if (e->last_used < oldest->last_used) {
+                oldest = e;
+            }
+        }
+        entry = oldest;
+    }
+
+    status = s_AdjustScores(matrix, query_composition, queryLength,
+                            subject_composition, subjectLength, matrixInfo,
+                            composition_adjust_mode, RE_pseudocounts,
+                            NRrecord, matrix_adjust_rule, calc_lambda,
+                            pvalueForThisPair, compositionTestIndex,
+                            ratioToPassBack);
+
+    if (entry != NULL && status == 0) {
+        entry->last_used = cache->clock;
+        entry->hash = hash;
+        entry->query_composition = *query_composition;
+        entry->subject_composition = *subject_composition;
+        entry->queryLength = queryLength;
+        entry->subjectLength = subjectLength;
+        entry->matrixInfo = matrixInfo;
+        entry->composition_adjust_mode = composition_adjust_mode;
+        entry->RE_pseudocounts = RE_pseudocounts;
+        entry->calc_lambda = calc_lambda;
+        entry->compositionTestIndex = compositionTestIndex;
+        for (i = 0;  i < alphsize;  i++) {
+            memcpy(entry->matrix[i], matrix[i], alphsize * sizeof(int));
+        }
+        entry->matrix_adjust_rule = *matrix_adjust_rule;
+        entry->pvalueForThisPair =
+            compositionTestIndex > 0 ? *pvalueForThisPair : 0.0;
+        entry->ratioToPassBack = *ratioToPassBack;
+    }
+    return status;
+}
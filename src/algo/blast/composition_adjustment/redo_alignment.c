@@ -1440,18 +1440,34 @@ Blast_RedoOneMatchSmithWaterman(BlastCompo_Alignment ** alignments,
                 int matchEnd, queryEnd;    /* end points of the alignments
                                             * computed by the Smith-Waterman
                                             * algorithm. */
-                status =
-                    Blast_SmithWatermanScoreOnly(&aSwScore, &matchEnd,
-                                                 &queryEnd,
-                                                 subject.data,
+                /* Use the caller's implementation when it has one; it
+                 * can not handle forbidden ranges */
+                status = -1;
+                if (callbacks->sw_score_only != NULL &&
+                    forbidden->isEmpty) {
+                    status =
+                        callbacks->sw_score_only(&aSwScore, &matchEnd,
+                                                 &queryEnd, subject.data,
                                                  subject.length,
-                                                 query.data,
-                                                 query.length, matrix,
+                                                 query.data, query.length,
+                                                 matrix, alphsize,
                                                  gap_open, gap_extend,
-                                                 positionBased,
-                                                 forbidden);
-                if (status != 0)
-                    goto window_index_loop_cleanup;
+                                                 positionBased);
+                }
+                if (status != 0) {
+                    status =
+                        Blast_SmithWatermanScoreOnly(&aSwScore, &matchEnd,
+                                                     &queryEnd,
+                                                     subject.data,
+                                                     subject.length,
+                                                     query.data,
+                                                     query.length, matrix,
+                                                     gap_open, gap_extend,
+                                                     positionBased,
+                                                     forbidden);
+                    if (status != 0)
+                        goto window_index_loop_cleanup;
+                }
 
                 if (do_link_hsps) {
                     alignment_is_significant = aSwScore >= params->cutoff_s;
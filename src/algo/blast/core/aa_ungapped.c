@@ -32,6 +32,17 @@
 #include <algo/blast/core/blast_aalookup.h>
 #include <algo/blast/core/blast_aascan.h>
 #include <algo/blast/core/blast_util.h>
+#include <algo/blast/core/blast_encoding.h> /* for BLASTAA_SIZE */
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+/** Two-hit extensions can be queued and run several at a time by a
+    gather-based kernel. The kernel is used only if the environment
+    variable BLAST_AA_BATCH_EXTEND is set: with short extensions and
+    frequent diagonal collisions it did not beat the scalar loops on the
+    hardware it was measured on. */
+#define BLAST_AA_BATCH_EXTEND 1
+#endif
 
 /** Scan a subject sequence for word hits and trigger two-hit extensions.
  *
@@ -196,6 +207,84 @@ static Int4 s_BlastAaExtendTwoHit(Int4 ** matrix,
                          Boolean *right_extend,
                          Int4* s_last_off);
 
+#ifdef BLAST_AA_BATCH_EXTEND
+
+/** Number of two-hit extensions queued before they are run */
+#define AA_EXTEND_BATCH_SIZE 64
+
+/** Number of extensions the batched kernel advances at once */
+#define AA_EXTEND_LANES 8
+
+/** Number of score profile columns per query position */
+#define AA_PROFILE_COLUMNS 32
+
+/** Value of DiagStruct::last_hit while the extension queued for that
+    diagonal has not been run. Real values are never negative. */
+#define AA_EXTEND_PENDING (-1)
+
+/** A two-hit extension queued by s_BlastAaWordFinder_TwoHit */
+typedef struct SAaExtendCandidate {
+    Int4 q_off;         /**< query offset of the second hit */
+    Int4 s_off;         /**< subject offset of the second hit */
+    Int4 s_left_off;    /**< subject offset one beyond the first hit */
+    Int4 diag_coord;    /**< diagonal of the two hits */
+    const BlastUngappedCutoffs* cutoffs; /**< cutoffs of the query context */
+    Int4 q_right_off;   /**< query offset both extensions start from */
+    Int4 s_right_off;   /**< subject offset both extensions start from */
+    Int4 left_score;    /**< best score of the left extension */
+    Int4 left_d;        /**< length of the left extension */
+    Int4 right_score;   /**< best score of the right extension */
+    Int4 right_d;       /**< length of the right extension */
+    Int4 s_last_off;    /**< rightmost subject offset examined */
+    Boolean right_extend; /**< TRUE if the right extension was run */
+} SAaExtendCandidate;
+
+/** Return the Int16 score profile of the query, building it on first use.
+ *
+ * Row i holds the scores of query position i against every subject
+ * letter, so one lookup replaces the two-level matrix access of the
+ * scalar extension routines. A trailing all-zero row parks idle lanes of
+ * the batched kernel.
+ *
+ * @param ewp word extension structure that owns the profile [in][out]
+ * @param matrix the substitution matrix or PSSM [in]
+ * @param query query sequence [in]
+ * @param use_pssm TRUE if the scoring matrix is position-specific [in]
+ * @return the profile, or NULL if the batched kernel is not enabled, a
+ *         score does not fit in 16 bits or memory is short
+ */
+static const Int2* s_BlastAaProfileGet(Blast_ExtendWord* ewp,
+                                       Int4** matrix,
+                                       const BLAST_SequenceBlk* query,
+                                       Boolean use_pssm);
+
+/** Run a batch of queued two-hit extensions, then report the resulting
+ * HSPs and update the diagonal array exactly as s_BlastAaExtendTwoHit
+ * followed by the bookkeeping in s_BlastAaWordFinder_TwoHit would have,
+ * in queue order.
+ *
+ * @param candidates the queued extensions [in][out]
+ * @param num_candidates number of queued extensions [in]
+ * @param profile score profile from s_BlastAaProfileGet [in]
+ * @param subject subject sequence, at least 4 letters long [in]
+ * @param query query sequence [in]
+ * @param word_size number of letters in one word [in]
+ * @param diag_array the diagonal array [in][out]
+ * @param diag_offset current offset of the diagonal array [in]
+ * @param ungapped_hsps hsps resulting from the ungapped extension [out]
+ */
+static void s_BlastAaExtendTwoHitBatch(SAaExtendCandidate* candidates,
+                                       Int4 num_candidates,
+                                       const Int2* profile,
+                                       const BLAST_SequenceBlk* subject,
+                                       const BLAST_SequenceBlk* query,
+                                       Int4 word_size,
+                                       DiagStruct* diag_array,
+                                       Int4 diag_offset,
+                                       BlastInitHitList* ungapped_hsps);
+
+#endif /* BLAST_AA_BATCH_EXTEND */
+
 
 Int2 BlastAaWordFinder(BLAST_SequenceBlk * subject,
                        BLAST_SequenceBlk * query,
@@ -467,6 +556,11 @@ s_BlastAaWordFinder_TwoHit(const BLAST_SequenceBlk * subject,
     BLAST_DiagTable * diag = ewp->diag_table;
     TAaScanSubjectFunction scansub;
     Int4 scan_range[3];
+#ifdef BLAST_AA_BATCH_EXTEND
+    SAaExtendCandidate batch[AA_EXTEND_BATCH_SIZE];
+    Int4 num_queued = 0;
+    const Int2* profile = NULL;
+#endif
 
     ASSERT(diag != NULL);
 
@@ -492,6 +586,12 @@ s_BlastAaWordFinder_TwoHit(const BLAST_SequenceBlk * subject,
         wordsize = lookup->word_length;
     }
 
+#ifdef BLAST_AA_BATCH_EXTEND
+    /* the batched kernel reads the subject four letters at a time */
+    if (subject->length >= 4)
+        profile = s_BlastAaProfileGet(ewp, matrix, query, use_pssm);
+#endif
+
     scan_range[0] = 0;
     scan_range[1] = subject->seq_ranges[0].left;
     scan_range[2] = subject->seq_ranges[0].right - wordsize;
@@ -515,6 +615,19 @@ s_BlastAaWordFinder_TwoHit(const BLAST_SequenceBlk * subject,
 
             diag_coord = (query_offset - subject_offset) & diag_mask;
 
+#ifdef BLAST_AA_BATCH_EXTEND
+            /* An extension on this diagonal is still queued; run the
+               queue so that the diagonal is up to date. */
+            if (diag_array[diag_coord].flag &&
+                diag_array[diag_coord].last_hit == AA_EXTEND_PENDING) {
+                s_BlastAaExtendTwoHitBatch(batch, num_queued, profile,
+                                           subject, query, wordsize,
+                                           diag_array, diag_offset,
+                                           ungapped_hsps);
+                num_queued = 0;
+            }
+#endif
+
             /* If the reset bit is set, an extension just happened. */
             if (diag_array[diag_coord].flag) {
                 /* If we've already extended past this hit, skip it. */
@@ -573,6 +686,33 @@ s_BlastAaWordFinder_TwoHit(const BLAST_SequenceBlk * subject,
                 }
 
                 cutoffs = word_params->cutoffs + curr_context;
+
+#ifdef BLAST_AA_BATCH_EXTEND
+                /* Queue the extension and mark the diagonal as pending;
+                   the next hit on it runs the queue first. */
+                if (profile) {
+                    SAaExtendCandidate* candidate = batch + num_queued++;
+
+                    candidate->q_off = query_offset;
+                    candidate->s_off = subject_offset;
+                    candidate->s_left_off = last_hit + wordsize;
+                    candidate->diag_coord = diag_coord;
+                    candidate->cutoffs = cutoffs;
+                    diag_array[diag_coord].flag = 1;
+                    diag_array[diag_coord].last_hit = AA_EXTEND_PENDING;
+                    ++hits_extended;
+
+                    if (num_queued == AA_EXTEND_BATCH_SIZE) {
+                        s_BlastAaExtendTwoHitBatch(batch, num_queued, profile,
+                                                   subject, query, wordsize,
+                                                   diag_array, diag_offset,
+                                                   ungapped_hsps);
+                        num_queued = 0;
+                    }
+                    continue;
+                }
+#endif
+
                 score = s_BlastAaExtendTwoHit(matrix, subject, query,
                                               last_hit + wordsize,
                                               subject_offset, query_offset,
@@ -610,6 +750,14 @@ s_BlastAaWordFinder_TwoHit(const BLAST_SequenceBlk * subject,
     }                           /* end while - done with the entire sequence. 
                                  */
 
+#ifdef BLAST_AA_BATCH_EXTEND
+    if (num_queued > 0) {
+        s_BlastAaExtendTwoHitBatch(batch, num_queued, profile,
+                                   subject, query, wordsize,
+                                   diag_array, diag_offset, ungapped_hsps);
+    }
+#endif
+
     /* increment the offset in the diagonal array */
     Blast_ExtendWordExit(ewp, subject->length);
 
@@ -1156,3 +1304,385 @@ s_BlastAaExtendTwoHit(Int4 ** matrix,
     *hsp_len = left_d + right_d;
     return MAX(left_score, right_score);
 }
+
+#ifdef BLAST_AA_BATCH_EXTEND
+
+static const Int2*
+s_BlastAaProfileGet(Blast_ExtendWord* ewp, Int4** matrix,
+                    const BLAST_SequenceBlk* query, Boolean use_pssm)
+{
+    Int2* profile;
+    Int4 i, j;
+
+    if (ewp->aa_profile_matrix == matrix &&
+        ewp->aa_profile_query == query->sequence) {
+        return ewp->aa_profile;
+    }
+
+    sfree(ewp->aa_profile);
+    ewp->aa_profile_matrix = matrix;
+    ewp->aa_profile_query = query->sequence;
+
+    /* a NULL profile selects the scalar path for the rest of the search */
+    if (getenv("BLAST_AA_BATCH_EXTEND") == NULL)
+        return NULL;
+
+    /* the kernel loads profile entries four bytes at a time, so pad
+       the last row by one entry */
+    profile = (Int2*) calloc((query->length + 1) * AA_PROFILE_COLUMNS + 1,
+                             sizeof(Int2));
+    if (!profile)
+        return NULL;
+
+    for (i = 0; i < query->length; i++) {
+        const Int4* row = use_pssm ? matrix[i] : matrix[query->sequence[i]];
+        Int2* prow = profile + i * AA_PROFILE_COLUMNS;
+
+        for (j = 0; j < BLASTAA_SIZE; j++) {
+            if (row[j] < INT2_MIN || row[j] > INT2_MAX) {
+                sfree(profile);
+                return NULL;
+            }
+            prow[j] = (Int2) row[j];
+        }
+    }
+
+    ewp->aa_profile = profile;
+    return profile;
+}
+
+/** State of the AA_EXTEND_LANES extensions advanced by the batched
+    kernel, kept in memory between the steps that finish one of them */
+typedef struct SAaExtendLanes {
+    Int4 work[AA_EXTEND_LANES];     /**< 2 * candidate (+1 when extending
+                                         to the right), or -1 if idle */
+    Int4 q[AA_EXTEND_LANES];        /**< profile row offset of the next
+                                         query position */
+    Int4 s[AA_EXTEND_LANES];        /**< next subject position */
+    Int4 q_step[AA_EXTEND_LANES];   /**< +/- AA_PROFILE_COLUMNS */
+    Int4 s_step[AA_EXTEND_LANES];   /**< +/- 1 */
+    Int4 score[AA_EXTEND_LANES];    /**< running score */
+    Int4 maxscore[AA_EXTEND_LANES]; /**< best running score */
+    Int4 best[AA_EXTEND_LANES];     /**< step of the best score, or -1 */
+    Int4 step[AA_EXTEND_LANES];     /**< number of steps taken */
+    Int4 num_steps[AA_EXTEND_LANES]; /**< number of steps available */
+    Int4 dropoff[AA_EXTEND_LANES];  /**< X-dropoff of the extension */
+    Int4 floor[AA_EXTEND_LANES];    /**< -1 to stop once the running score
+                                         is not positive, 0 otherwise */
+    Int4 stopped[AA_EXTEND_LANES];  /**< -1 if the last step tripped a
+                                         termination test */
+} SAaExtendLanes;
+
+/** Record the outcome of one finished extension. A left extension that
+ * reaches the first hit queues the right extension of its candidate.
+ *
+ * @param candidates the queued two-hit extensions [in][out]
+ * @param work the finished extension [in]
+ * @param maxscore best running score [in]
+ * @param length length of the extension [in]
+ * @param last_step index of the last step examined [in]
+ * @param queue extensions waiting for a lane [in][out]
+ * @param queue_tail one past the last waiting extension [in][out]
+ */
+static void
+s_BlastAaExtendFinish(SAaExtendCandidate* candidates, Int4 work,
+                      Int4 maxscore, Int4 length, Int4 last_step,
+                      Int4* queue, Int4* queue_tail)
+{
+    SAaExtendCandidate* c = candidates + (work >> 1);
+
+    if (work & 1) {
+        c->right_score = maxscore;
+        c->right_d = length;
+        c->s_last_off = c->s_right_off + last_step;
+    } else {
+        c->left_score = maxscore;
+        c->left_d = length;
+        /* extend to the right only if left extension reached the
+           first hit */
+        if (length >= c->s_right_off - c->s_left_off) {
+            c->right_extend = TRUE;
+            queue[(*queue_tail)++] = work + 1;
+        }
+    }
+}
+
+/** Give a lane the next waiting extension, or park it on the all-zero
+ * profile row if none is left. Extensions with no room to grow finish
+ * here without occupying the lane.
+ *
+ * @return TRUE if the lane is busy
+ */
+static Boolean
+s_BlastAaExtendLaneLoad(SAaExtendLanes* lanes, Int4 lane,
+                        SAaExtendCandidate* candidates,
+                        Int4* queue, Int4* queue_head, Int4* queue_tail,
+                        Int4 subject_length, Int4 query_length)
+{
+    while (*queue_head < *queue_tail) {
+        Int4 work = queue[(*queue_head)++];
+        SAaExtendCandidate* c = candidates + (work >> 1);
+        Int4 q_off, s_off, n, maxscore;
+
+        if (work & 1) {
+            q_off = c->q_right_off;
+            s_off = c->s_right_off;
+            n = MIN(subject_length - s_off, query_length - q_off);
+            maxscore = c->left_score;
+        } else {
+            q_off = c->q_right_off - 1;
+            s_off = c->s_right_off - 1;
+            n = MIN(s_off, q_off) + 1;
+            maxscore = 0;
+        }
+
+        if (n <= 0) {
+            s_BlastAaExtendFinish(candidates, work, maxscore, 0, 0,
+                                  queue, queue_tail);
+            continue;
+        }
+
+        lanes->work[lane] = work;
+        lanes->q[lane] = q_off * AA_PROFILE_COLUMNS;
+        lanes->s[lane] = s_off;
+        lanes->s_step[lane] = (work & 1) ? 1 : -1;
+        lanes->q_step[lane] = lanes->s_step[lane] * AA_PROFILE_COLUMNS;
+        lanes->score[lane] = maxscore;
+        lanes->maxscore[lane] = maxscore;
+        lanes->best[lane] = -1;
+        lanes->step[lane] = 0;
+        lanes->num_steps[lane] = n;
+        lanes->dropoff[lane] = c->cutoffs->x_dropoff;
+        lanes->floor[lane] = (work & 1) ? -1 : 0;
+        return TRUE;
+    }
+
+    lanes->work[lane] = -1;
+    lanes->q[lane] = query_length * AA_PROFILE_COLUMNS;
+    lanes->s[lane] = 0;
+    lanes->s_step[lane] = 0;
+    lanes->q_step[lane] = 0;
+    lanes->score[lane] = 0;
+    lanes->maxscore[lane] = 0;
+    lanes->best[lane] = -1;
+    lanes->step[lane] = 0;
+    lanes->num_steps[lane] = -1;
+    lanes->dropoff[lane] = 1;
+    lanes->floor[lane] = 0;
+    return FALSE;
+}
+
+/** Number of lanes set in a movemask result */
+static NCBI_INLINE Int4 s_BlastAaLaneCount(Int4 mask)
+{
+    mask = mask - ((mask >> 1) & 0x55);
+    mask = (mask & 0x33) + ((mask >> 2) & 0x33);
+    return (mask + (mask >> 4)) & 0x0f;
+}
+
+/** Load one SAaExtendLanes field into a vector */
+#define AA_LANES_LOAD(field) \
+    _mm256_loadu_si256((const __m256i*) lanes.field)
+
+/** Store a vector into one SAaExtendLanes field */
+#define AA_LANES_STORE(field, v) \
+    _mm256_storeu_si256((__m256i*) lanes.field, (v))
+
+static void
+s_BlastAaExtendTwoHitBatch(SAaExtendCandidate* candidates,
+                           Int4 num_candidates,
+                           const Int2* profile,
+                           const BLAST_SequenceBlk* subject,
+                           const BLAST_SequenceBlk* query,
+                           Int4 word_size,
+                           DiagStruct* diag_array,
+                           Int4 diag_offset,
+                           BlastInitHitList* ungapped_hsps)
+{
+    const Uint1* s = subject->sequence;
+    Int4 queue[2 * AA_EXTEND_BATCH_SIZE];
+    Int4 queue_head = 0, queue_tail = 0;
+    SAaExtendLanes lanes;
+    Int4 num_busy = 0;
+    Int4 lane, i;
+
+    /* Find one beyond the position (up to word_size-1 letters to the
+       right) that gives the largest starting score, as in
+       s_BlastAaExtendTwoHit, and queue the left extensions. */
+    for (i = 0; i < num_candidates; i++) {
+        SAaExtendCandidate* c = candidates + i;
+        Int4 score = 0, best_score = 0, right_d = 0, k;
+
+        for (k = 0; k < word_size; k++) {
+            score += profile[(c->q_off + k) * AA_PROFILE_COLUMNS +
+                             s[c->s_off + k]];
+            if (score > best_score) {
+                best_score = score;
+                right_d = k + 1;
+            }
+        }
+        c->q_right_off = c->q_off + right_d;
+        c->s_right_off = c->s_off + right_d;
+        c->left_score = c->right_score = 0;
+        c->left_d = c->right_d = 0;
+        c->s_last_off = c->s_right_off;
+        c->right_extend = FALSE;
+        queue[queue_tail++] = 2 * i;
+    }
+
+    for (lane = 0; lane < AA_EXTEND_LANES; lane++) {
+        num_busy += s_BlastAaExtendLaneLoad(&lanes, lane, candidates, queue,
+                                            &queue_head, &queue_tail,
+                                            subject->length, query->length);
+    }
+
+    /* Each lane walks one extension a letter at a time with the same
+       arithmetic and termination tests as s_BlastAaExtendLeft and
+       s_BlastAaExtendRight. Lanes advance in blocks of four letters, the
+       subject letters of a block coming from one four-byte load kept
+       within the sequence. A finished lane is frozen until half the
+       lanes are done (or all of them, once nothing is waiting), so the
+       loop is not left after every extension. */
+    while (num_busy > 0) {
+        const __m256i v_zero = _mm256_setzero_si256();
+        const __m256i v_one = _mm256_set1_epi32(1);
+        const __m256i v_last_word = _mm256_set1_epi32(subject->length - 4);
+        const __m256i v_last_row = _mm256_set1_epi32(query->length *
+                                                     AA_PROFILE_COLUMNS);
+        const Int4 threshold = (queue_head < queue_tail) ?
+                               AA_EXTEND_LANES / 2 : AA_EXTEND_LANES;
+        __m256i v_q = AA_LANES_LOAD(q);
+        __m256i v_s = AA_LANES_LOAD(s);
+        __m256i v_q_step = AA_LANES_LOAD(q_step);
+        __m256i v_s_step = AA_LANES_LOAD(s_step);
+        __m256i v_score = AA_LANES_LOAD(score);
+        __m256i v_max = AA_LANES_LOAD(maxscore);
+        __m256i v_best = AA_LANES_LOAD(best);
+        __m256i v_step = AA_LANES_LOAD(step);
+        __m256i v_num_steps = AA_LANES_LOAD(num_steps);
+        __m256i v_dropoff = AA_LANES_LOAD(dropoff);
+        __m256i v_floor = AA_LANES_LOAD(floor);
+        __m256i v_dead = _mm256_cmpgt_epi32(v_zero, AA_LANES_LOAD(work));
+        __m256i v_stopped = v_zero;
+        __m256i v_shift_step = _mm256_slli_epi32(v_s_step, 3);
+        __m256i v_word_back = _mm256_and_si256(_mm256_srai_epi32(v_s_step, 31),
+                                               _mm256_set1_epi32(-3));
+        Int4 done;
+
+        do {
+            /* the four letters from s (right) or ending at s (left) */
+            __m256i v_addr = _mm256_min_epi32(_mm256_max_epi32(
+                                 _mm256_add_epi32(v_s, v_word_back),
+                                 v_zero), v_last_word);
+            __m256i v_word = _mm256_i32gather_epi32((const int*) s, v_addr, 1);
+            __m256i v_shift = _mm256_slli_epi32(_mm256_sub_epi32(v_s, v_addr),
+                                                3);
+            Int4 k;
+
+            for (k = 0; k < 4; k++) {
+                __m256i v_active = _mm256_xor_si256(v_dead,
+                                                    _mm256_set1_epi32(-1));
+                __m256i v_letter = _mm256_and_si256(
+                                      _mm256_srlv_epi32(v_word, v_shift),
+                                      _mm256_set1_epi32(0xff));
+                /* frozen lanes keep moving; clamp them to the profile */
+                __m256i v_row = _mm256_min_epi32(_mm256_max_epi32(v_q, v_zero),
+                                                 v_last_row);
+                __m256i v_val = _mm256_i32gather_epi32((const int*) profile,
+                                          _mm256_add_epi32(v_row, v_letter), 2);
+                __m256i v_better, v_stop;
+
+                /* sign-extend the low 16 bits; frozen lanes add nothing */
+                v_val = _mm256_and_si256(v_active, _mm256_srai_epi32(
+                                         _mm256_slli_epi32(v_val, 16), 16));
+
+                v_score = _mm256_add_epi32(v_score, v_val);
+                v_better = _mm256_cmpgt_epi32(v_score, v_max);
+                v_max = _mm256_max_epi32(v_max, v_score);
+                v_best = _mm256_blendv_epi8(v_best, v_step, v_better);
+
+                /* (maxscore - score) >= dropoff, or score <= 0 for right
+                   extensions */
+                v_stop = _mm256_or_si256(
+                             _mm256_andnot_si256(
+                                 _mm256_cmpgt_epi32(v_dropoff,
+                                            _mm256_sub_epi32(v_max, v_score)),
+                                 v_active),
+                             _mm256_and_si256(
+                                 _mm256_and_si256(v_active, v_floor),
+                                 _mm256_cmpgt_epi32(v_one, v_score)));
+                v_stopped = _mm256_or_si256(v_stopped, v_stop);
+
+                v_step = _mm256_add_epi32(v_step,
+                                          _mm256_and_si256(v_active, v_one));
+                v_dead = _mm256_or_si256(v_dead, _mm256_or_si256(v_stop,
+                             _mm256_cmpeq_epi32(v_step, v_num_steps)));
+                v_q = _mm256_add_epi32(v_q, v_q_step);
+                v_shift = _mm256_add_epi32(v_shift, v_shift_step);
+            }
+            v_s = _mm256_add_epi32(v_s, _mm256_slli_epi32(v_s_step, 2));
+
+            done = _mm256_movemask_ps(_mm256_castsi256_ps(v_dead));
+        } while (s_BlastAaLaneCount(done) < threshold);
+
+        AA_LANES_STORE(q, v_q);
+        AA_LANES_STORE(s, v_s);
+        AA_LANES_STORE(score, v_score);
+        AA_LANES_STORE(maxscore, v_max);
+        AA_LANES_STORE(best, v_best);
+        AA_LANES_STORE(step, v_step);
+        AA_LANES_STORE(stopped, v_stopped);
+
+        for (lane = 0; lane < AA_EXTEND_LANES; lane++) {
+            if ((done & (1 << lane)) == 0 || lanes.work[lane] < 0)
+                continue;
+
+            /* a termination test breaks out before the step counter
+               would advance, as in the scalar loops */
+            s_BlastAaExtendFinish(candidates, lanes.work[lane],
+                                  lanes.maxscore[lane], lanes.best[lane] + 1,
+                                  lanes.stopped[lane] ? lanes.step[lane] - 1
+                                                      : lanes.num_steps[lane],
+                                  queue, &queue_tail);
+            num_busy -= 1;
+            num_busy += s_BlastAaExtendLaneLoad(&lanes, lane, candidates,
+                                                queue, &queue_head,
+                                                &queue_tail, subject->length,
+                                                query->length);
+        }
+        /* lanes left idle above may now find work queued by right
+           extensions */
+        for (lane = 0; lane < AA_EXTEND_LANES && queue_head < queue_tail;
+             lane++) {
+            if (lanes.work[lane] < 0) {
+                num_busy += s_BlastAaExtendLaneLoad(&lanes, lane, candidates,
+                                                    queue, &queue_head,
+                                                    &queue_tail,
+                                                    subject->length,
+                                                    query->length);
+            }
+        }
+    }
+
+    for (i = 0; i < num_candidates; i++) {
+        SAaExtendCandidate* c = candidates + i;
+        Int4 score = MAX(c->left_score, c->right_score);
+
+        /* if the hsp meets the score threshold, report it */
+        if (score >= c->cutoffs->cutoff_score)
+            BlastSaveInitHsp(ungapped_hsps, c->q_right_off - c->left_d,
+                             c->s_right_off - c->left_d, c->q_off, c->s_off,
+                             c->left_d + c->right_d, score);
+
+        /* the same diagonal bookkeeping as s_BlastAaWordFinder_TwoHit */
+        if (c->right_extend) {
+            diag_array[c->diag_coord].last_hit =
+                c->s_last_off - (word_size - 1) + diag_offset;
+        } else {
+            diag_array[c->diag_coord].flag = 0;
+            diag_array[c->diag_coord].last_hit = c->s_off + diag_offset;
+        }
+    }
+}
+
+#endif /* BLAST_AA_BATCH_EXTEND */
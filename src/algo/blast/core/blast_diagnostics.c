@@ -41,6 +41,8 @@ BlastDiagnostics* Blast_DiagnosticsFree(BlastDiagnostics* diagnostics)
       sfree(diagnostics->ungapped_stat);
       sfree(diagnostics->gapped_stat);
       sfree(diagnostics->cutoffs);
+      sfree(diagnostics->hsp_stream_stat);
+      sfree(diagnostics->stage_times);
       if (diagnostics->mt_lock)
          diagnostics->mt_lock = MT_LOCK_Delete(diagnostics->mt_lock);
       sfree(diagnostics);
@@ -73,6 +75,15 @@ BlastDiagnostics* Blast_DiagnosticsCopy(const BlastDiagnostics* diagnostics)
     } else {
       sfree(diagnostics->cutoffs);
     }
+    if (diagnostics->hsp_stream_stat) {
+        memcpy((void*)retval->hsp_stream_stat,
+               (void*)diagnostics->hsp_stream_stat,
+               sizeof(*retval->hsp_stream_stat));
+    }
+    if (diagnostics->stage_times) {
+        memcpy((void*)retval->stage_times, (void*)diagnostics->stage_times,
+               sizeof(*retval->stage_times));
+    }
     return retval;
 }
 
@@ -87,6 +98,10 @@ BlastDiagnostics* Blast_DiagnosticsInit()
       (BlastGappedStats*) calloc(1, sizeof(BlastGappedStats));
    diagnostics->cutoffs = 
       (BlastRawCutoffs*) calloc(1, sizeof(BlastRawCutoffs));
+   diagnostics->hsp_stream_stat = 
+      (BlastHSPStreamStats*) calloc(1, sizeof(BlastHSPStreamStats));
+   diagnostics->stage_times = 
+      (BlastStageTimes*) calloc(1, sizeof(BlastStageTimes));
 
    return diagnostics;
 }
@@ -147,6 +162,15 @@ Blast_DiagnosticsUpdate(BlastDiagnostics* global, BlastDiagnostics* local)
          local->gapped_stat->num_seqs_passed;
    }
 
+   if (global->hsp_stream_stat && local->hsp_stream_stat) {
+      global->hsp_stream_stat->hsp_lists_written += 
+         local->hsp_stream_stat->hsp_lists_written;
+      global->hsp_stream_stat->lock_acquisitions += 
+         local->hsp_stream_stat->lock_acquisitions;
+      global->hsp_stream_stat->lock_contentions += 
+         local->hsp_stream_stat->lock_contentions;
+   }
+
    if (global->cutoffs && local->cutoffs) {
       global->cutoffs->x_drop_ungapped = local->cutoffs->x_drop_ungapped;
       global->cutoffs->x_drop_gap = local->cutoffs->x_drop_gap;
@@ -78,6 +78,18 @@
 /** Converts nucleotide coordinates to protein */
 #define CONV_NUCL2PROT_COORDINATES(length) (length) / CODON_LENGTH
 
+/** Number of HSP lists a preliminary search thread collects before writing
+    them to a shared HSP stream */
+#define HSP_LIST_WRITE_BATCH_SIZE 64
+
+/** Nucleotide subjects up to this length are collected into batches and
+    scanned together. */
+#define SUBJECT_BATCH_MAX_LENGTH 2048
+/** Maximum number of subjects in a batch. */
+#define SUBJECT_BATCH_MAX_SUBJECTS 256
+/** Maximum total length of the subjects in a batch. */
+#define SUBJECT_BATCH_MAX_RESIDUES (1 << 17)
+
 NCBI_XBLAST_EXPORT const int   kBlastMajorVersion = 2;
 NCBI_XBLAST_EXPORT const int   kBlastMinorVersion = 13;
 NCBI_XBLAST_EXPORT const int   kBlastPatchVersion = 0;
@@ -105,6 +117,10 @@ typedef struct BlastCoreAuxStruct {
     Uint1* translation_table; /**< Translation table for forward strand */
     Uint1* translation_table_rc; /**< Translation table for reverse
                                      strand */
+    BlastNaSubjectBatch* subject_batch; /**< Short subjects scanned together,
+                                            or NULL if not batching */
+    Int4 batch_index; /**< Index in subject_batch of the subject being
+                          searched, or -1 */
 } BlastCoreAuxStruct;
 
 /** Deallocates all memory in BlastCoreAuxStruct */
@@ -115,6 +131,7 @@ s_BlastCoreAuxStructFree(BlastCoreAuxStruct* aux_struct)
     BLAST_InitHitListFree(aux_struct->init_hitlist);
     sfree(aux_struct->offset_pairs);
     MapperWordHitsFree(aux_struct->mapper_wordhits);
+    BlastNaSubjectBatchFree(aux_struct->subject_batch);
 
     sfree(aux_struct);
     return NULL;
@@ -491,7 +508,17 @@ s_BlastSearchEngineOneContext(EBlastProgramType program_number,
 
         BlastInitHitListReset(init_hitlist);
 
-        if (aux_struct->WordFinder) {
+        if (aux_struct->batch_index >= 0) {
+            /* The subject was scanned with the rest of its batch */
+            BlastNaWordFinderBatch(subject, query, query_info, lookup, matrix,
+                                   word_params, aux_struct->ewp,
+                                   aux_struct->subject_batch,
+                                   aux_struct->batch_index,
+                                   init_hitlist, ungapped_stats);
+
+            if (init_hitlist->total == 0) continue;
+        }
+        else if (aux_struct->WordFinder) {
             aux_struct->WordFinder(subject, query, query_info, lookup, matrix,
                                    word_params, aux_struct->ewp,
                                    aux_struct->offset_pairs,
@@ -1006,6 +1033,7 @@ s_BlastSetUpAuxStructures(const BlastSeqSrc* seq_src,
 
     aux_struct->JumperGapped = NULL;
     aux_struct->mapper_wordhits = NULL;
+    aux_struct->batch_index = -1;
 
     if (smith_waterman) {
         aux_struct->WordFinder = NULL;
@@ -1316,6 +1344,31 @@ s_AdjustSubjectForSraSearch(BlastHSPList* hsp_list, Uint1 offset )
 }
 
 
+/** Write the HSP lists collected by a preliminary search thread to the HSP
+ * stream, and free any lists that could not be written.
+ * @param hsp_stream HSP stream to write to [in] [out]
+ * @param hsp_list_batch Collected HSP lists [in] [out]
+ * @param num_batched Number of lists in hsp_list_batch, set to 0 on
+ *                    return [in] [out]
+ * @param stats HSP stream write counts [in] [out]
+ * @return Status of BlastHSPStreamBatchWrite
+ */
+static Int2
+s_BlastHSPListBatchFlush(BlastHSPStream* hsp_stream,
+                         BlastHSPList** hsp_list_batch, Int4* num_batched,
+                         BlastHSPStreamStats* stats)
+{
+    Int4 index;
+    Int2 status = BlastHSPStreamBatchWrite(hsp_stream, hsp_list_batch,
+                                           *num_batched, stats);
+
+    for (index = 0; index < *num_batched; index++) {
+        hsp_list_batch[index] = Blast_HSPListFree(hsp_list_batch[index]);
+    }
+    *num_batched = 0;
+    return status;
+}
+
 static Int4 s_GetMinimumSubjSeqLen(LookupTableWrap* lookup_wrap)
 {
     Int4 word_length = 1;
@@ -1331,6 +1384,135 @@ static Int4 s_GetMinimumSubjSeqLen(LookupTableWrap* lookup_wrap)
     return word_length * 3 + 2;
 }
 
+/** Save the HSP list of one subject sequence to the HSP stream, either
+ * directly or through the calling thread's batch of HSP lists.
+ * @param hsp_stream The HSP stream [in]
+ * @param hsp_list_ptr The HSP list; set to NULL once saved [in] [out]
+ * @param batch_writes Whether HSP lists are written in batches [in]
+ * @param hsp_list_batch HSP lists held by this thread [in] [out]
+ * @param num_batched Number of HSP lists in hsp_list_batch [in] [out]
+ * @param stats HSP stream counters to update [in] [out]
+ * @return Status of BlastHSPStreamBatchWrite
+ */
+static Int2
+s_BlastSaveHSPList(BlastHSPStream* hsp_stream, BlastHSPList** hsp_list_ptr,
+                   Boolean batch_writes, BlastHSPList** hsp_list_batch,
+                   Int4* num_batched, BlastHSPStreamStats* stats)
+{
+    if (batch_writes) {
+        hsp_list_batch[(*num_batched)++] = *hsp_list_ptr;
+        *hsp_list_ptr = NULL;
+        if (*num_batched == HSP_LIST_WRITE_BATCH_SIZE) {
+            return s_BlastHSPListBatchFlush(hsp_stream, hsp_list_batch,
+                                            num_batched, stats);
+        }
+        return 0;
+    }
+    return BlastHSPStreamBatchWrite(hsp_stream, hsp_list_ptr, 1, stats);
+}
+
+/** Raise the per-query score thresholds after results have been saved.
+ * @param hit_params Hit saving parameters holding the thresholds [in] [out]
+ * @param hsp_stream The HSP stream holding the results so far [in]
+ */
+static void
+s_BlastUpdateLowScore(BlastHitSavingParameters* hit_params,
+                      const BlastHSPStream* hsp_stream)
+{
+    int query_index;
+
+    if (!hit_params->low_score)
+        return;
+
+    for (query_index=0; query_index<hsp_stream->results->num_queries; query_index++)
+        if (hsp_stream->results->hitlist_array[query_index] && hsp_stream->results->hitlist_array[query_index]->heapified)
+            hit_params->low_score[query_index] =
+                MAX(hit_params->low_score[query_index],
+                    hit_params->options->low_score_perc*(hsp_stream->results->hitlist_array[query_index]->low_score));
+}
+
+/** Search the subjects collected in the subject batch of the auxiliary
+ * structures. The lookup table is scanned for all of them in one pass;
+ * then each subject with word hits goes through the rest of the
+ * preliminary search exactly as if it had been searched on its own.
+ * The batch is empty on return.
+ * @return 0 on success, or the first nonzero status of the search
+ */
+static Int2
+s_BlastSearchSubjectBatch(EBlastProgramType program_number,
+    BLAST_SequenceBlk* query, BlastQueryInfo* query_info,
+    LookupTableWrap* lookup_wrap, BlastGapAlignStruct* gap_align,
+    const BlastScoringParameters* score_params,
+    const BlastInitialWordParameters* word_params,
+    const BlastExtensionParameters* ext_params,
+    BlastHitSavingParameters* hit_params,
+    const BlastDatabaseOptions* db_options,
+    BlastDiagnostics* diagnostics, BlastCoreAuxStruct* aux_struct,
+    BlastHSPStream* hsp_stream, Boolean batch_writes,
+    BlastHSPList** hsp_list_batch, Int4* num_batched,
+    TInterruptFnPtr interrupt_search, SBlastProgress* progress_info)
+{
+    BlastNaSubjectBatch* batch = aux_struct->subject_batch;
+    BlastHSPStreamStats* stream_stats =
+        diagnostics ? diagnostics->hsp_stream_stat : NULL;
+    Int2 status = 0;
+    Int4 index;
+
+    if (batch->num_subjects == 0)
+        return 0;
+
+    if (BlastNaSubjectBatchScan(batch, lookup_wrap, aux_struct->offset_pairs,
+                                GetOffsetArraySize(lookup_wrap)) != 0) {
+        BlastNaSubjectBatchReset(batch);
+        return BLASTERR_MEMORY;
+    }
+
+    for (index = 0; index < batch->num_subjects; index++) {
+        BLAST_SequenceBlk subject;
+        BlastHSPList* hsp_list = NULL;
+
+        BlastNaSubjectBatchGetSubject(batch, index, &subject);
+
+        if (batch->hit_starts[index] == batch->hit_starts[index + 1]) {
+            /* Without word hits nothing can be found; only advance the
+               diagonal bookkeeping as the word finder would have */
+            Blast_ExtendWordExit(aux_struct->ewp, subject.length);
+        } else {
+            aux_struct->batch_index = index;
+            status = s_BlastSearchEngineCore(program_number, query,
+                                             query_info, &subject,
+                                             lookup_wrap, gap_align,
+                                             score_params, word_params,
+                                             ext_params, hit_params,
+                                             db_options, diagnostics,
+                                             aux_struct, &hsp_list,
+                                             interrupt_search, progress_info);
+            aux_struct->batch_index = -1;
+            if (status)
+                break;
+
+            if (hsp_list && hsp_list->hspcnt > 0) {
+                status = s_BlastSaveHSPList(hsp_stream, &hsp_list,
+                                            batch_writes, hsp_list_batch,
+                                            num_batched, stream_stats);
+                if (status)
+                    break;
+                s_BlastUpdateLowScore(hit_params, hsp_stream);
+            }
+            hsp_list = Blast_HSPListFree(hsp_list);
+        }
+
+        /* check for interrupt */
+        if (interrupt_search && (*interrupt_search)(progress_info) == TRUE) {
+            status = BLASTERR_INTERRUPTED;
+            break;
+        }
+    }
+
+    BlastNaSubjectBatchReset(batch);
+    return status;
+}
+
 
 Int4
 BLAST_PreliminarySearchEngine(EBlastProgramType program_number,
@@ -1361,6 +1543,17 @@ BLAST_PreliminarySearchEngine(EBlastProgramType program_number,
     BlastScoreBlk* sbp = gap_align->sbp;
     BlastSeqSrcIterator* itr;
     const Boolean kNucleotide = Blast_ProgramIsNucleotide(program_number);
+    BlastHSPStreamStats* stream_stats =
+        diagnostics ? diagnostics->hsp_stream_stat : NULL;
+    /* When the HSP stream is shared with other threads, HSP lists are
+       collected locally and written in batches, so that the stream lock is
+       taken once per batch rather than once per subject sequence. Mapping
+       searches read the stream back after every write, so they write each
+       list immediately. */
+    const Boolean kBatchWrites = hsp_stream && hsp_stream->x_lock &&
+        !Blast_ProgramIsMapping(program_number);
+    BlastHSPList* hsp_list_batch[HSP_LIST_WRITE_BATCH_SIZE];
+    Int4 num_batched = 0;
 
     T_MB_IdbCheckOid check_index_oid =
         (T_MB_IdbCheckOid)lookup_wrap->check_index_oid;
@@ -1407,6 +1600,20 @@ BLAST_PreliminarySearchEngine(EBlastProgramType program_number,
 
     db_length = BlastSeqSrcGetTotLen(seq_src);
 
+    /* Short subjects of gapped blastn database searches are collected into
+       batches, so that the lookup table is scanned for many of them in one
+       pass and subjects without word hits cost no further per-subject
+       set up. */
+    if (program_number == eBlastTypeBlastn && gapped_calculation &&
+        db_length > 0 && check_index_oid == 0 &&
+        aux_struct->WordFinder == BlastNaWordFinder &&
+        !hit_params->link_hsp_params &&
+        BlastSeqSrcGetMinSeqLen(seq_src) <= SUBJECT_BATCH_MAX_LENGTH) {
+        aux_struct->subject_batch =
+            BlastNaSubjectBatchNew(SUBJECT_BATCH_MAX_SUBJECTS,
+                                   SUBJECT_BATCH_MAX_RESIDUES);
+    }
+
     itr = BlastSeqSrcIteratorNewEx(MAX(BlastSeqSrcGetNumSeqs(seq_src)/100,1));
 
     /* iterate over all subject sequences */
@@ -1444,6 +1651,45 @@ BLAST_PreliminarySearchEngine(EBlastProgramType program_number,
               return status;
       }
 
+      if (aux_struct->subject_batch) {
+          BLAST_SequenceBlk* subject = seq_arg.seq;
+          if (subject->length <= SUBJECT_BATCH_MAX_LENGTH &&
+              subject->mask_type == eNoSubjMasking &&
+              subject->bases_offset == 0) {
+              if (!BlastNaSubjectBatchAdd(aux_struct->subject_batch,
+                                          subject)) {
+                  /* The batch is full: search it, then start a new one */
+                  status = s_BlastSearchSubjectBatch(program_number, query,
+                               query_info, lookup_wrap, gap_align,
+                               score_params, word_params, ext_params,
+                               hit_params, db_options, diagnostics,
+                               aux_struct, hsp_stream, kBatchWrites,
+                               hsp_list_batch, &num_batched,
+                               interrupt_search, progress_info);
+                  if (status == 0)
+                      BlastNaSubjectBatchAdd(aux_struct->subject_batch,
+                                             subject);
+              }
+              BlastSeqSrcReleaseSequence(seq_src, &seq_arg);
+              if (status)
+                  break;
+              continue;
+          }
+
+          /* Keep subjects in database order: search the batched ones
+             before this one */
+          status = s_BlastSearchSubjectBatch(program_number, query,
+                       query_info, lookup_wrap, gap_align, score_params,
+                       word_params, ext_params, hit_params, db_options,
+                       diagnostics, aux_struct, hsp_stream, kBatchWrites,
+                       hsp_list_batch, &num_batched, interrupt_search,
+                       progress_info);
+          if (status) {
+              BlastSeqSrcReleaseSequence(seq_src, &seq_arg);
+              break;
+          }
+      }
+
       stat_length = seq_arg.seq->length;
 
       /* Calculate cutoff scores for linking HSPs. Do this only for
@@ -1479,7 +1725,6 @@ BLAST_PreliminarySearchEngine(EBlastProgramType program_number,
       }
 
       if (hsp_list && hsp_list->hspcnt > 0) {
-         int query_index=0; /* Used to loop over queries below. */
          if (!gapped_calculation) {
         	 if(seq_arg.seq->bases_offset > 0)
         	 {
@@ -1552,7 +1797,9 @@ BLAST_PreliminarySearchEngine(EBlastProgramType program_number,
          }
 
          /* Save the results. */
-         status = BlastHSPStreamWrite(hsp_stream, &hsp_list);
+         status = s_BlastSaveHSPList(hsp_stream, &hsp_list, kBatchWrites,
+                                     hsp_list_batch, &num_batched,
+                                     stream_stats);
          if (status != 0)
             break;
 
@@ -1565,14 +1812,7 @@ BLAST_PreliminarySearchEngine(EBlastProgramType program_number,
                               hit_params, hsp_stream);
          }
 
-         if (hit_params->low_score)
-         {
- 	    for (query_index=0; query_index<hsp_stream->results->num_queries; query_index++)
-              if (hsp_stream->results->hitlist_array[query_index] && hsp_stream->results->hitlist_array[query_index]->heapified)
-                   hit_params->low_score[query_index] =
-			MAX(hit_params->low_score[query_index],
-                           hit_params->options->low_score_perc*(hsp_stream->results->hitlist_array[query_index]->low_score));
-         }
+         s_BlastUpdateLowScore(hit_params, hsp_stream);
       }
 
       BlastSeqSrcReleaseSequence(seq_src, &seq_arg);
@@ -1584,6 +1824,15 @@ BLAST_PreliminarySearchEngine(EBlastProgramType program_number,
       }
     }
 
+    /* Search the subjects still held in the subject batch */
+    if (status == 0 && aux_struct->subject_batch) {
+        status = s_BlastSearchSubjectBatch(program_number, query, query_info,
+                     lookup_wrap, gap_align, score_params, word_params,
+                     ext_params, hit_params, db_options, diagnostics,
+                     aux_struct, hsp_stream, kBatchWrites, hsp_list_batch,
+                     &num_batched, interrupt_search, progress_info);
+    }
+
     /* Tell the indexing library that this thread is done with
        preliminary search.
     */
@@ -1592,6 +1841,16 @@ BLAST_PreliminarySearchEngine(EBlastProgramType program_number,
             lookup_wrap->end_search_indication))( last_vol_idx );
     }
 
+    /* Write the HSP lists still held by this thread */
+    if (num_batched > 0) {
+        Int2 flush_status = s_BlastHSPListBatchFlush(hsp_stream,
+                                                     hsp_list_batch,
+                                                     &num_batched,
+                                                     stream_stats);
+        if (status == 0)
+            status = flush_status;
+    }
+
     hsp_list = Blast_HSPListFree(hsp_list);  /* in case we were interrupted */
     BlastSequenceBlkFree(seq_arg.seq);
     itr = BlastSeqSrcIteratorFree(itr);
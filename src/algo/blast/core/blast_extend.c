@@ -208,6 +208,7 @@ Blast_ExtendWord *BlastExtendWordFree(Blast_ExtendWord * ewp)
 
     s_BlastDiagTableFree(ewp->diag_table);
     s_BlastDiagHashFree(ewp->hash_table);
+    sfree(ewp->aa_profile);
     sfree(ewp);
     return NULL;
 }
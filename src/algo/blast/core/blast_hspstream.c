@@ -330,29 +330,43 @@ int BlastHSPStreamRead(BlastHSPStream* hsp_stream, BlastHSPList** hsp_list_out)
    return kBlastHSPStream_Success;
 }
 
-/** Write an HSP list to the collector HSP stream. The HSP stream assumes
- * ownership of the HSP list and sets the dereferenced pointer to NULL.
+/** Acquire the HSP stream lock, if there is one.
+ * @param hsp_stream Stream to lock [in]
+ * @param stats If not NULL, counts the acquisition, and whether it had to
+ * wait for another thread [in] [out]
+ */
+static void s_HSPStreamLock(BlastHSPStream* hsp_stream,
+                            BlastHSPStreamStats* stats)
+{
+   if (!hsp_stream->x_lock)
+      return;
+
+   if (stats) {
+      ++stats->lock_acquisitions;
+      if (MT_LOCK_Do(hsp_stream->x_lock, eMT_TryLock) > 0)
+         return;
+      ++stats->lock_contentions;
+   }
+   MT_LOCK_Do(hsp_stream->x_lock, eMT_Lock);
+}
+
+/** Pass one HSP list to the writer. Must be called with the stream lock
+ * held.
  * @param hsp_stream Stream to write to. [in] [out]
  * @param hsp_list Pointer to the HSP list to save in the collector. [in]
  * @return Success or error, if stream is already closed for writing.
  */
-int BlastHSPStreamWrite(BlastHSPStream* hsp_stream, BlastHSPList** hsp_list)
+static int s_HSPStreamWriteLocked(BlastHSPStream* hsp_stream,
+                                  BlastHSPList** hsp_list)
 {
    Int2 status = 0;
 
-   if (!hsp_stream)
-      return kBlastHSPStream_Error;
-
-   /** Lock the mutex, if necessary */
-   MT_LOCK_Do(hsp_stream->x_lock, eMT_Lock);
-
    /** Prohibit writing after reading has already started. This prohibition
     *  can be lifted later. There is no inherent problem in using read and
     *  write in any order, except that sorting would have to be done on
     *  every read after a write.
     */
    if (hsp_stream->results_sorted) {
-      MT_LOCK_Do(hsp_stream->x_lock, eMT_Unlock);
       return kBlastHSPStream_Error;
    }
 
@@ -370,7 +384,6 @@ int BlastHSPStreamWrite(BlastHSPStream* hsp_stream, BlastHSPList** hsp_list)
    }
 
    if (status != 0) {
-      MT_LOCK_Do(hsp_stream->x_lock, eMT_Unlock);
       return kBlastHSPStream_Error;
    }
    /* Results structure is no longer sorted, even if it was before.
@@ -381,10 +394,46 @@ int BlastHSPStreamWrite(BlastHSPStream* hsp_stream, BlastHSPList** hsp_list)
    /* Free the caller from this pointer's ownership. */
    *hsp_list = NULL;
 
+   return kBlastHSPStream_Success;
+}
+
+/** Write an HSP list to the collector HSP stream. The HSP stream assumes
+ * ownership of the HSP list and sets the dereferenced pointer to NULL.
+ * @param hsp_stream Stream to write to. [in] [out]
+ * @param hsp_list Pointer to the HSP list to save in the collector. [in]
+ * @return Success or error, if stream is already closed for writing.
+ */
+int BlastHSPStreamWrite(BlastHSPStream* hsp_stream, BlastHSPList** hsp_list)
+{
+   return BlastHSPStreamBatchWrite(hsp_stream, hsp_list, 1, NULL);
+}
+
+int BlastHSPStreamBatchWrite(BlastHSPStream* hsp_stream,
+                             BlastHSPList** hsp_lists, Int4 num_hsp_lists,
+                             BlastHSPStreamStats* stats)
+{
+   Int4 index;
+   int status = kBlastHSPStream_Success;
+
+   if (!hsp_stream)
+      return kBlastHSPStream_Error;
+
+   /** Lock the mutex, if necessary */
+   s_HSPStreamLock(hsp_stream, stats);
+
+   for (index = 0; index < num_hsp_lists; index++) {
+      status = s_HSPStreamWriteLocked(hsp_stream, &hsp_lists[index]);
+      if (status != kBlastHSPStream_Success)
+         break;
+   }
+
    /** Unlock the mutex */
    MT_LOCK_Do(hsp_stream->x_lock, eMT_Unlock);
 
-   return kBlastHSPStream_Success;
+   if (stats)
+      stats->hsp_lists_written += index;
+
+   return status;
 }
 
 /* #define _DEBUG_VERBOSE 1 */
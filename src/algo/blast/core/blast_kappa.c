@@ -42,6 +42,7 @@
 #include <algo/blast/core/blast_traceback.h>
 #include <algo/blast/core/link_hsps.h>
 #include <algo/blast/core/gencode_singleton.h>
+#include <algo/blast/core/blast_sw.h>
 #include "blast_psi_priv.h"
 #include "blast_gapalign_priv.h"
 #include "blast_hits_priv.h"
@@ -675,6 +676,10 @@ s_GetStartFreqRatios(double ** returnRatios,
  * -(BLAST_SCORE_MIN) */
 #define SCALING_FACTOR 32
 
+/** Number of composition-adjusted score matrices each thread keeps for
+ * reuse (@sa Blast_CompositionWorkspaceInitMatrixCache) */
+#define ADJUSTED_MATRIX_CACHE_SIZE 32
+
 
 /**
  * Produce a scaled-up version of the position-specific matrix
@@ -2386,11 +2391,35 @@ s_GappingParamsNew(BlastKappa_GappingParamsContext * context,
 }
 
 
+/**
+ * Compute the score and end of a Smith-Waterman alignment with the
+ * striped kernel of blast_sw.c, when this build has it. Conforms to
+ * the interface of sw_score_only_type.
+ */
+static int
+s_SmithWatermanScoreOnly(int *score, int *matchSeqEnd, int *queryEnd,
+                         const Uint1 * subject_data, int subject_length,
+                         const Uint1 * query_data, int query_length,
+                         int **matrix, int alphsize, int gapOpen,
+                         int gapExtend, int positionSpecific)
+{
+    if (alphsize != BLASTAA_SIZE) {
+        return -1;
+    }
+    *score = SmithWatermanScoreOnlyStriped(query_data, query_length,
+                                           subject_data, subject_length,
+                                           gapOpen, gapExtend, matrix,
+                                           (Boolean) positionSpecific,
+                                           queryEnd, matchSeqEnd);
+    return *score < 0 ? -1 : 0;
+}
+
+
 /** Callbacks used by the Blast_RedoOneMatch* routines */
 static const Blast_RedoAlignCallbacks
 redo_align_callbacks = {
     s_CalcLambda, s_SequenceGetRange, s_RedoOneAlignment,
-    s_NewAlignmentUsingXdrop, s_FreeEditScript
+    s_NewAlignmentUsingXdrop, s_FreeEditScript, s_SmithWatermanScoreOnly
 };
 
 
@@ -3321,6 +3350,14 @@ Blast_RedoAlignmentCore_MT(EBlastProgramType program_number,
             if (status_code != 0) {
                 goto function_cleanup;
             }
+            status_code = Blast_CompositionWorkspaceInitMatrixCache(
+                    NRrecord_tld[i],
+                    ADJUSTED_MATRIX_CACHE_SIZE,
+                    BLASTAA_SIZE
+            );
+            if (status_code != 0) {
+                goto function_cleanup;
+            }
         }
 
         gapping_params_context_tld[i].gap_align = gap_align_tld[i];
@@ -3431,7 +3468,15 @@ Blast_RedoAlignmentCore_MT(EBlastProgramType program_number,
     status_code_tld)
     {
         int b;
-#pragma omp for schedule(static)
+        /* Matches are sorted by e-value, so a static partition in blocks
+         * would give the first thread all of the best ones; deal them out
+         * round robin instead, which balances the load and lets every
+         * thread's heap fill up early enough for
+         * BlastCompo_EarlyTermination to take effect.  The schedule must
+         * not depend on timing: which matches a thread's heap terminates
+         * early depends on the matches it was given, and a dynamic
+         * schedule would make the hit list vary from run to run. */
+#pragma omp for schedule(static, 1)
         for (b = 0; b < numMatches; ++b) {
 #pragma omp flush(interrupt)
             if (!interrupt) {
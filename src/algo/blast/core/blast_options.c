@@ -1553,6 +1553,7 @@ Int2 PSIBlastOptionsNew(PSIBlastOptions** psi_options)
    options->nsg_compatibility_mode = FALSE;
    options->impala_scaling_factor = kPSSM_NoImpalaScaling;
    options->ignore_unaligned_positions = FALSE;
+   options->num_threads = 1;
    
    return 0;
 }
@@ -114,17 +114,21 @@ PSICreatePssmWithDiagnostics(const PSIMsa* msap,                    /* [in] */
     _PSISequenceWeights* seq_weights = NULL; 
     _PSIInternalPssmData* internal_pssm = NULL;
     _PSIPackedMsa* packed_msa = NULL;
+    Uint4 num_threads = 1;
     int status = 0;
 
     if ( !msap || !options || !sbp || !pssm ) {
         return PSIERR_BADPARAM;
     }
+    if (options->num_threads > 1) {
+        num_threads = (Uint4) options->num_threads;
+    }
 
     packed_msa = _PSIPackedMsaNew(msap);
 
     /*** Run the engine's stages ***/
 
-    status = _PSIPurgeBiasedSegments(packed_msa);
+    status = _PSIPurgeBiasedSegments(packed_msa, num_threads);
     if (status != PSI_SUCCESS) {
         s_PSICreatePssmCleanUp(pssm, packed_msa, msa, aligned_block, 
                                seq_weights, internal_pssm);
@@ -169,7 +173,7 @@ PSICreatePssmWithDiagnostics(const PSIMsa* msap,                    /* [in] */
 
     status = _PSIComputeSequenceWeights(msa, aligned_block, 
                                         options->nsg_compatibility_mode,
-                                        seq_weights);
+                                        num_threads, seq_weights);
     if (status != PSI_SUCCESS) {
         s_PSICreatePssmCleanUp(pssm, packed_msa, msa, aligned_block, 
                                seq_weights, internal_pssm);
@@ -179,7 +183,7 @@ PSICreatePssmWithDiagnostics(const PSIMsa* msap,                    /* [in] */
     status = _PSIComputeFreqRatios(msa, seq_weights, sbp, aligned_block, 
                                    options->pseudo_count, 
                                    options->nsg_compatibility_mode,
-                                   internal_pssm);
+                                   num_threads, internal_pssm);
     if (status != PSI_SUCCESS) {
         s_PSICreatePssmCleanUp(pssm, packed_msa, msa, aligned_block, 
                                seq_weights, internal_pssm);
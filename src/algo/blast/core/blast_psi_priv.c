@@ -40,6 +40,10 @@
 
 #include <algo/blast/composition_adjustment/matrix_frequency_data.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 /****************************************************************************/
 /* Use the following #define's to enable/disable functionality */
 
@@ -913,16 +917,23 @@ _PSIValidateCdMSA(const PSICdMsa* cd_msa, Uint4 alphabet_size)
 
 /** Remove those sequences which are identical to the query sequence 
  * @param msa multiple sequence alignment data structure [in]
+ * @param extents aligned extents of each sequence [in]
+ * @param num_threads number of threads to use [in]
  */
 static void
-s_PSIPurgeSelfHits(_PSIPackedMsa* msa);
+s_PSIPurgeSelfHits(_PSIPackedMsa* msa, const SSeqRange* extents,
+                   Uint4 num_threads);
 
 /** Keeps only one copy of any aligned sequences which are >kPSINearIdentical%
  * identical to one another
  * @param msa multiple sequence alignment data structure [in]
+ * @param extents aligned extents of each sequence [in]
+ * @param num_threads number of threads to use [in]
  */
 static void
-s_PSIPurgeNearIdenticalAlignments(_PSIPackedMsa* msa);
+s_PSIPurgeNearIdenticalAlignments(_PSIPackedMsa* msa,
+                                  const SSeqRange* extents,
+                                  Uint4 num_threads);
 
 /** This function compares the sequences in the msa->cell
  * structure indexed by sequence_index1 and seq_index2. If it finds aligned 
@@ -930,6 +941,9 @@ s_PSIPurgeNearIdenticalAlignments(_PSIPackedMsa* msa);
  * it removes the sequence identified by seq_index2.
  * FIXME: needs more descriptive name 
  * @param msa multiple sequence alignment data structure [in]
+ * @param extents first and last aligned positions of each sequence in the
+ * multiple sequence alignment before any purging; positions outside of these
+ * are not examined [in]
  * @param seq_index1 index of the sequence of interest [in]
  * @param seq_index2 index of the sequence of interest [in]
  * @param max_percent_identity percent identity needed to drop sequence
@@ -938,6 +952,7 @@ s_PSIPurgeNearIdenticalAlignments(_PSIPackedMsa* msa);
  */
 static void
 s_PSIPurgeSimilarAlignments(_PSIPackedMsa* msa,
+                            const SSeqRange* extents,
                             Uint4 seq_index1,
                             Uint4 seq_index2,
                             double max_percent_identity);
@@ -945,44 +960,101 @@ s_PSIPurgeSimilarAlignments(_PSIPackedMsa* msa,
 
 /**************** PurgeMatches stage of PSSM creation ***********************/
 int
-_PSIPurgeBiasedSegments(_PSIPackedMsa* msa)
+_PSIPurgeBiasedSegments(_PSIPackedMsa* msa, Uint4 num_threads)
 {
+    SSeqRange* extents = NULL;  /* aligned extents of each sequence */
+    Uint4 s = 0;                /* index on sequences */
+
     if ( !msa ) {
         return PSIERR_BADPARAM;
     }
+    if (num_threads == 0) {
+        num_threads = 1;
+    }
+
+    extents = (SSeqRange*) malloc((msa->dimensions->num_seqs + 1) *
+                                  sizeof(SSeqRange));
+    if ( !extents ) {
+        return PSIERR_OUTOFMEM;
+    }
+    for (s = 0; s < msa->dimensions->num_seqs + 1; s++) {
+        const _PSIPackedMsaCell* kCells = msa->data[s];
+        Int4 left = 0;
+        Int4 right = (Int4) msa->dimensions->query_length - 1;
+
+        while (left <= right && !kCells[left].is_aligned) {
+            left++;
+        }
+        while (right >= left && !kCells[right].is_aligned) {
+            right--;
+        }
+        extents[s].left = left;
+        extents[s].right = right;
+    }
 
-    s_PSIPurgeSelfHits(msa);
-    s_PSIPurgeNearIdenticalAlignments(msa);
+    s_PSIPurgeSelfHits(msa, extents, num_threads);
+    s_PSIPurgeNearIdenticalAlignments(msa, extents, num_threads);
 
+    sfree(extents);
     return PSI_SUCCESS;
 }
 
 static void
-s_PSIPurgeSelfHits(_PSIPackedMsa* msa)
+s_PSIPurgeSelfHits(_PSIPackedMsa* msa, const SSeqRange* extents,
+                   Uint4 num_threads)
 {
-    Uint4 s = 0;        /* index on sequences */
+    const int kNumSeqs = (int) msa->dimensions->num_seqs;
+    int s = 0;          /* index on sequences */
 
     ASSERT(msa);
 
-    for (s = kQueryIndex + 1; s < msa->dimensions->num_seqs + 1; s++) {
-        s_PSIPurgeSimilarAlignments(msa, kQueryIndex, s, kPSIIdentical);
+    /* Each comparison can only purge sequence s */
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads) if(num_threads > 1) \
+        schedule(dynamic, 16)
+#endif
+    for (s = kQueryIndex + 1; s <= kNumSeqs; s++) {
+        s_PSIPurgeSimilarAlignments(msa, extents, kQueryIndex, (Uint4) s,
+                                    kPSIIdentical);
     }
 }
 
 static void
-s_PSIPurgeNearIdenticalAlignments(_PSIPackedMsa* msa)
+s_PSIPurgeNearIdenticalAlignments(_PSIPackedMsa* msa,
+                                  const SSeqRange* extents,
+                                  Uint4 num_threads)
 {
-    Uint4 i = 0;
-    Uint4 j = 0;
+    const int kNumSeqs = (int) msa->dimensions->num_seqs;
 
     ASSERT(msa);
 
-    for (i = 1; i < msa->dimensions->num_seqs + 1; i++) { 
-        for (j = 1; (i + j) < msa->dimensions->num_seqs + 1; j++) {
-            /* N.B.: The order of comparison of sequence pairs is deliberate,
-             * tests on real data indicated that this approach allowed more
-             * sequences to be purged */
-            s_PSIPurgeSimilarAlignments(msa, j, (i + j), kPSINearIdentical);
+    /* N.B.: The order of comparison of sequence pairs is deliberate,
+     * tests on real data indicated that this approach allowed more
+     * sequences to be purged: pairs (j, i+j) are compared in order of
+     * increasing distance i. As such a comparison can only purge sequence
+     * i+j, the pairs at a given distance form independent chains of
+     * sequences congruent modulo i. The chains are processed concurrently,
+     * each in the original order, so that the sequences purged do not
+     * depend on the number of threads. */
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_threads) if(num_threads > 1)
+#endif
+    {
+        int i = 0;      /* distance between the sequences compared */
+        int first = 0;  /* first sequence of a chain */
+        int j = 0;
+
+        for (i = 1; i < kNumSeqs; i++) {
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+            for (first = 1; first <= MIN(i, kNumSeqs - i); first++) {
+                for (j = first; (i + j) <= kNumSeqs; j += i) {
+                    s_PSIPurgeSimilarAlignments(msa, extents, (Uint4) j,
+                                                (Uint4) (i + j),
+                                                kPSINearIdentical);
+                }
+            }
         }
     }
 }
@@ -1184,6 +1256,7 @@ _handleEitherAlignedNeitherX(_PSIAlignmentTraits* traits,
 
 static void
 s_PSIPurgeSimilarAlignments(_PSIPackedMsa* msa,
+                            const SSeqRange* extents,
                             Uint4 seq_index1,
                             Uint4 seq_index2,
                             double max_percent_identity)
@@ -1192,7 +1265,10 @@ s_PSIPurgeSimilarAlignments(_PSIPackedMsa* msa,
     const Uint1 kXResidue = AMINOACID_TO_NCBISTDAA['X'];
     _EPSIPurgeFsmState state = eCounting;   /* initial state of the fsm */
     _PSIAlignmentTraits traits;
-    const Uint4 kQueryLength = msa->dimensions->query_length;
+    const SSeqRange* kExtent1 = &extents[seq_index1];
+    const SSeqRange* kExtent2 = &extents[seq_index2];
+    Int4 first = 0;                 /* first position examined */
+    Int4 last = 0;                  /* last position examined */
     _PSIPackedMsaCell* seq1 = 0;    /* array of cells for sequence 1 in MSA */
     _PSIPackedMsaCell* seq2 = 0;    /* array of cells for sequence 2 in MSA */
     Uint4 p = 0;                    /* position on alignment */
@@ -1205,13 +1281,36 @@ s_PSIPurgeSimilarAlignments(_PSIPackedMsa* msa,
         return;
     }
 
-    _PSIResetAlignmentTraits(&traits, p);
-    seq1 = msa->data[seq_index1];
-    seq2 = msa->data[seq_index2];
+    /* Identical residues are only counted where both sequences are aligned,
+     * so nothing can be purged if their extents do not overlap */
+    if (max_percent_identity > 0.0 &&
+        MAX(kExtent1->left, kExtent2->left) > 
+        MIN(kExtent1->right, kExtent2->right)) {
+        return;
+    }
+
+    /* Positions where neither sequence is aligned only close the region
+     * being examined, so those before the first and after the last aligned
+     * position are skipped. Skipping leading positions leaves the fsm
+     * resting, as examining them would have. */
+    if (seq_index1 == kQueryIndex) {
+        first = kExtent2->left;
+        last = kExtent2->right;
+    } else {
+        first = MIN(kExtent1->left, kExtent2->left);
+        last = MAX(kExtent1->right, kExtent2->right);
+    }
+    if (first > 0) {
+        state = eResting;
+    }
+
+    _PSIResetAlignmentTraits(&traits, (Uint4) first);
+    seq1 = msa->data[seq_index1] + first;
+    seq2 = msa->data[seq_index2] + first;
 
     /* Examine each position of the aligned sequences and use the fsm to
      * determine if a region of the alignment should be purged */
-    for (p = 0; p < kQueryLength; p++, seq1++, seq2++) {
+    for (p = (Uint4) first; (Int4) p <= last; p++, seq1++, seq2++) {
 
         /* Indicates if the position in seq_index1 currently being examined is 
          * aligned. In the special case for seq_index1 == kQueryIndex, this 
@@ -1490,6 +1589,10 @@ _PSIGetAlignedSequencesForPosition(
  * @param aligned_seqs array containing the indices of the sequences 
  * participating in the multiple sequence alignment at the requested 
  * position [in]
+ * @param norm_seq_weights normalized sequence weights for the requested
+ * position, array of length num_seqs + 1 [out]
+ * @param row_sigma array of length num_seqs + 1, must be zeroed by the
+ * caller [in|out]
  * @param seq_weights sequence weights data structure [out]
  */
 static void
@@ -1498,6 +1601,8 @@ _PSICalculateNormalizedSequenceWeights(
     const _PSIAlignedBlock* aligned_blocks,
     Uint4 position,
     const SDynamicUint4Array* aligned_seqs,
+    double* norm_seq_weights,
+    double* row_sigma,
     _PSISequenceWeights* seq_weights);
 
 /** Calculate the weighted observed sequence weights
@@ -1507,6 +1612,8 @@ _PSICalculateNormalizedSequenceWeights(
  * @param aligned_seqs array containing the indices of the sequences 
  * participating in the multiple sequence alignment at the requested 
  * position [in]
+ * @param norm_seq_weights normalized sequence weights for the requested
+ * position [in]
  * @param seq_weights sequence weights data structure [in|out]
  */
 static void
@@ -1514,6 +1621,7 @@ _PSICalculateMatchWeights(
     const _PSIMsa* msa,
     Uint4 position,
     const SDynamicUint4Array* aligned_seqs,
+    const double* norm_seq_weights,
     _PSISequenceWeights* seq_weights);
 
 /** Uses disperse method of spreading the gap weights
@@ -1552,75 +1660,94 @@ int
 _PSIComputeSequenceWeights(const _PSIMsa* msa,                      /* [in] */
                            const _PSIAlignedBlock* aligned_blocks,  /* [in] */
                            Boolean nsg_compatibility_mode,          /* [in] */
+                           Uint4 num_threads,                       /* [in] */
                            _PSISequenceWeights* seq_weights)        /* [out] */
 {
-    SDynamicUint4Array* aligned_seqs = 0;     /* list of indices of sequences
-                                       which participate in an
-                                       aligned position */
-    SDynamicUint4Array* prev_pos_aligned_seqs = 0; /* list of indices of 
-                                       sequences for the previous position in 
-                                       the query (i.e.: column in MSA). */
-    Uint4 kQueryLength = 0;         /* length of the query */
-    Uint4 pos = 0;                  /* position index */
+    int kQueryLength = 0;           /* length of the query */
     int retval = PSI_SUCCESS;       /* return value */
     const Uint4 kExpectedNumMatchingSeqs = nsg_compatibility_mode ? 0 : 1;
-    Uint4 last_calc_pos = 0;
 
     if ( !msa || !aligned_blocks || !seq_weights ) {
         return PSIERR_BADPARAM;
     }
-
-    aligned_seqs = DynamicUint4ArrayNewEx(msa->dimensions->num_seqs + 1);
-    prev_pos_aligned_seqs = DynamicUint4Array_Dup(aligned_seqs);
-    if ( !aligned_seqs || !prev_pos_aligned_seqs ) {
-        return PSIERR_OUTOFMEM;
+    if (num_threads == 0) {
+        num_threads = 1;
     }
-    kQueryLength = msa->dimensions->query_length;
+    kQueryLength = (int) msa->dimensions->query_length;
 
-    for (pos = 0; pos < kQueryLength; pos++) {
+    /* The sequence weights of each position only depend on the multiple
+     * sequence alignment, so the positions are processed concurrently, each
+     * thread using its own scratch arrays. The first thread uses those in
+     * seq_weights. */
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_threads) if(num_threads > 1)
+#endif
+    {
+        const Uint4 kNumSeqs = msa->dimensions->num_seqs + 1;
+        SDynamicUint4Array* aligned_seqs = 0;   /* list of indices of 
+                                       sequences which participate in an
+                                       aligned position */
+        double* norm_seq_weights = seq_weights->norm_seq_weights;
+        double* row_sigma = seq_weights->row_sigma;
+        Boolean own_scratch = FALSE;
+        int pos = 0;                    /* position index */
 
-        /* ignore positions of no interest */
-        if (aligned_blocks->size[pos] == 0 || 
-            msa->num_matching_seqs[pos] <= kExpectedNumMatchingSeqs) {
-            continue;
+#ifdef _OPENMP
+        if (omp_get_thread_num() != 0) {
+            norm_seq_weights = (double*) malloc(kNumSeqs * sizeof(double));
+            row_sigma = (double*) malloc(kNumSeqs * sizeof(double));
+            own_scratch = TRUE;
         }
-
-        DynamicUint4Array_Copy(prev_pos_aligned_seqs, aligned_seqs);
-        _PSIGetAlignedSequencesForPosition(msa, pos, aligned_seqs);
-        ASSERT(msa->num_matching_seqs[pos] == aligned_seqs->num_used);
-        if (aligned_seqs->num_used <= kExpectedNumMatchingSeqs) {
-            continue;
+#endif
+        aligned_seqs = DynamicUint4ArrayNewEx(kNumSeqs);
+        if ( !aligned_seqs || !norm_seq_weights || !row_sigma ) {
+#ifdef _OPENMP
+#pragma omp critical(psi_seq_weights)
+#endif
+            retval = PSIERR_OUTOFMEM;
         }
-        last_calc_pos = pos;
 
-        if (last_calc_pos != pos - 1 ||
-            !DynamicUint4Array_AreEqual(aligned_seqs, prev_pos_aligned_seqs)) {
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for (pos = 0; pos < kQueryLength; pos++) {
 
-            memset((void*)seq_weights->norm_seq_weights, 0, 
-                   sizeof(double)*(msa->dimensions->num_seqs+1));
-            memset((void*)seq_weights->row_sigma, 0,
-                   sizeof(double)*(msa->dimensions->num_seqs+1));
+            /* ignore positions of no interest */
+            if (aligned_blocks->size[pos] == 0 || 
+                msa->num_matching_seqs[pos] <= kExpectedNumMatchingSeqs ||
+                !aligned_seqs || !norm_seq_weights || !row_sigma) {
+                continue;
+            }
 
-            _PSICalculateNormalizedSequenceWeights(msa, aligned_blocks, pos, 
-                                                   aligned_seqs, seq_weights);
-        } else {
-            int index;
-            seq_weights->sigma[pos] = seq_weights->sigma[pos-1];
-            for (index = 0; index <= EFFECTIVE_ALPHABET; index++) {
-               seq_weights->posDistinctDistrib[pos][index] = seq_weights->posDistinctDistrib[pos-1][index];
+            _PSIGetAlignedSequencesForPosition(msa, pos, aligned_seqs);
+            ASSERT(msa->num_matching_seqs[pos] == aligned_seqs->num_used);
+            if (aligned_seqs->num_used <= kExpectedNumMatchingSeqs) {
+                continue;
             }
-            /* seq_weights->norm_seq_weights are unchanged from the previous
-             * iteration, leaving them ready to be used in
-             * _PSICalculateMatchWeights */
+
+            memset((void*)norm_seq_weights, 0, sizeof(double)*kNumSeqs);
+            memset((void*)row_sigma, 0, sizeof(double)*kNumSeqs);
+
+            _PSICalculateNormalizedSequenceWeights(msa, aligned_blocks, pos, 
+                                                   aligned_seqs,
+                                                   norm_seq_weights,
+                                                   row_sigma, seq_weights);
+            seq_weights->posNumParticipating[pos] = aligned_seqs->num_used;
+
+            /* Uses norm_seq_weights to populate match_weights */
+            _PSICalculateMatchWeights(msa, pos, aligned_seqs,
+                                      norm_seq_weights, seq_weights);
         }
-        seq_weights->posNumParticipating[pos] = aligned_seqs->num_used;
 
-        /* Uses seq_weights->norm_seq_weights to populate match_weights */
-        _PSICalculateMatchWeights(msa, pos, aligned_seqs, seq_weights);
+        DynamicUint4ArrayFree(aligned_seqs);
+        if (own_scratch) {
+            sfree(norm_seq_weights);
+            sfree(row_sigma);
+        }
+    }
+    if (retval != PSI_SUCCESS) {
+        return retval;
     }
-
-    DynamicUint4ArrayFree(aligned_seqs);
-    DynamicUint4ArrayFree(prev_pos_aligned_seqs);
 
     /* Check that the sequence weights add up to 1 in each column */
     retval = _PSICheckSequenceWeights(msa, seq_weights, 
@@ -1752,7 +1879,9 @@ _PSICalculateNormalizedSequenceWeights(
     const _PSIAlignedBlock* aligned_blocks, /* [in] */
     Uint4 position,                        /* [in] */
     const SDynamicUint4Array* aligned_seqs,             /* [in] */
-    _PSISequenceWeights* seq_weights)       /* [out] norm_seq_weights, sigma */
+    double* norm_seq_weights,               /* [out] */
+    double* row_sigma,                      /* [in|out] */
+    _PSISequenceWeights* seq_weights)       /* [out] sigma */
 {
     const Uint1 kGapResidue = AMINOACID_TO_NCBISTDAA['-'];
     const Uint1 kXResidue = AMINOACID_TO_NCBISTDAA['X'];
@@ -1829,7 +1958,7 @@ _PSICalculateNormalizedSequenceWeights(
             /* This is a modified version of the Henikoff's idea in
              * "Position-based sequence weights" paper. The modification
              * consists in using the alignment extents. */
-            seq_weights->row_sigma[seq_idx] += 
+            row_sigma[seq_idx] += 
                 (1.0 / (double) 
                  (residue_counts_for_column[residue] * 
                   num_distinct_residues_for_column) );
@@ -1844,17 +1973,17 @@ _PSICalculateNormalizedSequenceWeights(
 
         for (asi = 0; asi < aligned_seqs->num_used; asi++) {
             const Uint4 seq_idx = aligned_seqs->data[asi];
-            seq_weights->norm_seq_weights[seq_idx] = 
-                seq_weights->row_sigma[seq_idx] / 
+            norm_seq_weights[seq_idx] = 
+                row_sigma[seq_idx] / 
                 (aligned_blocks->pos_extnt[position].right -
                  aligned_blocks->pos_extnt[position].left + 1);
-            weight_sum += seq_weights->norm_seq_weights[seq_idx];
+            weight_sum += norm_seq_weights[seq_idx];
         }
 
         /* Normalize */
         for (asi = 0; asi < aligned_seqs->num_used; asi++) {
             const Uint4 seq_idx = aligned_seqs->data[asi];
-            seq_weights->norm_seq_weights[seq_idx] /= weight_sum;
+            norm_seq_weights[seq_idx] /= weight_sum;
         }
 
     } else {
@@ -1863,7 +1992,7 @@ _PSICalculateNormalizedSequenceWeights(
          * all participating sequences */
         for (asi = 0; asi < aligned_seqs->num_used; asi++) {
             const Uint4 seq_idx = aligned_seqs->data[asi];
-            seq_weights->norm_seq_weights[seq_idx] = 
+            norm_seq_weights[seq_idx] = 
                 (1.0/(double) aligned_seqs->num_used);
         }
     }
@@ -1876,6 +2005,7 @@ _PSICalculateMatchWeights(
     const _PSIMsa* msa,  /* [in] */
     Uint4 position,                     /* [in] */
     const SDynamicUint4Array* aligned_seqs,          /* [in] */
+    const double* norm_seq_weights,      /* [in] */
     _PSISequenceWeights* seq_weights)    /* [out] */
 {
     const Uint1 kGapResidue = AMINOACID_TO_NCBISTDAA['-'];
@@ -1890,12 +2020,12 @@ _PSICalculateMatchWeights(
         const Uint1 residue = msa->cell[seq_idx][position].letter;
 
         seq_weights->match_weights[position][residue] += 
-            seq_weights->norm_seq_weights[seq_idx];
+            norm_seq_weights[seq_idx];
 
         /* Collected for diagnostics information, not used elsewhere */
         if (residue != kGapResidue) {
             seq_weights->gapless_column_weights[position] +=
-             seq_weights->norm_seq_weights[seq_idx];
+             norm_seq_weights[seq_idx];
         }
     }
 }
@@ -2074,13 +2204,15 @@ _PSIComputeFreqRatios(const _PSIMsa* msa,
                       const _PSIAlignedBlock* aligned_blocks,
                       Int4 pseudo_count,
                       Boolean nsg_compatibility_mode,
+                      Uint4 num_threads,
                       _PSIInternalPssmData* internal_pssm)
 {
     /* Subscripts are indicated as follows: N_i, where i is a subscript of N */
     const Uint1 kXResidue = AMINOACID_TO_NCBISTDAA['X'];
     SFreqRatios* freq_ratios = NULL;/* matrix-specific frequency ratios */
-    Uint4 p = 0;                    /* index on positions */
-    Uint4 r = 0;                    /* index on residues */
+    int kQueryLength = 0;           /* length of the query */
+    int p = 0;                      /* index on positions */
+    int retval = PSI_SUCCESS;       /* return value */
     const double kZeroObsPseudo = 30.0; /*arbitrary constant to use for columns with
                              zero observations in actual data (ZERO_OBS_PSEUDO in posit.c) */
     double  expno[MAX_IND_OBSERVATIONS+1]; /*table of expectations*/
@@ -2090,18 +2222,28 @@ _PSIComputeFreqRatios(const _PSIMsa* msa,
         return PSIERR_BADPARAM;
     }
     ASSERT(((Uint4)sbp->alphabet_size) == msa->alphabet_size);
+    if (num_threads == 0) {
+        num_threads = 1;
+    }
+    kQueryLength = (int) msa->dimensions->query_length;
 
     freq_ratios = _PSIMatrixFrequencyRatiosNew(sbp->name);
 
     s_initializeExpNumObservations(&(expno[0]),  backgroundProbabilities);
 
-    for (p = 0; p < msa->dimensions->query_length; p++) {
+    /* Each position only depends on its own column of the sequence weights */
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads) if(num_threads > 1) \
+        schedule(dynamic, 16)
+#endif
+    for (p = 0; p < kQueryLength; p++) {
+        Uint4 r = 0;               /* index on residues */
         double columnCounts = 0.0; /*column-specific pseudocounts*/
         double observations = 0.0;
         double pseudoWeight; /*multiplier for pseudocounts term*/
         if (msa->cell[kQueryIndex][p].letter != kXResidue)
         {
-           observations = s_effectiveObservations(aligned_blocks, seq_weights, p, msa->dimensions->query_length, expno);
+           observations = s_effectiveObservations(aligned_blocks, seq_weights, p, kQueryLength, expno);
 
            // this is done so that effective observations can be reported in
            // diagnostics
@@ -2160,7 +2302,11 @@ _PSIComputeFreqRatios(const _PSIMsa* msa,
                 denominator = observations + kBeta;
 
                 if (nsg_compatibility_mode && denominator == 0.0) {
-                    return PSIERR_UNKNOWN;
+#ifdef _OPENMP
+#pragma omp critical(psi_freq_ratios)
+#endif
+                    retval = PSIERR_UNKNOWN;
+                    break;
                 } else {
                     ASSERT(denominator != 0.0);
                 }
@@ -2177,7 +2323,7 @@ _PSIComputeFreqRatios(const _PSIMsa* msa,
 
     freq_ratios = _PSIMatrixFrequencyRatiosFree(freq_ratios);
 
-    return PSI_SUCCESS;
+    return retval;
 }
 
 
@@ -399,11 +399,14 @@ _PSISequenceWeightsFree(_PSISequenceWeights* seq_weights);
  * data will not be modified.
  * @sa implementation of PSICreatePssmWithDiagnostics
  * @param msa multiple sequence alignment data structure [in]
- * @return PSIERR_BADPARAM if alignment is NULL; PSI_SUCCESS otherwise
+ * @param num_threads number of threads to compare the aligned sequences
+ * with; the sequences purged do not depend on it [in]
+ * @return PSIERR_BADPARAM if alignment is NULL, PSIERR_OUTOFMEM in case of
+ * memory allocation failure; PSI_SUCCESS otherwise
  */
 NCBI_XBLAST_EXPORT 
 int 
-_PSIPurgeBiasedSegments(_PSIPackedMsa* msa);
+_PSIPurgeBiasedSegments(_PSIPackedMsa* msa, Uint4 num_threads);
 
 /** Main validation function for multiple sequence alignment structure. Should
  * be called after _PSIPurgeBiasedSegments.
@@ -440,6 +443,8 @@ _PSIComputeAlignmentBlocks(const _PSIMsa* msa,
  * @param nsg_compatibility_mode set to true to emulate the structure group's
  * use of PSSM engine in the cddumper application. By default should be FALSE
  * [in]
+ * @param num_threads number of threads to compute the sequence weights of
+ * the query positions with [in]
  * @param seq_weights data structure containing the data needed to compute the
  * sequence weights [out]
  * @return PSIERR_BADPARAM if arguments are NULL, PSIERR_OUTOFMEM in case of
@@ -451,6 +456,7 @@ int
 _PSIComputeSequenceWeights(const _PSIMsa* msa,
                            const _PSIAlignedBlock* aligned_blocks,
                            Boolean nsg_compatibility_mode,
+                           Uint4 num_threads,
                           _PSISequenceWeights* seq_weights);
 
 /** Main function to calculate CD weights and combine weighted residue counts
@@ -481,6 +487,8 @@ _PSIComputeFrequenciesFromCDs(const PSICdMsa* cd_msa,
  * @param pseudo_count pseudo count constant [in]
  * @param nsg_compatibility_mode set to true to emulate the structure group's
  * use of PSSM engine in the cddumper application. By default should be FALSE
+ * @param num_threads number of threads to compute the frequency ratios of the
+ * query positions with [in]
  * @param internal_pssm PSSM being computed [out]
  * @return PSIERR_BADPARAM if arguments are NULL, PSI_SUCCESS otherwise
  */
@@ -492,6 +500,7 @@ _PSIComputeFreqRatios(const _PSIMsa* msa,
                       const _PSIAlignedBlock* aligned_blocks,
                       Int4 pseudo_count,
                       Boolean nsg_compatibility_mode,
+                      Uint4 num_threads,
                       _PSIInternalPssmData* internal_pssm);
 
 /** Main function to compute CD-based PSSM's frequency ratios
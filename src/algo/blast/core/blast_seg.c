@@ -1315,7 +1315,16 @@ double log_win10[] =
 
 const int kProtAlphabet = 2;   /**< identifies protein alphabet (FIXME: needed?). */
 
+/** Largest alphabet seg works with; sizes the per-window arrays so that
+ * windows need no memory of their own. */
+#define SEG_MAX_ALPHASIZE 20
 
+/** Number of entries in the letter tables of the Alpha structure. */
+#define SEG_CHARSET 256
+
+/** Largest number of precomputed entropy terms; for bigger windows the
+ * terms are computed as the window moves. */
+#define SEG_MAX_ENTROPY_TERMS 65536
 
 /** Information about the alphabet used by seg.
  *  For proteins this version of seg uses ncbistdaa,
@@ -1326,27 +1335,52 @@ typedef struct Alpha
    Int4 alphabet;              /**< which alphabet, kProtAlphabet for proteins. */
    Int4 alphasize;             /**< size of above alphabet. */
    double lnalphasize;         /**< nat. log of size of above alphabet. */
-   Int4* alphaindex;           /**< value in ncbistdaa. */
-   unsigned char* alphaflag;   /**< array of bools to indicate that letter is (not) valid?? */
+   Int4 alphaindex[SEG_CHARSET];         /**< value in ncbistdaa. */
+   unsigned char alphaflag[SEG_CHARSET]; /**< TRUE if letter is not in the
+                                            alphabet (e.g., X). */
   } Alpha;
 
 
-/** General sequence information */
+/** General sequence information: the part of a sequence to be segged. */
 typedef struct SSequence
   {
-   struct SSequence* parent;   /**< SSequence window that encompasses the current one */
-   char* seq;                  /**< sequence in ncbistdaa. */
-   Alpha* palpha;              /**< alphabet information */
-   Int4 start;                 /**< starting offset to seg. */
+   const Uint1* seq;           /**< sequence in ncbistdaa. */
    Int4 length;                /**< Length of sequence to be segged. */
+  } SSequence;
+
+/** A window sliding over an SSequence.  The composition and the state
+ * vector are updated as the window moves, so that nothing is recounted
+ * or allocated per window position.
+ */
+typedef struct SSegWindow
+  {
+   const SSequence* parent;    /**< SSequence that encompasses the window */
+   const Uint1* seq;           /**< first residue of the window */
+   Int4 start;                 /**< offset of the window in parent. */
+   Int4 length;                /**< Length of the window. */
    Int4 bogus;                 /**< tracks number of non-allowed residues (e.g., X) */
-   Boolean punctuation;        /**< FIXME: always FALSE, never set to TRUE? */
-   Int4* composition;          /**< totals number of each type of residue */
-   Int4* state;                /**< "state vector as described on pg. 151 of Wootton and Federhen
-                                  (Comput. Chem. 17, 149 (1993)).  Tracks number of each residue,
-                                  like composition, but without gaps in array. */
-   double entropy;             /**< entropy of what this array refers to. */
-} SSequence;
+   Boolean changed;            /**< FALSE if the last shift left the state
+                                  vector as it was */
+   Int4 composition[SEG_MAX_ALPHASIZE];  /**< totals number of each type of residue */
+   Int4 state[SEG_MAX_ALPHASIZE+1];      /**< "state vector as described on pg. 151
+                                  of Wootton and Federhen (Comput. Chem. 17, 149
+                                  (1993)).  Tracks number of each residue, like
+                                  composition, but without gaps in array and
+                                  sorted in decreasing order; zero terminated. */
+  } SSegWindow;
+
+/** Alphabet and tables shared by all windows examined while segging one
+ * sequence.
+ */
+typedef struct SSegContext
+  {
+   const SegParameters* sparamsp;  /**< the SEG parameters */
+   Alpha alpha;                    /**< alphabet information */
+   double* entropy_terms;          /**< entropy terms of the trigger windows;
+                                      row b holds the terms of a window with
+                                      b bogus residues, indexed by letter count.
+                                      NULL if the table would be too big. */
+  } SSegContext;
 
 /** List of sequence segments (hits) */
 typedef struct SSeg
@@ -1356,66 +1390,6 @@ typedef struct SSeg
    struct SSeg *next;  /**< next object in linked list */
   } SSeg;
 
-/** Initializes SSequence structure */
-static SSequence*
-s_SSequenceNew(void)
-{
-   SSequence* seq;
-
-   seq = (SSequence*) calloc(1, sizeof(SSequence));
-   if (seq==NULL)
-     {
-      /* raise error flag and etc. */
-      return(seq);
-     }
-
-   seq->parent = (SSequence*) NULL;
-   seq->seq = (char*) NULL;
-   seq->palpha = (Alpha*) NULL;
-   seq->start = seq->length = 0;
-   seq->bogus = seq->punctuation = FALSE;
-   seq->composition = seq->state = (Int4*) NULL;
-   seq->entropy = (double) 0.0;
-
-   return(seq);
-}
-
-/*------------------------------------------------------------(AlphaFree)---*/
-
-/** Frees the Alpha structure and underlying structures.
- * @param palpha the object to be freed [in]
- */
-static void
-s_AlphaFree (Alpha* palpha)
-
-  {
-   if (!palpha) return;
-
-   sfree (palpha->alphaindex);
-   sfree (palpha->alphaflag);
-   sfree (palpha);
-
-   return;
- }
-
-/*--------------------------------------------------------------(SSequenceFree)---*/
-
-/** Frees the SSequence structure and the underlying structure
- * @param seq the object to be freed [in]
- */
-static void
-s_SSequenceFree(SSequence* seq)
-{
-   if (seq==NULL) return;
-
-   sfree(seq->seq);
-   s_AlphaFree(seq->palpha);
-   sfree(seq->composition);
-   sfree(seq->state);
-   sfree(seq);
-   return;
-}
-
 /*--------------------------------------------------------------(SSegFree)---*/
 
 /** Frees the SSeg structure
@@ -1436,27 +1410,6 @@ s_SegFree(SSeg* seg)
    return;
 }
 
-/*--------------------------------------------------------------(hasdash)---*/
-
-/** Checks if sequence contains a dash.
- * @param win SSequence structure for a piece of a sequence [in]
- * @return TRUE if dash is found in the sequence, otherwise FALSE [in]
- */
-static Boolean
-s_HasDash(SSequence* win)
-{
-	char	*seq, *seqmax;
-
-	seq = win->seq;
-	seqmax = seq + win->length;
-
-	while (seq < seqmax) {
-		if (*seq++ == '-')
-			return TRUE;
-	}
-	return FALSE;
-}
-
 /*------------------------------------------------------------(state_cmp)---*/
 
 /** State comparison function */
@@ -1471,156 +1424,54 @@ s_StateCmp(const void* s1, const void* s2)
 	return (*np2 - *np1);
 }
 
-/*---------------------------------------------------------------(compon)---*/
-
-/** Calculates sequence composition array values.
- * @param win the object to be analyzed [in]
- */
-static void
-s_CompOn(SSequence* win)
-
-{
-	Int4* comp;
-	Int4 letter;
-	char* seq,* seqmax;
-        Int4* alphaindex;
-        unsigned char* alphaflag;
-        Int4 alphasize;
-
-        alphasize = win->palpha->alphasize;
-        alphaindex = win->palpha->alphaindex;
-        alphaflag = win->palpha->alphaflag;
-
-	win->composition = comp =
-                (Int4*) calloc(alphasize, sizeof(Int4));
-	seq = win->seq;
-	seqmax = seq + win->length;
-
-	while (seq < seqmax) {
-		letter = *seq++;
-		if (!alphaflag[letter])
-			comp[alphaindex[letter]]++;
-                else
-                        win->bogus++;
-	}
-
-	return;
-}
-
-/*--------------------------------------------------------------(stateon)---*/
-
-/** Calculates state array values
- * @param win the object to be analyzed [in]
- */
-static void
-s_StateOn(SSequence* win)
-
-{
-	Int4 letter, nel, c;
-        Int4 alphasize;
-
-        alphasize = win->palpha->alphasize;
-
-	if (win->composition == NULL)
-		s_CompOn(win);
-
-	win->state = (Int4*) calloc((alphasize+1), sizeof(win->state[0]));
-
-	for (letter = nel = 0; letter < alphasize; ++letter) {
-		if ((c = win->composition[letter]) == 0)
-			continue;
-		win->state[nel++] = c;
-	}
-	for (letter = nel; letter < alphasize+1; ++letter)
-		win->state[letter] = 0;
-
-	qsort(win->state, nel, sizeof(win->state[0]), s_StateCmp);
-
-	return;
-}
-
 /*--------------------------------------------------------------(s_OpenWin)---*/
 
-/** Initializes an SSequence structure for part of sequence contained in a
- * window.
+/** Initializes a window over part of a sequence: counts the composition of
+ * the window and builds its state vector.
+ * @param win the window to initialize [out]
  * @param parent Parent (whole) sequence [in]
  * @param start Window start in parent [in]
  * @param length Window length in parent [in]
- * @return Pointer to the resulting SSequence structure.
- */
-static SSequence*
-s_OpenWin(SSequence* parent, Int4 start, Int4 length)
-{
-   SSequence* win;
-
-   if (start<0 || length<0 || start+length>parent->length)
-     {
-      return((SSequence*) NULL);
-     }
-
-      win = (SSequence*) calloc(1, sizeof(SSequence));
-
-/*---                                          ---[set links, up and down]---*/
-
-      win->parent = parent;
-      win->palpha = parent->palpha;
-
-/*---                          ---[install the local copy of the sequence]---*/
-
-      win->start = start;
-      win->length = length;
-	win->seq = parent->seq + start;
-
-        win->bogus = 0;
-	win->punctuation = FALSE;
-
-	win->entropy = -2.;
-	win->state = (Int4*) NULL;
-	win->composition = (Int4*) NULL;
-
-	s_StateOn(win);
-
-	return win;
-}
-
-/*--------------------------------------------------------------(s_Entropy)---*/
-
-/** Calculates entropy of an integer array
- * @param sv array to be analyzed [in]
- * @return the entropy
+ * @param palpha alphabet information [in]
  */
-static double
-s_Entropy(Int4* sv)
+static void
+s_OpenWin(SSegWindow* win, const SSequence* parent, Int4 start, Int4 length,
+          const Alpha* palpha)
 {
-   double ent;
-   Int4 i, total;
-
-   total = 0;
-   for (i=0; sv[i]!=0; i++)
-     {
-      total += sv[i];
-     }
-   if (total==0) return(0.);
-
-   ent = 0.0;
-   if (total == 10)
-   { /* Use precomputed table. */
-   	for (i=0; sv[i]!=0; i++)
-     	{
-      		ent += ((double)sv[i])*log_win10[sv[i]]/NCBIMATH_LN2;
-     	}
-
+   const Uint1* seq,* seqmax;
+   Int4 letter, nel;
+
+   ASSERT(start >= 0 && length >= 0 && start+length <= parent->length);
+
+   win->parent = parent;
+   win->seq = parent->seq + start;
+   win->start = start;
+   win->length = length;
+   win->bogus = 0;
+   win->changed = TRUE;
+   memset(win->composition, 0, sizeof(win->composition));
+
+   seq = win->seq;
+   seqmax = seq + length;
+
+   while (seq < seqmax) {
+      letter = *seq++;
+      if (!palpha->alphaflag[letter])
+         win->composition[palpha->alphaindex[letter]]++;
+      else
+         win->bogus++;
    }
-   else
-   {
-   	for (i=0; sv[i]!=0; i++)
-     	{
-      		ent += ((double)sv[i])*log(((double)sv[i])/(double)total)/NCBIMATH_LN2;
-     	}
+
+   for (letter = nel = 0; letter < palpha->alphasize; ++letter) {
+      if (win->composition[letter] != 0)
+         win->state[nel++] = win->composition[letter];
    }
-   ent = fabs(ent/(double)total);
+   for (letter = nel; letter < SEG_MAX_ALPHASIZE+1; ++letter)
+      win->state[letter] = 0;
 
-   return(ent);
+   qsort(win->state, nel, sizeof(win->state[0]), s_StateCmp);
+
+   return;
 }
 
 /*----------------------------------------------------------(decrementsv)---*/
@@ -1666,138 +1517,172 @@ s_IncrementSV(Int4* sv, Int4 class)
 /** Moves over the "window" of sequence seg is currently working on.
  *
  * @param win object to be operated on [in]
+ * @param palpha alphabet information [in]
  * @return FALSE if nothing done, TRUE otherwise
  */
 
 static Boolean
-s_ShiftWin1(SSequence* win)
+s_ShiftWin1(SSegWindow* win, const Alpha* palpha)
 {
-    Uint4 j, length;
-    Int4* comp;
-    Int4* alphaindex;
-    unsigned char* alphaflag;
+    Uint1 out, in;
+    Int4 length;
 
-    length = (Uint4) win->length;
-    comp = win->composition;
-    alphaindex = win->palpha->alphaindex;
-    alphaflag = win->palpha->alphaflag;
+    length = win->length;
+    win->changed = FALSE;
 
-    if ((Uint1) win->seq[length] == FENCE_SENTRY) {
+    if (win->start + length + 1 > win->parent->length) {
         return FALSE;
     }
-    if ((++win->start + length) > win->parent->length) {
-        --win->start;
+    if (win->seq[length] == FENCE_SENTRY) {
         return FALSE;
     }
+    ++win->start;
 
-    j = (Uint1) win->seq[0];        /* prevent sign-extension */
+    out = win->seq[0];
+    in = win->seq[length];
+    ++win->seq;
 
-    if (!alphaflag[j])
-        s_DecrementSV(win->state, comp[alphaindex[j]]--);
-    else win->bogus--;
+    /* the same residue leaving and entering the window, as is common in
+       the low-complexity regions seg is after, changes nothing */
+    if (out == in || (palpha->alphaflag[out] && palpha->alphaflag[in]))
+        return TRUE;
 
-    j = (Uint1) win->seq[length];   /* prevent sign-extension */
-    ++win->seq;
+    if (!palpha->alphaflag[out])
+        s_DecrementSV(win->state, win->composition[palpha->alphaindex[out]]--);
+    else win->bogus--;
 
-    if (!alphaflag[j])
-        s_IncrementSV(win->state, comp[alphaindex[j]]++);
+    if (!palpha->alphaflag[in])
+        s_IncrementSV(win->state, win->composition[palpha->alphaindex[in]]++);
     else win->bogus++;
 
-    if (win->entropy > -2.)
-        win->entropy = s_Entropy(win->state);
-
+    win->changed = TRUE;
     return TRUE;
 }
 
-/*-------------------------------------------------------------(closewin)---*/
-
-/** Frees the SSequence structure corresponding to a sequence window
- * Does not free palpha like s_SSequenceFree (two functions needed?).
- * @param win object to be freed
+/** Drops the last residue from a window.
+ *
+ * @param win object to be operated on [in]
+ * @param palpha alphabet information [in]
  */
 static void
-s_CloseWin(SSequence* win)
+s_ShrinkWin1(SSegWindow* win, const Alpha* palpha)
 {
-   if (win==NULL) return;
+    Uint1 j;
 
-   if (win->state!=NULL)       sfree(win->state);
-   if (win->composition!=NULL) sfree(win->composition);
+    ASSERT(win->length > 0);
 
-   sfree(win);
-   return;
+    j = win->seq[--win->length];
+
+    if (!palpha->alphaflag[j])
+        s_DecrementSV(win->state, win->composition[palpha->alphaindex[j]]--);
+    else win->bogus--;
+
+    win->changed = TRUE;
 }
 
-/*----------------------------------------------------------------(enton)---*/
+/*----------------------------------------------------------(s_EntropyTerm)---*/
 
-/** Calculates entropy of a sequence window
- * @param win object to be analyzed [in]
+/** Calculates the contribution of one letter to the entropy of a window.
+ * @param count number of times the letter occurs in the window [in]
+ * @param total number of valid letters in the window [in]
+ * @return the term, in bits, summed by s_Entropy
  */
-static void
-s_EntropyOn(SSequence* win)
+static double
+s_EntropyTerm(Int4 count, Int4 total)
+{
+   if (total == 10)
+   { /* Use precomputed table. */
+      return ((double)count)*log_win10[count]/NCBIMATH_LN2;
+   }
+   return ((double)count)*log(((double)count)/(double)total)/NCBIMATH_LN2;
+}
 
-  {
-   if (win->state==NULL) {s_StateOn(win);}
+/*--------------------------------------------------------------(s_Entropy)---*/
 
-   win->entropy = s_Entropy(win->state);
+/** Calculates entropy of a state vector
+ * @param sv array to be analyzed [in]
+ * @param total sum of the elements of sv [in]
+ * @param terms entropy terms for total indexed by letter count, or NULL to
+ *        compute them [in]
+ * @return the entropy
+ */
+static double
+s_Entropy(const Int4* sv, Int4 total, const double* terms)
+{
+   double ent;
+   Int4 i;
 
-   return;
-  }
+   if (total==0) return(0.);
+
+   ent = 0.0;
+   if (terms)
+   {
+   	for (i=0; sv[i]!=0; i++)
+     	{
+      		ent += terms[sv[i]];
+     	}
+   }
+   else
+   {
+   	for (i=0; sv[i]!=0; i++)
+     	{
+      		ent += s_EntropyTerm(sv[i], total);
+     	}
+   }
+   ent = fabs(ent/(double)total);
+
+   return(ent);
+}
 
 /** Calculates entropy for a given sequence and window
  *
- * @param seq Sequence to examine [in]
- * @param window amount of sequence to examine at once [in]
- * @param maxbogus limit on non-allowed (e.g., X) characters [in]
- * @return calculated entropy
+ * @param ctx seg alphabet, parameters and tables [in]
+ * @param seq Sequence to examine, at least one window long [in]
+ * @param H entropy of the window centered at each position of seq, -1 if
+ *        there is none or it has too many non-allowed residues [out]
  */
-static double*
-s_SeqEntropy(SSequence* seq, Int4 window, Int4 maxbogus)
+static void
+s_SeqEntropy(const SSegContext* ctx, const SSequence* seq, double* H)
 {
-   SSequence* win;
-   double* H;
+   SSegWindow win;
+   Int4 window, maxbogus;
    Int4 i, first, last, downset, upset;
+   double entropy = 0.;
+   Boolean stale = TRUE;
 
+   window = ctx->sparamsp->window;
+   maxbogus = ctx->sparamsp->maxbogus;
    downset = (window+1)/2 - 1;
    upset = window - downset;
 
-   if (window>seq->length)
-     {
-      return((double*) NULL);
-     }
-
-   H = (double*) calloc(seq->length, sizeof(double));
-
    for (i=0; i<seq->length; i++)
      {
       H[i] = -1.;
      }
 
-   win = s_OpenWin(seq, 0, window);
-   s_EntropyOn(win);
+   s_OpenWin(&win, seq, 0, window, &ctx->alpha);
 
    first = downset;
    last = seq->length - upset;
 
    for (i=first; i<=last; i++)
      {
-      if (seq->punctuation && s_HasDash(win))
+      stale = stale || win.changed;
+      if (win.bogus <= maxbogus)
         {
-         H[i] = -1.;
-         s_ShiftWin1(win);
-         continue;
+         if (stale)
+           {
+            const double* terms = ctx->entropy_terms ?
+               ctx->entropy_terms + win.bogus*(window+1) : NULL;
+            entropy = s_Entropy(win.state, window - win.bogus, terms);
+            stale = FALSE;
+           }
+         H[i] = entropy;
         }
-      if (win->bogus > maxbogus)
-        {
-         H[i] = -1.;
-         s_ShiftWin1(win);
-         continue;
-        }
-      H[i] = win->entropy;
-      s_ShiftWin1(win);
+      s_ShiftWin1(&win, &ctx->alpha);
      }
 
-   s_CloseWin(win);
-   return(H);
+   return;
 }
 
 /*---------------------------------------------------------------(s_FindLow)---*/
@@ -1858,20 +1743,22 @@ s_lnfact(Int4 n) {
   else return ((n+0.5)*log(n) - n + 0.9189385332);
 }
 
+
 /** calculate "K2" entropy per equation 3 of Wootton and Federhen
  * (Comput. Chem. 17, 149 (1993).
  * @param sv state vector [in]
- * @param window_length length of window being examined
+ * @param lnfact_length log(n!) of the length n of the window being
+ *        examined, which is the same for all windows of a trim pass [in]
  * @return K2
  */
 static double
-s_LnPerm(const Int4* sv, Int4 window_length)
+s_LnPerm(const Int4* sv, double lnfact_length)
 
   {
    double ans;
    Int4 i;
 
-   ans = s_lnfact(window_length);
+   ans = lnfact_length;
 
    for (i=0; sv[i]!=0; i++)
      {
@@ -1933,15 +1820,18 @@ s_LnAss(const Int4* sv, Int4 alphasize)
 }
 
 
+
+
 /** This function calculates the natural log of the value P sub 0 from
  * equation 3 of Wootton and Federhen (Methods Enzymol. 1996;266:554-71).
  * @param sv state vector [in]
  * @param total window length of area examined [in]
+ * @param lnfact_total log(total!) [in]
  * @param palpha structure for alphabet information [in]
  * @return log of P sub 0 as mentioned above
  */
 static double
-s_GetProb(const Int4* sv, Int4 total, const Alpha* palpha)
+s_GetProb(const Int4* sv, Int4 total, double lnfact_total, const Alpha* palpha)
 
   {
    double ans, ans1, ans2 = 0, totseq;
@@ -1951,7 +1841,7 @@ s_GetProb(const Int4* sv, Int4 total, const Alpha* palpha)
    ans1 = s_LnAss(sv, palpha->alphasize);
    if (ans1 > -100000.0 && sv[0] != INT4_MIN)
    {
-	ans2 = s_LnPerm(sv, total);
+	ans2 = s_LnPerm(sv, lnfact_total);
    }
    else
    {
@@ -1965,71 +1855,84 @@ s_GetProb(const Int4* sv, Int4 total, const Alpha* palpha)
   }
 
 /** Trims view of sequence so as to minimize the probability returned by s_GetProb
+ * @param ctx seg alphabet, parameters and tables [in]
  * @param seq the part of sequence to be examined [in]
  * @param leftend left-most end of sequence [in|out]
  * @param rightend right-most end of sequence [in|out]
- * @param sparamsp the SEG parameters [in]
  */
-static Int2
-s_Trim(SSequence* seq, Int4* leftend, Int4* rightend, const SegParameters* sparamsp)
+static void
+s_Trim(const SSegContext* ctx, const SSequence* seq,
+       Int4* leftend, Int4* rightend)
 
 {
-   double prob, minprob;
+   const Alpha* palpha = &ctx->alpha;
+   SSegWindow prefix, win;
+   double prob = 0., minprob;
    Int4 len;
    Int4 lend, rend;
    Int4 minlen;
    Int4 maxtrim;
-   Int2 status = 0;
 
    lend = 0;
    rend = seq->length - 1;
    minlen = 1;
-   maxtrim = sparamsp->maxtrim;
+   maxtrim = ctx->sparamsp->maxtrim;
    if ((seq->length-maxtrim)>minlen)
         minlen = seq->length-maxtrim;
 
    minprob = 1.;
+
+   /* prefix covers the first len residues; the windows of each length
+      start from a copy of it rather than from a recount */
+   s_OpenWin(&prefix, seq, 0, seq->length, palpha);
+
    for (len=seq->length; len>minlen; len--)
    {
+      const double lnfact_len = s_lnfact(len);
       Boolean shift = TRUE;
       Int4 i = 0;
-      SSequence* win = s_OpenWin(seq, 0, len);
+
+      win = prefix;
+      win.changed = TRUE;
 
       while (shift)
       {
-         prob = s_GetProb(win->state, len, win->palpha);
+         if (win.changed)
+            prob = s_GetProb(win.state, len, lnfact_len, palpha);
          if (prob<minprob)
          {
             minprob = prob;
             lend = i;
             rend = len + i - 1;
          }
-         shift = s_ShiftWin1(win);
+         shift = s_ShiftWin1(&win, palpha);
          i++;
       }
-      s_CloseWin(win);
+
+      s_ShrinkWin1(&prefix, palpha);
    }
 
    *leftend = *leftend + lend;
    *rightend = *rightend - (seq->length - rend - 1);
 
-   s_CloseWin(seq);
-   return status;
+   return;
 }
 
 /** High-level function to perform calculations to find
  * low-complexity segments.  Thi function calls itself
  * recursively
  *
+ * @param ctx seg alphabet, parameters and tables [in]
  * @param seq sequence to be checked [in]
- * @param sparamsp seg parameters [in]
  * @param segs low-complexity segments found [out]
  * @param offset offset of sequence passed in [in]
+ * @return 0 on success, -1 if memory allocation failed.
  */
 static Int2
-s_SegSeq(SSequence* seq, SegParameters* sparamsp, SSeg **segs,
+s_SegSeq(const SSegContext* ctx, const SSequence* seq, SSeg **segs,
                    Int4 offset)
 {
+   const SegParameters* sparamsp = ctx->sparamsp;
    SSeg* seg = (SSeg*) NULL;
    Int4 window;
    double locut, hicut;
@@ -2041,19 +1944,23 @@ s_SegSeq(SSequence* seq, SegParameters* sparamsp, SSeg **segs,
    Int2 status = 0;
 
    if (sparamsp->window<=0) return status;
-   if (sparamsp->locut<=0.) sparamsp->locut = 0.;
-   if (sparamsp->hicut<=0.) sparamsp->hicut = 0.;
 
    window = sparamsp->window;
    locut = sparamsp->locut;
    hicut = sparamsp->hicut;
+   if (locut<=0.) locut = 0.;
+   if (hicut<=0.) hicut = 0.;
    downset = (window+1)/2 - 1;
    upset = window - downset;
 
-   H = s_SeqEntropy(seq, window, sparamsp->maxbogus);
+   if (window>seq->length)
+      return status;
 
+   H = (double*) malloc(seq->length * sizeof(double));
    if (H == NULL)
-      return status;
+      return -1;
+
+   s_SeqEntropy(ctx, seq, H);
 
    first = downset;
    last = seq->length - upset;
@@ -2065,44 +1972,48 @@ s_SegSeq(SSequence* seq, SegParameters* sparamsp, SSeg **segs,
         {
          Int4 loi = s_FindLow(i, lowlim, hicut, H);
          Int4 hii = s_FindHigh(i, last, hicut, H);
-         SSequence* temp_seq = NULL;
+         SSequence temp_seq;
 
          leftend = loi - downset;
          rightend = hii + upset - 1;
 
-         temp_seq = s_OpenWin(seq, leftend, rightend-leftend+1);
-         status = s_Trim(temp_seq, &leftend, &rightend, sparamsp);
-
-         if (status < 0) {
-             s_CloseWin(temp_seq);
-             break;
-         }
+         temp_seq.seq = seq->seq + leftend;
+         temp_seq.length = rightend-leftend+1;
+         s_Trim(ctx, &temp_seq, &leftend, &rightend);
 
          if (i+upset-1<leftend)   /* check for trigger window in left trim */
          {
             Int4 lend = loi - downset;
             Int4 rend = leftend - 1;
 
-            SSequence* leftseq = s_OpenWin(seq, lend, rend-lend+1);
+            SSequence leftseq;
             SSeg *leftsegs = (SSeg*) NULL;
-            status = s_SegSeq(leftseq, sparamsp, &leftsegs, offset+lend);
+
+            leftseq.seq = seq->seq + lend;
+            leftseq.length = rend-lend+1;
+            status = s_SegSeq(ctx, &leftseq, &leftsegs, offset+lend);
             if (status < 0)
 	    {
    		sfree(H);
                 return status;
 	    }
 
-            /* prepend here, order will be restored in s_SegToSeqLoc */
+            /* prepend here, order will be restored in s_SegToSeqLoc;
+               only the last segment found on the left is kept */
             if (leftsegs!=NULL)
             {
+               s_SegFree(leftsegs->next);
                leftsegs->next = *segs;
                *segs = leftsegs;
             }
-            s_CloseWin(leftseq);
-
          }
 
          seg = (SSeg*) calloc(1, sizeof(SSeg));
+         if (seg == NULL)
+         {
+            sfree(H);
+            return -1;
+         }
          seg->begin = leftend + offset;
          seg->end = rightend + offset;
          seg->next = *segs;
@@ -2122,7 +2033,7 @@ s_SegSeq(SSequence* seq, SegParameters* sparamsp, SSeg **segs,
  * @param segs segment information [in]
 */
 static void
-s_MergeSegs(SSequence* seq, SSeg* segs)
+s_MergeSegs(const SSequence* seq, SSeg* segs)
 {
    SSeg* seg,* nextseg;
    Int4 hilenmin;              /* hilenmin yet unset */
@@ -2182,43 +2093,69 @@ s_SegsToBlastSeqLoc(SSeg* segs, Int4 offset, BlastSeqLoc** seg_locs)
    return 0;
 }
 
-/** Creats the Alphabet structure for standard protein alphabet.
- * @return pointer to the alphabet structure.
+
+/** Fills in the Alphabet structure for standard protein alphabet.
+ * @param palpha the alphabet structure [out]
  */
-static Alpha*
-s_AA20alphaStd (void)
+static void
+s_AA20alphaStd (Alpha* palpha)
 {
-   Alpha* palpha;
-   Int4* alphaindex;
-   unsigned char* alphaflag;
-   Uint1 c, i;
-   const int kCharSet = 128;
+   Int4 c, i;
    const double kLn20 = 2.9957322735539909;
 
-   palpha = (Alpha*) calloc(1, sizeof(Alpha));
-
    palpha->alphabet = kProtAlphabet;
    palpha->alphasize = 20;
    palpha->lnalphasize = kLn20;
 
-   alphaindex = (Int4*) calloc(kCharSet , sizeof(Int4));
-   alphaflag = (unsigned char*) calloc(kCharSet , sizeof(unsigned char));
-
-   for (c=0, i=0; c<kCharSet; c++)
+   for (c=0, i=0; c<SEG_CHARSET; c++)
      {
         if (c == 1 || (c >= 3 && c <= 20) || c == 22) {
-           alphaflag[c] = FALSE;
-           alphaindex[c] = i;
+           palpha->alphaflag[c] = FALSE;
+           palpha->alphaindex[c] = i;
            ++i;
         } else {
-           alphaflag[c] = TRUE; alphaindex[c] = 20;
+           palpha->alphaflag[c] = TRUE; palpha->alphaindex[c] = 20;
         }
      }
 
-   palpha->alphaindex = alphaindex;
-   palpha->alphaflag = alphaflag;
+   return;
+}
+
+/** Sets up the alphabet and the table of entropy terms for the trigger
+ * windows.  A trigger window with b non-allowed residues has
+ * window - b valid letters, so only maxbogus + 1 rows of terms are needed.
+ * @param ctx the object to be initialized [out]
+ * @param sparamsp the SEG parameters, already checked [in]
+ * @return 0 on success, -1 if memory allocation failed.
+ */
+static Int2
+s_SegContextInit(SSegContext* ctx, const SegParameters* sparamsp)
+{
+   Int4 window = sparamsp->window;
+   Int4 maxbogus = sparamsp->maxbogus;
+   Int4 bogus, count;
+
+   ctx->sparamsp = sparamsp;
+   ctx->entropy_terms = NULL;
+   s_AA20alphaStd(&ctx->alpha);
+
+   if ((Int8)(maxbogus+1)*(window+1) > SEG_MAX_ENTROPY_TERMS)
+      return 0;
 
-   return (palpha);
+   ctx->entropy_terms =
+       (double*) calloc((maxbogus+1)*(window+1), sizeof(double));
+   if (ctx->entropy_terms == NULL)
+      return -1;
+
+   for (bogus = 0; bogus <= maxbogus; bogus++) {
+      double* terms = ctx->entropy_terms + bogus*(window+1);
+      Int4 total = window - bogus;
+
+      for (count = 1; count <= total; count++)
+         terms[count] = s_EntropyTerm(count, total);
+   }
+
+   return 0;
 }
 
 /* Comments in blast_seg.h */
@@ -2277,11 +2214,13 @@ void SegParametersFree(SegParameters* sparamsp)
    return;
 }
 
+
 /* comments in blast_seg.h */
 Int2 SeqBufferSeg (Uint1* sequence, Int4 length, Int4 offset,
                      SegParameters* sparamsp, BlastSeqLoc** seg_locs)
 {
-   SSequence* seqwin;
+   SSegContext ctx;
+   SSequence seq;
    SSeg* segs;
    Boolean params_allocated = FALSE;
    Int2 status = 0;
@@ -2297,41 +2236,42 @@ Int2 SeqBufferSeg (Uint1* sequence, Int4 length, Int4 offset,
          return -1;
    }
 
-   /* make an old-style genwin sequence window object */
-
-   seqwin = s_SSequenceNew();
-   seqwin->seq = (char*) sequence;
-   seqwin->length = length;
-   seqwin->palpha = s_AA20alphaStd();
-
    *seg_locs = NULL;
 
-   /* seg the sequence */
+   /* the alphabet and entropy tables are shared by all windows */
 
-   segs = (SSeg*) NULL;
-   status = s_SegSeq (seqwin, sparamsp, &segs, 0);
+   status = s_SegContextInit(&ctx, sparamsp);
    if (status < 0)
    {
-     seqwin->seq = NULL;
-     s_SSequenceFree (seqwin);
+     if (params_allocated)
+       SegParametersFree(sparamsp);
      return status;
    }
 
-   /* merge the segment if desired. */
-   if (sparamsp->overlaps)
-      s_MergeSegs(seqwin, segs);
+   seq.seq = sequence;
+   seq.length = length;
+
+   /* seg the sequence */
+
+   segs = (SSeg*) NULL;
+   status = s_SegSeq (&ctx, &seq, &segs, 0);
+
+   if (status == 0)
+   {
+     /* merge the segment if desired. */
+     if (sparamsp->overlaps)
+        s_MergeSegs(&seq, segs);
 
-   /* convert segs to seqlocs */
-   s_SegsToBlastSeqLoc(segs, offset, seg_locs);
+     /* convert segs to seqlocs */
+     s_SegsToBlastSeqLoc(segs, offset, seg_locs);
+   }
 
    /* clean up & return */
-   seqwin->seq = NULL;
-   s_SSequenceFree (seqwin);
+   sfree(ctx.entropy_terms);
    s_SegFree (segs);
 
    if(params_allocated)
        SegParametersFree(sparamsp);
 
-   return 0;
+   return status;
 }
-
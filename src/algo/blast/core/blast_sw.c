@@ -34,6 +34,13 @@
 
 #include <algo/blast/core/blast_sw.h>
 #include <algo/blast/core/blast_util.h> /* for NCBI2NA_UNPACK_BASE */
+#include <algo/blast/core/blast_encoding.h> /* for BLASTAA_SIZE */
+
+#if defined(NCBI_SSE)  &&  NCBI_SSE >= 20
+#include <emmintrin.h>
+/** Striped (Farrar) Smith-Waterman is available in this build */
+#define BLAST_SW_STRIPED 1
+#endif
 
 /** swap (pointers to) a pair of sequences */
 #define SWAP_SEQS(A, B) {const Uint1 *tmp = (A); (A) = (B); (B) = tmp; }
@@ -147,6 +154,535 @@ static Int4 s_SmithWatermanScoreOnly(const Uint1 *A, Int4 a_size,
 }
 
 
+#ifdef BLAST_SW_STRIPED
+
+/** Return value of the striped kernels when the score does not fit
+    in the lane width used */
+#define SW_STRIPED_OVERFLOW -1
+
+/** Shortest streamed sequence for which building the striped profile
+    pays for itself; shorter pairs use the scalar code */
+#define SW_STRIPED_MIN_LENGTH 200
+
+/** Allocate an array of 128-bit vectors, aligned to 16 bytes.
+ * @param num Number of vectors [in]
+ * @param base Start of the underlying allocation, to be freed [out]
+ * @return Aligned pointer to the zeroed array, or NULL
+ */
+static __m128i* s_AllocVectors(Int4 num, void **base)
+{
+   char *mem = (char *)calloc((size_t)num * sizeof(__m128i) + 15, 1);
+   *base = mem;
+   if (mem == NULL)
+      return NULL;
+   return (__m128i *)(((size_t)mem + 15) & ~(size_t)15);
+}
+
+/** Update the end of the best alignment found so far by a striped
+ *  kernel with the column just computed. Among the cells that attain
+ *  the best score, s_SmithWatermanScoreOnly and the composition-based
+ *  Smith-Waterman report the one with the smallest position in A and
+ *  then in B; columns are visited by increasing position in B, so a
+ *  column only replaces an end with the same score if its cell comes
+ *  earlier in A.
+ * @param col_best Best score in the column [in]
+ * @param a_pos Smallest position in A attaining col_best [in]
+ * @param b_pos Position in B of the column [in]
+ * @param best Best score so far [in|out]
+ * @param a_end Position in A of the end of the best alignment [in|out]
+ * @param b_end Position in B of the end of the best alignment [in|out]
+ */
+static NCBI_INLINE void s_SmithWatermanStripedUpdateEnd(Int4 col_best,
+                                    Int4 a_pos, Int4 b_pos, Int4 *best,
+                                    Int4 *a_end, Int4 *b_end)
+{
+   if (col_best > *best || (col_best == *best && a_pos < *a_end)) {
+      *best = col_best;
+      *a_end = a_pos;
+      *b_end = b_pos;
+   }
+}
+
+/** Find where in a column of 8-bit striped scores the best score
+ *  first occurs, and update the end of the best alignment with it.
+ * @param h_store The column, in striped order [in]
+ * @param seg_len Number of vectors in the column [in]
+ * @param a_size Length of A; later lanes positions are padding [in]
+ * @param b_pos Position in B of the column [in]
+ * @param col_best Best score in the column [in]
+ * @param best Best score so far [in|out]
+ * @param a_end Position in A of the end of the best alignment [in|out]
+ * @param b_end Position in B of the end of the best alignment [in|out]
+ */
+static void s_SmithWatermanStripedEnd8(const __m128i *h_store,
+                                       Int4 seg_len, Int4 a_size,
+                                       Int4 b_pos, Int4 col_best,
+                                       Int4 *best, Int4 *a_end,
+                                       Int4 *b_end)
+{
+   Int4 i, k;
+   const Uint1 *h = (const Uint1 *)h_store;
+
+   /* lane k of vector i holds position k * seg_len + i of A, so this
+      visits the positions in increasing order */
+   for (k = 0; k < 16; k++) {
+      for (i = 0; i < seg_len; i++) {
+         Int4 pos = k * seg_len + i;
+         if (pos >= a_size)
+            return;
+         if (h[16 * i + k] == col_best) {
+            s_SmithWatermanStripedUpdateEnd(col_best, pos, b_pos,
+                                            best, a_end, b_end);
+            return;
+         }
+      }
+   }
+}
+
+/** Find where in a column of 16-bit striped scores the best score
+ *  first occurs, and update the end of the best alignment with it.
+ *  See s_SmithWatermanStripedEnd8 for the parameters.
+ */
+static void s_SmithWatermanStripedEnd16(const __m128i *h_store,
+                                        Int4 seg_len, Int4 a_size,
+                                        Int4 b_pos, Int4 col_best,
+                                        Int4 *best, Int4 *a_end,
+                                        Int4 *b_end)
+{
+   Int4 i, k;
+   const Int2 *h = (const Int2 *)h_store;
+
+   for (k = 0; k < 8; k++) {
+      for (i = 0; i < seg_len; i++) {
+         Int4 pos = k * seg_len + i;
+         if (pos >= a_size)
+            return;
+         if (h[8 * i + k] == col_best) {
+            s_SmithWatermanStripedUpdateEnd(col_best, pos, b_pos,
+                                            best, a_end, b_end);
+            return;
+         }
+      }
+   }
+}
+
+/** Striped Smith-Waterman score with 16 unsigned 8-bit lanes.
+ *  Each substitution score is split into a positive part, added with
+ *  saturation, and a negative part, subtracted with saturation. H, E
+ *  and F then floor at zero exactly like the local alignment
+ *  recurrence does, and a score of -255 or less always yields zero.
+ * @param profile Striped query profile; for each letter of the
+ *                alphabet, seg_len pairs of (positive, negative)
+ *                score vectors [in]
+ * @param seg_len Number of vectors per lane group [in]
+ * @param B The sequence to scan against the profile [in]
+ * @param b_size Length of B [in]
+ * @param gap_open_extend Cost of a gap of length 1 [in]
+ * @param gap_extend Cost of extending a gap [in]
+ * @param work 4 * seg_len vectors of scratch space [in]
+ * @param a_size Length of the sequence the profile was built from [in]
+ * @param a_end Position in that sequence where the best alignment ends,
+ *              or NULL if not needed [out]
+ * @param b_end Position in B where the best alignment ends [out]
+ * @return The best local score, or SW_STRIPED_OVERFLOW if it
+ *         could not be represented
+ */
+static Int4 s_SmithWatermanStriped8(const __m128i *profile, Int4 seg_len,
+                                    const Uint1 *B, Int4 b_size,
+                                    Uint1 gap_open_extend,
+                                    Uint1 gap_extend, __m128i *work,
+                                    Int4 a_size, Int4 *a_end, Int4 *b_end)
+{
+   Int4 i, j;
+   Uint1 lanes[16];
+   Int4 best = 0;
+   Int4 end_best = 0;
+   __m128i *h_store = work;
+   __m128i *h_load = work + seg_len;
+   __m128i *e_store = work + 2 * seg_len;
+   __m128i *f_store = work + 3 * seg_len;
+   __m128i v_gap_o = _mm_set1_epi8((char)gap_open_extend);
+   __m128i v_gap_e = _mm_set1_epi8((char)gap_extend);
+   __m128i v_zero = _mm_setzero_si128();
+   __m128i v_saturated = _mm_set1_epi8((char)0xff);
+   __m128i v_max = v_zero;
+   __m128i v_end_best = _mm_set1_epi8(1);
+
+   for (i = 0; i < 3 * seg_len; i++)
+      work[i] = v_zero;
+   if (a_end != NULL)
+      *a_end = *b_end = 0;
+
+   for (j = 0; j < b_size; j++) {
+      const __m128i *v_prof = profile + 2 * B[j] * seg_len;
+      __m128i v_f = v_zero;
+      __m128i v_col_max = v_zero;
+      __m128i v_h = _mm_slli_si128(h_store[seg_len - 1], 1);
+      __m128i *tmp = h_load;
+      h_load = h_store;
+      h_store = tmp;
+
+      for (i = 0; i < seg_len; i++) {
+         __m128i v_e = e_store[i];
+
+         /* substitution, then the two gap states and the zero floor */
+         v_h = _mm_adds_epu8(v_h, v_prof[2 * i]);
+         v_h = _mm_subs_epu8(v_h, v_prof[2 * i + 1]);
+         v_h = _mm_max_epu8(v_h, v_e);
+         v_h = _mm_max_epu8(v_h, v_f);
+         f_store[i] = v_f;
+         v_col_max = _mm_max_epu8(v_col_max, v_h);
+         h_store[i] = v_h;
+
+         v_h = _mm_subs_epu8(v_h, v_gap_o);
+         v_e = _mm_subs_epu8(v_e, v_gap_e);
+         e_store[i] = _mm_max_epu8(v_e, v_h);
+         v_f = _mm_subs_epu8(v_f, v_gap_e);
+         v_f = _mm_max_epu8(v_f, v_h);
+
+         v_h = h_load[i];
+      }
+
+      /* lazy F loop: carry gaps that cross the stripe boundaries.
+         A carried gap that is no better than an F already applied
+         to the cell it enters can never change anything further down
+         the lane, so stop once that holds for every lane */
+      v_f = _mm_slli_si128(v_f, 1);
+      i = 0;
+      for (;;) {
+         v_h = _mm_max_epu8(h_store[i], v_f);
+         h_store[i] = v_h;
+         f_store[i] = _mm_max_epu8(f_store[i], v_f);
+         v_h = _mm_subs_epu8(v_h, v_gap_o);
+         e_store[i] = _mm_max_epu8(e_store[i], v_h);
+         v_f = _mm_subs_epu8(v_f, v_gap_e);
+
+         if (++i == seg_len) {
+            i = 0;
+            v_f = _mm_slli_si128(v_f, 1);
+         }
+         if (_mm_movemask_epi8(_mm_cmpeq_epi8(
+                        _mm_subs_epu8(v_f, f_store[i]), v_zero)) == 0xffff)
+            break;
+      }
+
+      /* once any lane saturates the 16-bit kernel has to be run
+         anyway, so stop early */
+      v_max = _mm_max_epu8(v_max, v_col_max);
+      if (_mm_movemask_epi8(_mm_cmpeq_epi8(v_max, v_saturated)) != 0)
+         return SW_STRIPED_OVERFLOW;
+
+      /* a gap never scores as high as the cell it started from, so
+         the carried F values above cannot create a new maximum */
+      if (a_end != NULL &&
+          _mm_movemask_epi8(_mm_cmpeq_epi8(
+                  _mm_max_epu8(v_col_max, v_end_best), v_col_max)) != 0) {
+         Int4 col_best = 0;
+         _mm_storeu_si128((__m128i *)lanes, v_col_max);
+         for (i = 0; i < 16; i++)
+            col_best = MAX(col_best, (Int4)lanes[i]);
+         s_SmithWatermanStripedEnd8(h_store, seg_len, a_size, j,
+                                    col_best, &end_best, a_end, b_end);
+         v_end_best = _mm_set1_epi8((char)end_best);
+      }
+   }
+
+   _mm_storeu_si128((__m128i *)lanes, v_max);
+   for (i = 0; i < 16; i++)
+      best = MAX(best, (Int4)lanes[i]);
+
+   /* a lane that reached 255 may have clipped */
+   if (best >= 255)
+      return SW_STRIPED_OVERFLOW;
+   return best;
+}
+
+/** Striped Smith-Waterman score with 8 signed 16-bit lanes.
+ * @param profile Striped query profile, seg_len vectors per letter
+ *                of the alphabet [in]
+ * @param seg_len Number of vectors per profile row [in]
+ * @param B The sequence to scan against the profile [in]
+ * @param b_size Length of B [in]
+ * @param gap_open_extend Cost of a gap of length 1 [in]
+ * @param gap_extend Cost of extending a gap [in]
+ * @param work 4 * seg_len vectors of scratch space [in]
+ * @param a_size Length of the sequence the profile was built from [in]
+ * @param a_end Position in that sequence where the best alignment ends,
+ *              or NULL if not needed [out]
+ * @param b_end Position in B where the best alignment ends [out]
+ * @return The best local score, or SW_STRIPED_OVERFLOW if it
+ *         could not be represented
+ */
+static Int4 s_SmithWatermanStriped16(const __m128i *profile, Int4 seg_len,
+                                     const Uint1 *B, Int4 b_size,
+                                     Int2 gap_open_extend, Int2 gap_extend,
+                                     __m128i *work,
+                                     Int4 a_size, Int4 *a_end, Int4 *b_end)
+{
+   Int4 i, j;
+   Int2 lanes[8];
+   Int4 best = 0;
+   Int4 end_best = 0;
+   __m128i *h_store = work;
+   __m128i *h_load = work + seg_len;
+   __m128i *e_store = work + 2 * seg_len;
+   __m128i *f_store = work + 3 * seg_len;
+   __m128i v_gap_o = _mm_set1_epi16(gap_open_extend);
+   __m128i v_gap_e = _mm_set1_epi16(gap_extend);
+   __m128i v_zero = _mm_setzero_si128();
+   __m128i v_max = v_zero;
+   __m128i v_end_best = _mm_set1_epi16(1);
+
+   for (i = 0; i < 3 * seg_len; i++)
+      work[i] = v_zero;
+   if (a_end != NULL)
+      *a_end = *b_end = 0;
+
+   for (j = 0; j < b_size; j++) {
+      const __m128i *v_prof = profile + B[j] * seg_len;
+      __m128i v_f = _mm_set1_epi16(INT2_MIN);
+      __m128i v_col_max = v_zero;
+      __m128i v_h = _mm_slli_si128(h_store[seg_len - 1], 2);
+      __m128i *tmp = h_load;
+      h_load = h_store;
+      h_store = tmp;
+
+      for (i = 0; i < seg_len; i++) {
+         __m128i v_e = e_store[i];
+
+         v_h = _mm_adds_epi16(v_h, v_prof[i]);
+         v_h = _mm_max_epi16(v_h, v_e);
+         v_h = _mm_max_epi16(v_h, v_f);
+         f_store[i] = v_f;
+         v_h = _mm_max_epi16(v_h, v_zero);
+         v_col_max = _mm_max_epi16(v_col_max, v_h);
+         h_store[i] = v_h;
+
+         v_h = _mm_subs_epi16(v_h, v_gap_o);
+         v_e = _mm_subs_epi16(v_e, v_gap_e);
+         e_store[i] = _mm_max_epi16(v_e, v_h);
+         v_f = _mm_subs_epi16(v_f, v_gap_e);
+         v_f = _mm_max_epi16(v_f, v_h);
+
+         v_h = h_load[i];
+      }
+
+      v_f = _mm_insert_epi16(_mm_slli_si128(v_f, 2), INT2_MIN, 0);
+      i = 0;
+      for (;;) {
+         v_h = _mm_max_epi16(h_store[i], v_f);
+         h_store[i] = v_h;
+         f_store[i] = _mm_max_epi16(f_store[i], v_f);
+         v_h = _mm_subs_epi16(v_h, v_gap_o);
+         e_store[i] = _mm_max_epi16(e_store[i], v_h);
+         v_f = _mm_subs_epi16(v_f, v_gap_e);
+
+         if (++i == seg_len) {
+            i = 0;
+            v_f = _mm_insert_epi16(_mm_slli_si128(v_f, 2), INT2_MIN, 0);
+         }
+         if (_mm_movemask_epi8(_mm_cmpgt_epi16(v_f, f_store[i])) == 0)
+            break;
+      }
+
+      v_max = _mm_max_epi16(v_max, v_col_max);
+      if (a_end != NULL &&
+          _mm_movemask_epi8(_mm_cmplt_epi16(v_col_max, v_end_best))
+                                                               != 0xffff) {
+         Int4 col_best = 0;
+         _mm_storeu_si128((__m128i *)lanes, v_col_max);
+         for (i = 0; i < 8; i++)
+            col_best = MAX(col_best, (Int4)lanes[i]);
+         s_SmithWatermanStripedEnd16(h_store, seg_len, a_size, j,
+                                     col_best, &end_best, a_end, b_end);
+         v_end_best = _mm_set1_epi16((Int2)end_best);
+      }
+   }
+
+   _mm_storeu_si128((__m128i *)lanes, v_max);
+   for (i = 0; i < 8; i++)
+      best = MAX(best, (Int4)lanes[i]);
+
+   if (best >= INT2_MAX)
+      return SW_STRIPED_OVERFLOW;
+   return best;
+}
+
+/** Compute the same score as s_SmithWatermanScoreOnly using the
+ *  striped vectorization of Farrar (Bioinformatics 23:156, 2007).
+ *  A is laid out across vector lanes and B is streamed past it.
+ *  The 8-bit kernel is tried first; if its lanes saturate the
+ *  search is repeated with 16-bit lanes.
+ * @param A The first sequence [in]
+ * @param a_size Length of the first sequence [in]
+ * @param B The second sequence [in]
+ * @param b_size Length of the second sequence [in]
+ * @param gap_open Gap open penalty [in]
+ * @param gap_extend Gap extension penalty [in]
+ * @param matrix Score matrix, indexed by [letter of A][letter of B],
+ *               or by [position in A][letter of B] if is_pssm [in]
+ * @param is_pssm TRUE if matrix has one row per position of A [in]
+ * @param symmetric TRUE if matrix[a][b] == matrix[b][a] for all
+ *                  letters; only used if is_pssm is FALSE [in]
+ * @param a_end Position in A where the best alignment ends, or NULL
+ *              if not needed [out]
+ * @param b_end Position in B where the best alignment ends [out]
+ * @return The score of the best local alignment between A and B, or
+ *         SW_STRIPED_OVERFLOW if the scalar code should be used instead
+ */
+static Int4 s_SmithWatermanScoreOnlyStriped(const Uint1 *A, Int4 a_size,
+                            const Uint1 *B, Int4 b_size,
+                            Int4 gap_open, Int4 gap_extend,
+                            Int4 **matrix, Boolean is_pssm,
+                            Boolean symmetric, Int4 *a_end, Int4 *b_end)
+{
+   Int4 i, k, r;
+   Int4 max_score = 0;
+   Int4 seg_len8;
+   Int4 seg_len16;
+   Int4 gap_open_extend = gap_open + gap_extend;
+   Int4 score = SW_STRIPED_OVERFLOW;
+   void *profile_mem = NULL;
+   void *work_mem = NULL;
+   __m128i *profile;
+   __m128i *work;
+
+   if (a_size <= 0 || b_size <= 0) {
+      if (a_end != NULL)
+         *a_end = *b_end = 0;
+      return 0;
+   }
+   /* the lazy F loop stops once a carried gap is no better than
+      opening a new one, which needs both penalties to be positive */
+   if (gap_open <= 0 || gap_extend <= 0 || gap_open_extend > INT2_MAX)
+      return SW_STRIPED_OVERFLOW;
+
+   if (!is_pssm && symmetric && a_end == NULL) {
+      /* build the profile on the shorter sequence and stream the
+         longer one past it */
+      if (a_size > b_size) {
+         SWAP_SEQS(A, B);
+         SWAP_INT(a_size, b_size);
+      }
+   }
+
+   if (b_size < SW_STRIPED_MIN_LENGTH)
+      return SW_STRIPED_OVERFLOW;
+
+   seg_len8 = (a_size + 15) / 16;
+   seg_len16 = (a_size + 7) / 8;
+
+   /* the profile lives on A: entry (r, pos) is the score of letter
+      pos of A against residue r. Scores at or below INT2_MIN (e.g.
+      BLAST_SCORE_MIN entries for gaps) can never start or extend
+      a local alignment, so clamping them loses nothing */
+   for (i = 0; i < a_size; i++) {
+      const Int4 *row = is_pssm ? matrix[i] : matrix[A[i]];
+      for (r = 0; r < BLASTAA_SIZE; r++)
+         max_score = MAX(max_score, row[r]);
+   }
+   if (max_score >= INT2_MAX)
+      return SW_STRIPED_OVERFLOW;
+
+   profile = s_AllocVectors(BLASTAA_SIZE * MAX(2 * seg_len8, seg_len16),
+                            &profile_mem);
+   work = s_AllocVectors(4 * seg_len16, &work_mem);
+   if (profile == NULL || work == NULL)
+      goto done;
+
+   /* 8-bit pass: positions past the end of A always score zero */
+   if (gap_open_extend < 255 && max_score < 255) {
+      for (r = 0; r < BLASTAA_SIZE; r++) {
+         Uint1 *p = (Uint1 *)(profile + 2 * r * seg_len8);
+         for (i = 0; i < seg_len8; i++) {
+            for (k = 0; k < 16; k++) {
+               Int4 pos = k * seg_len8 + i;
+               Int4 s = -255;
+               if (pos < a_size)
+                  s = is_pssm ? matrix[pos][r] : matrix[A[pos]][r];
+               p[32 * i + k] = (Uint1)MAX(s, 0);
+               p[32 * i + 16 + k] = (Uint1)MIN(MAX(-s, 0), 255);
+            }
+         }
+      }
+      score = s_SmithWatermanStriped8(profile, seg_len8, B, b_size,
+                                      (Uint1)gap_open_extend,
+                                      (Uint1)gap_extend, work,
+                                      a_size, a_end, b_end);
+      if (score != SW_STRIPED_OVERFLOW)
+         goto done;
+   }
+
+   /* 16-bit pass: INT2_MIN added with saturation always floors to zero */
+   for (r = 0; r < BLASTAA_SIZE; r++) {
+      Int2 *p = (Int2 *)(profile + r * seg_len16);
+      for (i = 0; i < seg_len16; i++) {
+         for (k = 0; k < 8; k++) {
+            Int4 pos = k * seg_len16 + i;
+            Int4 s = INT2_MIN;
+            if (pos < a_size)
+               s = is_pssm ? matrix[pos][r] : matrix[A[pos]][r];
+            p[8 * i + k] = (Int2)MAX(s, INT2_MIN);
+         }
+      }
+   }
+   score = s_SmithWatermanStriped16(profile, seg_len16, B, b_size,
+                                    (Int2)gap_open_extend,
+                                    (Int2)gap_extend, work,
+                                    a_size, a_end, b_end);
+
+done:
+   free(profile_mem);
+   free(work_mem);
+   return score;
+}
+
+#endif /* BLAST_SW_STRIPED */
+
+/* See blast_sw.h for details */
+Int4 SmithWatermanScoreOnly(const Uint1 *A, Int4 a_size,
+                            const Uint1 *B, Int4 b_size,
+                            Int4 gap_open, Int4 gap_extend,
+                            BlastGapAlignStruct *gap_align,
+                            Boolean allow_simd)
+{
+#ifdef BLAST_SW_STRIPED
+   if (allow_simd) {
+      Boolean is_pssm = gap_align->positionBased;
+      Int4 score = s_SmithWatermanScoreOnlyStriped(A, a_size, B, b_size,
+                              gap_open, gap_extend,
+                              is_pssm ? gap_align->sbp->psi_matrix->pssm->data
+                                      : gap_align->sbp->matrix->data,
+                              is_pssm, TRUE, NULL, NULL);
+      if (score != SW_STRIPED_OVERFLOW)
+         return score;
+   }
+#endif
+   return s_SmithWatermanScoreOnly(A, a_size, B, b_size,
+                                   gap_open, gap_extend, gap_align);
+}
+
+/* See blast_sw.h for details */
+Int4 SmithWatermanScoreOnlyStriped(const Uint1 *query, Int4 query_length,
+                                   const Uint1 *subject,
+                                   Int4 subject_length,
+                                   Int4 gap_open, Int4 gap_extend,
+                                   Int4 **matrix, Boolean position_based,
+                                   Int4 *query_end, Int4 *subject_end)
+{
+#ifdef BLAST_SW_STRIPED
+   Int4 score = s_SmithWatermanScoreOnlyStriped(query, query_length,
+                                                subject, subject_length,
+                                                gap_open, gap_extend,
+                                                matrix, position_based,
+                                                FALSE, query_end,
+                                                subject_end);
+   if (score != SW_STRIPED_OVERFLOW)
+      return score;
+#endif
+   return -1;
+}
+
 /** Compute the score of the best local alignment between
  *  two nucleotide sequences. One of the sequences must be in
  *  packed format. For nucleotide Smith-Waterman, the vast
@@ -692,14 +1228,14 @@ Int2 BLAST_SmithWatermanGetGappedScore (EBlastProgramType program_number,
       }
 
       if (is_prot) {
-         score = s_SmithWatermanScoreOnly(
+         score = SmithWatermanScoreOnly(
                               query->sequence + curr_ctx->query_offset,
                               curr_ctx->query_length,
                               subject->sequence,
                               subject->length,
                               score_params->gap_open,
                               score_params->gap_extend,
-                              gap_align);
+                              gap_align, TRUE);
       }
       else {
          score = s_NuclSmithWaterman(subject->sequence,
@@ -294,6 +294,170 @@ s_GetNextNonAffineTback(Int4 **last_seq2_off, Int4 d,
 }
 
 
+#ifndef WORDS_BIGENDIAN
+/** Matching runs are found 8 bases at a time, by comparing 8 bytes of
+    seq1 against 8 bytes of (unpacked) seq2 in one machine word. This
+    relies on the first byte in memory being the least significant one */
+#define GREEDY_WORD_MATCH 1
+#endif
+
+#ifdef GREEDY_WORD_MATCH
+
+/** Number of bases compared per machine word */
+#define GREEDY_WORD_BASES 8
+
+/** The four bases of an ncbi2na byte, one per byte, first base in the
+    least significant byte */
+#define UNPACK4(b) ((Uint4)(((b) >> 6) & 3) | \
+                    ((Uint4)(((b) >> 4) & 3) << 8) | \
+                    ((Uint4)(((b) >> 2) & 3) << 16) | \
+                    ((Uint4)((b) & 3) << 24))
+/** Table entries for 4 consecutive bytes */
+#define UNPACK_ROW4(b) UNPACK4(b), UNPACK4((b)+1), UNPACK4((b)+2), \
+                       UNPACK4((b)+3)
+/** Table entries for 16 consecutive bytes */
+#define UNPACK_ROW16(b) UNPACK_ROW4(b), UNPACK_ROW4((b)+4), \
+                        UNPACK_ROW4((b)+8), UNPACK_ROW4((b)+12)
+/** Table entries for 64 consecutive bytes */
+#define UNPACK_ROW64(b) UNPACK_ROW16(b), UNPACK_ROW16((b)+16), \
+                        UNPACK_ROW16((b)+32), UNPACK_ROW16((b)+48)
+
+/** Unpacked form of every ncbi2na byte */
+static const Uint4 s_Ncbi2naUnpacked[256] = {
+    UNPACK_ROW64(0), UNPACK_ROW64(64), UNPACK_ROW64(128), UNPACK_ROW64(192)
+};
+
+/** Mask selecting the bits that are nonzero only for ambiguous bases */
+#define AMBIG_BYTES_MASK 0xFCFCFCFCFCFCFCFCULL
+
+/** Load 8 unaligned bytes
+ * @param p Address of the first byte [in]
+ * @return The bytes, first byte in the least significant position
+ */
+static NCBI_INLINE Uint8 s_LoadWord(const Uint1 *p)
+{
+    Uint8 word;
+    memcpy(&word, p, sizeof(word));
+    return word;
+}
+
+/** Unpack 8 consecutive bases of an ncbi2na sequence
+ * @param seq The compressed sequence [in]
+ * @param pos Offset of the first base, counted from the start of seq [in]
+ * @return The bases, one per byte, first base in the least
+ *         significant byte
+ */
+static NCBI_INLINE Uint8 s_UnpackWord(const Uint1 *seq, Int4 pos)
+{
+    const Uint1 *p = seq + pos / 4;
+    Int4 shift = 8 * (pos % 4);
+    Uint8 word = (Uint8)s_Ncbi2naUnpacked[p[0]] |
+                 ((Uint8)s_Ncbi2naUnpacked[p[1]] << 32);
+
+    /* the third byte is only touched if some of its bases are needed */
+    if (shift)
+        word = (word >> shift) |
+               ((Uint8)s_Ncbi2naUnpacked[p[2]] << (64 - shift));
+    return word;
+}
+
+/** Number of zero bytes below the lowest nonzero byte of a word
+ * @param word The word, which must be nonzero [in]
+ */
+static NCBI_INLINE Int4 s_LowZeroBytes(Uint8 word)
+{
+#if defined(__GNUC__)
+    return __builtin_ctzll(word) / 8;
+#else
+    Int4 n = 0;
+    while ((word & 0xFF) == 0) {
+        word >>= 8;
+        n++;
+    }
+    return n;
+#endif
+}
+
+/** Number of zero bytes above the highest nonzero byte of a word
+ * @param word The word, which must be nonzero [in]
+ */
+static NCBI_INLINE Int4 s_HighZeroBytes(Uint8 word)
+{
+#if defined(__GNUC__)
+    return __builtin_clzll(word) / 8;
+#else
+    Int4 n = 0;
+    while ((word >> 56) == 0) {
+        word <<= 8;
+        n++;
+    }
+    return n;
+#endif
+}
+
+/** Skip over exact matches 8 bases at a time. Stops at or before the
+ * first mismatch; the caller finishes the comparison (and performs
+ * sentinel detection) one base at a time, so the result of
+ * s_FindFirstMismatch does not depend on this function.
+ * Arguments are as for s_FindFirstMismatch; seq1_index and seq2_index
+ * are advanced past the matches found [in|out]
+ */
+static NCBI_INLINE void s_SkipWordMatches(const Uint1 *seq1, const Uint1 *seq2,
+                                          Int4 len1, Int4 len2,
+                                          Int4 *seq1_index, Int4 *seq2_index,
+                                          Boolean reverse, Uint1 rem)
+{
+    Int4 i1 = *seq1_index;
+    Int4 i2 = *seq2_index;
+    Int4 num_words = MIN(len1 - i1, len2 - i2) / GREEDY_WORD_BASES;
+
+    /* A seq1 byte that is an ambiguity never matches: for compressed
+       seq2 it cannot equal an unpacked base, and for uncompressed seq2
+       it is forced to differ by AMBIG_BYTES_MASK */
+
+    for (; num_words > 0; num_words--) {
+        Uint8 word1, diff;
+
+        if (reverse) {
+            word1 = s_LoadWord(seq1 + len1 - GREEDY_WORD_BASES - i1);
+            if (rem == 4) {
+                Uint8 word2 = s_LoadWord(seq2 + len2 - GREEDY_WORD_BASES - i2);
+                diff = (word1 ^ word2) | (word1 & AMBIG_BYTES_MASK);
+            } else {
+                diff = word1 ^ s_UnpackWord(seq2,
+                                            len2 - GREEDY_WORD_BASES - i2);
+            }
+            if (diff) {
+                Int4 matches = s_HighZeroBytes(diff);
+                i1 += matches;
+                i2 += matches;
+                break;
+            }
+        } else {
+            word1 = s_LoadWord(seq1 + i1);
+            if (rem == 4) {
+                Uint8 word2 = s_LoadWord(seq2 + i2);
+                diff = (word1 ^ word2) | (word1 & AMBIG_BYTES_MASK);
+            } else {
+                diff = word1 ^ s_UnpackWord(seq2, i2 + rem);
+            }
+            if (diff) {
+                Int4 matches = s_LowZeroBytes(diff);
+                i1 += matches;
+                i2 += matches;
+                break;
+            }
+        }
+        i1 += GREEDY_WORD_BASES;
+        i2 += GREEDY_WORD_BASES;
+    }
+
+    *seq1_index = i1;
+    *seq2_index = i2;
+}
+
+#endif /* GREEDY_WORD_MATCH */
+
 /** Find the first mismatch in a pair of sequences
  * @param seq1 First sequence (always uncompressed) [in]
  * @param seq2 Second sequence (compressed or uncompressed) [in]
@@ -318,6 +482,11 @@ static NCBI_INLINE Int4 s_FindFirstMismatch(const Uint1 *seq1, const Uint1 *seq2
 {
     Int4 tmp = seq1_index;
 
+#ifdef GREEDY_WORD_MATCH
+    s_SkipWordMatches(seq1, seq2, len1, len2, &seq1_index, &seq2_index,
+                      reverse, rem);
+#endif
+
     /* Sentry detection here should be relatively inexpensive: The
        sentry value cannot appear in the query, so detection only
        needs to be done at exit from the subject-query matching loop.
@@ -0,0 +1,790 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/** @file lookup_cache.c
+ * Saving finalized lookup tables to disk and loading them back
+ * @sa lookup_cache.h
+ */
+
+#include <algo/blast/core/lookup_cache.h>
+#include <algo/blast/core/blast_aalookup.h>
+#include <algo/blast/core/blast_nalookup.h>
+#include <algo/blast/core/blast_filter.h>
+#include <algo/blast/core/blast_util.h>
+
+/** Identifies a lookup table cache file */
+static const char kLutCacheMagic[8] = { 'B', 'L', 'A', 'S', 'T', 'L', 'U', 'T' };
+
+/** Version of the cache file format; bump when the layout of the file or
+    of any lookup table structure written to it changes */
+#define LUT_CACHE_VERSION 2
+
+/** Written to every file to detect a byte order mismatch */
+#define LUT_CACHE_BYTE_ORDER 0x01020304
+
+/** Arrays in a cache file start on multiples of this many bytes */
+#define LUT_CACHE_ALIGN 8
+
+/** Fixed-size header of a lookup table cache file */
+typedef struct SLutCacheHeader {
+    char magic[8];         /**< kLutCacheMagic */
+    Uint4 version;         /**< LUT_CACHE_VERSION */
+    Uint4 byte_order;      /**< LUT_CACHE_BYTE_ORDER */
+    Uint8 key;             /**< key from LookupTableCacheKey */
+    Int4 lut_type;         /**< ELookupTableType of the table */
+    Int4 query_length;     /**< length of the query the table indexes */
+    Int4 cell_size;        /**< size of one thick backbone cell, to detect
+                                structure layout differences */
+    Int4 reserved;         /**< padding, always zero */
+} SLutCacheHeader;
+
+/*------------------------- key computation ---------------------------*/
+
+/** Initial value of the 64-bit FNV-1a hash */
+#define LUT_CACHE_FNV_OFFSET 14695981039346656037ULL
+/** Multiplier of the 64-bit FNV-1a hash */
+#define LUT_CACHE_FNV_PRIME 1099511628211ULL
+
+/** Add a block of bytes to a running 64-bit FNV-1a hash
+ * @param hash the hash so far [in]
+ * @param data the bytes to add [in]
+ * @param size number of bytes [in]
+ * @return the updated hash
+ */
+static Uint8 s_HashBytes(Uint8 hash, const void* data, size_t size)
+{
+    const Uint1* p = (const Uint1*)data;
+    size_t i;
+
+    for (i = 0; i < size; i++) {
+        hash ^= p[i];
+        hash *= LUT_CACHE_FNV_PRIME;
+    }
+    return hash;
+}
+
+/** Add an integer to a running hash */
+static Uint8 s_HashInt(Uint8 hash, Int8 value)
+{
+    return s_HashBytes(hash, &value, sizeof(value));
+}
+
+/** Add the contents of a score matrix to a running hash
+ * @param hash the hash so far [in]
+ * @param matrix the matrix [in]
+ * @return the updated hash
+ */
+static Uint8 s_HashMatrix(Uint8 hash, const SBlastScoreMatrix* matrix)
+{
+    size_t i;
+
+    hash = s_HashInt(hash, (Int8)matrix->ncols);
+    hash = s_HashInt(hash, (Int8)matrix->nrows);
+    for (i = 0; i < matrix->ncols; i++) {
+        hash = s_HashBytes(hash, matrix->data[i],
+                           matrix->nrows * sizeof(matrix->data[i][0]));
+    }
+    return hash;
+}
+
+Boolean LookupTableCacheSupported(const LookupTableOptions* lookup_options)
+{
+    if (!lookup_options || lookup_options->db_filter)
+        return FALSE;
+
+    switch (lookup_options->lut_type) {
+    case eAaLookupTable:
+    case eNaLookupTable:
+    case eSmallNaLookupTable:
+    case eMBLookupTable:
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
+Uint8 LookupTableCacheKey(const BLAST_SequenceBlk* query,
+                          const LookupTableOptions* lookup_options,
+                          const QuerySetUpOptions* query_options,
+                          const BlastSeqLoc* lookup_segments,
+                          const BlastScoreBlk* sbp)
+{
+    Uint8 hash = LUT_CACHE_FNV_OFFSET;
+    Boolean mask_at_hash = FALSE;
+    const BlastSeqLoc* loc;
+
+    hash = s_HashInt(hash, LUT_CACHE_VERSION);
+
+    /* query residues and the parts of the query that are indexed */
+    hash = s_HashInt(hash, query->length);
+    hash = s_HashBytes(hash, query->sequence, query->length);
+    for (loc = lookup_segments; loc; loc = loc->next) {
+        hash = s_HashInt(hash, loc->ssr->left);
+        hash = s_HashInt(hash, loc->ssr->right);
+    }
+
+    /* lookup table options */
+    hash = s_HashBytes(hash, &lookup_options->threshold,
+                       sizeof(lookup_options->threshold));
+    hash = s_HashInt(hash, lookup_options->lut_type);
+    hash = s_HashInt(hash, lookup_options->word_size);
+    hash = s_HashInt(hash, lookup_options->mb_template_length);
+    hash = s_HashInt(hash, lookup_options->mb_template_type);
+    hash = s_HashInt(hash, lookup_options->program_number);
+    hash = s_HashInt(hash, lookup_options->stride);
+
+    /* filtering options that change the table beyond the lookup
+       segments (masked words are kept for mask-at-hash) */
+    if (query_options) {
+        mask_at_hash =
+            SBlastFilterOptionsMaskAtHash(query_options->filtering_options) ||
+            (query_options->filter_string &&
+             strstr(query_options->filter_string, "m"));
+    }
+    hash = s_HashInt(hash, mask_at_hash);
+
+    /* protein tables contain neighboring words, which depend on the
+       scores */
+    if (lookup_options->lut_type == eAaLookupTable && sbp) {
+        if (sbp->psi_matrix && sbp->psi_matrix->pssm)
+            hash = s_HashMatrix(hash, sbp->psi_matrix->pssm);
+        else if (sbp->matrix)
+            hash = s_HashMatrix(hash, sbp->matrix);
+    }
+
+    return hash;
+}
+
+/** Collect the lookup table options stored in a cache file, so that a
+ * file is used only with the options it was built with even if two keys
+ * collide
+ * @param lookup_options the options [in]
+ * @param scalars the options other than the threshold [out]
+ */
+static void s_LookupOptionScalars(const LookupTableOptions* lookup_options,
+                                  Int8 scalars[6])
+{
+    scalars[0] = lookup_options->lut_type;
+    scalars[1] = lookup_options->word_size;
+    scalars[2] = lookup_options->mb_template_length;
+    scalars[3] = lookup_options->mb_template_type;
+    scalars[4] = lookup_options->program_number;
+    scalars[5] = lookup_options->stride;
+}
+
+/*------------------------------ writing ------------------------------*/
+
+/** Write a block of bytes, padded to LUT_CACHE_ALIGN bytes
+ * @param fp the file [in]
+ * @param data the bytes to write [in]
+ * @param size number of bytes [in]
+ * @return TRUE on success
+ */
+static Boolean s_Write(FILE* fp, const void* data, size_t size)
+{
+    static const Uint1 kZeros[LUT_CACHE_ALIGN] = { 0 };
+    size_t pad = (LUT_CACHE_ALIGN - size % LUT_CACHE_ALIGN) % LUT_CACHE_ALIGN;
+
+    if (size > 0 && fwrite(data, 1, size, fp) != size)
+        return FALSE;
+    if (pad > 0 && fwrite(kZeros, 1, pad, fp) != pad)
+        return FALSE;
+    return TRUE;
+}
+
+/** Write an array preceded by its size in bytes. A NULL array is
+ * written as an empty one
+ * @param fp the file [in]
+ * @param data the array [in]
+ * @param size size of the array in bytes [in]
+ * @return TRUE on success
+ */
+static Boolean s_WriteArray(FILE* fp, const void* data, Int8 size)
+{
+    if (!data)
+        size = 0;
+    return s_Write(fp, &size, sizeof(size)) &&
+           s_Write(fp, data, (size_t)size);
+}
+
+/** Write the query residues and the lookup table options a table was
+ * built from
+ * @param fp the file [in]
+ * @param query the query [in]
+ * @param lookup_options the lookup table options [in]
+ * @return TRUE on success
+ */
+static Boolean s_WriteInputs(FILE* fp, const BLAST_SequenceBlk* query,
+                             const LookupTableOptions* lookup_options)
+{
+    Int8 scalars[6];
+
+    s_LookupOptionScalars(lookup_options, scalars);
+    return s_WriteArray(fp, query->sequence, query->length) &&
+        s_Write(fp, &lookup_options->threshold,
+                sizeof(lookup_options->threshold)) &&
+        s_Write(fp, scalars, sizeof(scalars));
+}
+
+/** Write a list of locations as a count followed by (left, right) pairs
+ * @param fp the file [in]
+ * @param locs the list [in]
+ * @return TRUE on success
+ */
+static Boolean s_WriteSeqLocs(FILE* fp, const BlastSeqLoc* locs)
+{
+    const BlastSeqLoc* loc;
+    Int8 count = 0;
+
+    for (loc = locs; loc; loc = loc->next)
+        count++;
+    if (!s_Write(fp, &count, sizeof(count)))
+        return FALSE;
+
+    for (loc = locs; loc; loc = loc->next) {
+        Int4 range[2];
+        range[0] = loc->ssr->left;
+        range[1] = loc->ssr->right;
+        if (!s_Write(fp, range, sizeof(range)))
+            return FALSE;
+    }
+    return TRUE;
+}
+
+/** Write the scalar fields and arrays of a small nucleotide table */
+static Boolean s_WriteSmallNa(FILE* fp, const BlastSmallNaLookupTable* lut)
+{
+    Int4 scalars[7];
+
+    scalars[0] = lut->mask;
+    scalars[1] = lut->word_length;
+    scalars[2] = lut->lut_word_length;
+    scalars[3] = lut->scan_step;
+    scalars[4] = lut->backbone_size;
+    scalars[5] = lut->longest_chain;
+    scalars[6] = lut->overflow_size;
+
+    return s_Write(fp, scalars, sizeof(scalars)) &&
+        s_WriteArray(fp, lut->final_backbone,
+                     (Int8)lut->backbone_size * sizeof(Int2)) &&
+        s_WriteArray(fp, lut->overflow,
+                     (Int8)lut->overflow_size * sizeof(Int2)) &&
+        s_WriteSeqLocs(fp, lut->masked_locations);
+}
+
+/** Write the scalar fields and arrays of a standard nucleotide table */
+static Boolean s_WriteNa(FILE* fp, const BlastNaLookupTable* lut)
+{
+    Int4 scalars[7];
+
+    scalars[0] = lut->mask;
+    scalars[1] = lut->word_length;
+    scalars[2] = lut->lut_word_length;
+    scalars[3] = lut->scan_step;
+    scalars[4] = lut->backbone_size;
+    scalars[5] = lut->longest_chain;
+    scalars[6] = lut->overflow_size;
+
+    return s_Write(fp, scalars, sizeof(scalars)) &&
+        s_WriteArray(fp, lut->thick_backbone,
+                     (Int8)lut->backbone_size *
+                     sizeof(NaLookupBackboneCell)) &&
+        s_WriteArray(fp, lut->overflow,
+                     (Int8)lut->overflow_size * sizeof(Int4)) &&
+        s_WriteArray(fp, lut->pv,
+                     (Int8)((lut->backbone_size >> PV_ARRAY_BTS) + 1) *
+                     sizeof(PV_ARRAY_TYPE)) &&
+        s_WriteSeqLocs(fp, lut->masked_locations);
+}
+
+/** Write the scalar fields and arrays of a megablast table */
+static Boolean s_WriteMB(FILE* fp, const BlastMBLookupTable* lut,
+                         Int4 query_length)
+{
+    Int8 scalars[14];
+    const Int8 kTableBytes = lut->hashsize * sizeof(Int4);
+    const Int8 kNextPosBytes = ((Int8)query_length + 1) * sizeof(Int4);
+
+    scalars[0] = lut->word_length;
+    scalars[1] = lut->lut_word_length;
+    scalars[2] = lut->hashsize;
+    scalars[3] = lut->discontiguous;
+    scalars[4] = lut->template_length;
+    scalars[5] = lut->template_type;
+    scalars[6] = lut->two_templates;
+    scalars[7] = lut->second_template_type;
+    scalars[8] = lut->stride;
+    scalars[9] = lut->scan_step;
+    scalars[10] = lut->pv_array_bts;
+    scalars[11] = lut->longest_chain;
+    scalars[12] = lut->num_unique_pos_added;
+    scalars[13] = lut->num_words_added;
+
+    return s_Write(fp, scalars, sizeof(scalars)) &&
+        s_WriteArray(fp, lut->hashtable, kTableBytes) &&
+        s_WriteArray(fp, lut->hashtable2, kTableBytes) &&
+        s_WriteArray(fp, lut->next_pos, kNextPosBytes) &&
+        s_WriteArray(fp, lut->next_pos2, kNextPosBytes) &&
+        s_WriteArray(fp, lut->pv_array,
+                     (lut->hashsize >> lut->pv_array_bts) * PV_ARRAY_BYTES) &&
+        s_WriteSeqLocs(fp, lut->masked_locations);
+}
+
+/** Size of one thick backbone cell of a protein table */
+static size_t s_AaCellSize(EBoneType bone_type)
+{
+    return bone_type == eBackbone ? sizeof(AaLookupBackboneCell) :
+                                    sizeof(AaLookupSmallboneCell);
+}
+
+/** Write the scalar fields and arrays of a protein table */
+static Boolean s_WriteAa(FILE* fp, const BlastAaLookupTable* lut)
+{
+    Int4 scalars[13];
+    const size_t kOverflowCell =
+        lut->bone_type == eBackbone ? sizeof(Int4) : sizeof(Uint2);
+
+    scalars[0] = lut->threshold;
+    scalars[1] = lut->mask;
+    scalars[2] = lut->charsize;
+    scalars[3] = lut->word_length;
+    scalars[4] = lut->lut_word_length;
+    scalars[5] = lut->alphabet_size;
+    scalars[6] = lut->backbone_size;
+    scalars[7] = lut->longest_chain;
+    scalars[8] = lut->bone_type;
+    scalars[9] = lut->overflow_size;
+    scalars[10] = lut->use_pssm;
+    scalars[11] = lut->neighbor_matches;
+    scalars[12] = lut->exact_matches;
+
+    return s_Write(fp, scalars, sizeof(scalars)) &&
+        s_WriteArray(fp, lut->thick_backbone,
+                     (Int8)lut->backbone_size *
+                     s_AaCellSize(lut->bone_type)) &&
+        s_WriteArray(fp, lut->overflow,
+                     (Int8)lut->overflow_size * kOverflowCell) &&
+        s_WriteArray(fp, lut->pv,
+                     (Int8)((lut->backbone_size >> PV_ARRAY_BTS) + 1) *
+                     sizeof(PV_ARRAY_TYPE));
+}
+
+/** Size of one thick backbone cell of a lookup table, stored in the
+ * file header so that a file written by a build with a different
+ * structure layout is rejected
+ */
+static Int4 s_CellSize(const LookupTableWrap* lookup_wrap)
+{
+    switch (lookup_wrap->lut_type) {
+    case eSmallNaLookupTable:
+        return sizeof(Int2);
+    case eNaLookupTable:
+        return sizeof(NaLookupBackboneCell);
+    case eMBLookupTable:
+        return sizeof(Int4);
+    case eAaLookupTable:
+        return (Int4)s_AaCellSize(
+                    ((const BlastAaLookupTable*)lookup_wrap->lut)->bone_type);
+    default:
+        return 0;
+    }
+}
+
+Int2 LookupTableWrapSave(const LookupTableWrap* lookup_wrap, Uint8 key,
+                         const BLAST_SequenceBlk* query,
+                         const LookupTableOptions* lookup_options,
+                         const char* file_name)
+{
+    SLutCacheHeader header;
+    FILE* fp;
+    Boolean ok = FALSE;
+
+    if (!lookup_wrap || !lookup_wrap->lut || !query || !lookup_options ||
+        !file_name)
+        return -1;
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, kLutCacheMagic, sizeof(header.magic));
+    header.version = LUT_CACHE_VERSION;
+    header.byte_order = LUT_CACHE_BYTE_ORDER;
+    header.key = key;
+    header.lut_type = lookup_wrap->lut_type;
+    header.query_length = query->length;
+    header.cell_size = s_CellSize(lookup_wrap);
+    if (header.cell_size == 0)
+        return -1;
+
+    fp = fopen(file_name, "wb");
+    if (!fp)
+        return -1;
+
+    if (s_Write(fp, &header, sizeof(header)) &&
+        s_WriteInputs(fp, query, lookup_options)) {
+        switch (lookup_wrap->lut_type) {
+        case eSmallNaLookupTable:
+            ok = s_WriteSmallNa(fp,
+                        (const BlastSmallNaLookupTable*)lookup_wrap->lut);
+            break;
+        case eNaLookupTable:
+            ok = s_WriteNa(fp, (const BlastNaLookupTable*)lookup_wrap->lut);
+            break;
+        case eMBLookupTable:
+            ok = s_WriteMB(fp, (const BlastMBLookupTable*)lookup_wrap->lut,
+                           query->length);
+            break;
+        case eAaLookupTable:
+            ok = s_WriteAa(fp, (const BlastAaLookupTable*)lookup_wrap->lut);
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (fclose(fp) != 0)
+        ok = FALSE;
+    if (!ok) {
+        remove(file_name);
+        return -1;
+    }
+    return 0;
+}
+
+/*------------------------------ reading ------------------------------*/
+
+/** Read a block of bytes written by s_Write
+ * @param fp the file [in]
+ * @param data where to put the bytes [out]
+ * @param size number of bytes [in]
+ * @return TRUE on success
+ */
+static Boolean s_Read(FILE* fp, void* data, size_t size)
+{
+    Uint1 pad_bytes[LUT_CACHE_ALIGN];
+    size_t pad = (LUT_CACHE_ALIGN - size % LUT_CACHE_ALIGN) % LUT_CACHE_ALIGN;
+
+    if (size > 0 && fread(data, 1, size, fp) != size)
+        return FALSE;
+    if (pad > 0 && fread(pad_bytes, 1, pad, fp) != pad)
+        return FALSE;
+    return TRUE;
+}
+
+/** Read an array written by s_WriteArray into newly allocated memory
+ * @param fp the file [in]
+ * @param expected_size the size the array must have, in bytes; an empty
+ *                      array is also accepted [in]
+ * @param array the array, or NULL if it was empty [out]
+ * @return TRUE on success
+ */
+static Boolean s_ReadArray(FILE* fp, Int8 expected_size, void** array)
+{
+    Int8 size;
+
+    *array = NULL;
+    if (!s_Read(fp, &size, sizeof(size)))
+        return FALSE;
+    if (size == 0)
+        return TRUE;
+    if (size != expected_size)
+        return FALSE;
+
+    *array = malloc((size_t)size);
+    if (*array == NULL)
+        return FALSE;
+    return s_Read(fp, *array, (size_t)size);
+}
+
+/** Check that the query residues and lookup table options written by
+ * s_WriteInputs are those of the current search
+ * @param fp the file [in]
+ * @param query the query [in]
+ * @param lookup_options the lookup table options [in]
+ * @return TRUE if they are
+ */
+static Boolean s_ReadAndCompareInputs(FILE* fp,
+                                      const BLAST_SequenceBlk* query,
+                                      const LookupTableOptions* lookup_options)
+{
+    Uint1* residues = NULL;
+    double threshold;
+    Int8 scalars[6], expected_scalars[6];
+    Boolean same;
+
+    if (!s_ReadArray(fp, query->length, (void**)&residues))
+        return FALSE;
+    same = query->length == 0 ||
+        (residues && memcmp(residues, query->sequence, query->length) == 0);
+    sfree(residues);
+    if (!same)
+        return FALSE;
+
+    s_LookupOptionScalars(lookup_options, expected_scalars);
+    return s_Read(fp, &threshold, sizeof(threshold)) &&
+        memcmp(&threshold, &lookup_options->threshold,
+               sizeof(threshold)) == 0 &&
+        s_Read(fp, scalars, sizeof(scalars)) &&
+        memcmp(scalars, expected_scalars, sizeof(scalars)) == 0;
+}
+
+/** Read a list of locations written by s_WriteSeqLocs
+ * @param fp the file [in]
+ * @param locs the list [out]
+ * @return TRUE on success
+ */
+static Boolean s_ReadSeqLocs(FILE* fp, BlastSeqLoc** locs)
+{
+    BlastSeqLoc* tail = NULL;
+    Int8 i, count;
+
+    *locs = NULL;
+    if (!s_Read(fp, &count, sizeof(count)) || count < 0)
+        return FALSE;
+
+    for (i = 0; i < count; i++) {
+        Int4 range[2];
+        if (!s_Read(fp, range, sizeof(range)))
+            return FALSE;
+        tail = BlastSeqLocNew(tail ? &tail : locs, range[0], range[1]);
+    }
+    return TRUE;
+}
+
+/** Read a small nucleotide table written by s_WriteSmallNa */
+static Boolean s_ReadSmallNa(FILE* fp, BlastSmallNaLookupTable* lut)
+{
+    Int4 scalars[7];
+
+    if (!s_Read(fp, scalars, sizeof(scalars)))
+        return FALSE;
+    lut->mask = scalars[0];
+    lut->word_length = scalars[1];
+    lut->lut_word_length = scalars[2];
+    lut->scan_step = scalars[3];
+    lut->backbone_size = scalars[4];
+    lut->longest_chain = scalars[5];
+    lut->overflow_size = scalars[6];
+
+    return s_ReadArray(fp, (Int8)lut->backbone_size * sizeof(Int2),
+                       (void**)&lut->final_backbone) &&
+        lut->final_backbone != NULL &&
+        s_ReadArray(fp, (Int8)lut->overflow_size * sizeof(Int2),
+                    (void**)&lut->overflow) &&
+        s_ReadSeqLocs(fp, &lut->masked_locations);
+}
+
+/** Read a standard nucleotide table written by s_WriteNa */
+static Boolean s_ReadNa(FILE* fp, BlastNaLookupTable* lut)
+{
+    Int4 scalars[7];
+
+    if (!s_Read(fp, scalars, sizeof(scalars)))
+        return FALSE;
+    lut->mask = scalars[0];
+    lut->word_length = scalars[1];
+    lut->lut_word_length = scalars[2];
+    lut->scan_step = scalars[3];
+    lut->backbone_size = scalars[4];
+    lut->longest_chain = scalars[5];
+    lut->overflow_size = scalars[6];
+
+    return s_ReadArray(fp, (Int8)lut->backbone_size *
+                       sizeof(NaLookupBackboneCell),
+                       (void**)&lut->thick_backbone) &&
+        lut->thick_backbone != NULL &&
+        s_ReadArray(fp, (Int8)lut->overflow_size * sizeof(Int4),
+                    (void**)&lut->overflow) &&
+        s_ReadArray(fp, (Int8)((lut->backbone_size >> PV_ARRAY_BTS) + 1) *
+                    sizeof(PV_ARRAY_TYPE), (void**)&lut->pv) &&
+        lut->pv != NULL &&
+        s_ReadSeqLocs(fp, &lut->masked_locations);
+}
+
+/** Read a megablast table written by s_WriteMB */
+static Boolean s_ReadMB(FILE* fp, BlastMBLookupTable* lut,
+                        Int4 query_length)
+{
+    Int8 scalars[14];
+    Int8 table_bytes, next_pos_bytes;
+
+    if (!s_Read(fp, scalars, sizeof(scalars)))
+        return FALSE;
+    lut->word_length = (Int4)scalars[0];
+    lut->lut_word_length = (Int4)scalars[1];
+    lut->hashsize = scalars[2];
+    lut->discontiguous = (Boolean)scalars[3];
+    lut->template_length = (Int4)scalars[4];
+    lut->template_type = (EDiscTemplateType)scalars[5];
+    lut->two_templates = (Boolean)scalars[6];
+    lut->second_template_type = (EDiscTemplateType)scalars[7];
+    lut->stride = (Boolean)scalars[8];
+    lut->scan_step = (Int4)scalars[9];
+    lut->pv_array_bts = (Int4)scalars[10];
+    lut->longest_chain = (Int4)scalars[11];
+    lut->num_unique_pos_added = (Int4)scalars[12];
+    lut->num_words_added = (Int4)scalars[13];
+
+    if (lut->hashsize != (1LL << (2 * lut->lut_word_length)) ||
+        lut->pv_array_bts < 0 || lut->pv_array_bts > 32)
+        return FALSE;
+
+    table_bytes = lut->hashsize * sizeof(Int4);
+    next_pos_bytes = ((Int8)query_length + 1) * sizeof(Int4);
+
+    return s_ReadArray(fp, table_bytes, (void**)&lut->hashtable) &&
+        lut->hashtable != NULL &&
+        s_ReadArray(fp, table_bytes, (void**)&lut->hashtable2) &&
+        s_ReadArray(fp, next_pos_bytes, (void**)&lut->next_pos) &&
+        s_ReadArray(fp, next_pos_bytes, (void**)&lut->next_pos2) &&
+        s_ReadArray(fp, (lut->hashsize >> lut->pv_array_bts) * PV_ARRAY_BYTES,
+                    (void**)&lut->pv_array) &&
+        lut->pv_array != NULL &&
+        s_ReadSeqLocs(fp, &lut->masked_locations);
+}
+
+/** Read a protein table written by s_WriteAa */
+static Boolean s_ReadAa(FILE* fp, BlastAaLookupTable* lut)
+{
+    Int4 scalars[13];
+
+    if (!s_Read(fp, scalars, sizeof(scalars)))
+        return FALSE;
+    lut->threshold = scalars[0];
+    lut->mask = scalars[1];
+    lut->charsize = scalars[2];
+    lut->word_length = scalars[3];
+    lut->lut_word_length = scalars[4];
+    lut->alphabet_size = scalars[5];
+    lut->backbone_size = scalars[6];
+    lut->longest_chain = scalars[7];
+    lut->bone_type = (EBoneType)scalars[8];
+    lut->overflow_size = scalars[9];
+    lut->use_pssm = (Boolean)scalars[10];
+    lut->neighbor_matches = scalars[11];
+    lut->exact_matches = scalars[12];
+
+    if (lut->bone_type != eBackbone && lut->bone_type != eSmallbone)
+        return FALSE;
+
+    return s_ReadArray(fp, (Int8)lut->backbone_size *
+                       s_AaCellSize(lut->bone_type),
+                       &lut->thick_backbone) &&
+        lut->thick_backbone != NULL &&
+        s_ReadArray(fp, (Int8)lut->overflow_size *
+                    (lut->bone_type == eBackbone ?
+                     sizeof(Int4) : sizeof(Uint2)),
+                    &lut->overflow) &&
+        s_ReadArray(fp, (Int8)((lut->backbone_size >> PV_ARRAY_BTS) + 1) *
+                    sizeof(PV_ARRAY_TYPE), (void**)&lut->pv) &&
+        lut->pv != NULL;
+}
+
+Int2 LookupTableWrapLoad(const char* file_name, Uint8 key,
+                         BLAST_SequenceBlk* query,
+                         const LookupTableOptions* lookup_options,
+                         LookupTableWrap** lookup_wrap_ptr)
+{
+    SLutCacheHeader header;
+    LookupTableWrap* lookup_wrap;
+    FILE* fp;
+    Boolean ok = FALSE;
+
+    if (!lookup_wrap_ptr)
+        return -1;
+    *lookup_wrap_ptr = NULL;
+    if (!file_name || !query || !lookup_options)
+        return -1;
+
+    fp = fopen(file_name, "rb");
+    if (!fp)
+        return -1;
+
+    if (!s_Read(fp, &header, sizeof(header)) ||
+        memcmp(header.magic, kLutCacheMagic, sizeof(header.magic)) != 0 ||
+        header.version != LUT_CACHE_VERSION ||
+        header.byte_order != LUT_CACHE_BYTE_ORDER ||
+        header.key != key ||
+        header.query_length != query->length ||
+        !s_ReadAndCompareInputs(fp, query, lookup_options)) {
+        fclose(fp);
+        return -1;
+    }
+
+    lookup_wrap = (LookupTableWrap*)calloc(1, sizeof(LookupTableWrap));
+    if (!lookup_wrap) {
+        fclose(fp);
+        return -1;
+    }
+    lookup_wrap->lut_type = (ELookupTableType)header.lut_type;
+
+    switch (lookup_wrap->lut_type) {
+    case eSmallNaLookupTable:
+        lookup_wrap->lut = calloc(1, sizeof(BlastSmallNaLookupTable));
+        ok = lookup_wrap->lut &&
+             s_ReadSmallNa(fp, (BlastSmallNaLookupTable*)lookup_wrap->lut);
+        break;
+    case eNaLookupTable:
+        lookup_wrap->lut = calloc(1, sizeof(BlastNaLookupTable));
+        ok = lookup_wrap->lut &&
+             s_ReadNa(fp, (BlastNaLookupTable*)lookup_wrap->lut);
+        break;
+    case eMBLookupTable:
+        lookup_wrap->lut = calloc(1, sizeof(BlastMBLookupTable));
+        ok = lookup_wrap->lut &&
+             s_ReadMB(fp, (BlastMBLookupTable*)lookup_wrap->lut,
+                      query->length);
+        break;
+    case eAaLookupTable:
+        lookup_wrap->lut = calloc(1, sizeof(BlastAaLookupTable));
+        ok = lookup_wrap->lut &&
+             s_ReadAa(fp, (BlastAaLookupTable*)lookup_wrap->lut);
+        break;
+    default:
+        break;
+    }
+    fclose(fp);
+
+    if (ok && header.cell_size != s_CellSize(lookup_wrap))
+        ok = FALSE;
+
+    if (!ok) {
+        if (lookup_wrap->lut)
+            LookupTableWrapFree(lookup_wrap);
+        else
+            sfree(lookup_wrap);
+        return -1;
+    }
+
+    /* the small table scans against a compressed copy of the query,
+       which is created while the table is built */
+    if (lookup_wrap->lut_type == eSmallNaLookupTable &&
+        query->compressed_nuc_seq_start == NULL) {
+        BlastCompressBlastnaSequence(query);
+    }
+
+    *lookup_wrap_ptr = lookup_wrap;
+    return 0;
+}
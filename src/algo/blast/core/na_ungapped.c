@@ -1592,6 +1592,51 @@ s_BlastSmallNaExtend(const BlastOffsetPair * offset_pairs, Int4 num_hits,
     return hits_extended;
 }
 
+/** Get the word lengths and the scanning and extension routines chosen
+ * for a nucleotide lookup table.
+ * @param lookup_wrap Pointer to the (wrapper) lookup table structure [in]
+ * @param word_length The real word length [out]
+ * @param lut_word_length The lookup table word length [out]
+ * @param scansub The scanning routine [out]
+ * @param extend The extension routine [out]
+ */
+static void s_NaGetWordFinderRoutines(const LookupTableWrap * lookup_wrap,
+                                      Int4 * word_length,
+                                      Int4 * lut_word_length,
+                                      TNaScanSubjectFunction * scansub,
+                                      TNaExtendFunction * extend)
+{
+    if (lookup_wrap->lut_type == eSmallNaLookupTable) {
+        BlastSmallNaLookupTable *lookup = 
+                                (BlastSmallNaLookupTable *) lookup_wrap->lut;
+        *word_length = lookup->word_length;
+        *lut_word_length = lookup->lut_word_length;
+        *scansub = (TNaScanSubjectFunction)lookup->scansub_callback;
+        *extend = (TNaExtendFunction)lookup->extend_callback;
+    }
+    else if (lookup_wrap->lut_type == eMBLookupTable) {
+        BlastMBLookupTable *lookup = 
+                                (BlastMBLookupTable *) lookup_wrap->lut;
+        if (lookup->discontiguous) {
+            *word_length = lookup->template_length;
+            *lut_word_length = lookup->template_length;
+        } else {
+            *word_length = lookup->word_length;
+            *lut_word_length = lookup->lut_word_length;
+        }
+        *scansub = (TNaScanSubjectFunction)lookup->scansub_callback;
+        *extend = (TNaExtendFunction)lookup->extend_callback;
+    }
+    else {
+        BlastNaLookupTable *lookup = 
+                                (BlastNaLookupTable *) lookup_wrap->lut;
+        *word_length = lookup->word_length;
+        *lut_word_length = lookup->lut_word_length;
+        *scansub = (TNaScanSubjectFunction)lookup->scansub_callback;
+        *extend = (TNaExtendFunction)lookup->extend_callback;
+    }
+}
+
 /* Description in na_ungapped.h */
 
 Int2 BlastNaWordFinder(BLAST_SequenceBlk * subject,
@@ -1614,35 +1659,8 @@ Int2 BlastNaWordFinder(BLAST_SequenceBlk * subject,
     Int4 word_length;
     Int4 lut_word_length;
 
-    if (lookup_wrap->lut_type == eSmallNaLookupTable) {
-        BlastSmallNaLookupTable *lookup = 
-                                (BlastSmallNaLookupTable *) lookup_wrap->lut;
-        word_length = lookup->word_length;
-        lut_word_length = lookup->lut_word_length;
-        scansub = (TNaScanSubjectFunction)lookup->scansub_callback;
-        extend = (TNaExtendFunction)lookup->extend_callback;
-    }
-    else if (lookup_wrap->lut_type == eMBLookupTable) {
-        BlastMBLookupTable *lookup = 
-                                (BlastMBLookupTable *) lookup_wrap->lut;
-        if (lookup->discontiguous) {
-            word_length = lookup->template_length;
-            lut_word_length = lookup->template_length;
-        } else {
-            word_length = lookup->word_length;
-            lut_word_length = lookup->lut_word_length;
-        }
-        scansub = (TNaScanSubjectFunction)lookup->scansub_callback;
-        extend = (TNaExtendFunction)lookup->extend_callback;
-    }
-    else {
-        BlastNaLookupTable *lookup = 
-                                (BlastNaLookupTable *) lookup_wrap->lut;
-        word_length = lookup->word_length;
-        lut_word_length = lookup->lut_word_length;
-        scansub = (TNaScanSubjectFunction)lookup->scansub_callback;
-        extend = (TNaExtendFunction)lookup->extend_callback;
-    }
+    s_NaGetWordFinderRoutines(lookup_wrap, &word_length, &lut_word_length,
+                              &scansub, &extend);
 
     scan_range[0] = 0;  /* subject seq mask index */
     scan_range[1] = 0;	/* start pos of scan */
@@ -1694,6 +1712,209 @@ Int2 BlastNaWordFinder(BLAST_SequenceBlk * subject,
     return 0;
 }
 
+/* Description in na_ungapped.h */
+
+BlastNaSubjectBatch* BlastNaSubjectBatchNew(Int4 max_subjects,
+                                            Int4 max_residues)
+{
+    BlastNaSubjectBatch* batch =
+        (BlastNaSubjectBatch*) calloc(1, sizeof(BlastNaSubjectBatch));
+
+    if (!batch)
+        return NULL;
+
+    /* Every subject may need one byte more than its residues fill */
+    batch->max_bytes = max_residues / COMPRESSION_RATIO + max_subjects;
+    batch->max_subjects = max_subjects;
+    batch->sequence = (Uint1*) malloc(batch->max_bytes);
+    batch->oids = (Int4*) malloc(max_subjects * sizeof(Int4));
+    batch->starts = (Int4*) malloc(max_subjects * sizeof(Int4));
+    batch->lengths = (Int4*) malloc(max_subjects * sizeof(Int4));
+    batch->hit_starts = (Int4*) malloc((max_subjects + 1) * sizeof(Int4));
+
+    if (!batch->sequence || !batch->oids || !batch->starts ||
+        !batch->lengths || !batch->hit_starts)
+        return BlastNaSubjectBatchFree(batch);
+
+    return batch;
+}
+
+/* Description in na_ungapped.h */
+
+BlastNaSubjectBatch* BlastNaSubjectBatchFree(BlastNaSubjectBatch* batch)
+{
+    if (!batch)
+        return NULL;
+
+    sfree(batch->sequence);
+    sfree(batch->oids);
+    sfree(batch->starts);
+    sfree(batch->lengths);
+    sfree(batch->hits);
+    sfree(batch->hit_starts);
+    sfree(batch);
+    return NULL;
+}
+
+/* Description in na_ungapped.h */
+
+void BlastNaSubjectBatchReset(BlastNaSubjectBatch* batch)
+{
+    batch->num_subjects = 0;
+    batch->sequence_bytes = 0;
+    batch->num_hits = 0;
+}
+
+/* Description in na_ungapped.h */
+
+Boolean BlastNaSubjectBatchAdd(BlastNaSubjectBatch* batch,
+                               const BLAST_SequenceBlk* subject)
+{
+    /* Copy the bytes holding residues, plus the byte that follows the last
+       complete byte; scanning routines may read, but do not use, it */
+    Int4 num_bytes = subject->length / COMPRESSION_RATIO + 1;
+    Int4 index = batch->num_subjects;
+
+    ASSERT(subject->mask_type == eNoSubjMasking);
+
+    if (index == batch->max_subjects ||
+        batch->sequence_bytes + num_bytes > batch->max_bytes)
+        return FALSE;
+
+    memcpy(batch->sequence + batch->sequence_bytes, subject->sequence,
+           (subject->length + COMPRESSION_RATIO - 1) / COMPRESSION_RATIO);
+    if (subject->length % COMPRESSION_RATIO == 0)
+        batch->sequence[batch->sequence_bytes + num_bytes - 1] = 0;
+
+    batch->oids[index] = subject->oid;
+    batch->starts[index] = batch->sequence_bytes * COMPRESSION_RATIO;
+    batch->lengths[index] = subject->length;
+    batch->sequence_bytes += num_bytes;
+    batch->num_subjects++;
+    return TRUE;
+}
+
+/* Description in na_ungapped.h */
+
+void BlastNaSubjectBatchGetSubject(const BlastNaSubjectBatch* batch,
+                                   Int4 index, BLAST_SequenceBlk* subject)
+{
+    ASSERT(index >= 0 && index < batch->num_subjects);
+
+    memset((void*) subject, 0, sizeof(BLAST_SequenceBlk));
+    subject->sequence = batch->sequence +
+                        batch->starts[index] / COMPRESSION_RATIO;
+    subject->length = batch->lengths[index];
+    subject->oid = batch->oids[index];
+    subject->mask_type = eNoSubjMasking;
+}
+
+/* Description in na_ungapped.h */
+
+Int2 BlastNaSubjectBatchScan(BlastNaSubjectBatch* batch,
+                             LookupTableWrap* lookup_wrap,
+                             BlastOffsetPair* offset_pairs,
+                             Int4 max_hits)
+{
+    BLAST_SequenceBlk all_subjects;
+    TNaScanSubjectFunction scansub = NULL;
+    TNaExtendFunction extend = NULL;
+    Int4 word_length, lut_word_length;
+    Int4 index;
+
+    s_NaGetWordFinderRoutines(lookup_wrap, &word_length, &lut_word_length,
+                              &scansub, &extend);
+    ASSERT(scansub);
+
+    memset((void*) &all_subjects, 0, sizeof(all_subjects));
+    all_subjects.sequence = batch->sequence;
+    all_subjects.length = batch->sequence_bytes * COMPRESSION_RATIO;
+    all_subjects.mask_type = eNoSubjMasking;
+
+    batch->num_hits = 0;
+    for (index = 0; index < batch->num_subjects; index++) {
+        Int4 start = batch->starts[index];
+        /* start and end (inclusive) of the scan, as in BlastNaWordFinder
+           for an unmasked subject */
+        Int4 scan_range[2];
+
+        scan_range[0] = start;
+        scan_range[1] = start + batch->lengths[index] - lut_word_length;
+        batch->hit_starts[index] = batch->num_hits;
+
+        while (scan_range[0] <= scan_range[1]) {
+            Int4 i;
+            Int4 hitsfound = scansub(lookup_wrap, &all_subjects,
+                                     offset_pairs, max_hits, scan_range);
+
+            if (batch->num_hits + hitsfound > batch->max_hits) {
+                Int4 new_size = MAX(2 * batch->max_hits,
+                                    batch->num_hits + hitsfound);
+                BlastOffsetPair* new_hits = (BlastOffsetPair*)
+                    realloc(batch->hits, new_size * sizeof(BlastOffsetPair));
+                if (!new_hits)
+                    return -1;
+                batch->hits = new_hits;
+                batch->max_hits = new_size;
+            }
+
+            for (i = 0; i < hitsfound; i++) {
+                BlastOffsetPair* hit = batch->hits + batch->num_hits + i;
+                hit->qs_offsets.q_off = offset_pairs[i].qs_offsets.q_off;
+                hit->qs_offsets.s_off =
+                    offset_pairs[i].qs_offsets.s_off - start;
+            }
+            batch->num_hits += hitsfound;
+        }
+    }
+    batch->hit_starts[batch->num_subjects] = batch->num_hits;
+
+    return 0;
+}
+
+/* Description in na_ungapped.h */
+
+Int2 BlastNaWordFinderBatch(BLAST_SequenceBlk* subject,
+                            BLAST_SequenceBlk* query,
+                            BlastQueryInfo* query_info,
+                            LookupTableWrap* lookup_wrap,
+                            Int4** matrix,
+                            const BlastInitialWordParameters* word_params,
+                            Blast_ExtendWord* ewp,
+                            const BlastNaSubjectBatch* batch,
+                            Int4 index,
+                            BlastInitHitList* init_hitlist,
+                            BlastUngappedStats* ungapped_stats)
+{
+    TNaScanSubjectFunction scansub = NULL;
+    TNaExtendFunction extend = NULL;
+    Int4 word_length, lut_word_length;
+    Int4 total_hits = batch->hit_starts[index + 1] - batch->hit_starts[index];
+    Int4 hits_extended = 0;
+
+    s_NaGetWordFinderRoutines(lookup_wrap, &word_length, &lut_word_length,
+                              &scansub, &extend);
+    ASSERT(extend);
+    ASSERT(subject->length == batch->lengths[index]);
+
+    if (total_hits > 0) {
+        hits_extended = extend(batch->hits + batch->hit_starts[index],
+                               total_hits, word_params, lookup_wrap, query,
+                               subject, matrix, query_info, ewp,
+                               init_hitlist, subject->length);
+    }
+
+    Blast_ExtendWordExit(ewp, subject->length);
+
+    Blast_UngappedStatsUpdate(ungapped_stats, total_hits, hits_extended,
+                              init_hitlist->total);
+
+    if (word_params->ungapped_extension)
+        Blast_InitHitListSortByScore(init_hitlist);
+
+    return 0;
+}
+
 Int2 MB_IndexedWordFinder( 
         BLAST_SequenceBlk * subject,
         BLAST_SequenceBlk * query,
@@ -0,0 +1,228 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/** @file blast_sw_perf.cpp
+ * Command line tool to compare the scalar and striped score-only
+ * Smith-Waterman kernels of blast_sw.c.
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbiapp.hpp>
+#include <corelib/ncbistr.hpp>
+#include <corelib/ncbitime.hpp>
+#include <util/random_gen.hpp>
+#include <algo/blast/core/blast_sw.h>
+#include <algo/blast/core/blast_stat.h>
+#include <algo/blast/core/blast_encoding.h>
+#include <algo/blast/composition_adjustment/smith_waterman.h>
+
+#ifndef SKIP_DOXYGEN_PROCESSING
+USING_NCBI_SCOPE;
+#endif
+
+/// The application class
+class CBlastSWPerfApp : public CNcbiApplication
+{
+public:
+    /** @inheritDoc */
+    CBlastSWPerfApp() {}
+private:
+    /** @inheritDoc */
+    virtual void Init();
+    /** @inheritDoc */
+    virtual int Run();
+
+    /// Fill seq with random residues (no gaps, no ambiguities)
+    static void x_RandomSequence(CRandom& rng, vector<Uint1>& seq);
+};
+
+void
+CBlastSWPerfApp::x_RandomSequence(CRandom& rng, vector<Uint1>& seq)
+{
+    // ncbistdaa codes of the 20 standard amino acids
+    static const Uint1 kResidues[] = { 1, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+                                       13, 14, 15, 16, 17, 18, 19, 20, 22 };
+    NON_CONST_ITERATE(vector<Uint1>, it, seq) {
+        *it = kResidues[rng.GetRand(0, ArraySize(kResidues) - 1)];
+    }
+}
+
+void CBlastSWPerfApp::Init()
+{
+    HideStdArgs(fHideLogfile | fHideConffile | fHideFullVersion |
+                fHideXmlHelp | fHideDryRun);
+
+    unique_ptr<CArgDescriptions> arg_desc(new CArgDescriptions);
+    arg_desc->SetUsageContext(GetArguments().GetProgramBasename(),
+                  "Smith-Waterman score-only kernel performance tester");
+
+    arg_desc->AddDefaultKey("matrix", "name", "Scoring matrix",
+                            CArgDescriptions::eString, "BLOSUM62");
+    arg_desc->AddDefaultKey("gapopen", "cost", "Gap open penalty",
+                            CArgDescriptions::eInteger, "11");
+    arg_desc->AddDefaultKey("gapextend", "cost", "Gap extension penalty",
+                            CArgDescriptions::eInteger, "1");
+    arg_desc->AddDefaultKey("query_len", "length", "Query length",
+                            CArgDescriptions::eInteger, "300");
+    arg_desc->AddDefaultKey("subject_len", "length", "Subject length",
+                            CArgDescriptions::eInteger, "500");
+    arg_desc->AddDefaultKey("num_pairs", "number",
+                            "Number of random sequence pairs to align",
+                            CArgDescriptions::eInteger, "1000");
+    arg_desc->AddDefaultKey("seed", "number", "Random number generator seed",
+                            CArgDescriptions::eInteger, "1");
+    arg_desc->AddDefaultKey("percent_related", "percent",
+                            "Percentage of pairs that share a diverged copy "
+                            "of part of the query",
+                            CArgDescriptions::eInteger, "10");
+    arg_desc->SetConstraint("percent_related",
+                            new CArgAllow_Integers(0, 100));
+    arg_desc->AddFlag("compo",
+                      "Time the Smith-Waterman used with composition-based "
+                      "statistics (score and end points) instead");
+
+    SetupArgDescriptions(arg_desc.release());
+}
+
+int CBlastSWPerfApp::Run(void)
+{
+    const CArgs& args = GetArgs();
+    const int kNumPairs = args["num_pairs"].AsInteger();
+    const int kGapOpen = args["gapopen"].AsInteger();
+    const int kGapExtend = args["gapextend"].AsInteger();
+
+    BlastScoreBlk* sbp = BlastScoreBlkNew(BLASTAA_SEQ_CODE, 1);
+    sbp->name = strdup(args["matrix"].AsString().c_str());
+    if (Blast_ScoreBlkMatrixFill(sbp, NULL) != 0) {
+        BlastScoreBlkFree(sbp);
+        ERR_POST(Error << "Unknown matrix " << args["matrix"].AsString());
+        return 1;
+    }
+
+    BlastGapAlignStruct gap_align;
+    memset(&gap_align, 0, sizeof(gap_align));
+    gap_align.sbp = sbp;
+
+    CRandom rng((CRandom::TValue)args["seed"].AsInteger());
+    vector< vector<Uint1> > queries(kNumPairs), subjects(kNumPairs);
+    for (int i = 0; i < kNumPairs; i++) {
+        queries[i].resize(args["query_len"].AsInteger());
+        subjects[i].resize(args["subject_len"].AsInteger());
+        x_RandomSequence(rng, queries[i]);
+        x_RandomSequence(rng, subjects[i]);
+        if ((int)rng.GetRand(0, 99) >= args["percent_related"].AsInteger()) {
+            continue;
+        }
+        // plant a diverged copy of part of the query, as in a true hit
+        for (size_t j = 0; j < min(queries[i].size(), subjects[i].size()) / 2;
+             j++) {
+            if (rng.GetRand(0, 3) != 0) {
+                subjects[i][j + subjects[i].size() / 4] = queries[i][j];
+            }
+        }
+    }
+
+    // score, query end and subject end of each pair
+    vector<Int4> scores[2];
+    double elapsed[2];
+    Blast_ForbiddenRanges forbidden;
+    Blast_ForbiddenRangesInitialize(&forbidden,
+                                    args["query_len"].AsInteger());
+    for (int simd = 0; simd < 2; simd++) {
+        CStopWatch sw(CStopWatch::eStart);
+        scores[simd].reserve(3 * kNumPairs);
+        for (int i = 0; i < kNumPairs; i++) {
+            if ( !args["compo"] ) {
+                scores[simd].push_back(
+                    SmithWatermanScoreOnly(&queries[i][0], queries[i].size(),
+                                           &subjects[i][0],
+                                           subjects[i].size(),
+                                           kGapOpen, kGapExtend, &gap_align,
+                                           (Boolean)simd));
+                continue;
+            }
+            Int4 score = -1, query_end = 0, subject_end = 0;
+            if (simd) {
+                score = SmithWatermanScoreOnlyStriped(&queries[i][0],
+                                           queries[i].size(),
+                                           &subjects[i][0],
+                                           subjects[i].size(),
+                                           kGapOpen, kGapExtend,
+                                           sbp->matrix->data, FALSE,
+                                           &query_end, &subject_end);
+            }
+            if (score < 0) {
+                Blast_SmithWatermanScoreOnly(&score, &subject_end,
+                                             &query_end, &subjects[i][0],
+                                             subjects[i].size(),
+                                             &queries[i][0],
+                                             queries[i].size(),
+                                             sbp->matrix->data,
+                                             kGapOpen, kGapExtend, FALSE,
+                                             &forbidden);
+            }
+            scores[simd].push_back(score);
+            scores[simd].push_back(query_end);
+            scores[simd].push_back(subject_end);
+        }
+        elapsed[simd] = sw.Elapsed();
+    }
+    Blast_ForbiddenRangesRelease(&forbidden);
+
+    int mismatches = 0;
+    const int kValuesPerPair = args["compo"] ? 3 : 1;
+    for (int i = 0; i < kNumPairs; i++) {
+        if ( !equal(scores[0].begin() + i * kValuesPerPair,
+                    scores[0].begin() + (i + 1) * kValuesPerPair,
+                    scores[1].begin() + i * kValuesPerPair) ) {
+            mismatches++;
+        }
+    }
+
+    const double kCells = (double)kNumPairs * args["query_len"].AsInteger() *
+        args["subject_len"].AsInteger();
+    const char* kNames[] = { "Scalar", "Striped" };
+    for (int simd = 0; simd < 2; simd++) {
+        cout << kNames[simd] << ": " << elapsed[simd] << " s, "
+             << NStr::NumericToString((Uint8)(kCells / elapsed[simd]),
+                                      NStr::fWithCommas)
+             << " cells/second" << endl;
+    }
+    cout << "Result mismatches: " << mismatches << endl;
+
+    sfree(gap_align.dp_mem);
+    BlastScoreBlkFree(sbp);
+    return mismatches ? 1 : 0;
+}
+
+
+#ifndef SKIP_DOXYGEN_PROCESSING
+int main(int argc, const char* argv[] /*, const char* envp[]*/)
+{
+    return CBlastSWPerfApp().AppMain(argc, argv);
+}
+#endif /* SKIP_DOXYGEN_PROCESSING */
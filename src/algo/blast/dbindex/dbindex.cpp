@@ -37,6 +37,7 @@
 #include <string>
 #include <corelib/ncbi_limits.hpp>
 #include <corelib/ncbifile.hpp>
+#include <corelib/ncbiapp_api.hpp>
 
 #include <objmgr/object_manager.hpp>
 #include <objmgr/seq_vector.hpp>
@@ -434,6 +435,56 @@ CRef< CDbIndex > CDbIndex::Load( const std::string & fname, bool nomap )
     }
 }
 
+//-------------------------------------------------------------------------
+CDbIndex::TMapMode CDbIndex::ParseMapMode( const std::string & mode )
+{
+    static const struct {
+        const char * name;
+        TMapMode flag;
+    } kModeNames[] = {
+        { "hugepage", fMapHugePage },
+        { "populate", fMapPopulate },
+        { "lock",     fMapLock     }
+    };
+
+    TMapMode result = 0;
+    vector< string > tokens;
+    NStr::Split( mode, ", \t", tokens, NStr::fSplit_Tokenize );
+
+    ITERATE( vector< string >, token, tokens ) {
+        bool found = false;
+
+        for( size_t i = 0; i < ArraySize( kModeNames ); ++i ) {
+            if( NStr::EqualNocase( *token, kModeNames[i].name ) ) {
+                result |= kModeNames[i].flag;
+                found = true;
+                break;
+            }
+        }
+
+        if( !found ) {
+            ERR_POST( Warning << "Ignoring unknown index mapping mode '" 
+                              << *token << "'" );
+        }
+    }
+
+    return result;
+}
+
+//-------------------------------------------------------------------------
+CDbIndex::TMapMode CDbIndex::GetMapMode()
+{
+    CNcbiEnvironment env;
+    string mode = env.Get( "BLASTDB_INDEX_MAP_MODE" );
+
+    if( mode.empty() ) {
+        CNcbiApplicationAPI * app = CNcbiApplicationAPI::Instance();
+        if( app ) mode = app->GetConfig().Get( "BLAST", "INDEX_MAP_MODE" );
+    }
+
+    return ParseMapMode( mode );
+}
+
 //-------------------------------------------------------------------------
 unsigned long GetCodeBits( unsigned long stride )
 {
@@ -36,6 +36,12 @@
 #include <algorithm>
 
 #include <corelib/ncbifile.hpp>
+#include <corelib/ncbi_system.hpp>
+
+#if defined(NCBI_OS_UNIX)
+#include <sys/mman.h>
+#include <errno.h>
+#endif
 
 #include <algo/blast/core/blast_extend.h>
 #include <algo/blast/core/blast_gapalign.h>
@@ -60,6 +66,44 @@ BEGIN_SCOPE( blastdbindex )
 typedef CDbIndex::TSeqNum TSeqNum;
 typedef CDbIndex::TWord TWord;
 
+//-------------------------------------------------------------------------
+/** Apply the index mapping mode to a mapped index volume.
+    @param map          [I]     the mapped volume
+    @param mode         [I]     mapping mode flags
+*/
+static void ApplyMapMode( CMemoryFile & map, CDbIndex::TMapMode mode )
+{
+#if defined(NCBI_OS_UNIX)
+    char * ptr = (char *)map.GetPtr();
+    size_t size = map.GetSize();
+    if( ptr == 0 || size == 0 ) return;
+
+#if defined(MADV_HUGEPAGE)
+    // Only honored if the kernel supports huge pages in the page cache.
+    if( mode & CDbIndex::fMapHugePage ) madvise( ptr, size, MADV_HUGEPAGE );
+#endif
+
+    if( mode & CDbIndex::fMapLock ) {
+        // mlock() faults the pages in; locked page cache pages are
+        // shared by every process that maps the volume.
+        if( mlock( ptr, size ) == 0 ) return;
+        ERR_POST( Warning << "Cannot lock index volume " 
+                          << map.GetFileName() << " in memory: "
+                          << strerror( errno ) );
+    }
+
+    if( mode & (CDbIndex::fMapPopulate | CDbIndex::fMapLock) ) {
+        map.MemMapAdvise( CMemoryFile::eMMA_WillNeed );
+        const size_t page_size = CSystemInfo::GetVirtualMemoryPageSize();
+        volatile char sink = 0;
+        for( size_t offset = 0; offset < size; offset += page_size ) {
+            sink ^= ptr[offset];
+        }
+        (void)sink;
+    }
+#endif
+}
+
 //-------------------------------------------------------------------------
 /** Memory map a file and return a pointer to the mapped area.
     @param fname        [I]     file name
@@ -81,7 +125,10 @@ CMemoryFile * MapFile( const std::string & fname )
         }
     }
 
-    if( result == 0 ) {
+    if( result != 0 ) {
+        ApplyMapMode( *result, CDbIndex::GetMapMode() );
+    }
+    else {
         ERR_POST( 
             "Index memory mapping failed.\n"
             "It is possible that an index volume is missing or is too large.\n"
@@ -745,6 +745,24 @@ CBlastFormat::x_PrintStructuredReport(const blast::CSearchResults& results,
     }
 }
 
+void
+CBlastFormat::x_InitTabularSubjectCache(void)
+{
+    if (m_TabularSubjectCache.NotEmpty() || m_IsBl2Seq || m_IsDbScan ||
+        m_IsRemoteSearch || m_SearchDb.Empty()) {
+        return;
+    }
+    try {
+        // Same database handle as the one registered with the BLAST
+        // database data loader
+        CRef<CSeqDB> seqdb = m_SearchDb->GetSeqDb();
+        m_TabularSubjectCache.Reset(new CBlastTabularSubjectCache(seqdb));
+    } catch (const CException&) {
+        // Subjects are retrieved from the scope
+        m_TabularSubjectCache.Reset();
+    }
+}
+
 void
 CBlastFormat::x_PrintTabularReport(const blast::CSearchResults& results, 
                                    unsigned int itr_num)
@@ -777,6 +795,10 @@ CBlastFormat::x_PrintTabularReport(const blast::CSearchResults& results,
         tabinfo.SetQueryRange(m_QueryRange);
         if (ncbi::NStr::ToLower(m_Program) == string("blastn"))
         	tabinfo.SetNoFetch(true);
+        x_InitTabularSubjectCache();
+        if (m_TabularSubjectCache.NotEmpty()) {
+            tabinfo.SetSubjectCache(m_TabularSubjectCache);
+        }
 
         if (m_FormatType == CFormattingArgs::eTabularWithComments) {
             string strProgVersion =
@@ -34,6 +34,7 @@
 #include <corelib/test_boost.hpp>
 
 #include <corelib/ncbitime.hpp>
+#include <corelib/ncbienv.hpp>
 #include <objmgr/object_manager.hpp>
 #include <objmgr/scope.hpp>
 
@@ -43,6 +44,13 @@
 #include <algo/blast/core/blast_encoding.h>
 #include <algo/blast/core/blast_setup.h>
 #include <algo/blast/core/blast_gapalign.h>
+#include <algo/blast/core/blast_sw.h>
+#include <algo/blast/core/aa_ungapped.h>
+#include <algo/blast/core/blast_aalookup.h>
+#include <algo/blast/core/blast_aascan.h>
+#include <algo/blast/core/lookup_wrap.h>
+#include <algo/blast/composition_adjustment/smith_waterman.h>
+#include <util/random_gen.hpp>
 #include <blast_objmgr_priv.hpp>
 #ifdef NCBI_OS_IRIX
 #include <stdlib.h>
@@ -583,6 +591,525 @@ BOOST_AUTO_TEST_CASE(testBlastExtendWordFreeWithNULLInput) {
         BOOST_REQUIRE_EQUAL(true, null_output);
 }
 
+BOOST_AUTO_TEST_CASE(testSmithWatermanScoreOnlySimdMatchesScalar) {
+        const int kNumPairs = 50;
+        const int kQueryLen = 300;
+        const int kSubjectLen = 500;
+        const int kGapOpen = 11;
+        const int kGapExtend = 1;
+
+        BlastScoreBlk* sbp = BlastScoreBlkNew(BLASTAA_SEQ_CODE, 1);
+        BOOST_REQUIRE(sbp);
+        sbp->name = strdup("BLOSUM62");
+        BOOST_REQUIRE_EQUAL(0, (int)Blast_ScoreBlkMatrixFill(sbp, NULL));
+
+        BlastGapAlignStruct gap_align;
+        memset(&gap_align, 0, sizeof(gap_align));
+        gap_align.sbp = sbp;
+
+        CRandom rng(1);
+        vector<Uint1> query(kQueryLen), subject(kSubjectLen);
+        for (int pair = 0; pair < kNumPairs; pair++) {
+            for (int i = 0; i < kQueryLen; i++)
+                query[i] = (Uint1)rng.GetRand(1, 22);
+            for (int i = 0; i < kSubjectLen; i++)
+                subject[i] = (Uint1)rng.GetRand(1, 22);
+            // plant a diverged copy of the query in every other subject
+            if (pair % 2 == 0) {
+                for (int i = 0; i < kQueryLen; i++) {
+                    if (rng.GetRand(0, 3) != 0)
+                        subject[100 + i] = query[i];
+                }
+            }
+
+            Int4 scalar = SmithWatermanScoreOnly(&query[0], kQueryLen,
+                                                 &subject[0], kSubjectLen,
+                                                 kGapOpen, kGapExtend,
+                                                 &gap_align, FALSE);
+            Int4 simd = SmithWatermanScoreOnly(&query[0], kQueryLen,
+                                               &subject[0], kSubjectLen,
+                                               kGapOpen, kGapExtend,
+                                               &gap_align, TRUE);
+            BOOST_REQUIRE_EQUAL(scalar, simd);
+        }
+
+        sfree(gap_align.dp_mem);
+        BlastScoreBlkFree(sbp);
+}
+
+// The Smith-Waterman used with composition-based statistics takes the score
+// and the end of the alignment from the striped kernel; both must match
+// what the scalar code reports, for asymmetric (composition-adjusted)
+// matrices and PSSMs alike
+BOOST_AUTO_TEST_CASE(testCompoSmithWatermanSimdMatchesScalar) {
+        const int kNumPairs = 40;
+        const int kQueryLen = 250;
+        const int kSubjectLen = 400;
+        const int kGapOpen = 11;
+        const int kGapExtend = 1;
+
+        BlastScoreBlk* sbp = BlastScoreBlkNew(BLASTAA_SEQ_CODE, 1);
+        BOOST_REQUIRE(sbp);
+        sbp->name = strdup("BLOSUM62");
+        BOOST_REQUIRE_EQUAL(0, (int)Blast_ScoreBlkMatrixFill(sbp, NULL));
+
+        // an asymmetric matrix, like the ones composition adjustment
+        // produces, and a PSSM with one row per query position
+        vector< vector<int> > adjusted(BLASTAA_SIZE,
+                                       vector<int>(BLASTAA_SIZE));
+        vector<int*> adjusted_rows(BLASTAA_SIZE);
+        for (int a = 0; a < BLASTAA_SIZE; a++) {
+            for (int b = 0; b < BLASTAA_SIZE; b++) {
+                adjusted[a][b] = sbp->matrix->data[a][b] +
+                    (a * 7 + b * 3) % 5 - 2;
+            }
+            adjusted_rows[a] = &adjusted[a][0];
+        }
+        vector< vector<int> > pssm(kQueryLen, vector<int>(BLASTAA_SIZE));
+        vector<int*> pssm_rows(kQueryLen);
+
+        Blast_ForbiddenRanges forbidden;
+        BOOST_REQUIRE_EQUAL(0, Blast_ForbiddenRangesInitialize(&forbidden,
+                                                               kQueryLen));
+
+        CRandom rng(7);
+        vector<Uint1> query(kQueryLen), subject(kSubjectLen);
+        for (int pair = 0; pair < kNumPairs; pair++) {
+            for (int i = 0; i < kQueryLen; i++)
+                query[i] = (Uint1)rng.GetRand(1, 22);
+            for (int i = 0; i < kSubjectLen; i++)
+                subject[i] = (Uint1)rng.GetRand(1, 22);
+            // plant a diverged copy of the query in most subjects, and
+            // a second one, which ties with it, in some
+            if (pair % 4 != 3) {
+                for (int i = 0; i < kQueryLen; i++) {
+                    if (rng.GetRand(0, 3) != 0)
+                        subject[75 + i] = query[i];
+                }
+            }
+            if (pair % 4 == 1) {
+                for (int i = 0; i < 60; i++)
+                    subject[kSubjectLen - 60 + i] = query[40 + i];
+            }
+            for (int i = 0; i < kQueryLen; i++) {
+                for (int b = 0; b < BLASTAA_SIZE; b++) {
+                    pssm[i][b] = adjusted[query[i]][b] +
+                        (int)rng.GetRand(0, 2) - 1;
+                }
+                pssm_rows[i] = &pssm[i][0];
+            }
+
+            for (int position_based = 0; position_based < 2;
+                 position_based++) {
+                int** matrix = position_based ? &pssm_rows[0]
+                                              : &adjusted_rows[0];
+                int score = 0, match_end = 0, query_end = 0;
+                BOOST_REQUIRE_EQUAL(0,
+                    Blast_SmithWatermanScoreOnly(&score, &match_end,
+                                                 &query_end, &subject[0],
+                                                 kSubjectLen, &query[0],
+                                                 kQueryLen, matrix,
+                                                 kGapOpen, kGapExtend,
+                                                 position_based,
+                                                 &forbidden));
+
+                Int4 simd_query_end = -1, simd_subject_end = -1;
+                Int4 simd = SmithWatermanScoreOnlyStriped(&query[0],
+                                               kQueryLen, &subject[0],
+                                               kSubjectLen, kGapOpen,
+                                               kGapExtend, matrix,
+                                               (Boolean)position_based,
+                                               &simd_query_end,
+                                               &simd_subject_end);
+                // -1: no striped kernel in this build
+                if (simd != -1) {
+                    BOOST_REQUIRE_EQUAL(score, simd);
+                    BOOST_REQUIRE_EQUAL(query_end, simd_query_end);
+                    BOOST_REQUIRE_EQUAL(match_end, simd_subject_end);
+                }
+            }
+        }
+
+        Blast_ForbiddenRangesRelease(&forbidden);
+        BlastScoreBlkFree(sbp);
+}
+
+/// Runs the two-hit protein word finder over every subject with one word
+/// extension structure, as a search of a database would, and returns the
+/// statistics and ungapped HSPs found in each subject as text
+static vector<string>
+s_AaTwoHitWordFinder(BLAST_SequenceBlk* query, BlastQueryInfo* query_info,
+                     LookupTableWrap* lookup_wrap, Int4** matrix,
+                     const BlastInitialWordParameters* word_params,
+                     const vector<BLAST_SequenceBlk*>& subjects)
+{
+    Blast_ExtendWord* ewp = NULL;
+    BOOST_REQUIRE_EQUAL(0, (int)BlastExtendWordNew(query->length, word_params,
+                                                   &ewp));
+    vector<BlastOffsetPair> offset_pairs(GetOffsetArraySize(lookup_wrap));
+    BlastInitHitList* init_hitlist = BLAST_InitHitListNew();
+
+    vector<string> retval;
+    ITERATE(vector<BLAST_SequenceBlk*>, subject, subjects) {
+        BlastUngappedStats stats;
+        memset(&stats, 0, sizeof(stats));
+        BlastInitHitListReset(init_hitlist);
+        BOOST_REQUIRE_EQUAL(0, (int)BlastAaWordFinder(*subject, query,
+                                          query_info, lookup_wrap, matrix,
+                                          word_params, ewp, &offset_pairs[0],
+                                          (Int4)offset_pairs.size(),
+                                          init_hitlist, &stats));
+        CNcbiOstrstream os;
+        os << stats.lookup_hits << ' ' << stats.init_extends << ' '
+           << stats.good_init_extends;
+        for (Int4 i = 0; i < init_hitlist->total; i++) {
+            const BlastInitHSP& hsp = init_hitlist->init_hsp_array[i];
+            os << " (" << hsp.offsets.qs_offsets.q_off << ','
+               << hsp.offsets.qs_offsets.s_off << ','
+               << hsp.ungapped_data->q_start << ','
+               << hsp.ungapped_data->s_start << ','
+               << hsp.ungapped_data->length << ','
+               << hsp.ungapped_data->score << ')';
+        }
+        retval.push_back(CNcbiOstrstreamToString(os));
+    }
+
+    BLAST_InitHitListFree(init_hitlist);
+    BlastExtendWordFree(ewp);
+    return retval;
+}
+
+/// Allocates a protein sequence block, with sentinels, for a sequence
+static BLAST_SequenceBlk*
+s_AaSequenceBlkNew(const vector<Uint1>& residues)
+{
+    Uint1* buffer = (Uint1*) calloc(residues.size() + 2, sizeof(Uint1));
+    if ( !residues.empty() )
+        memcpy(buffer + 1, &residues[0], residues.size());
+
+    BLAST_SequenceBlk* seq_blk = NULL;
+    BOOST_REQUIRE_EQUAL(0, (int)BlastSeqBlkNew(&seq_blk));
+    BOOST_REQUIRE_EQUAL(0, (int)BlastSeqBlkSetSequence(seq_blk, buffer,
+                                                   (Int4)residues.size()));
+    SSeqRange full_range;
+    full_range.left = 0;
+    full_range.right = seq_blk->length;
+    BOOST_REQUIRE_EQUAL(0, (int)BlastSeqBlkSetSeqRanges(seq_blk, &full_range,
+                                                   1, true, eNoSubjMasking));
+    return seq_blk;
+}
+
+// With BLAST_AA_BATCH_EXTEND set, builds with AVX2 queue the two-hit
+// ungapped extensions and run them in batches; the hits saved, their order
+// and the diagonal bookkeeping must not change, with a matrix or a PSSM,
+// and for subjects too short for the batched kernel
+BOOST_AUTO_TEST_CASE(testAaBatchedUngappedExtensionMatchesScalar) {
+        const int kQueryLen = 300;
+        const int kNumSubjects = 40;
+        const int kMaxSubjectLen = 700;
+
+        CRandom rng(11);
+        vector<Uint1> query(kQueryLen);
+        for (int i = 0; i < kQueryLen; i++)
+            query[i] = (Uint1)rng.GetRand(1, 22);
+        BLAST_SequenceBlk* query_blk = s_AaSequenceBlkNew(query);
+
+        // subjects of every length, down to ones shorter than a word, with
+        // several diverged copies of pieces of the query, so that many hits
+        // fall on diagonals that are still being extended
+        vector<BLAST_SequenceBlk*> subjects;
+        for (int n = 0; n < kNumSubjects; n++) {
+            int length = n < 4 ? n + 1 : (int)rng.GetRand(5, kMaxSubjectLen);
+            vector<Uint1> subject(length);
+            for (int i = 0; i < length; i++)
+                subject[i] = (Uint1)rng.GetRand(1, 22);
+            for (int copy = 0; copy < 6 && length > 20; copy++) {
+                int piece = (int)rng.GetRand(10, min(length, kQueryLen) - 1);
+                int q_start = (int)rng.GetRand(0, kQueryLen - piece);
+                int s_start = (int)rng.GetRand(0, length - piece);
+                for (int i = 0; i < piece; i++) {
+                    if (rng.GetRand(0, 4) != 0)
+                        subject[s_start + i] = query[q_start + i];
+                }
+            }
+            subjects.push_back(s_AaSequenceBlkNew(subject));
+        }
+
+        LookupTableOptions* lookup_options = NULL;
+        BOOST_REQUIRE_EQUAL(0, (int)LookupTableOptionsNew(eBlastTypeBlastp,
+                                                          &lookup_options));
+        BOOST_REQUIRE_EQUAL(0, (int)BLAST_FillLookupTableOptions(
+                                  lookup_options, eBlastTypeBlastp, FALSE,
+                                  BLAST_WORD_THRESHOLD_BLASTP, 3));
+        BlastScoringOptions* score_options = NULL;
+        BOOST_REQUIRE_EQUAL(0, (int)BlastScoringOptionsNew(eBlastTypeBlastp,
+                                                           &score_options));
+        BOOST_REQUIRE_EQUAL(0, (int)BLAST_FillScoringOptions(score_options,
+                                  eBlastTypeBlastp, FALSE, 0, 0, NULL,
+                                  BLAST_GAP_OPEN_PROT, BLAST_GAP_EXTN_PROT));
+        BlastScoreBlk* sbp = BlastScoreBlkNew(BLASTAA_SEQ_CODE, 1);
+        BOOST_REQUIRE(sbp);
+        BOOST_REQUIRE_EQUAL(0, (int)Blast_ScoreBlkMatrixInit(eBlastTypeBlastp,
+                                  score_options, sbp, &BlastFindMatrixPath));
+
+        BlastSeqLoc* lookup_segments = NULL;
+        BlastSeqLocNew(&lookup_segments, 0, kQueryLen - 1);
+        LookupTableWrap* lookup_wrap = NULL;
+        BOOST_REQUIRE_EQUAL(0, (int)LookupTableWrapInit(query_blk,
+                                  lookup_options, NULL, lookup_segments, sbp,
+                                  &lookup_wrap, NULL, NULL, NULL));
+        lookup_segments = BlastSeqLocFree(lookup_segments);
+        BOOST_REQUIRE_EQUAL((int)eAaLookupTable, (int)lookup_wrap->lut_type);
+        BlastChooseProteinScanSubject(lookup_wrap);
+        BlastAaLookupTable* lookup = (BlastAaLookupTable*)lookup_wrap->lut;
+
+        BlastQueryInfo* query_info = BlastQueryInfoNew(eBlastTypeBlastp, 1);
+        query_info->contexts[0].query_offset = 0;
+        query_info->contexts[0].query_length = kQueryLen;
+        query_info->max_length = kQueryLen;
+
+        BlastInitialWordOptions word_options;
+        memset(&word_options, 0, sizeof(word_options));
+        word_options.window_size = BLAST_WINDOW_SIZE_PROT;
+        BlastUngappedCutoffs cutoffs;
+        memset(&cutoffs, 0, sizeof(cutoffs));
+        BlastInitialWordParameters word_params;
+        memset(&word_params, 0, sizeof(word_params));
+        word_params.options = &word_options;
+        word_params.cutoffs = &cutoffs;
+        word_params.container_type = eDiagArray;
+        word_params.ungapped_extension = TRUE;
+
+        // a PSSM built on the matrix, with some forbidden positions
+        vector< vector<Int4> > pssm(kQueryLen, vector<Int4>(BLASTAA_SIZE));
+        vector<Int4*> pssm_rows(kQueryLen);
+        for (int i = 0; i < kQueryLen; i++) {
+            for (int b = 0; b < BLASTAA_SIZE; b++) {
+                pssm[i][b] = sbp->matrix->data[query[i]][b] +
+                    (Int4)rng.GetRand(0, 2) - 1;
+            }
+            if (i % 37 == 0)
+                pssm[i][query[i]] = BLAST_SCORE_MIN;
+            pssm_rows[i] = &pssm[i][0];
+        }
+
+        CNcbiEnvironment env;
+        for (int position_based = 0; position_based < 2; position_based++) {
+            Int4** matrix = position_based ? &pssm_rows[0]
+                                           : sbp->matrix->data;
+            lookup->use_pssm = (Boolean)position_based;
+
+            for (int x_dropoff = 7; x_dropoff <= 70; x_dropoff *= 10) {
+                cutoffs.x_dropoff_init = cutoffs.x_dropoff = x_dropoff;
+                cutoffs.cutoff_score = 30;
+                word_params.x_dropoff_max = cutoffs.x_dropoff;
+                word_params.cutoff_score_min = cutoffs.cutoff_score;
+
+                env.Unset("BLAST_AA_BATCH_EXTEND");
+                vector<string> scalar =
+                    s_AaTwoHitWordFinder(query_blk, query_info, lookup_wrap,
+                                         matrix, &word_params, subjects);
+                env.Set("BLAST_AA_BATCH_EXTEND", "1");
+                vector<string> batched =
+                    s_AaTwoHitWordFinder(query_blk, query_info, lookup_wrap,
+                                         matrix, &word_params, subjects);
+                env.Unset("BLAST_AA_BATCH_EXTEND");
+
+                BOOST_REQUIRE_EQUAL(scalar.size(), batched.size());
+                for (size_t i = 0; i < scalar.size(); i++)
+                    BOOST_REQUIRE_EQUAL(scalar[i], batched[i]);
+            }
+        }
+        lookup->use_pssm = FALSE;
+
+        BlastQueryInfoFree(query_info);
+        LookupTableWrapFree(lookup_wrap);
+        BlastScoreBlkFree(sbp);
+        BlastScoringOptionsFree(score_options);
+        LookupTableOptionsFree(lookup_options);
+        ITERATE(vector<BLAST_SequenceBlk*>, subject, subjects) {
+            BlastSequenceBlkFree(*subject);
+        }
+        BlastSequenceBlkFree(query_blk);
+}
+
+/// Packs ncbi2na bases, one per byte, four to a byte, the first base at
+/// offset rem within the first byte
+static vector<Uint1>
+s_PackNcbi2na(const vector<Uint1>& bases, Uint1 rem)
+{
+    vector<Uint1> packed((rem + bases.size() + 3) / 4, 0);
+    for (size_t i = 0; i < bases.size(); i++) {
+        size_t pos = rem + i;
+        packed[pos / 4] |= (Uint1)((bases[i] & 3) << (2 * (3 - pos % 4)));
+    }
+    return packed;
+}
+
+/// Number of matches from offset start of two sequences of length len,
+/// compared one base at a time as the greedy extension did before it
+/// compared machine words. seq2 is packed with s_PackNcbi2na (at offset 0
+/// for reverse extensions) unless rem is 4; fence_hit is set if the run
+/// ends at a sentinel of an uncompressed seq2
+static Int4
+s_ScalarMatchRun(const vector<Uint1>& seq1, const vector<Uint1>& seq2,
+                 Int4 len, Int4 start, bool reverse, Uint1 rem,
+                 bool* fence_hit)
+{
+    Int4 i = start;
+    for ( ; i < len; i++) {
+        Int4 pos1 = reverse ? len - 1 - i : i;
+        if (rem == 4) {
+            if (seq1[pos1] >= 4 || seq1[pos1] != seq2[pos1])
+                break;
+        } else {
+            Int4 pos2 = reverse ? pos1 : pos1 + rem;
+            if (seq1[pos1] != NCBI2NA_UNPACK_BASE(seq2[pos2 / 4],
+                                                  3 - pos2 % 4))
+                break;
+        }
+    }
+    *fence_hit = rem == 4 && i < len &&
+                 seq2[reverse ? len - 1 - i : i] == FENCE_SENTRY;
+    return i - start;
+}
+
+/// Runs a greedy extension of seq1 against seq2, both of length len, and
+/// checks the runs of matches it reports against s_ScalarMatchRun; the
+/// sequences are identical but for at most one difference
+static void
+s_CheckGreedyMatchRuns(BlastGapAlignStruct* gap_align,
+                       const BlastScoringParameters& score_params,
+                       const vector<Uint1>& seq1, const vector<Uint1>& seq2,
+                       Int4 len, bool reverse, Uint1 rem)
+{
+    bool fence_expected = false;
+    Int4 run = s_ScalarMatchRun(seq1, seq2, len, 0, reverse, rem,
+                                &fence_expected);
+    // the run of matches past the difference
+    bool fence_after = false;
+    Int4 run_after = run < len ?
+        s_ScalarMatchRun(seq1, seq2, len, run + 1, reverse, rem,
+                         &fence_after) : 0;
+
+    Int4 seq1_align_len = -1, seq2_align_len = -1;
+    Boolean fence_hit = FALSE;
+    SGreedySeed seed;
+    Int4 score = BLAST_AffineGreedyAlign(&seq1[0], len, &seq2[0], len,
+                                         (Boolean)reverse,
+                                         gap_align->gap_x_dropoff,
+                                         score_params.reward,
+                                         -score_params.penalty,
+                                         score_params.gap_open,
+                                         score_params.gap_extend,
+                                         &seq1_align_len, &seq2_align_len,
+                                         gap_align->greedy_align_mem, NULL,
+                                         rem, &fence_hit, &seed);
+
+    BOOST_REQUIRE_EQUAL(fence_expected, fence_hit != FALSE);
+    if (fence_expected) {
+        // the affine extension stops at once, the non-affine one after
+        // recording the first run
+        if (score_params.gap_open == 0)
+            BOOST_REQUIRE_EQUAL(run, seed.match_length);
+        else
+            BOOST_REQUIRE_EQUAL(-1, score);
+    } else if (run == len) {
+        BOOST_REQUIRE_EQUAL(len, seq1_align_len);
+        BOOST_REQUIRE_EQUAL(len, seq2_align_len);
+        BOOST_REQUIRE_EQUAL(len, seed.match_length);
+    } else {
+        BOOST_REQUIRE_EQUAL(max(run, run_after), seed.match_length);
+    }
+}
+
+// The greedy extension skips over matches a machine word at a time; runs
+// of matches must still end where the base-by-base comparison ends them,
+// at a mismatch, a query ambiguity or a subject sentinel, for sequences
+// ending anywhere in a word, every offset of a compressed subject within
+// its first byte, uncompressed subjects, and extensions in both directions
+BOOST_AUTO_TEST_CASE(testGreedyWordMatchesMatchScalar) {
+        const Uint1 kAmbiguity = 14;    // N in blastna
+        // non-affine and affine scoring
+        const Int4 kNumScoring = 2;
+        const Int4 kReward[kNumScoring] = { 1, 2 };
+        const Int4 kPenalty[kNumScoring] = { -2, -3 };
+        const Int4 kGapOpen[kNumScoring] = { 0, 5 };
+        const Int4 kGapExtend[kNumScoring] = { 0, 2 };
+        // a substitution in the subject, an ambiguity in the query, the
+        // same ambiguity in both (still a mismatch) and a sentinel in
+        // the subject; the last two need an uncompressed subject
+        enum { eSubstitution, eAmbiguity, eSharedAmbiguity, eSentinel,
+               eNumKinds };
+
+        BlastScoreBlk* sbp = BlastScoreBlkNew(BLASTNA_SEQ_CODE, 1);
+        BOOST_REQUIRE(sbp);
+        BlastExtensionOptions ext_options;
+        memset(&ext_options, 0, sizeof(ext_options));
+        ext_options.ePrelimGapExt = eGreedyScoreOnly;
+        BlastExtensionParameters ext_params;
+        memset(&ext_params, 0, sizeof(ext_params));
+        ext_params.options = &ext_options;
+        ext_params.gap_x_dropoff = ext_params.gap_x_dropoff_final = 30;
+
+        CRandom rng(5);
+        for (Int4 scoring = 0; scoring < kNumScoring; scoring++) {
+            BlastScoringParameters score_params;
+            memset(&score_params, 0, sizeof(score_params));
+            score_params.reward = kReward[scoring];
+            score_params.penalty = kPenalty[scoring];
+            score_params.gap_open = kGapOpen[scoring];
+            score_params.gap_extend = kGapExtend[scoring];
+            BlastGapAlignStruct* gap_align = NULL;
+            BOOST_REQUIRE_EQUAL(0, (int)BLAST_GapAlignStructNew(&score_params,
+                                          &ext_params, 10000, sbp,
+                                          &gap_align));
+
+            // lengths ending at every offset of a word
+            for (Int4 len = 64; len < 72; len++) {
+                vector<Uint1> bases(len);
+                for (Int4 i = 0; i < len; i++)
+                    bases[i] = (Uint1)rng.GetRand(0, 3);
+
+                for (Int4 kind = 0; kind < eNumKinds; kind++) {
+                    // pos == len leaves the sequences identical
+                    for (Int4 pos = 0; pos <= len; pos++) {
+                        vector<Uint1> seq1(bases);
+                        vector<Uint1> seq2(bases);
+                        if (pos < len && kind == eSubstitution)
+                            seq2[pos] = (seq2[pos] + 1) & 3;
+                        else if (pos < len && kind == eAmbiguity)
+                            seq1[pos] = kAmbiguity;
+                        else if (pos < len && kind == eSharedAmbiguity)
+                            seq1[pos] = seq2[pos] = kAmbiguity;
+                        else if (pos < len)
+                            seq2[pos] = FENCE_SENTRY;
+
+                        for (Int4 reverse = 0; reverse < 2; reverse++) {
+                            s_CheckGreedyMatchRuns(gap_align, score_params,
+                                                   seq1, seq2, len,
+                                                   reverse != 0, 4);
+                            if (kind == eSharedAmbiguity ||
+                                kind == eSentinel)
+                                continue;
+                            // reverse extensions index a compressed
+                            // subject from its first byte
+                            for (Uint1 rem = 0; rem < (reverse ? 1 : 4);
+                                 rem++) {
+                                s_CheckGreedyMatchRuns(gap_align,
+                                    score_params, seq1,
+                                    s_PackNcbi2na(seq2, rem), len,
+                                    reverse != 0, rem);
+                            }
+                        }
+                    }
+                }
+            }
+            BLAST_GapAlignStructFree(gap_align);
+        }
+        BlastScoreBlkFree(sbp);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 /*
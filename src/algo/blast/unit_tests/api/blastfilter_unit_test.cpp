@@ -50,6 +50,8 @@
 #include <algo/blast/api/blast_nucl_options.hpp>
 
 #include <algo/blast/core/blast_setup.h>
+#include <algo/blast/core/blast_seg.h>
+#include <algo/blast/core/blast_encoding.h>
 
 // For repeats and dust filtering only
 #include <algo/blast/api/repeats_filter.hpp>
@@ -504,7 +506,208 @@ BOOST_AUTO_TEST_CASE(SegFilter) {
 
     BOOST_REQUIRE_EQUAL(kNumLocs, loc_index);
 }
-    
+
+/// Runs SEG on a protein sequence given in IUPACAA and checks the masked
+/// ranges against the expected ones, in order
+static void
+s_CheckSegMasks(const string& residues, SegParameters* params,
+                const TRangeVector& expected)
+{
+    vector<Uint1> sequence;
+    ITERATE(string, c, residues) {
+        sequence.push_back(AMINOACID_TO_NCBISTDAA[(int) *c]);
+    }
+
+    BlastSeqLoc* seg_locs = NULL;
+    Int2 status = SeqBufferSeg(&sequence[0], (Int4) sequence.size(), 0,
+                               params, &seg_locs);
+    SegParametersFree(params);
+    BOOST_REQUIRE_EQUAL(0, (int) status);
+
+    TRangeVector masks;
+    for (BlastSeqLoc* loc = seg_locs; loc; loc = loc->next) {
+        masks.push_back(TSeqRange(loc->ssr->left, loc->ssr->right));
+    }
+    BlastSeqLocFree(seg_locs);
+
+    BOOST_REQUIRE_EQUAL(expected.size(), masks.size());
+    for (size_t i = 0; i < masks.size(); i++) {
+        BOOST_REQUIRE_EQUAL(expected[i].GetFrom(), masks[i].GetFrom());
+        BOOST_REQUIRE_EQUAL(expected[i].GetTo(), masks[i].GetTo());
+    }
+}
+
+/// Builds the expected ranges from pairs of offsets
+static TRangeVector
+s_SegRanges(const TSeqPos ranges[][2], size_t num_ranges)
+{
+    TRangeVector retval;
+    for (size_t i = 0; i < num_ranges; i++) {
+        retval.push_back(TSeqRange(ranges[i][0], ranges[i][1]));
+    }
+    return retval;
+}
+
+/// High complexity protein sequence the SEG test sequences are built from
+static const string kSegHighComplexity =
+    "MKTAYIAKQRQISFVKSHFSRQLEERLGLIEVQAPILSRVGDGTQDNLSGAEKAVQVKVKALPDAQ"
+    "FEVVHSLAKWKRQTLGQHDFSAGEGLYTHMKALRPDEDRLSPLHSVYVDQWDWERVMGDGERQFST"
+    "LKSTVEAIWAGIKATEAAVSEEFGLAPFLPDQIHFVHSQELLSRYPDLDAKGRERAIAKDLGAVFL"
+    "VGIGGKLSDGHRHDVRAPDYDDWSTPSELGHAGLNGDILVWNPVLEDAFELSSMGIRVDADTLKHQ"
+    "LALTGDEDRLELEWHQALLRGEMPQTIGGGIGQSRLTMLLLQLPHIGQVQAGVWPAACRERVAEAV"
+    "IRFEQLVQRVNHPDEVFIEP";
+
+/// Low complexity regions with X residues in and next to them
+static string s_SegSequenceWithX()
+{
+    return kSegHighComplexity.substr(0, 60) + "QQQQQQQXQQQQQQQQ" +
+        kSegHighComplexity.substr(60, 50) + "PAPAPAPSPAPAPAPPAP" +
+        kSegHighComplexity.substr(110, 40) + "XXXXXXGGGGSGGGGSGGGGSGGGG" +
+        kSegHighComplexity.substr(150, 60);
+}
+
+// The expected masks below were computed with the SEG engine as it was
+// before it was reworked around a rolling window, and must not change.
+
+BOOST_AUTO_TEST_CASE(SegMasksWithDefaultParameters) {
+    const TSeqPos kMasks[][2] = { { 60, 75 }, { 126, 144 }, { 189, 208 } };
+    s_CheckSegMasks(s_SegSequenceWithX(), SegParametersNewAa(),
+                    s_SegRanges(kMasks, ArraySize(kMasks)));
+}
+
+BOOST_AUTO_TEST_CASE(SegMasksWithMaxbogus) {
+    // No X in a trigger window: the X residues split the masks
+    const TSeqPos kNoBogus[][2] =
+        { { 54, 66 }, { 68, 75 }, { 126, 144 }, { 190, 208 } };
+    SegParameters* params = SegParametersNewAa();
+    params->maxbogus = 0;
+    s_CheckSegMasks(s_SegSequenceWithX(), params,
+                    s_SegRanges(kNoBogus, ArraySize(kNoBogus)));
+
+    // Trigger windows may cover the run of X
+    const TSeqPos kManyBogus[][2] =
+        { { 60, 75 }, { 126, 144 }, { 182, 188 }, { 189, 208 } };
+    params = SegParametersNewAa();
+    params->maxbogus = 6;
+    s_CheckSegMasks(s_SegSequenceWithX(), params,
+                    s_SegRanges(kManyBogus, ArraySize(kManyBogus)));
+}
+
+BOOST_AUTO_TEST_CASE(SegMasksWithMaxtrim) {
+    // Nothing is trimmed off the extended segments
+    const TSeqPos kMasks[][2] = { { 49, 83 }, { 120, 148 }, { 188, 216 } };
+    SegParameters* params = SegParametersNewAa();
+    params->maxtrim = 0;
+    s_CheckSegMasks(s_SegSequenceWithX(), params,
+                    s_SegRanges(kMasks, ArraySize(kMasks)));
+}
+
+BOOST_AUTO_TEST_CASE(SegMasksWithWindowOf10) {
+    // A window of 10 uses the precomputed logarithms
+    const TSeqPos kMasks[][2] =
+        { { 5, 40 }, { 40, 45 }, { 52, 76 }, { 82, 105 }, { 114, 124 },
+          { 126, 144 }, { 147, 162 }, { 164, 169 }, { 171, 185 },
+          { 190, 267 } };
+    SegParameters* params = SegParametersNewAa();
+    params->window = 10;
+    params->locut = 3.0;
+    params->hicut = 3.3;
+    s_CheckSegMasks(s_SegSequenceWithX(), params,
+                    s_SegRanges(kMasks, ArraySize(kMasks)));
+}
+
+BOOST_AUTO_TEST_CASE(SegMasksWithOverlaps) {
+    const string kSequence =
+        "TLGQHDFSAGEGLYTEEEEEEEEEEEEEEEEEPVLEDAFELSSMGIGPGGPGGPGGRVMGDGEQEQ"
+        "EQEQEQEQEQEQEQEQEQEQEQEQEQRQEQEQEQEQEQEQEQEQEQEQEQEQEQISFVKSHFSRQL"
+        "EERLGLIEVQAPILSRVGDGTQAPAPAPAPAPAPAPAPAPAPAPAPAPISFVAPAPAPAPAPAPAP"
+        "APAPAPAPAPAP";
+
+    const TSeqPos kSeparate[][2] =
+        { { 15, 31 }, { 44, 55 }, { 54, 61 }, { 62, 119 }, { 121, 128 },
+          { 131, 139 }, { 154, 179 }, { 184, 209 } };
+    SegParameters* params = SegParametersNewAa();
+    params->window = 8;
+    params->locut = 2.2;
+    params->hicut = 2.3;
+    s_CheckSegMasks(kSequence, params,
+                    s_SegRanges(kSeparate, ArraySize(kSeparate)));
+
+    // The overlapping segments 44-55 and 54-61 are merged
+    const TSeqPos kMerged[][2] =
+        { { 15, 31 }, { 44, 61 }, { 62, 119 }, { 121, 128 }, { 131, 139 },
+          { 154, 179 }, { 184, 209 } };
+    params = SegParametersNewAa();
+    params->window = 8;
+    params->locut = 2.2;
+    params->hicut = 2.3;
+    params->overlaps = TRUE;
+    s_CheckSegMasks(kSequence, params,
+                    s_SegRanges(kMerged, ArraySize(kMerged)));
+}
+
+BOOST_AUTO_TEST_CASE(SegMasksWithLargeWindow) {
+    string low_complexity;
+    for (int i = 0; i < 25; i++) {
+        low_complexity += "QPQQPSQQQPQQAQPQ";
+    }
+    const string kSequence = kSegHighComplexity +
+        low_complexity.substr(0, 200) + "X" + low_complexity.substr(200) +
+        kSegHighComplexity;
+    BOOST_REQUIRE_EQUAL(1101, (int) kSequence.size());
+
+    // The entropy terms of (maxbogus + 1) * (window + 1) trigger windows
+    // are precomputed only up to a limit; both paths must agree.
+    const TSeqPos kMasks[][2] = { { 148, 932 } };
+    SegParameters* params = SegParametersNewAa();
+    params->window = 300;
+    params->locut = 3.5;
+    params->hicut = 3.8;
+    s_CheckSegMasks(kSequence, params, s_SegRanges(kMasks, ArraySize(kMasks)));
+
+    params = SegParametersNewAa();
+    params->window = 300;
+    params->locut = 3.5;
+    params->hicut = 3.8;
+    params->maxbogus = 300;
+    s_CheckSegMasks(kSequence, params, s_SegRanges(kMasks, ArraySize(kMasks)));
+
+    const TSeqPos kNoBogus[][2] = { { 183, 549 }, { 551, 926 } };
+    params = SegParametersNewAa();
+    params->window = 300;
+    params->locut = 3.5;
+    params->hicut = 3.8;
+    params->maxbogus = 0;
+    s_CheckSegMasks(kSequence, params,
+                    s_SegRanges(kNoBogus, ArraySize(kNoBogus)));
+
+    const TSeqPos kLowCutoff[][2] = { { 240, 902 } };
+    params = SegParametersNewAa();
+    params->window = 300;
+    params->locut = 3.2;
+    params->hicut = 3.4;
+    params->maxbogus = 300;
+    s_CheckSegMasks(kSequence, params,
+                    s_SegRanges(kLowCutoff, ArraySize(kLowCutoff)));
+}
+
+BOOST_AUTO_TEST_CASE(SegMasksShortAndBogusSequences) {
+    // Shorter than the window
+    s_CheckSegMasks(string(11, 'Q'), SegParametersNewAa(), TRangeVector());
+    const TSeqPos kWindow[][2] = { { 0, 11 } };
+    s_CheckSegMasks(string(12, 'Q'), SegParametersNewAa(),
+                    s_SegRanges(kWindow, ArraySize(kWindow)));
+
+    // Every trigger window has more X than maxbogus allows, unless
+    // maxbogus covers the whole window
+    s_CheckSegMasks(string(50, 'X'), SegParametersNewAa(), TRangeVector());
+    const TSeqPos kAll[][2] = { { 0, 49 } };
+    SegParameters* params = SegParametersNewAa();
+    params->maxbogus = 12;
+    s_CheckSegMasks(string(50, 'X'), params,
+                    s_SegRanges(kAll, ArraySize(kAll)));
+}
+
 BOOST_AUTO_TEST_CASE(RepeatsFilter) {
     const size_t kNumLocs = 4;
     const TSeqPos kRepeatStarts[kNumLocs] = { 0, 380, 2851, 3113 };
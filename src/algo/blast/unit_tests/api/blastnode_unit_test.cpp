@@ -0,0 +1,302 @@
+/*  $Id$
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+* File Description:
+*   Unit tests for the master node that runs the chunks of a multi-threaded
+*   search and writes their output
+*
+* ===========================================================================
+*/
+#include <ncbi_pch.hpp>
+#include <corelib/test_boost.hpp>
+#include <corelib/ncbienv.hpp>
+#include <corelib/ncbifile.hpp>
+#include <corelib/ncbitime.hpp>
+#include <util/line_reader.hpp>
+
+#include <algo/blast/api/blast_node.hpp>
+
+using namespace std;
+using namespace ncbi;
+using namespace ncbi::blast;
+
+/// Chunk whose output is a given string; it can be made to wait for a
+/// semaphore before completing
+class CTestNode : public CBlastNode
+{
+public:
+    CTestNode(int node_num, CBlastAppDiagHandler & bah,
+              CBlastNodeMailbox * mailbox, const string & output,
+              CSemaphore * gate, vector<int> & start_order,
+              CFastMutex & start_order_mutex)
+        : CBlastNode(node_num,
+                     CNcbiApplication::Instance()->GetArguments(),
+                     s_Args, bah, node_num, 1, mailbox),
+          m_Output(output), m_Gate(gate), m_StartOrder(start_order),
+          m_StartOrderMutex(start_order_mutex)
+    {
+        SetState(eInitialized);
+        SendMsg(CBlastNodeMsg::eRunRequest, (void*) this);
+    }
+
+    virtual int GetBlastResults(CNcbiOstream & os)
+    {
+        os << m_Output;
+        return GetStatus();
+    }
+
+protected:
+    virtual void* Main(void)
+    {
+        SetState(eRunning);
+        {
+            CFastMutexGuard guard(m_StartOrderMutex);
+            m_StartOrder.push_back(GetNodeNum());
+        }
+        if (m_Gate) {
+            m_Gate->Wait();
+        }
+        SetStatus(0);
+        SetState(eDone);
+        SendMsg(CBlastNodeMsg::ePostResult, (void*) this);
+        return NULL;
+    }
+
+private:
+    static CArgs s_Args;
+    string m_Output;
+    CSemaphore * m_Gate;
+    vector<int> & m_StartOrder;
+    CFastMutex & m_StartOrderMutex;
+};
+
+CArgs CTestNode::s_Args;
+
+struct CBlastNodeTestFixture
+{
+    CBlastAppDiagHandler m_Bah;
+    CNcbiEnvironment m_Env;
+    /// Released by the tests to let chunk 0 complete
+    CSemaphore m_Gate;
+    /// Chunk numbers in the order the chunks started
+    vector<int> m_StartOrder;
+    CFastMutex m_StartOrderMutex;
+    CStopWatch m_StopWatch;
+
+    CBlastNodeTestFixture() : m_Gate(0, 1), m_StopWatch(CStopWatch::eStart)
+    {
+        m_Env.Unset("BLAST_MT_OUTPUT_BUFFER_MB");
+        m_Env.Unset("BLAST_MT_OUTPUT_SPILL_DIR");
+    }
+
+    ~CBlastNodeTestFixture()
+    {
+        m_Env.Unset("BLAST_MT_OUTPUT_BUFFER_MB");
+        m_Env.Unset("BLAST_MT_OUTPUT_SPILL_DIR");
+    }
+
+    /// Registers chunk chunk_num, which holds chunk 0 back until m_Gate is
+    /// released
+    void x_Register(CBlastMasterNode & master, int chunk_num,
+                    const string & output, Int8 est_length = 0)
+    {
+        CBlastNodeMailbox * mb =
+            new CBlastNodeMailbox(chunk_num, master.GetBuzzer());
+        CTestNode * node =
+            new CTestNode(chunk_num, m_Bah, mb, output,
+                          chunk_num == 0 ? &m_Gate : NULL,
+                          m_StartOrder, m_StartOrderMutex);
+        master.RegisterNode(node, mb, est_length);
+    }
+
+    /// One turn of the loop the applications drive the master node with:
+    /// registers the next chunk, numbered next, unless the master node is
+    /// full. Returns false once all chunks are done.
+    bool x_Step(CBlastMasterNode & master, const vector<string> & outputs,
+                int & next)
+    {
+        const double kMaxSeconds = 60.0;
+        BOOST_REQUIRE(m_StopWatch.Elapsed() < kMaxSeconds);
+        if ( !master.Processing() ) {
+            return false;
+        }
+        if (next < (int) outputs.size()) {
+            if ( !master.IsFull() ) {
+                x_Register(master, next, outputs[next]);
+                next++;
+            }
+        }
+        else {
+            master.Shutdown();
+        }
+        return true;
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(BlastNode, CBlastNodeTestFixture)
+
+// Chunks completing after a later one are still written in chunk order, and
+// the later chunks are released and buffered in the meantime
+BOOST_AUTO_TEST_CASE(testOutputInChunkOrder) {
+    const int kNumChunks = 6;
+    vector<string> outputs;
+    string expected;
+    for (int i = 0; i < kNumChunks; i++) {
+        outputs.push_back("Chunk " + NStr::IntToString(i) + "\n");
+        expected += outputs.back();
+    }
+
+    CNcbiOstrstream out;
+    CBlastMasterNode master(out, 4);
+    int next = 0;
+    bool released = false;
+    while (x_Step(master, outputs, next)) {
+        // release chunk 0 once every other chunk is done and buffered
+        if ( !released && next == kNumChunks &&
+             master.GetNumNodes() == 1 &&
+             master.GetBufferedBytes() ==
+             (Int8) (expected.size() - outputs[0].size()) ) {
+            BOOST_REQUIRE(((string) CNcbiOstrstreamToString(out)).empty());
+            m_Gate.Post();
+            released = true;
+        }
+    }
+
+    BOOST_REQUIRE_EQUAL(expected, (string) CNcbiOstrstreamToString(out));
+    BOOST_REQUIRE_EQUAL(0, (int) master.GetBufferedBytes());
+    BOOST_REQUIRE_EQUAL(kNumChunks, master.GetNumOfQueries());
+    BOOST_REQUIRE_EQUAL(0, master.GetNumErrStatus());
+}
+
+// Completed chunks waiting for an earlier one count toward the limit on
+// chunks in flight, so no more chunks are registered while they wait
+BOOST_AUTO_TEST_CASE(testBufferedChunksMakeMasterFull) {
+    const int kNumThreads = 2;
+    // kNumThreads running plus max(2, kNumThreads) registered ahead
+    const int kMaxNumNodes = 4;
+    vector<string> outputs;
+    string expected;
+    for (int i = 0; i < 2 * kMaxNumNodes; i++) {
+        outputs.push_back(NStr::IntToString(i) + ";");
+        expected += outputs.back();
+    }
+
+    CNcbiOstrstream out;
+    CBlastMasterNode master(out, kNumThreads);
+    int next = 0;
+    bool released = false;
+    while (x_Step(master, outputs, next)) {
+        if ( !released ) {
+            BOOST_REQUIRE(next <= kMaxNumNodes);
+            // chunk 0 still runs, the other chunks are done and buffered
+            if (next == kMaxNumNodes && master.GetNumNodes() == 1) {
+                BOOST_REQUIRE(master.IsFull());
+                m_Gate.Post();
+                released = true;
+            }
+        }
+    }
+    BOOST_REQUIRE_EQUAL(expected, (string) CNcbiOstrstreamToString(out));
+}
+
+// Output beyond BLAST_MT_OUTPUT_BUFFER_MB goes to temporary files in
+// BLAST_MT_OUTPUT_SPILL_DIR, which are removed once written
+BOOST_AUTO_TEST_CASE(testOutputSpilledToDisk) {
+    const int kNumChunks = 6;
+    const size_t kChunkSize = 400 * 1024;
+    vector<string> outputs;
+    string expected;
+    for (int i = 0; i < kNumChunks; i++) {
+        outputs.push_back(string(kChunkSize, (char) ('a' + i)));
+        expected += outputs.back();
+    }
+
+    CDir spill_dir(CFile::GetTmpName());
+    BOOST_REQUIRE(spill_dir.Create());
+    m_Env.Set("BLAST_MT_OUTPUT_BUFFER_MB", "1");
+    m_Env.Set("BLAST_MT_OUTPUT_SPILL_DIR", spill_dir.GetPath());
+
+    CNcbiOstrstream out;
+    {
+        CBlastMasterNode master(out, 4);
+        int next = 0;
+        bool released = false;
+        while (x_Step(master, outputs, next)) {
+            // two of the five chunks done fit in 1 MB, the rest spill
+            if ( !released && next == kNumChunks &&
+                 master.GetNumNodes() == 1 &&
+                 master.GetBufferedBytes() == (Int8) (2 * kChunkSize) &&
+                 spill_dir.GetEntries("blast_chunk_*",
+                                      CDir::fIgnoreRecursive).size() == 3 ) {
+                m_Gate.Post();
+                released = true;
+            }
+        }
+        BOOST_REQUIRE(released);
+        BOOST_REQUIRE_EQUAL(0, (int) master.GetBufferedBytes());
+    }
+
+    BOOST_REQUIRE(expected == (string) CNcbiOstrstreamToString(out));
+    BOOST_REQUIRE_EQUAL(0, (int) spill_dir.GetEntries(kEmptyStr,
+                                        CDir::fIgnoreRecursive).size());
+    spill_dir.Remove();
+}
+
+// Waiting chunks start longest first, but only among the oldest waiting
+// chunk and those registered right after it, so that a long chunk further
+// on does not hold back the oldest ones; the output is still written in
+// chunk order
+BOOST_AUTO_TEST_CASE(testStartOrderWithinWindow) {
+    // with one thread the window spans 1 + max(2, 1) chunks
+    const int kNumChunks = 6;
+    const Int8 kEstLengths[kNumChunks] = { 10, 50, 20, 100, 5, 30 };
+    // chunk 3, the longest, waits until chunk 0 leaves the window
+    const int kStartOrder[kNumChunks] = { 1, 2, 0, 3, 5, 4 };
+    string expected;
+
+    CNcbiOstrstream out;
+    CBlastMasterNode master(out, 1);
+    // every chunk is waiting before the first one starts
+    for (int i = 0; i < kNumChunks; i++) {
+        string output = "Chunk " + NStr::IntToString(i) + "\n";
+        x_Register(master, i, output, kEstLengths[i]);
+        expected += output;
+    }
+    master.Shutdown();
+    m_Gate.Post();
+
+    const double kMaxSeconds = 60.0;
+    while (master.Processing()) {
+        BOOST_REQUIRE(m_StopWatch.Elapsed() < kMaxSeconds);
+    }
+
+    BOOST_REQUIRE_EQUAL(expected, (string) CNcbiOstrstreamToString(out));
+    BOOST_REQUIRE_EQUAL(kNumChunks, (int) m_StartOrder.size());
+    for (int i = 0; i < kNumChunks; i++) {
+        BOOST_REQUIRE_EQUAL(kStartOrder[i], m_StartOrder[i]);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,183 @@
+/*  $Id$
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+* File Description:
+*   Unit tests for loading megablast database indices and mapping their
+*   chunks back to subjects
+*
+* ===========================================================================
+*/
+#include <ncbi_pch.hpp>
+#include <corelib/test_boost.hpp>
+#include <corelib/ncbienv.hpp>
+#include <corelib/ncbifile.hpp>
+#include <util/random_gen.hpp>
+
+#include <algo/blast/dbindex/dbindex.hpp>
+#include <algo/blast/dbindex/sequence_istream_fasta.hpp>
+
+using namespace std;
+using namespace ncbi;
+using namespace ncbi::blastdbindex;
+
+/// Number of sequences in the test index
+static const int kNumSeqs = 40;
+
+/// Sequences longer than this are split into several chunks
+static const unsigned long kChunkSize = 1000;
+
+struct CDbIndexTestFixture
+{
+    CNcbiEnvironment m_Env;
+    /// FASTA file the index is made from
+    string m_FastaName;
+    /// Index volume
+    string m_IndexName;
+    /// Sequence lengths, in FASTA file order
+    vector<TSeqPos> m_Lengths;
+
+    CDbIndexTestFixture()
+        : m_FastaName(CFile::GetTmpName(CFile::eTmpFileCreate)),
+          m_IndexName(CFile::GetTmpName(CFile::eTmpFileCreate))
+    {
+        static const char kBases[] = "ACGT";
+        m_Env.Unset("BLASTDB_INDEX_MAP_MODE");
+
+        // sequences of one chunk, of exactly one chunk and of several
+        CRandom rng(1);
+        CNcbiOfstream fasta(m_FastaName.c_str());
+        for (int i = 0; i < kNumSeqs; i++) {
+            TSeqPos length = i % 4 == 0 ? (TSeqPos)kChunkSize :
+                             (TSeqPos)rng.GetRand(200, 5 * kChunkSize);
+            m_Lengths.push_back(length);
+            fasta << ">seq" << i << "\n";
+            for (TSeqPos j = 0; j < length; j++) {
+                fasta << kBases[rng.GetRand(0, 3)];
+                if (j % 80 == 79 || j + 1 == length)
+                    fasta << "\n";
+            }
+        }
+    }
+
+    ~CDbIndexTestFixture()
+    {
+        m_Env.Unset("BLASTDB_INDEX_MAP_MODE");
+        CFile(m_FastaName).Remove();
+        CFile(m_IndexName).Remove();
+    }
+
+    /// Makes the index volume from the FASTA file, in the legacy or the
+    /// current format
+    void x_MakeIndex(bool legacy)
+    {
+        CDbIndex::SOptions options = CDbIndex::DefaultSOptions();
+        options.legacy = legacy;
+        options.chunk_size = kChunkSize;
+        options.report_level = 0;
+        CSequenceIStreamFasta input(m_FastaName);
+        CDbIndex::TSeqNum stop = kMax_UI4;
+        CDbIndex::MakeIndex(input, m_IndexName, 0, stop, options);
+        BOOST_REQUIRE_EQUAL(kNumSeqs, (int) stop);
+    }
+
+    /// Checks that every chunk maps to its subject and to its number
+    /// within the subject, and back
+    void x_CheckChunks(const CDbIndex & index)
+    {
+        BOOST_REQUIRE_EQUAL(kNumSeqs, (int) index.getNumSubjects());
+
+        CDbIndex::TSeqNum sid = 0, rcid = 0;
+        for (CDbIndex::TSeqNum cid = 0; cid < index.getNumChunks(); cid++) {
+            pair<CDbIndex::TSeqNum, CDbIndex::TSeqNum> srcid =
+                index.getSRCId(cid);
+            if (cid > 0 && srcid.first != sid) {
+                // the previous subject has no more chunks
+                BOOST_REQUIRE_EQUAL(index.getNumChunks(sid), rcid + 1);
+                BOOST_REQUIRE_EQUAL(sid + 1, srcid.first);
+                sid = srcid.first;
+                rcid = 0;
+            } else if (cid > 0) {
+                rcid++;
+            }
+            BOOST_REQUIRE_EQUAL(sid, srcid.first);
+            BOOST_REQUIRE_EQUAL(rcid, srcid.second);
+            BOOST_REQUIRE_EQUAL(cid, index.getCId(sid, rcid));
+            BOOST_REQUIRE_EQUAL(sid, index.getSIdByCId(cid));
+        }
+        BOOST_REQUIRE_EQUAL(kNumSeqs - 1, (int) sid);
+        BOOST_REQUIRE_EQUAL(index.getNumChunks(sid), rcid + 1);
+
+        for (sid = 0; sid < (CDbIndex::TSeqNum) kNumSeqs; sid++) {
+            BOOST_REQUIRE_EQUAL(m_Lengths[sid], index.getSubjectLength(sid));
+            BOOST_REQUIRE_EQUAL(m_Lengths[sid] <= kChunkSize,
+                                index.getNumChunks(sid) == 1);
+        }
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(DbIndex, CDbIndexTestFixture)
+
+BOOST_AUTO_TEST_CASE(testChunkToSubjectMap) {
+    for (int legacy = 0; legacy < 2; legacy++) {
+        x_MakeIndex(legacy != 0);
+        CRef<CDbIndex> index = CDbIndex::Load(m_IndexName);
+        BOOST_REQUIRE(index.NotEmpty());
+        x_CheckChunks(*index);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testParseMapMode) {
+    BOOST_REQUIRE_EQUAL(0, CDbIndex::ParseMapMode(""));
+    BOOST_REQUIRE_EQUAL((int) CDbIndex::fMapHugePage,
+                        CDbIndex::ParseMapMode("hugepage"));
+    BOOST_REQUIRE_EQUAL(CDbIndex::fMapPopulate | CDbIndex::fMapLock,
+                        CDbIndex::ParseMapMode(" populate,LOCK "));
+    // unknown names are ignored
+    BOOST_REQUIRE_EQUAL((int) CDbIndex::fMapLock,
+                        CDbIndex::ParseMapMode("lock, bogus"));
+
+    m_Env.Set("BLASTDB_INDEX_MAP_MODE", "hugepage,populate");
+    BOOST_REQUIRE_EQUAL(CDbIndex::fMapHugePage | CDbIndex::fMapPopulate,
+                        CDbIndex::GetMapMode());
+    m_Env.Unset("BLASTDB_INDEX_MAP_MODE");
+    BOOST_REQUIRE_EQUAL(0, CDbIndex::GetMapMode());
+}
+
+// The mapping modes change how the volume is brought into memory, not what
+// is read from it; locking may be refused by RLIMIT_MEMLOCK, in which case
+// the volume is only pre-faulted
+BOOST_AUTO_TEST_CASE(testLoadWithMapModes) {
+    const char* kModes[] = { "hugepage", "populate", "lock",
+                             "hugepage,populate,lock" };
+    x_MakeIndex(false);
+    for (size_t i = 0; i < ArraySize(kModes); i++) {
+        m_Env.Set("BLASTDB_INDEX_MAP_MODE", kModes[i]);
+        CRef<CDbIndex> index = CDbIndex::Load(m_IndexName);
+        BOOST_REQUIRE(index.NotEmpty());
+        x_CheckChunks(*index);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -236,4 +236,95 @@ BOOST_AUTO_TEST_CASE(testMultiSeqHSPCollector) {
     hit_options = BlastHitSavingOptionsFree(hit_options);
     BOOST_REQUIRE(hit_options == NULL);
 }
+static BlastHSPStream* s_MakeCollectorHSPStream(EBlastProgramType program,
+                                                int num_queries)
+{
+    BlastExtensionOptions* ext_options = NULL;
+    BlastExtensionOptionsNew(program, &ext_options, true);
+    BlastScoringOptions* scoring_options = NULL;
+    BlastScoringOptionsNew(program, &scoring_options);
+    BlastHitSavingOptions* hit_options = NULL;
+    BlastHitSavingOptionsNew(program, &hit_options,
+                             scoring_options->gapped_calculation);
+
+    BlastHSPWriterInfo * writer_info = BlastHSPCollectorInfoNew(
+            BlastHSPCollectorParamsNew(
+        hit_options, ext_options->compositionBasedStats,
+        scoring_options->gapped_calculation));
+    BlastHSPWriter* writer = BlastHSPWriterNew(&writer_info, NULL, NULL);
+    BlastHSPStream* hsp_stream = BlastHSPStreamNew(
+        program, ext_options, FALSE, num_queries, writer);
+
+    BlastScoringOptionsFree(scoring_options);
+    BlastExtensionOptionsFree(ext_options);
+    BlastHitSavingOptionsFree(hit_options);
+    return hsp_stream;
+}
+
+BOOST_AUTO_TEST_CASE(testBatchWriteHSPStream) {
+    const int kNumQueries = 3;
+    const int kNumSubjects = 100;
+    const int kBatchSize = 16;
+    const EBlastProgramType kProgram = eBlastTypeBlastp;
+
+    BlastHSPStream* single_stream =
+        s_MakeCollectorHSPStream(kProgram, kNumQueries);
+    BlastHSPStream* batch_stream =
+        s_MakeCollectorHSPStream(kProgram, kNumQueries);
+    BlastHSPStreamRegisterMTLock(batch_stream, Blast_CMT_LOCKInit());
+
+    BlastHSPStreamStats stats;
+    memset(&stats, 0, sizeof(stats));
+    vector<BlastHSPList*> batch;
+    int index, status;
+
+    // Write the same HSP lists to both streams, one at a time and in
+    // batches; subjects are visited out of order as in a threaded search
+    for (index = 0; index < kNumSubjects; ++index) {
+        int oid = (index * 37) % kNumSubjects;
+        BlastHSPList* hsp_list = setupHSPList(oid, kNumQueries, oid);
+        status = BlastHSPStreamWrite(single_stream, &hsp_list);
+        BOOST_REQUIRE_EQUAL(kBlastHSPStream_Success, status);
+        BOOST_REQUIRE(hsp_list == NULL);
+
+        batch.push_back(setupHSPList(oid, kNumQueries, oid));
+        if ((int)batch.size() == kBatchSize || index == kNumSubjects - 1) {
+            status = BlastHSPStreamBatchWrite(batch_stream, &batch[0],
+                                              (Int4)batch.size(), &stats);
+            BOOST_REQUIRE_EQUAL(kBlastHSPStream_Success, status);
+            ITERATE(vector<BlastHSPList*>, itr, batch) {
+                BOOST_REQUIRE(*itr == NULL);
+            }
+            batch.clear();
+        }
+    }
+
+    BOOST_REQUIRE_EQUAL((Int8)kNumSubjects, stats.hsp_lists_written);
+    BOOST_REQUIRE_EQUAL((Int8)((kNumSubjects + kBatchSize - 1) / kBatchSize),
+                        stats.lock_acquisitions);
+    BOOST_REQUIRE_EQUAL((Int8)0, stats.lock_contentions);
+
+    // Both streams must return the same HSP lists in the same order
+    BlastHSPList* single_list = NULL;
+    BlastHSPList* batch_list = NULL;
+    int num_read = 0;
+    while (BlastHSPStreamRead(single_stream, &single_list) ==
+           kBlastHSPStream_Success) {
+        status = BlastHSPStreamRead(batch_stream, &batch_list);
+        BOOST_REQUIRE_EQUAL(kBlastHSPStream_Success, status);
+        BOOST_REQUIRE_EQUAL(single_list->oid, batch_list->oid);
+        BOOST_REQUIRE_EQUAL(single_list->query_index,
+                            batch_list->query_index);
+        BOOST_REQUIRE_EQUAL(single_list->hspcnt, batch_list->hspcnt);
+        single_list = Blast_HSPListFree(single_list);
+        batch_list = Blast_HSPListFree(batch_list);
+        ++num_read;
+    }
+    BOOST_REQUIRE(num_read > 0);
+    status = BlastHSPStreamRead(batch_stream, &batch_list);
+    BOOST_REQUIRE_EQUAL(kBlastHSPStream_Eof, status);
+
+    single_stream = BlastHSPStreamFree(single_stream);
+    batch_stream = BlastHSPStreamFree(batch_stream);
+}
 BOOST_AUTO_TEST_SUITE_END()
@@ -59,6 +59,8 @@
 #include <algo/blast/api/disc_nucl_options.hpp>
 #include <algo/blast/core/blast_nalookup.h>
 #include <algo/blast/core/lookup_util.h>
+#include <algo/blast/core/lookup_cache.h>
+#include <corelib/ncbifile.hpp>
 
 #include "test_objmgr.hpp"
 #include "blast_test_util.hpp"
@@ -732,6 +734,98 @@ BOOST_AUTO_TEST_CASE(testMegablastLookupTableDebruijn) {
         BOOST_REQUIRE(lookup_options == NULL);
 }
 
+// Test that a lookup table saved to a cache file loads back unchanged,
+// and that a file saved with a different key, or, when keys collide, for
+// different query residues or lookup table options, is rejected.
+BOOST_AUTO_TEST_CASE(testLookupTableCacheRoundTrip) {
+
+    const int alphabet_size=4;
+    const int word_size=12;
+
+    debruijnInit(word_size, alphabet_size);
+
+    const bool kMegablast[] = { false, true };
+    for (size_t i = 0; i < sizeof(kMegablast)/sizeof(kMegablast[0]); i++) {
+        LookupTableOptions* lookup_options;
+        LookupTableOptionsNew(eBlastTypeBlastn, &lookup_options);
+        BLAST_FillLookupTableOptions(lookup_options, eBlastTypeBlastn,
+                                     kMegablast[i], 0, kMegablast[i] ? 0 : 8);
+        BOOST_REQUIRE(LookupTableCacheSupported(lookup_options));
+
+        QuerySetUpOptions* query_options = NULL;
+        BlastQuerySetUpOptionsNew(&query_options);
+        const Uint8 kKey = LookupTableCacheKey(query_blk, lookup_options,
+                                               query_options, lookup_segments,
+                                               NULL);
+        LookupTableWrap* lookup_wrap_ptr;
+        BOOST_REQUIRE_EQUAL((int)LookupTableWrapInit(query_blk,
+                             lookup_options, query_options, lookup_segments,
+                             0, &lookup_wrap_ptr, NULL, NULL, NULL), 0);
+        query_options = BlastQuerySetUpOptionsFree(query_options);
+
+        const string kFile1 = CFile::GetTmpName(CFile::eTmpFileCreate);
+        const string kFile2 = CFile::GetTmpName(CFile::eTmpFileCreate);
+        BOOST_REQUIRE_EQUAL(0, (int)LookupTableWrapSave(lookup_wrap_ptr, kKey,
+                                                        query_blk,
+                                                        lookup_options,
+                                                        kFile1.c_str()));
+
+        LookupTableWrap* loaded = NULL;
+        BOOST_REQUIRE(LookupTableWrapLoad(kFile1.c_str(), kKey + 1,
+                                          query_blk, lookup_options,
+                                          &loaded) != 0);
+        BOOST_REQUIRE(loaded == NULL);
+
+        // the same key for a query differing in one residue
+        const Uint1 kResidue = query_blk->sequence[query_blk->length / 2];
+        query_blk->sequence[query_blk->length / 2] = (kResidue + 1) % 4;
+        BOOST_REQUIRE(LookupTableWrapLoad(kFile1.c_str(), kKey,
+                                          query_blk, lookup_options,
+                                          &loaded) != 0);
+        BOOST_REQUIRE(loaded == NULL);
+        query_blk->sequence[query_blk->length / 2] = kResidue;
+
+        // the same key for different lookup table options
+        LookupTableOptions other_options = *lookup_options;
+        other_options.word_size++;
+        BOOST_REQUIRE(LookupTableWrapLoad(kFile1.c_str(), kKey,
+                                          query_blk, &other_options,
+                                          &loaded) != 0);
+        BOOST_REQUIRE(loaded == NULL);
+        other_options = *lookup_options;
+        other_options.threshold += 0.5;
+        BOOST_REQUIRE(LookupTableWrapLoad(kFile1.c_str(), kKey,
+                                          query_blk, &other_options,
+                                          &loaded) != 0);
+        BOOST_REQUIRE(loaded == NULL);
+
+        BOOST_REQUIRE_EQUAL(0, (int)LookupTableWrapLoad(kFile1.c_str(), kKey,
+                                                        query_blk,
+                                                        lookup_options,
+                                                        &loaded));
+        BOOST_REQUIRE_EQUAL(lookup_wrap_ptr->lut_type, loaded->lut_type);
+
+        // every field written to the file survives the round trip
+        BOOST_REQUIRE_EQUAL(0, (int)LookupTableWrapSave(loaded, kKey,
+                                                        query_blk,
+                                                        lookup_options,
+                                                        kFile2.c_str()));
+        BOOST_REQUIRE(CFile(kFile1).Compare(kFile2));
+
+        if (loaded->lut_type == eMBLookupTable) {
+            BlastMBLookupTable* lookup = (BlastMBLookupTable*) loaded->lut;
+            BOOST_REQUIRE_EQUAL(16777216, lookup->hashsize);
+            BOOST_REQUIRE_EQUAL(10, lookup->pv_array_bts);
+        }
+
+        CFile(kFile1).Remove();
+        CFile(kFile2).Remove();
+        loaded = LookupTableWrapFree(loaded);
+        lookup_wrap_ptr = LookupTableWrapFree(lookup_wrap_ptr);
+        lookup_options = LookupTableOptionsFree(lookup_options);
+    }
+}
+
 // Test that nothing is put into the lookup table if contiguous unmasked
 // regions are smaller than user specified word size.
 BOOST_AUTO_TEST_CASE(testStdTableSmallUnmaskedRegion) {
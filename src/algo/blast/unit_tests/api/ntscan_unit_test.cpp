@@ -843,6 +843,69 @@ BOOST_AUTO_TEST_CASE( DiscontigTwoSubjects )
     }
 }
 
+BOOST_AUTO_TEST_CASE( BatchScanMatchesSubjectScan )
+{
+    const Int4 kSubjects[] = { 313959, 271065, 313959 };
+    const Int4 kNumSubjects = sizeof(kSubjects) / sizeof(kSubjects[0]);
+    vector< vector< pair<Uint4, Uint4> > > expected(kNumSubjects);
+    BlastNaSubjectBatch* batch = NULL;
+    BlastMBLookupTable *mb_lt = NULL;
+    Int4 max_hits;
+    Int4 i, j;
+
+    SetUpQuery(555, eNa_strand_both);
+    SetUpLookupTable(TRUE, eMBWordCoding, 0, 11);
+    BOOST_REQUIRE(lookup_wrap_ptr->lut_type == eMBLookupTable);
+    mb_lt = (BlastMBLookupTable *)lookup_wrap_ptr->lut;
+    max_hits = GetOffsetArraySize(lookup_wrap_ptr);
+
+    batch = BlastNaSubjectBatchNew(kNumSubjects, 100000);
+    BOOST_REQUIRE(batch != NULL);
+
+    for (i = 0; i < kNumSubjects; i++) {
+        Int4 scan_range[2];
+        SetUpSubject(kSubjects[i]);
+
+        scan_range[0] = 0;
+        scan_range[1] = subject_blk->length - mb_lt->lut_word_length;
+        while (scan_range[0] <= scan_range[1]) {
+            Int4 hits = RunScanSubject(scan_range, max_hits);
+            for (j = 0; j < hits; j++) {
+                expected[i].push_back(make_pair(
+                                    offset_pairs[j].qs_offsets.q_off,
+                                    offset_pairs[j].qs_offsets.s_off));
+            }
+        }
+
+        subject_blk->oid = i;
+        BOOST_REQUIRE(BlastNaSubjectBatchAdd(batch, subject_blk));
+        TearDownSubject();
+    }
+
+    BOOST_REQUIRE_EQUAL(0, BlastNaSubjectBatchScan(batch, lookup_wrap_ptr,
+                                                   offset_pairs, max_hits));
+    BOOST_REQUIRE_EQUAL(kNumSubjects, batch->num_subjects);
+
+    for (i = 0; i < kNumSubjects; i++) {
+        BLAST_SequenceBlk subject;
+        BlastNaSubjectBatchGetSubject(batch, i, &subject);
+        BOOST_REQUIRE_EQUAL(i, subject.oid);
+
+        BOOST_REQUIRE(!expected[i].empty());
+        BOOST_REQUIRE_EQUAL((Int4)expected[i].size(),
+                batch->hit_starts[i + 1] - batch->hit_starts[i]);
+        for (j = 0; j < (Int4)expected[i].size(); j++) {
+            const BlastOffsetPair& hit =
+                                batch->hits[batch->hit_starts[i] + j];
+            BOOST_REQUIRE_EQUAL(expected[i][j].first, hit.qs_offsets.q_off);
+            BOOST_REQUIRE_EQUAL(expected[i][j].second, hit.qs_offsets.s_off);
+        }
+    }
+
+    batch = BlastNaSubjectBatchFree(batch);
+    BOOST_REQUIRE(batch == NULL);
+}
+
 #define DECLARE_TEST(name, gi, d_size, d_type, wordsize)                    \
 BOOST_AUTO_TEST_CASE( name##ScanOffsetSize##wordsize ) {                    \
     SetUpQuerySubjectAndLUT(TRUE, gi, (EDiscWordType)d_type, d_size, wordsize);\
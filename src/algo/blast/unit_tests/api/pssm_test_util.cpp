@@ -36,12 +36,75 @@
 #include <corelib/test_boost.hpp>
 #include "blast_test_util.hpp"
 #include "pssm_test_util.hpp"
+#include "test_objmgr.hpp"
+
+#include <serial/serial.hpp>
+#include <serial/objistr.hpp>
+#include <objects/seqloc/Seq_id.hpp>
 
 
 using namespace std;
 using namespace ncbi;
 using namespace ncbi::blast;
 
+USING_SCOPE(objects);
+
+void
+CPssmCreateTestFixture::LoadNr129295Alignments()
+{
+    const string kSeqAlignFile("data/nr-129295.new.asn.short");
+    unique_ptr<CObjectIStream> in
+        (CObjectIStream::Open(kSeqAlignFile, eSerial_AsnText));
+    m_Alignments.Reset(new CSeq_align_set());
+    *in >> *m_Alignments;
+
+    CSeq_id qid("gi|129295");
+    unique_ptr<SSeqLoc> q(CTestObjMgr::Instance().CreateSSeqLoc(qid));
+    SBlastSequence seq(GetSequence(*q->seqloc, eBlastEncodingProtein,
+                                   q->scope));
+    // don't copy the sentinels
+    m_Query.assign(seq.data.get() + 1, seq.data.get() + seq.length - 1);
+    m_Scope = q->scope;
+}
+
+CRef<CPssmWithParameters>
+CPssmCreateTestFixture::ComputePssm(CConstRef<CSeq_align_set> alignments,
+                                    int num_threads,
+                                    CRef<CPsiBlastMsaCache> msa_cache,
+                                    const unsigned char* query,
+                                    unsigned int query_length)
+{
+    BOOST_REQUIRE( !m_Query.empty() );
+    if ( !query ) {
+        query = &m_Query[0];
+        query_length = m_Query.size();
+    }
+
+    CPSIBlastOptions opts;
+    PSIBlastOptionsNew(&opts);
+    opts->num_threads = num_threads;
+
+    PSIDiagnosticsRequest request;
+    memset((void*) &request, 0, sizeof(request));
+    request.information_content = true;
+    request.residue_frequencies = true;
+    request.weighted_residue_frequencies = true;
+    request.frequency_ratios = true;
+    request.gapless_column_weights = true;
+    request.sigma = true;
+    request.interval_sizes = true;
+    request.num_matching_seqs = true;
+
+    CRef<CPsiBlastInputData> pssm_input(
+        new CPsiBlastInputData(query, query_length, alignments, m_Scope,
+                               *opts, "BLOSUM62", 11, 1, &request));
+    if (msa_cache.NotEmpty()) {
+        pssm_input->SetMsaCache(msa_cache);
+    }
+    CPssmEngine pssm_engine(pssm_input.GetPointer());
+    return pssm_engine.Run();
+}
+
 /// @param query protein sequence in ncbistdaa with sentinel bytes
 /// @param query_size length of the query sequence (w/o including sentinel
 //  bytes)
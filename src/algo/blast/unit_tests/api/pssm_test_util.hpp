@@ -45,6 +45,8 @@
 #include <algo/blast/core/blast_stat.h>
 #include <algo/blast/core/blast_setup.h>
 #include <objmgr/scope.hpp>
+#include <objects/seqalign/Seq_align_set.hpp>
+#include <objects/scoremat/PssmWithParameters.hpp>
 #include "blast_psi_priv.h"
 
 using namespace std;
@@ -97,6 +99,34 @@ public:
    {
          return input.GetNumAlignedSequences();
    }
+
+   /// Reads the alignments in data/nr-129295.new.asn.short into
+   /// m_Alignments and their query (gi 129295) into m_Query, fetching it
+   /// with m_Scope
+   void LoadNr129295Alignments();
+
+   /// Builds a PSSM, with all diagnostics, from alignments to the query
+   /// loaded by LoadNr129295Alignments
+   /// @param alignments alignments to build the PSSM from [in]
+   /// @param num_threads number of threads to build the PSSM with [in]
+   /// @param msa_cache cache of multiple sequence alignment rows to use, if
+   /// not empty [in]
+   /// @param query query to use instead of m_Query, if not NULL [in]
+   /// @param query_length length of query [in]
+   CRef<objects::CPssmWithParameters>
+   ComputePssm(CConstRef<objects::CSeq_align_set> alignments,
+               int num_threads,
+               CRef<CPsiBlastMsaCache> msa_cache,
+               const unsigned char* query = NULL,
+               unsigned int query_length = 0);
+
+protected:
+   /// Alignments read by LoadNr129295Alignments
+   CRef<objects::CSeq_align_set> m_Alignments;
+   /// Query sequence of m_Alignments in ncbistdaa, without sentinel bytes
+   vector<unsigned char> m_Query;
+   /// Scope the sequences aligned to m_Query are fetched from
+   CRef<objects::CScope> m_Scope;
 };
 
 /// @param query protein sequence in ncbistdaa with sentinel bytes
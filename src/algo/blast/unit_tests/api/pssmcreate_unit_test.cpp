@@ -564,7 +564,6 @@ const Uint1 CPssmInputTestData::kQuery[CPssmInputTestData::kQueryLength] = {
      6, 11,  6, 11,  9, 10,  8, 13, 14, 18, 13, 18,  9, 19, 22, 
      6,  7, 16, 22, 20, 17, 14};
 
-
 BOOST_FIXTURE_TEST_SUITE(pssmcreate, CPssmCreateTestFixture)
 
 
@@ -755,7 +754,7 @@ BOOST_AUTO_TEST_CASE(testSeqAlignToPsiBlastMultipleSequenceAlignment) {
 /// layer):
 /// 1. purged biased sequences
 BOOST_AUTO_TEST_CASE(testPurgeSequencesWithNull) {
-        int rv = _PSIPurgeBiasedSegments(NULL);
+        int rv = _PSIPurgeBiasedSegments(NULL, 1);
         BOOST_REQUIRE_EQUAL(PSIERR_BADPARAM, rv);
 }
 
@@ -764,7 +763,7 @@ BOOST_AUTO_TEST_CASE(testPurgeSelfHit) {
             (new CPssmInputTestData(CPssmInputTestData::eSelfHit));
         pssm_input->Process();  // standard calling convention
         AutoPtr<_PSIPackedMsa> msa(_PSIPackedMsaNew(pssm_input->GetData()));
-        int rv = _PSIPurgeBiasedSegments(msa.get());
+        int rv = _PSIPurgeBiasedSegments(msa.get(), 1);
         BOOST_REQUIRE_EQUAL(PSI_SUCCESS, rv);    
         const Uint4 kSelfHitIndex = 1;
 		BOOST_REQUIRE_EQUAL(true, !!msa->use_sequence[kQueryIndex]);
@@ -776,7 +775,7 @@ BOOST_AUTO_TEST_CASE(testPurgeDuplicateHit) {
             (new CPssmInputTestData(CPssmInputTestData::eDuplicateHit));
         pssm_input->Process();  // standard calling convention
         AutoPtr<_PSIPackedMsa> msa(_PSIPackedMsaNew(pssm_input->GetData()));
-        int rv = _PSIPurgeBiasedSegments(msa.get());
+        int rv = _PSIPurgeBiasedSegments(msa.get(), 1);
         BOOST_REQUIRE_EQUAL(PSI_SUCCESS, rv);    
         const Uint4 kDuplicateHitIndex = 2;
         BOOST_REQUIRE_EQUAL(false, !!msa->use_sequence[kDuplicateHitIndex]);
@@ -789,7 +788,7 @@ BOOST_AUTO_TEST_CASE(testPurgeNearIdenticalHits) {
             (new CPssmInputTestData(CPssmInputTestData::eNearIdenticalHits));
         pssm_input->Process();  // standard calling convention
         AutoPtr<_PSIPackedMsa> msa(_PSIPackedMsaNew(pssm_input->GetData()));
-        int rv = _PSIPurgeBiasedSegments(msa.get());
+        int rv = _PSIPurgeBiasedSegments(msa.get(), 1);
         BOOST_REQUIRE_EQUAL(PSI_SUCCESS, rv);    
         const Uint4 kRemovedHitIndex = 2;
         BOOST_REQUIRE_EQUAL(false, 
@@ -876,7 +875,7 @@ BOOST_AUTO_TEST_CASE(testMultiSeqAlignmentHasRegionsUnalignedToQuery) {
         /*** Run the stage to purge biased alignment segments */
         AutoPtr<_PSIPackedMsa> packed_msa
             (_PSIPackedMsaNew(pssm_input->GetData()));
-        int rv = _PSIPurgeBiasedSegments(packed_msa.get());
+        int rv = _PSIPurgeBiasedSegments(packed_msa.get(), 1);
         BOOST_REQUIRE_EQUAL(PSI_SUCCESS, rv);    
         BOOST_REQUIRE_EQUAL(true, 
                              !!packed_msa->use_sequence[kQueryIndex]);
@@ -941,6 +940,7 @@ BOOST_AUTO_TEST_CASE(testMultiSeqAlignmentHasRegionsUnalignedToQuery) {
                                    sbp));
         rv = _PSIComputeSequenceWeights(msa.get(), aligned_blocks.get(),
                                         opts->nsg_compatibility_mode,
+                                        opts->num_threads,
                                         seq_weights.get());
         ss.str("");
         ss << "_PSIComputeSequenceWeights failed: "
@@ -984,6 +984,7 @@ BOOST_AUTO_TEST_CASE(testMultiSeqAlignmentHasRegionsUnalignedToQuery) {
         rv = _PSIComputeFreqRatios(msa.get(), seq_weights.get(), sbp,
                                    aligned_blocks.get(), opts->pseudo_count,
                                    opts->nsg_compatibility_mode,
+                                   opts->num_threads,
                                    internal_pssm.get());
         ss.str("");
         ss << "_PSIComputeResidueFrequencies failed: "
@@ -1074,7 +1075,7 @@ BOOST_AUTO_TEST_CASE(testQueryIsOnlyAlignedSequenceInMsa) {
         /*** Run the stage to purge biased alignment segments */
         AutoPtr<_PSIPackedMsa> packed_msa
             (_PSIPackedMsaNew(pssm_input->GetData()));
-        int rv = _PSIPurgeBiasedSegments(packed_msa.get());
+        int rv = _PSIPurgeBiasedSegments(packed_msa.get(), 1);
         BOOST_REQUIRE_EQUAL(PSI_SUCCESS, rv);    
         const Uint4 kSelfHitIndex = 1;
         BOOST_REQUIRE_EQUAL(true, 
@@ -1118,6 +1119,7 @@ BOOST_AUTO_TEST_CASE(testQueryIsOnlyAlignedSequenceInMsa) {
                                         // N.B.: we're deliberately ignoring
                                         // the sequence weights check!!!!
                                         TRUE,
+                                        opts->num_threads,
                                         seq_weights.get());
         ss.str("");
         ss << "_PSIComputeSequenceWeights failed: "
@@ -1131,6 +1133,7 @@ BOOST_AUTO_TEST_CASE(testQueryIsOnlyAlignedSequenceInMsa) {
         rv = _PSIComputeFreqRatios(msa.get(), seq_weights.get(), sbp,
                                    aligned_blocks.get(), opts->pseudo_count,
                                    opts->nsg_compatibility_mode,
+                                   opts->num_threads,
                                    internal_pssm.get());
         ss.str("");
         ss << "_PSIComputeResidueFrequencies failed: "
@@ -1245,6 +1248,149 @@ BOOST_AUTO_TEST_CASE(testPsiLowerCaseMatrix) {
 
 }
 
+// The PSSM and its intermediate data must not depend on the number of
+// threads used to compute them
+BOOST_AUTO_TEST_CASE(testMultiThreadedPssmIsIdentical) {
+
+        LoadNr129295Alignments();
+        CRef<CPssmWithParameters> pssm_st =
+            ComputePssm(m_Alignments, 1, CRef<CPsiBlastMsaCache>());
+
+        const int kNumThreads[] = { 2, 4, 7 };
+        for (size_t i = 0; i < ArraySize(kNumThreads); i++) {
+            CRef<CPssmWithParameters> pssm_mt =
+                ComputePssm(m_Alignments, kNumThreads[i],
+                            CRef<CPsiBlastMsaCache>());
+            BOOST_REQUIRE_MESSAGE(pssm_st->Equals(*pssm_mt),
+                                  "PSSM differs with " << kNumThreads[i] <<
+                                  " threads");
+        }
+}
+
+// Rows of the multiple sequence alignment reused from a CPsiBlastMsaCache
+// must yield the same PSSM as rows built from the alignments
+BOOST_AUTO_TEST_CASE(testMsaCacheReuseIsIdentical) {
+
+        LoadNr129295Alignments();
+        CRef<CPssmWithParameters> pssm_no_cache =
+            ComputePssm(m_Alignments, 1, CRef<CPsiBlastMsaCache>());
+
+        // First use populates the cache
+        CRef<CPsiBlastMsaCache> msa_cache(new CPsiBlastMsaCache);
+        CRef<CPssmWithParameters> pssm =
+            ComputePssm(m_Alignments, 1, msa_cache);
+        BOOST_REQUIRE(pssm_no_cache->Equals(*pssm));
+        const size_t kNumRows = msa_cache->GetNumRows();
+        BOOST_REQUIRE(kNumRows > 1);
+        BOOST_REQUIRE_EQUAL((size_t)0, msa_cache->GetNumReusedRows());
+
+        // Second use copies all rows from the cache, as the alignments are
+        // unchanged
+        pssm = ComputePssm(m_Alignments, 1, msa_cache);
+        BOOST_REQUIRE(pssm_no_cache->Equals(*pssm));
+        BOOST_REQUIRE_EQUAL(kNumRows, msa_cache->GetNumRows());
+        BOOST_REQUIRE_EQUAL(kNumRows, msa_cache->GetNumReusedRows());
+
+        // Drop the alignments of the last subject sequence: all other rows
+        // are reused
+        CRef<CSeq_align_set> fewer(new CSeq_align_set());
+        fewer->Set() = m_Alignments->Get();
+        const CSeq_id& last_sid = fewer->Get().back()->GetSeq_id(1);
+        CSeq_id_Handle last_subject = CSeq_id_Handle::GetHandle(last_sid);
+        while ( !fewer->Get().empty() &&
+                CSeq_id_Handle::GetHandle(fewer->Get().back()->GetSeq_id(1))
+                    == last_subject ) {
+            fewer->Set().pop_back();
+        }
+        pssm_no_cache =
+            ComputePssm(fewer, 1, CRef<CPsiBlastMsaCache>());
+        pssm = ComputePssm(fewer, 1, msa_cache);
+        BOOST_REQUIRE(pssm_no_cache->Equals(*pssm));
+        BOOST_REQUIRE_EQUAL(kNumRows - 1, msa_cache->GetNumRows());
+        BOOST_REQUIRE_EQUAL(kNumRows - 1, msa_cache->GetNumReusedRows());
+
+        // Shorten the last remaining alignment by one residue, which changes
+        // its signature: its row is rebuilt, the others are reused
+        CRef<CSeq_align> changed(new CSeq_align);
+        changed->Assign(*fewer->Get().back());
+        CDense_seg& ds = changed->SetSegs().SetDenseg();
+        BOOST_REQUIRE(ds.GetLens().back() > 1);
+        ds.SetLens().back()--;
+        fewer->Set().back() = changed;
+        pssm_no_cache =
+            ComputePssm(fewer, 1, CRef<CPsiBlastMsaCache>());
+        pssm = ComputePssm(fewer, 1, msa_cache);
+        BOOST_REQUIRE(pssm_no_cache->Equals(*pssm));
+        BOOST_REQUIRE_EQUAL(kNumRows - 1, msa_cache->GetNumRows());
+        BOOST_REQUIRE_EQUAL(kNumRows - 2, msa_cache->GetNumReusedRows());
+
+        // Reuse combined with multiple threads
+        pssm = ComputePssm(fewer, 4, msa_cache);
+        BOOST_REQUIRE(pssm_no_cache->Equals(*pssm));
+        BOOST_REQUIRE_EQUAL(kNumRows - 1, msa_cache->GetNumReusedRows());
+}
+
+// Cached rows must not be reused for a query of a different length
+BOOST_AUTO_TEST_CASE(testMsaCacheQueryLengthMismatch) {
+
+        LoadNr129295Alignments();
+
+        // Populate the cache using a longer query: the same sequence followed
+        // by a few extra residues, which no alignment covers
+        const unsigned int kExtraResidues = 5;
+        vector<unsigned char> longer_query(m_Query);
+        longer_query.insert(longer_query.end(), m_Query.begin(),
+                            m_Query.begin() + kExtraResidues);
+        CRef<CPsiBlastMsaCache> msa_cache(new CPsiBlastMsaCache);
+        ComputePssm(m_Alignments, 1, msa_cache, &longer_query[0],
+                    longer_query.size());
+        const size_t kNumRows = msa_cache->GetNumRows();
+        BOOST_REQUIRE(kNumRows > 0);
+
+        CRef<CPssmWithParameters> pssm_no_cache =
+            ComputePssm(m_Alignments, 1, CRef<CPsiBlastMsaCache>());
+        CRef<CPssmWithParameters> pssm =
+            ComputePssm(m_Alignments, 1, msa_cache);
+        BOOST_REQUIRE(pssm_no_cache->Equals(*pssm));
+        BOOST_REQUIRE_EQUAL((size_t)0, msa_cache->GetNumReusedRows());
+        BOOST_REQUIRE_EQUAL(kNumRows, msa_cache->GetNumRows());
+        BOOST_REQUIRE_EQUAL(m_Query.size(),
+                            (size_t)pssm->GetPssm().GetNumColumns());
+}
+
+// Rows of subject sequences which cannot be retrieved must not be cached
+BOOST_AUTO_TEST_CASE(testMsaCacheSkipsUnavailableSequences) {
+
+        LoadNr129295Alignments();
+        CRef<CPsiBlastMsaCache> msa_cache(new CPsiBlastMsaCache);
+        ComputePssm(m_Alignments, 1, msa_cache);
+        const size_t kNumRows = msa_cache->GetNumRows();
+        BOOST_REQUIRE(kNumRows > 0);
+
+        // Append a copy of the first alignment whose subject is a sequence
+        // which is not available in the scope
+        CRef<CSeq_align> missing(new CSeq_align);
+        missing->Assign(*m_Alignments->Get().front());
+        missing->SetSegs().SetDenseg().SetIds().back()
+            .Reset(new CSeq_id("lcl|pssmcreate_unit_test_missing_seq"));
+        CRef<CSeq_align_set> with_missing(new CSeq_align_set());
+        with_missing->Set() = m_Alignments->Get();
+        with_missing->Set().push_back(missing);
+
+        CRef<CPssmWithParameters> pssm_no_cache =
+            ComputePssm(with_missing, 1, CRef<CPsiBlastMsaCache>());
+        CRef<CPssmWithParameters> pssm =
+            ComputePssm(with_missing, 1, msa_cache);
+        BOOST_REQUIRE(pssm_no_cache->Equals(*pssm));
+        BOOST_REQUIRE_EQUAL(kNumRows, msa_cache->GetNumRows());
+        BOOST_REQUIRE_EQUAL(kNumRows, msa_cache->GetNumReusedRows());
+
+        // Retrieval of the missing sequence is attempted again
+        pssm = ComputePssm(with_missing, 1, msa_cache);
+        BOOST_REQUIRE(pssm_no_cache->Equals(*pssm));
+        BOOST_REQUIRE_EQUAL(kNumRows, msa_cache->GetNumRows());
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -48,6 +48,9 @@
 #include <serial/objostr.hpp>
 
 #include <algo/blast/api/bl2seq.hpp>
+#include <algo/blast/api/local_blast.hpp>
+#include <algo/blast/api/objmgr_query_data.hpp>
+#include <algo/blast/api/uniform_search.hpp>
 #include <algo/blast/api/seqsrc_multiseq.hpp>
 #include <blast_objmgr_priv.hpp>
 #include <blast_psi_priv.h>
@@ -977,6 +980,42 @@ BOOST_AUTO_TEST_CASE(CheckLowerCaseMatrix)
       BOOST_REQUIRE(Blast_FrequencyDataIsAvailable("blosum62") == 1);
 }
 
+// Which matches BlastCompo_EarlyTermination skips depends on how the
+// matches are distributed over the threads, so that distribution must not
+// change between runs
+BOOST_AUTO_TEST_CASE(testRedoAlignmentMTIsDeterministic)
+{
+    CSeq_id id(CSeq_id::e_Gi, 1786182);
+    CBlastQueryVector q;
+    q.AddQuery(CTestObjMgr::Instance().CreateBlastSearchQuery(id));
+    CRef<IQueryFactory> query_factory(new CObjMgr_QueryFactory(q));
+
+    CRef<CBlastOptionsHandle> opts(CBlastOptionsFactory::Create(eBlastp));
+    opts->SetOptions().SetSegFiltering(false);
+    opts->SetOptions().SetCompositionBasedStats(eCompositionMatrixAdjust);
+    // a short hit list lets the early termination test skip matches
+    opts->SetOptions().SetHitlistSize(5);
+
+    CSearchDatabase dbinfo("ecoli", CSearchDatabase::eBlastDbIsProtein);
+    CRef<CLocalDbAdapter> db(new CLocalDbAdapter(dbinfo));
+
+    const int kNumThreads = 4;
+    string asn[2];
+    for (int i = 0; i < 2; i++) {
+        CLocalBlast blaster(query_factory, opts, db);
+        blaster.SetNumberOfThreads(kNumThreads);
+        CRef<CSearchResultSet> results = blaster.Run();
+        BOOST_REQUIRE_EQUAL((size_t)1, results->GetNumResults());
+        CConstRef<CSeq_align_set> aligns = (*results)[0].GetSeqAlign();
+        BOOST_REQUIRE(aligns.NotEmpty() && !aligns->Get().empty());
+
+        CNcbiOstrstream out;
+        out << MSerial_AsnText << *aligns;
+        asn[i] = CNcbiOstrstreamToString(out);
+    }
+    BOOST_REQUIRE_EQUAL(asn[0], asn[1]);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 /*
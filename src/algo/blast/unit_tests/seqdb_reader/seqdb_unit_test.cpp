@@ -3802,6 +3802,141 @@ BOOST_AUTO_TEST_CASE(VersionedSparseId)
     BOOST_REQUIRE(o3.size() == 1);
 }
 
+// Looks up accs in one batch and one at a time, and checks that the results
+// agree.  Returns the number of accessions found.
+static int s_CheckBatchLookup(const CSeqDB & db, const vector<string> & accs)
+{
+    vector<blastdb::TOid> oids;
+    db.AccessionsToOids(accs, oids);
+
+    BOOST_REQUIRE_EQUAL(accs.size(), oids.size());
+
+    int found = 0;
+
+    for(size_t i = 0; i < accs.size(); i++) {
+        vector<int> expected;
+        db.AccessionToOids(accs[i], expected);
+
+        if (expected.empty()) {
+            BOOST_REQUIRE_EQUAL(kSeqDBEntryNotFound, oids[i]);
+        } else {
+            BOOST_REQUIRE_EQUAL(expected.front(), oids[i]);
+            found++;
+        }
+    }
+
+    return found;
+}
+
+BOOST_AUTO_TEST_CASE(VersionedSparseIdBatch)
+{
+    CSeqDB db("data/sparse_id", CSeqDB::eNucleotide);
+
+    vector<string> accs;
+    accs.push_back("Z12841.1");
+    accs.push_back("Z12842.1");
+    accs.push_back("Z12843.1");
+
+    BOOST_REQUIRE_EQUAL(2, s_CheckBatchLookup(db, accs));
+}
+
+BOOST_AUTO_TEST_CASE(BatchAccessionLookup)
+{
+    CSeqDB db("data/seqp", CSeqDB::eProtein);
+
+    // Accessions in several forms and cases, plus some misses, in
+    // reverse OID order so the batch has to sort them.
+
+    vector<string> accs;
+
+    for(int oid = db.GetNumOIDs() - 1; oid >= 0; oid--) {
+        list< CRef<CSeq_id> > ids = db.GetSeqIDs(oid);
+
+        ITERATE(list< CRef<CSeq_id> >, id, ids) {
+            if ((*id)->IsGi()) {
+                continue;
+            }
+
+            string acc = (*id)->GetSeqIdString(true);
+
+            accs.push_back((*id)->AsFastaString());
+            accs.push_back(acc);
+            accs.push_back(NStr::ToUpper(acc));
+            accs.push_back((*id)->GetSeqIdString(false));
+            accs.push_back(acc + "0");
+        }
+    }
+    accs.push_back("no_such_accession");
+
+    BOOST_REQUIRE(s_CheckBatchLookup(db, accs) > 0);
+}
+
+BOOST_AUTO_TEST_CASE(BatchGiLookup)
+{
+    CSeqDB db("data/seqp", CSeqDB::eProtein);
+
+    // GIs with and without the prefix, and GIs next to them that may be
+    // missing, in reverse OID order.
+
+    vector<string> accs;
+    int num_gis = 0;
+
+    for(int oid = db.GetNumOIDs() - 1; oid >= 0; oid--) {
+        vector<TGi> gis;
+        db.GetGis(oid, gis);
+
+        ITERATE(vector<TGi>, gi, gis) {
+            Int8 id = GI_TO(Int8, *gi);
+
+            accs.push_back("gi|" + NStr::Int8ToString(id));
+            accs.push_back(NStr::Int8ToString(id));
+            accs.push_back("gi|" + NStr::Int8ToString(id + 1));
+            num_gis++;
+        }
+    }
+    accs.push_back("gi|1");
+
+    BOOST_REQUIRE(num_gis > 0);
+    BOOST_REQUIRE(s_CheckBatchLookup(db, accs) >= num_gis);
+}
+
+BOOST_AUTO_TEST_CASE(BatchPigLookup)
+{
+    CSeqDB db("data/wp_nr", CSeqDB::eProtein);
+
+    vector<string> accs;
+    int num_pigs = 0;
+
+    for(int oid = db.GetNumOIDs() - 1; oid >= 0; oid--) {
+        int pig = 0;
+
+        if (db.OidToPig(oid, pig)) {
+            accs.push_back("gnl|PIG|" + NStr::IntToString(pig));
+            accs.push_back("gnl|PIG|" + NStr::IntToString(pig + 1000000));
+            num_pigs++;
+        }
+    }
+    accs.push_back("gnl|PIG|1");
+
+    BOOST_REQUIRE(num_pigs > 0);
+    BOOST_REQUIRE(s_CheckBatchLookup(db, accs) >= num_pigs);
+}
+
+BOOST_AUTO_TEST_CASE(BatchTiLookup)
+{
+    CSeqDB db("data/short-tis", CSeqDB::eNucleotide);
+
+    vector<string> ids;
+    NStr::Split("19744 9872 1235 4936 2468 1234 1234000", " ", ids);
+
+    vector<string> accs;
+    ITERATE(vector<string>, id, ids) {
+        accs.push_back("gnl|ti|" + *id);
+    }
+
+    BOOST_REQUIRE_EQUAL(5, s_CheckBatchLookup(db, accs));
+}
+
 #if ((!defined(NCBI_COMPILER_WORKSHOP) || (NCBI_COMPILER_VERSION  > 550)) && \
      (!defined(NCBI_COMPILER_MIPSPRO)) )
 BOOST_AUTO_TEST_CASE(MaskDataColumn)
@@ -4471,6 +4606,135 @@ BOOST_AUTO_TEST_CASE(TestMemoryMapFile)
 	BOOST_REQUIRE_EQUAL(atlas.GetOpenedFilseCount(), MAX_FD_COUNT);
 }
 
+BOOST_AUTO_TEST_CASE(TestAtlasMapMode)
+{
+    BOOST_REQUIRE_EQUAL(CSeqDBAtlas::ParseMapMode(""), 0);
+    BOOST_REQUIRE_EQUAL(CSeqDBAtlas::ParseMapMode("Sequential, hugepage"),
+                        CSeqDBAtlas::fMapSequential |
+                        CSeqDBAtlas::fMapHugePage);
+    BOOST_REQUIRE_EQUAL(CSeqDBAtlas::ParseMapMode("populate,bogus"),
+                        CSeqDBAtlas::fMapPopulate);
+
+    string plain;
+    {
+        CSeqDBAtlas atlas(true);
+        CSeqDBFileMemMap file(atlas, "data/seqp.psq");
+        CSeqDBAtlas::TIndx length = 0;
+        BOOST_REQUIRE(atlas.GetFileSize("data/seqp.psq", length));
+        plain.assign(file.GetFileDataPtr(0), length);
+    }
+
+    CNcbiEnvironment env;
+    env.Set("BLASTDB_ATLAS_MODE", "sequential,populate,interleave,replicate");
+    {
+        CSeqDBAtlas atlas(true);
+        BOOST_REQUIRE_EQUAL(atlas.GetMapMode(),
+                            CSeqDBAtlas::fMapSequential |
+                            CSeqDBAtlas::fMapPopulate |
+                            CSeqDBAtlas::fMapInterleave |
+                            CSeqDBAtlas::fMapReplicate);
+        CSeqDBFileMemMap file(atlas, "data/seqp.psq");
+        BOOST_REQUIRE(plain == string(file.GetFileDataPtr(0), plain.size()));
+
+        Uint8 bytes_mapped = 0;
+        vector<CSeqDBAtlas::SNodeMapStats> stats = atlas.GetNodeMapStats();
+        ITERATE(vector<CSeqDBAtlas::SNodeMapStats>, node, stats) {
+            bytes_mapped += node->bytes_mapped;
+        }
+        BOOST_REQUIRE(bytes_mapped >= plain.size());
+    }
+
+    // Replicate over more than one node whether or not this machine has
+    // them: binding to a missing node fails and the copy stays usable.
+    // Node 0 is not listed, so a thread running there must be given the
+    // copy of the first listed node.
+    env.Set("BLASTDB_ATLAS_NODES", "1,3");
+    {
+        CSeqDBAtlas atlas(true);
+        BOOST_REQUIRE(atlas.GetNumaNodes() == CSeqDBAtlas::ParseNodeList("1,3"));
+        CSeqDBFileMemMap file(atlas, "data/seqp.psq");
+        BOOST_REQUIRE(plain == string(file.GetFileDataPtr(0), plain.size()));
+
+        vector<CSeqDBAtlas::SNodeMapStats> stats = atlas.GetNodeMapStats();
+        BOOST_REQUIRE_EQUAL(stats.size(), (size_t)4);
+#if defined(NCBI_OS_LINUX)
+        BOOST_REQUIRE_EQUAL(stats[1].bytes_mapped, (Uint8)plain.size());
+        BOOST_REQUIRE_EQUAL(stats[3].bytes_mapped, (Uint8)plain.size());
+#endif
+    }
+    env.Unset("BLASTDB_ATLAS_NODES");
+    env.Unset("BLASTDB_ATLAS_MODE");
+}
+
+BOOST_AUTO_TEST_CASE(TestAtlasNodeList)
+{
+    BOOST_REQUIRE(CSeqDBAtlas::ParseNodeList("").empty());
+    BOOST_REQUIRE(CSeqDBAtlas::ParseNodeList("0\n") == vector<int>(1, 0));
+
+    const int kExpected[] = { 0, 1, 2, 5, 7 };
+    BOOST_REQUIRE(CSeqDBAtlas::ParseNodeList("5,0-2,7,1") ==
+                  vector<int>(kExpected, kExpected + ArraySize(kExpected)));
+
+    // Malformed ranges are skipped
+    BOOST_REQUIRE(CSeqDBAtlas::ParseNodeList("x,2,-1,3-y") ==
+                  vector<int>(1, 2));
+}
+
+BOOST_AUTO_TEST_CASE(TestSubjectCache)
+{
+    const char * buffer = NULL;
+    {
+        CSeqDB::SetSubjectCacheLimit(0);
+        CSeqDB disabled("data/seqn", CSeqDB::eNucleotide);
+        BOOST_REQUIRE_EQUAL(disabled.GetCachedAmbigSeq(0, & buffer, kSeqDBNuclBlastNA8), -1);
+    }
+
+    CSeqDB::SetSubjectCacheLimit(64 * 1024 * 1024);
+    CSeqDB protein("data/seqp", CSeqDB::eProtein);
+    BOOST_REQUIRE_EQUAL(protein.GetCachedAmbigSeq(0, & buffer, kSeqDBNuclBlastNA8), -1);
+
+    Int8 hits0 = 0, misses0 = 0, bytes0 = 0;
+    CSeqDB::GetSubjectCacheStats(hits0, misses0, bytes0);
+
+    // The first object decodes every sequence into the cache; a second
+    // object on the same database is served from it.
+    Int8 hits = 0, misses = 0, bytes = 0;
+    int num_oids = 0;
+    {
+        CSeqDB first("data/seqn", CSeqDB::eNucleotide);
+        CSeqDB second("data/seqn", CSeqDB::eNucleotide);
+        num_oids = first.GetNumOIDs();
+        for (int pass = 0; pass < 2; pass++) {
+            CSeqDB & db = (pass == 0) ? first : second;
+            for (int oid = 0; oid < num_oids; oid++) {
+                char * expected = NULL;
+                int length = db.GetAmbigSeqAlloc(oid, & expected,
+                                                 kSeqDBNuclBlastNA8, eMalloc);
+                BOOST_REQUIRE_EQUAL(db.GetCachedAmbigSeq(oid, & buffer, kSeqDBNuclBlastNA8),
+                                    length);
+                BOOST_REQUIRE_EQUAL(0, memcmp(buffer, expected, length + 2));
+                BOOST_REQUIRE_EQUAL(0, (size_t) buffer % 16);
+                free(expected);
+            }
+        }
+
+        CSeqDB::GetSubjectCacheStats(hits, misses, bytes);
+        BOOST_REQUIRE_EQUAL(hits - hits0, num_oids);
+        BOOST_REQUIRE_EQUAL(misses - misses0, num_oids);
+        BOOST_REQUIRE(bytes > bytes0);
+    }
+
+    // The cache goes with the last object using it.
+    CSeqDB::GetSubjectCacheStats(hits, misses, bytes);
+    BOOST_REQUIRE_EQUAL(bytes, bytes0);
+    CSeqDB third("data/seqn", CSeqDB::eNucleotide);
+    BOOST_REQUIRE(third.GetCachedAmbigSeq(0, & buffer, kSeqDBNuclBlastNA8) >= 0);
+    Int8 misses_after = 0;
+    CSeqDB::GetSubjectCacheStats(hits, misses_after, bytes);
+    BOOST_REQUIRE_EQUAL(misses_after - misses, 1);
+    CSeqDB::SetSubjectCacheLimit(0);
+}
+
 #ifdef NCBI_THREADS
 class CTestThread : public CThread
 {
@@ -4509,6 +4773,55 @@ BOOST_AUTO_TEST_CASE(TestMemoryMapFile_MT)
 	}
 	BOOST_REQUIRE_EQUAL(atlas.GetOpenedFilseCount(), 2);
 }
+
+class CSubjectCacheThread : public CThread
+{
+public:
+    CSubjectCacheThread(CSeqDB & db, int nucl_code)
+        : m_Db(db), m_NuclCode(nucl_code) { }
+
+    virtual void* Main(void) {
+        const char * buffer = NULL;
+        for (int oid = 0; oid < m_Db.GetNumOIDs(); oid++) {
+            m_Db.GetCachedAmbigSeq(oid, & buffer, m_NuclCode);
+        }
+        return NULL;
+    }
+private:
+    CSeqDB & m_Db;
+    int m_NuclCode;
+};
+
+// Caches filling at the same time never reserve more memory than the
+// limit, and give it all back when the database is closed.
+BOOST_AUTO_TEST_CASE(TestSubjectCacheLimit_MT)
+{
+    Int8 hits = 0, misses = 0, bytes0 = 0, bytes = 0;
+    CSeqDB::GetSubjectCacheStats(hits, misses, bytes0);
+    // Room for the first block of only one of the two caches
+    const Int8 kLimit = 3 * 1024 * 1024 / 2;
+    CSeqDB::SetSubjectCacheLimit(bytes0 + kLimit);
+
+    for (int round = 0; round < 20; round++) {
+        {
+            CSeqDB db("data/seqn", CSeqDB::eNucleotide);
+            CSubjectCacheThread * blastna =
+                new CSubjectCacheThread(db, kSeqDBNuclBlastNA8);
+            CSubjectCacheThread * ncbina =
+                new CSubjectCacheThread(db, kSeqDBNuclNcbiNA8);
+            blastna->Run();
+            ncbina->Run();
+            blastna->Join();
+            ncbina->Join();
+
+            CSeqDB::GetSubjectCacheStats(hits, misses, bytes);
+            BOOST_REQUIRE(bytes - bytes0 <= kLimit);
+        }
+        CSeqDB::GetSubjectCacheStats(hits, misses, bytes);
+        BOOST_REQUIRE_EQUAL(bytes, bytes0);
+    }
+    CSeqDB::SetSubjectCacheLimit(0);
+}
 #endif
 
 BOOST_AUTO_TEST_CASE(TestTaxIdsLookup)
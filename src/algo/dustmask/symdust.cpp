@@ -211,9 +211,9 @@ inline void CSymDustMasker::save_masked_regions(
 }
 
 //------------------------------------------------------------------------------
+template< typename TSeq, typename TIter >
 std::unique_ptr< CSymDustMasker::TMaskList > 
-CSymDustMasker::operator()( const sequence_type & seq, 
-                            size_type start, size_type stop )
+CSymDustMasker::x_Mask( const TSeq & seq, size_type start, size_type stop )
 {
     std::unique_ptr< TMaskList > res( new TMaskList );
 
@@ -232,7 +232,7 @@ CSymDustMasker::operator()( const sequence_type & seq,
         P.clear();
         triplets w( window_, low_k_, P, thresholds_ );
 
-        seq_citer_type it(seq, start);
+        TIter it(seq, start);
 
         char c1 = *it, c2 = *++it;
         triplet_type t = (converter_( c1 )<<2) + converter_( c2 );
@@ -284,11 +284,28 @@ CSymDustMasker::operator()( const sequence_type & seq,
     return res;
 }
 
+//------------------------------------------------------------------------------
+std::unique_ptr< CSymDustMasker::TMaskList > 
+CSymDustMasker::operator()( const sequence_type & seq, 
+                            size_type start, size_type stop )
+{ return x_Mask< sequence_type, seq_citer_type >( seq, start, stop ); }
+
 //------------------------------------------------------------------------------
 std::unique_ptr< CSymDustMasker::TMaskList > 
 CSymDustMasker::operator()( const sequence_type & seq )
 { return (*this)( seq, 0, seq.size() - 1 ); }
 
+//------------------------------------------------------------------------------
+std::unique_ptr< CSymDustMasker::TMaskList > 
+CSymDustMasker::operator()( const std::string & seq, 
+                            size_type start, size_type stop )
+{ return x_Mask< std::string, buffer_citer_type >( seq, start, stop ); }
+
+//------------------------------------------------------------------------------
+std::unique_ptr< CSymDustMasker::TMaskList > 
+CSymDustMasker::operator()( const std::string & seq )
+{ return (*this)( seq, 0, seq.size() - 1 ); }
+
 //------------------------------------------------------------------------------
 void CSymDustMasker::GetMaskedLocs( 
     objects::CSeq_id & seq_id,
@@ -69,13 +69,22 @@ CSegMasker::operator()(const objects::CSeqVector & data)
     }
 
     string sequence;
-    BlastSeqLoc* seq_locs = NULL;
     data.GetSeqData(data.begin(), data.end(), sequence);
+    return (*this)(sequence);
+}
+
+//------------------------------------------------------------------------------
+CSegMasker::TMaskList*
+CSegMasker::operator()(const string & data) const
+{
+    // SeqBufferSeg normalizes the parameters it is given, so each call
+    // works on its own copy
+    SegParameters seg_params = *m_SegParameters;
+    BlastSeqLoc* seq_locs = NULL;
 
-    Int2 status = SeqBufferSeg((Uint1*)(sequence.data()),
-                               static_cast<Int4>(sequence.size()), 0,
-                               m_SegParameters, &seq_locs);
-    sequence.erase();
+    Int2 status = SeqBufferSeg((Uint1*)(data.data()),
+                               static_cast<Int4>(data.size()), 0,
+                               &seg_params, &seq_locs);
     if (status != 0) {
         seq_locs = BlastSeqLocFree(seq_locs);
         throw runtime_error("SEG internal error (check that input is protein) " + NStr::IntToString(status));
@@ -96,7 +96,6 @@ CSeqMasker::CSeqMasker( const string & lstat_name,
                                              arg_min_score,
                                              arg_set_min_score,
                                              arg_use_ba ) ),
-      score( NULL ), score_p3( NULL ), trigger_score( NULL ),
       window_size( arg_window_size ), window_step( arg_window_step ),
       unit_step( arg_unit_step ),
       merge_pass( arg_merge_pass ),
@@ -106,6 +105,7 @@ CSeqMasker::CSeqMasker( const string & lstat_name,
       merge_unit_step( arg_merge_unit_step ),
       trigger( arg_trigger == "mean" ? eTrigger_Mean
                : eTrigger_Min ),
+      tmin_count( tmin_count ),
       discontig( arg_discontig ), pattern( arg_pattern )
 {
     if( window_size == 0 ) window_size = ustat->UnitSize() + 4;
@@ -117,40 +117,11 @@ CSeqMasker::CSeqMasker( const string & lstat_name,
               (int)ustat->UnitSize() << ")";
         NCBI_THROW( CSeqMaskerException, eValidation, os.str() );
     }
-
-    trigger_score = score = new CSeqMaskerScoreMean( ustat );
-
-    if( trigger == eTrigger_Min )
-        trigger_score = new CSeqMaskerScoreMin( ustat, tmin_count );
-
-    if( !score )
-    {
-        NCBI_THROW( CSeqMaskerException,
-                    eScoreAllocFail,
-                    "" );
-    }
-
-    if( arg_merge_pass )
-    {
-        score_p3 = new CSeqMaskerScoreMeanGlob( ustat );
-
-        if( !score )
-        {
-            NCBI_THROW( CSeqMaskerException,
-                        eScoreP3AllocFail,
-                        "" );
-        }
-    }
 }
 
 //-------------------------------------------------------------------------
 CSeqMasker::~CSeqMasker()
-{ 
-    if( trigger_score != score ) delete trigger_score;
-
-    delete score; 
-    delete score_p3;
-}
+{}
 
 //-------------------------------------------------------------------------
 CSeqMasker::TMaskList *
@@ -162,7 +133,6 @@ CSeqMasker::TMaskList *
 CSeqMasker::DoMask( 
     const CSeqVector& data, TSeqPos begin, TSeqPos stop ) const
 {
-    ustat->total_ = 0;
     unique_ptr<TMaskList> mask(new TMaskList);
     Uint4 cutoff_score = ustat->get_threshold();
     Uint4 textend = ustat->get_textend();
@@ -176,6 +146,15 @@ CSeqMasker::DoMask(
                                  window_size, window_step, 
                                  unit_step, begin, stop ));
     CSeqMaskerWindow & window = *window_ptr;
+
+    // The score function objects hold the state of the window being 
+    // scored, so each call gets its own.
+    unique_ptr<CSeqMaskerScore> score( new CSeqMaskerScoreMean( ustat ) );
+    unique_ptr<CSeqMaskerScore> min_score( 
+            trigger == eTrigger_Min 
+            ? new CSeqMaskerScoreMin( ustat, tmin_count ) : NULL );
+    CSeqMaskerScore * trigger_score 
+        = min_score.get() ? min_score.get() : score.get();
     score->SetWindow( window );
 
     if( trigger == eTrigger_Min ) trigger_score->SetWindow( window );
@@ -260,6 +239,7 @@ CSeqMasker::DoMask(
 
         if( mask->size() < 2 ) return mask.release();
 
+        CSeqMaskerScoreMeanGlob score_p3( ustat );
         TMList masked, unmasked;
         TMaskList::iterator jtmp = mask->end();
 
@@ -268,15 +248,16 @@ CSeqMasker::DoMask(
                   i != j; )
              {
                  masked.push_back( mitem( i->first, i->second, unit_size, 
-                                          data, *this ) );
+                                          data, *this, score_p3 ) );
                  Uint4 nstart = (i++)->second - unit_size + 2;
                  unmasked.push_back( mitem( nstart, i->first + unit_size - 2, 
-                                            unit_size, data, *this ) );
+                                            unit_size, data, *this, 
+                                            score_p3 ) );
              }
 
              masked.push_back( mitem( (mask->rbegin())->first,
                                       (mask->rbegin())->second, 
-                                      unit_size, data, *this ) );
+                                      unit_size, data, *this, score_p3 ) );
          }}
 
         Int4 count = 0;
@@ -462,12 +443,13 @@ const char * CSeqMasker::CSeqMaskerException::GetErrCodeString() const
 
 //----------------------------------------------------------------------------
 CSeqMasker::mitem::mitem( Uint4 arg_start, Uint4 arg_end, Uint1 unit_size,
-                          const CSeqVector & data, const CSeqMasker & owner )
+                          const CSeqVector & data, const CSeqMasker & owner,
+                          CSeqMaskerScore & arg_score )
     : start( arg_start ), end( arg_end ), avg( 0.0 )
 {
     const Uint1 & window_size = owner.window_size;
     const CSeqMaskerWindow::TUnit & ambig_unit = owner.ustat->AmbigUnit();
-    CSeqMaskerScore * const score = owner.score_p3;
+    CSeqMaskerScore * const score = &arg_score;
     CSeqMaskerWindow * window = NULL;
 
     if( owner.discontig )
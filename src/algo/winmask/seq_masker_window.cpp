@@ -32,6 +32,7 @@
 
 #include <ncbi_pch.hpp>
 #include <string>
+#include <algorithm>
 
 #include <corelib/ncbi_limits.h>
 
@@ -45,6 +46,20 @@ USING_SCOPE(objects);
 //-------------------------------------------------------------------------
 Uint1 CSeqMaskerWindow::LOOKUP[kMax_UI1];
 
+//-------------------------------------------------------------------------
+// Number of bases copied out of the sequence vector at a time.
+static const TSeqPos kBufferSize = 8192;
+
+//-------------------------------------------------------------------------
+static bool s_InitLookup()
+{
+    CSeqMaskerWindow::LOOKUP[unsigned('A')] = 1;
+    CSeqMaskerWindow::LOOKUP[unsigned('C')] = 2;
+    CSeqMaskerWindow::LOOKUP[unsigned('G')] = 3;
+    CSeqMaskerWindow::LOOKUP[unsigned('T')] = 4;
+    return true;
+}
+
 //-------------------------------------------------------------------------
 CSeqMaskerWindow::CSeqMaskerWindow( const CSeqVector & arg_data, 
                                     Uint1 arg_unit_size, 
@@ -56,18 +71,13 @@ CSeqMaskerWindow::CSeqMaskerWindow( const CSeqVector & arg_data,
     : data(arg_data), state( false ), 
       unit_size( arg_unit_size ), unit_step( arg_unit_step ),
       window_size( arg_window_size ), window_step( arg_window_step ),
-      end( 0 ), first_unit( 0 ), unit_mask( 0 ), winend( arg_winend )
+      end( 0 ), first_unit( 0 ), unit_mask( 0 ), winend( arg_winend ),
+      buf_start( 0 )
 {
-    static bool first_call = true;
-
-    if( first_call )
-    {
-        LOOKUP[unsigned('A')] = 1;
-        LOOKUP[unsigned('C')] = 2;
-        LOOKUP[unsigned('G')] = 3;
-        LOOKUP[unsigned('T')] = 4;
-        first_call = false;
-    }
+    // Function local static initialization is thread safe, so windows
+    // may be created on several threads at once.
+    static const bool lookup_ready = s_InitLookup();
+    (void)lookup_ready;
 
     if( data.size() < window_size ) {
         // TODO Throw an exception.
@@ -89,6 +99,17 @@ CSeqMaskerWindow::~CSeqMaskerWindow()
 {
 }
 
+//-------------------------------------------------------------------------
+void CSeqMaskerWindow::FillBuffer( TSeqPos pos ) const
+{
+    buf_start = pos;
+    buf.clear();
+
+    if( pos < data.size() )
+        data.GetSeqData( pos, min( data.size() - pos, kBufferSize ) + pos, 
+                         buf );
+}
+
 //-------------------------------------------------------------------------
 void CSeqMaskerWindow::Advance( Uint4 step )
 {
@@ -105,7 +126,7 @@ void CSeqMaskerWindow::Advance( Uint4 step )
 
     for( ; ++end < winend && iter < step ; ++iter, ++start )
     {
-        Uint1 letter = LOOKUP[unsigned(data[end])];
+        Uint1 letter = LOOKUP[unsigned(GetBase( end ))];
 
         if( !(letter--) )
         { 
@@ -137,7 +158,7 @@ void CSeqMaskerWindow::FillWindow( Uint4 winstart )
 
     for( ; iter < window_size && end < data.size(); ++iter, ++end )
     {
-        Uint1 letter = LOOKUP[unsigned(data[end])];
+        Uint1 letter = LOOKUP[unsigned(GetBase( end ))];
 
         if( !(letter--) )
         {
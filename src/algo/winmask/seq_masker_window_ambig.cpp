@@ -72,7 +72,7 @@ void CSeqMaskerWindowAmbig::Advance( Uint4 step )
 
     for( ; ++end < data.size() && iter < step ; ++iter )
     {
-        Uint1 letter = LOOKUP[unsigned(data[end])];
+        Uint1 letter = LOOKUP[unsigned(GetBase( end ))];
 
         if( !(letter--) )
         { 
@@ -108,7 +108,7 @@ void CSeqMaskerWindowAmbig::FillWindow( Uint4 winstart )
     for( ; iter < window_size && end < data.size(); 
          ++iter, ++end, --ambig_pos )
     {
-        Uint1 letter = LOOKUP[unsigned(data[end])];
+        Uint1 letter = LOOKUP[unsigned(GetBase( end ))];
 
         if( !(letter--) )
         {
@@ -75,7 +75,7 @@ bool CSeqMaskerWindowPattern::MakeUnit( Uint4 ustart,
     for( Uint4 i = 0; i < unit_size; ++i )
         if( ((1ULL<<i)&~pattern) )
         {
-            Uint1 letter = LOOKUP[unsigned(data[ustart + i])];
+            Uint1 letter = LOOKUP[unsigned(GetBase( ustart + i ))];
 
             if( !(letter--) ) return false;
 
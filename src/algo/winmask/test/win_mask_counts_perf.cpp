@@ -0,0 +1,267 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/** @file win_mask_counts_perf.cpp
+ * Command line tool to compare the wall time and peak memory of the
+ * WindowMasker unit counts generation before and after it was made
+ * multi-threaded, and to check that all of them write the same counts.
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbiapp.hpp>
+#include <corelib/ncbifile.hpp>
+#include <corelib/ncbistr.hpp>
+#include <corelib/ncbitime.hpp>
+#include <corelib/ncbi_process.hpp>
+#include <util/random_gen.hpp>
+#include <algo/winmask/win_mask_gen_counts.hpp>
+
+#include "win_mask_gen_counts_baseline.hpp"
+
+#ifndef SKIP_DOXYGEN_PROCESSING
+USING_NCBI_SCOPE;
+#endif
+
+/// The application class
+class CWinMaskCountsPerfApp : public CNcbiApplication
+{
+public:
+    /** @inheritDoc */
+    CWinMaskCountsPerfApp() {}
+private:
+    /** @inheritDoc */
+    virtual void Init();
+    /** @inheritDoc */
+    virtual int Run();
+
+    /// Write a random genome with planted repeats to a FASTA file
+    void x_WriteGenome(const string& fname);
+
+    /// Generate the unit counts with the given number of threads
+    /// @param fname FASTA file with the genome
+    /// @param num_threads number of threads to count units with; 0 runs
+    /// the single-threaded generator the current one replaced
+    /// @param counts the counts file contents [out]
+    /// @return wall time in seconds
+    double x_GenerateCounts(const string& fname, Uint4 num_threads,
+                            string& counts);
+};
+
+void CWinMaskCountsPerfApp::Init()
+{
+    HideStdArgs(fHideLogfile | fHideConffile | fHideFullVersion |
+                fHideXmlHelp | fHideDryRun);
+
+    unique_ptr<CArgDescriptions> arg_desc(new CArgDescriptions);
+    arg_desc->SetUsageContext(GetArguments().GetProgramBasename(),
+                  "WindowMasker unit counts generation performance tester");
+
+    arg_desc->AddOptionalKey("input", "fasta_file",
+                             "Genome to count units in (by default a "
+                             "random genome is generated)",
+                             CArgDescriptions::eInputFile);
+    arg_desc->AddDefaultKey("genome_len", "length",
+                            "Length of the random genome",
+                            CArgDescriptions::eInt8, "20000000");
+    arg_desc->AddDefaultKey("seq_len", "length",
+                            "Length of the random genome sequences",
+                            CArgDescriptions::eInteger, "5000000");
+    arg_desc->AddDefaultKey("seed", "number", "Random number generator seed",
+                            CArgDescriptions::eInteger, "1");
+    arg_desc->AddDefaultKey("unit", "unit_length",
+                            "Number of bases in a unit",
+                            CArgDescriptions::eInteger, "12");
+    arg_desc->SetConstraint("unit", new CArgAllow_Integers(1, 16));
+    arg_desc->AddDefaultKey("mem", "available_memory",
+                            "Memory available for the counts in megabytes; "
+                            "values below 4**unit / 262144 split the counting "
+                            "into several passes over the genome",
+                            CArgDescriptions::eInteger, "1536");
+    arg_desc->AddDefaultKey("num_threads", "int_value",
+                            "Number of threads for the multi-threaded run",
+                            CArgDescriptions::eInteger, "4");
+    arg_desc->SetConstraint("num_threads",
+                            new CArgAllow_Integers(1, kMax_Int));
+    arg_desc->AddDefaultKey("mode", "mode",
+                            "Generators to run: the generator before "
+                            "multi-threading (baseline), the current one "
+                            "on 1 thread (serial) or on num_threads "
+                            "(parallel); peak memory is that of the "
+                            "process, so use a single generator per run "
+                            "to compare it",
+                            CArgDescriptions::eString, "all");
+    arg_desc->SetConstraint("mode", &(*new CArgAllow_Strings,
+                                      "baseline", "serial", "parallel",
+                                      "all"));
+
+    SetupArgDescriptions(arg_desc.release());
+}
+
+void CWinMaskCountsPerfApp::x_WriteGenome(const string& fname)
+{
+    static const char kBases[] = "ACGT";
+    const CArgs& args = GetArgs();
+    const Int8 kGenomeLen = args["genome_len"].AsInt8();
+    const Int8 kSeqLen = args["seq_len"].AsInteger();
+    CRandom rng((CRandom::TValue)args["seed"].AsInteger());
+
+    // A pool of repeat elements, so that the counts have a realistic tail
+    vector<string> repeats(50);
+    NON_CONST_ITERATE(vector<string>, it, repeats) {
+        it->resize(rng.GetRand(100, 2000));
+        NON_CONST_ITERATE(string, c, *it) {
+            *c = kBases[rng.GetRand(0, 3)];
+        }
+    }
+
+    CNcbiOfstream out(fname.c_str());
+    int seqno = 0;
+    for (Int8 written = 0; written < kGenomeLen; ++seqno) {
+        string seq;
+        seq.reserve((size_t)kSeqLen);
+        while ((Int8)seq.size() < kSeqLen) {
+            Uint4 r = rng.GetRand(0, 99);
+            if (r < 30) {
+                // a diverged repeat copy
+                string copy = repeats[rng.GetRand(0, repeats.size() - 1)];
+                NON_CONST_ITERATE(string, c, copy) {
+                    if (rng.GetRand(0, 19) == 0) {
+                        *c = kBases[rng.GetRand(0, 3)];
+                    }
+                }
+                seq += copy;
+            } else if (r < 31) {
+                seq.append(rng.GetRand(1, 1000), 'N');
+            } else {
+                for (int i = 0; i < 1000; i++) {
+                    seq += kBases[rng.GetRand(0, 3)];
+                }
+            }
+        }
+        seq.resize((size_t)min(kSeqLen, kGenomeLen - written));
+        written += seq.size();
+
+        out << ">seq" << seqno << "\n";
+        for (size_t i = 0; i < seq.size(); i += 80) {
+            out << seq.substr(i, 80) << "\n";
+        }
+    }
+}
+
+double CWinMaskCountsPerfApp::x_GenerateCounts(const string& fname,
+                                               Uint4 num_threads,
+                                               string& counts)
+{
+    const CArgs& args = GetArgs();
+    CNcbiOstrstream out;
+    CStopWatch sw(CStopWatch::eStart);
+    if (num_threads == 0) {
+        CWinMaskCountsBaseline cg(fname, out, "fasta", "obinary512",
+                                  "90,99,99.5,99.8",
+                                  args["mem"].AsInteger(),
+                                  args["unit"].AsInteger(),
+                                  0, 0, 0, false, false, NULL, NULL,
+                                  true, "");
+        cg();
+    } else {
+        CWinMaskCountsGenerator cg(fname, out, "fasta", "obinary512",
+                                   "90,99,99.5,99.8",
+                                   args["mem"].AsInteger(),
+                                   args["unit"].AsInteger(),
+                                   0, 0, 0, false, false, NULL, NULL,
+                                   true, "", num_threads);
+        cg();
+    }
+    double elapsed = sw.Elapsed();
+    counts = CNcbiOstrstreamToString(out);
+    return elapsed;
+}
+
+int CWinMaskCountsPerfApp::Run(void)
+{
+    const CArgs& args = GetArgs();
+    const string kMode = args["mode"].AsString();
+
+    string fname;
+    if (args["input"].HasValue()) {
+        fname = args["input"].AsString();
+    } else {
+        fname = CDirEntry::GetTmpName(CDirEntry::eTmpFileCreate);
+        x_WriteGenome(fname);
+    }
+
+    const int kNumRuns = 3;
+    const char* kNames[kNumRuns] = { "Baseline", "Serial", "Parallel" };
+    const char* kModes[kNumRuns] = { "baseline", "serial", "parallel" };
+    const Uint4 kThreads[kNumRuns] =
+        { 0, 1, (Uint4)args["num_threads"].AsInteger() };
+    string counts[kNumRuns];
+    bool ran[kNumRuns];
+    for (int i = 0; i < kNumRuns; i++) {
+        ran[i] = kMode == "all" || kMode == kModes[i];
+        if ( !ran[i] ) {
+            continue;
+        }
+        double elapsed = x_GenerateCounts(fname, kThreads[i], counts[i]);
+        CCurrentProcess::SMemoryUsage usage;
+        memset(&usage, 0, sizeof(usage));
+        CCurrentProcess::GetMemoryUsage(usage);
+        cout << kNames[i] << " (" << max(kThreads[i], 1U) << " thread"
+             << (kThreads[i] > 1 ? "s" : "") << "): " << elapsed
+             << " s, peak RSS "
+             << NStr::NumericToString((Uint8)usage.resident_peak / 1024,
+                                      NStr::fWithCommas)
+             << " KB" << endl;
+    }
+
+    if ( !args["input"].HasValue() ) {
+        CFile(fname).Remove();
+    }
+
+    // The current generator must write the counts the baseline wrote
+    int status = 0;
+    for (int i = 1; ran[0] && i < kNumRuns; i++) {
+        if (ran[i]) {
+            bool same = counts[0] == counts[i];
+            cout << kNames[i] << " counts file "
+                 << (same ? "matches" : "differs from") << " baseline"
+                 << endl;
+            if ( !same ) {
+                status = 1;
+            }
+        }
+    }
+    return status;
+}
+
+
+#ifndef SKIP_DOXYGEN_PROCESSING
+int main(int argc, const char* argv[] /*, const char* envp[]*/)
+{
+    return CWinMaskCountsPerfApp().AppMain(argc, argv);
+}
+#endif /* SKIP_DOXYGEN_PROCESSING */
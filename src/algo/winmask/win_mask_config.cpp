@@ -144,6 +144,13 @@ void CWinMaskConfig::AddWinMaskArgs(CArgDescriptions &arg_desc,
                                  new CArgAllow_Integers( 1, kMax_Int ) );
         arg_desc.SetConstraint( "t_low",
                                  new CArgAllow_Integers( 1, kMax_Int ) );
+        // Both the counting and the masking stages read num_threads
+        arg_desc.AddDefaultKey( "num_threads", "int_value",
+                                 "number of threads used to count units "
+                                 "or to mask sequences",
+                                 CArgDescriptions::eInteger, "1" );
+        arg_desc.SetConstraint( "num_threads",
+                                 new CArgAllow_Integers( 1, kMax_Int ) );
         arg_desc.AddDefaultKey( kInputFormat, "input_format",
                                 "controls the format of the masker input",
                                 CArgDescriptions::eString, *kInputFormats );
@@ -225,6 +232,7 @@ void CWinMaskConfig::AddWinMaskArgs(CArgDescriptions &arg_desc,
         if(determine_input)
             arg_desc.CArgDescriptions::SetDependency( "convert", CArgDescriptions::eExcludes, "fa_list" );
         arg_desc.CArgDescriptions::SetDependency( "convert", CArgDescriptions::eExcludes, "mem" );
+        arg_desc.CArgDescriptions::SetDependency( "convert", CArgDescriptions::eExcludes, "num_threads" );
         arg_desc.CArgDescriptions::SetDependency( "convert", CArgDescriptions::eExcludes, "unit" );
         arg_desc.CArgDescriptions::SetDependency( "convert", CArgDescriptions::eExcludes, "genome_size" );
         arg_desc.CArgDescriptions::SetDependency( "convert", CArgDescriptions::eExcludes, "dust" );
@@ -322,6 +330,8 @@ CWinMaskConfig::CWinMaskConfig( const CArgs & args, EAppType type, bool determin
       merge_unit_step( 1 ),
       fa_list( app_type == eComputeCounts && determine_input ? args["fa_list"].AsBoolean() : false ),
       mem( app_type == eComputeCounts ? args["mem"].AsInteger() : 0 ),
+      num_threads( app_type != eConvertCounts && args.Exist("num_threads") ?
+                   args["num_threads"].AsInteger() : 1 ),
       unit_size( app_type == eComputeCounts && args["unit"] ? args["unit"].AsInteger() : 0 ),
       genome_size( app_type == eComputeCounts && args["genome_size"] ? args["genome_size"].AsInt8() : 0 ),
       input( determine_input ? args[kInput].AsString() : ""),
@@ -35,6 +35,11 @@
 
 #include <vector>
 #include <sstream>
+#include <algorithm>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include <objects/seq/Bioseq.hpp>
 #include <objects/seq/Seq_inst.hpp>
@@ -120,6 +125,105 @@ Uint8 CWinMaskCountsGenerator::fastalen( const string & fname ) const
 static Uint4 reverse_complement( Uint4 seq, Uint1 size )
 { return CSeqMaskerUtil::reverse_complement( seq, size ); }
 
+//------------------------------------------------------------------------------
+// Letters of sequence data collected per thread before they are counted.
+static const Uint8 kBatchLettersPerThread = 8*1024*1024;
+
+// Length of the pieces sequences are cut into for counting on several threads.
+static const TSeqPos kBlockSize = 1024*1024;
+
+//------------------------------------------------------------------------------
+// Pass the suffix of every canonical n-mer that has the given prefix and
+// ends in [from, to) of seq to add. An n-mer that is its own reverse 
+// complement is passed twice, once per strand. The reverse complement is
+// updated along with the n-mer instead of being recomputed at each position.
+template< typename TAdd >
+static void count_units( const string & seq, TSeqPos from, TSeqPos to,
+                         Uint1 unit_size, Uint4 prefix, Uint4 prefix_mask,
+                         Uint4 suffix_mask, TAdd & add )
+{
+    Uint4 unit_mask( unit_size == 16 ? 0xFFFFFFFF 
+                                     : (1<<(2*unit_size)) - 1 );
+    Uint1 rc_shift( 2*(unit_size - 1) );
+    Uint4 count( 0 );
+    Uint4 unit( 0 );
+    Uint4 runit( 0 );
+
+    // Start early enough to see the whole n-mer ending at from.
+    TSeqPos i( from > unit_size - 1U ? from - (unit_size - 1) : 0 );
+
+    for( ; i < to; ++i ) {
+        if( ambig( seq[i] ) )
+        {
+            count = 0;
+            unit = 0;
+            runit = 0;
+            continue;
+        }
+        else
+        {
+            Uint4 l( letter( seq[i] ) );
+            unit = ((unit<<2)&unit_mask) + l;
+            runit = (runit>>2) + ((3 - l)<<rc_shift);
+
+            if( count >= unit_size - 1U && i >= from )
+            {
+                if( unit <= runit && (unit&prefix_mask) == prefix )
+                    add( unit&suffix_mask );
+
+                if( runit <= unit && (runit&prefix_mask) == prefix )
+                    add( runit&suffix_mask );
+            }
+
+            ++count;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Increments the count of a unit suffix, saturating at 0xffffffff.
+struct SCountAdder
+{
+    SCountAdder( vector< Uint4 > & arg_counts ) : counts( arg_counts ) {}
+
+    void operator()( Uint4 suffix )
+    {
+        Uint4 & c( counts[suffix] );
+
+        if( c < 0xffffffffUL ) {
+            ++c;
+        }
+    }
+
+    vector< Uint4 > & counts;
+};
+
+//------------------------------------------------------------------------------
+// Appends a unit suffix to the buffer of the shard it belongs to.
+struct SShardAdder
+{
+    SShardAdder( vector< vector< Uint4 > > & arg_shards, Uint1 arg_shift )
+        : shards( arg_shards ), shift( arg_shift ) {}
+
+    void operator()( Uint4 suffix ) 
+    { shards[suffix>>shift].push_back( suffix ); }
+
+    vector< vector< Uint4 > > & shards;
+    Uint1 shift;
+};
+
+//------------------------------------------------------------------------------
+// A piece of a sequence in a batch.
+struct SBlock
+{
+    SBlock( size_t arg_seq, TSeqPos arg_from, TSeqPos arg_to )
+        : seq( arg_seq ), from( arg_from ), to( arg_to ) {}
+
+    size_t seq;
+    TSeqPos from;
+    TSeqPos to;
+};
+
 //------------------------------------------------------------------------------
 CWinMaskCountsGenerator::CWinMaskCountsGenerator( 
     const string & arg_input,
@@ -136,7 +240,8 @@ CWinMaskCountsGenerator::CWinMaskCountsGenerator(
     bool arg_use_list,
     const CWinMaskUtil::CIdSet * arg_ids,
     const CWinMaskUtil::CIdSet * arg_exclude_ids,
-    bool use_ba, string const & metadata )
+    bool use_ba, string const & metadata,
+    Uint4 arg_num_threads )
 :   input( arg_input ),
     ustat( CSeqMaskerOstatFactory::create( 
                 sformat, os, use_ba, metadata ) ),
@@ -152,8 +257,13 @@ CWinMaskCountsGenerator::CWinMaskCountsGenerator(
     total_ecodes( 0 ), 
     score_counts( max_count, 0 ),
     ids( arg_ids ), exclude_ids( arg_exclude_ids ),
-    infmt( infmt_arg )
+    infmt( infmt_arg ),
+    num_threads( arg_num_threads == 0 ? 1 : arg_num_threads )
 {
+#ifndef _OPENMP
+    num_threads = 1;
+#endif
+
     // Parse arg_th to set up th[].
     string::size_type pos( 0 );
     Uint1 count( 0 );
@@ -182,7 +292,8 @@ CWinMaskCountsGenerator::CWinMaskCountsGenerator(
     bool arg_use_list,
     const CWinMaskUtil::CIdSet * arg_ids,
     const CWinMaskUtil::CIdSet * arg_exclude_ids,
-    bool use_ba, string const & metadata )
+    bool use_ba, string const & metadata,
+    Uint4 arg_num_threads )
 :   input( arg_input ),
     ustat( CSeqMaskerOstatFactory::create( 
                 sformat, output, use_ba, metadata ) ),
@@ -198,8 +309,13 @@ CWinMaskCountsGenerator::CWinMaskCountsGenerator(
     total_ecodes( 0 ), 
     score_counts( max_count, 0 ),
     ids( arg_ids ), exclude_ids( arg_exclude_ids ),
-    infmt( infmt_arg )
+    infmt( infmt_arg ),
+    num_threads( arg_num_threads == 0 ? 1 : arg_num_threads )
 {
+#ifndef _OPENMP
+    num_threads = 1;
+#endif
+
     // Parse arg_th to set up th[].
     string::size_type pos( 0 );
     Uint1 count( 0 );
@@ -402,11 +518,8 @@ void CWinMaskCountsGenerator::process( Uint4 prefix,
 {
     Uint1 suffix_size( unit_size - prefix_size );
     Uint8 vector_size( 1ULL<<(2*suffix_size) );
-    vector< Uint4 > counts( vector_size, 0 );
-    Uint4 unit_mask( (1<<(2*unit_size)) - 1 );
     Uint4 prefix_mask( ((1<<(2*prefix_size)) - 1)<<(2*suffix_size) );
     Uint4 suffix_mask( (1<<2*suffix_size) - 1 );
-    if( unit_size == 16 ) unit_mask = 0xFFFFFFFF;
 
     if( suffix_size == 16 )
     {
@@ -418,7 +531,6 @@ void CWinMaskCountsGenerator::process( Uint4 prefix,
             "\nprefix_size: " << (int)prefix_size <<
             "\nsuffix_size: " << (int)suffix_size <<
             "\nvector_size: " << vector_size <<
-            "\nunit_mask: " << unit_mask <<
             "\nprefix_mask: " << prefix_mask <<
             "\nsufffix_mask: " << suffix_mask );
 
@@ -433,70 +545,52 @@ void CWinMaskCountsGenerator::process( Uint4 prefix,
     */
 
     prefix <<= (2*suffix_size);
-    CRef<CObjectManager> om(CObjectManager::GetInstance());
+    vector< Uint4 > counts;
 
-    for( vector< string >::const_iterator it( input_list.begin() );
-         it != input_list.end(); ++it )
-    {
-        for(CWinMaskUtil::CInputBioseq_CI bs_iter(*it, infmt); bs_iter; ++bs_iter)
-        {
-            CBioseq_Handle bsh = *bs_iter;
+    // With a single prefix the counts from the first pass are still
+    // around, so the second pass does not read the input again.
+    if( prefix_size == 0 && !saved_counts.empty() ) {
+        counts.swap( saved_counts );
+    }
+    else {
+        counts.resize( vector_size, 0 );
+        vector< string > batch;
+        Uint8 batch_letters( 0 );
 
-            if( CWinMaskUtil::consider( bsh, ids, exclude_ids ) )
+        for( vector< string >::const_iterator it( input_list.begin() );
+             it != input_list.end(); ++it )
+        {
+            for(CWinMaskUtil::CInputBioseq_CI bs_iter(*it, infmt); bs_iter; ++bs_iter)
             {
-                CSeqVector data =
-                    bs_iter->GetSeqVector(CBioseq_Handle::eCoding_Iupac);
-
-                if( data.empty() )
-                    continue;
+                CBioseq_Handle bsh = *bs_iter;
 
-                TSeqPos length( data.size() );
-                Uint4 count( 0 );
-                Uint4 unit( 0 );
+                if( CWinMaskUtil::consider( bsh, ids, exclude_ids ) )
+                {
+                    CSeqVector data =
+                        bs_iter->GetSeqVector(CBioseq_Handle::eCoding_Iupac);
 
-                for( Uint4 i( 0 ); i < length; ++i ) {
-                    if( ambig( data[i] ) )
-                    {
-                        count = 0;
-                        unit = 0;
+                    if( data.empty() )
                         continue;
-                    }
-                    else
+
+                    batch.push_back( string() );
+                    data.GetSeqData( 0, data.size(), batch.back() );
+                    batch_letters += data.size();
+
+                    if( batch_letters >= num_threads*kBatchLettersPerThread )
                     {
-                        unit = ((unit<<2)&unit_mask) + letter( data[i] );
-
-                        if( count >= unit_size - 1 )
-                        {
-                            Uint4 runit( reverse_complement( unit, unit_size ) );
-
-                            if( unit <= runit && (unit&prefix_mask) == prefix )
-                            {
-                                auto & c( counts[unit&suffix_mask] );
-
-                                if( c < 0xffffffffUL )
-                                {
-                                    ++c;
-                                }
-                                // ++counts[unit&suffix_mask];
-                            }
-
-                            if( runit <= unit && (runit&prefix_mask) == prefix )
-                            {
-                                auto & c( counts[runit&suffix_mask] );
-
-                                if( c < 0xffffffffUL )
-                                {
-                                    ++c;
-                                }
-                                // ++counts[runit&suffix_mask];
-                            }
-                        }
-
-                        ++count;
+                        count_batch( batch, prefix, prefix_mask, 
+                                     suffix_size, suffix_mask, counts );
+                        batch.clear();
+                        batch_letters = 0;
                     }
                 }
             }
         }
+
+        if( !batch.empty() ) {
+            count_batch( batch, prefix, prefix_mask, 
+                         suffix_size, suffix_mask, counts );
+        }
     }
 
     /*
@@ -536,6 +630,86 @@ void CWinMaskCountsGenerator::process( Uint4 prefix,
                         u, (counts[i] > t_high) ? t_high : counts[i] );
         }
     }
+
+    if( prefix_size == 0 && !do_output ) {
+        saved_counts.swap( counts );
+    }
+}
+
+//------------------------------------------------------------------------------
+void CWinMaskCountsGenerator::count_batch( const vector< string > & batch,
+                                           Uint4 prefix,
+                                           Uint4 prefix_mask,
+                                           Uint1 suffix_size,
+                                           Uint4 suffix_mask,
+                                           vector< Uint4 > & counts ) const
+{
+    if( num_threads == 1 )
+    {
+        SCountAdder add( counts );
+
+        ITERATE( vector< string >, it, batch ) {
+            count_units( *it, 0, it->size(), unit_size, 
+                         prefix, prefix_mask, suffix_mask, add );
+        }
+
+        return;
+    }
+
+    vector< SBlock > blocks;
+
+    for( size_t i( 0 ); i < batch.size(); ++i ) {
+        TSeqPos length( batch[i].size() );
+
+        for( TSeqPos from( 0 ); from < length; from += kBlockSize ) {
+            blocks.push_back( 
+                    SBlock( i, from, min( length - from, kBlockSize ) + from ) );
+        }
+    }
+
+    // The counts table is split into a power of two shards, indexed by
+    // the high bits of the suffix. Each thread sorts the suffixes it finds 
+    // into its own per-shard buffers; each shard is then updated by one
+    // thread from all the buffers, so no two threads touch the same count.
+    Uint1 shard_bits( 0 );
+
+    while( (1U<<shard_bits) < num_threads && shard_bits < 2*suffix_size )
+        ++shard_bits;
+
+    const int num_shards( 1<<shard_bits );
+    const Uint1 shard_shift( 2*suffix_size - shard_bits );
+    const int num_blocks( blocks.size() );
+    vector< vector< vector< Uint4 > > > buffers( 
+            num_threads, vector< vector< Uint4 > >( num_shards ) );
+
+#ifdef _OPENMP
+    #pragma omp parallel for num_threads(num_threads) schedule(dynamic, 1)
+#endif
+    for( int b = 0; b < num_blocks; ++b )
+    {
+        int tid( 0 );
+#ifdef _OPENMP
+        tid = omp_get_thread_num();
+#endif
+        SShardAdder add( buffers[tid], shard_shift );
+        const SBlock & block( blocks[b] );
+        count_units( batch[block.seq], block.from, block.to, unit_size, 
+                     prefix, prefix_mask, suffix_mask, add );
+    }
+
+#ifdef _OPENMP
+    #pragma omp parallel for num_threads(num_threads) schedule(dynamic, 1)
+#endif
+    for( int s = 0; s < num_shards; ++s )
+    {
+        SCountAdder add( counts );
+
+        for( Uint4 t( 0 ); t < num_threads; ++t ) {
+            ITERATE( vector< Uint4 >, it, buffers[t][s] ) {
+                add( *it );
+            }
+        }
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -0,0 +1,632 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/** @file blast_server.cpp
+ * Long-running BLAST search server.
+ *
+ * The server runs blastn, blastp, blastx and tblastn searches on behalf of
+ * clients, keeping BLAST databases (CSeqDB handles, their memory maps and
+ * the BLAST database data loader used for formatting) open between
+ * requests, so that a request only pays for the search itself.
+ *
+ * Requests are read from a UNIX domain socket (-socket) or, without it,
+ * from standard input with responses written to standard output. Each
+ * request and response is framed as follows:
+ *
+ * @verbatim
+ *   request:   BLAST <program> <number of arguments> <query length>\n
+ *              <argument>\n            (once per argument)
+ *              <query>                 (FASTA, exactly <query length> bytes)
+ *
+ *   response:  <exit code> <output length> <message length>\n
+ *              <output>                (the formatted report)
+ *              <messages>              (warnings and errors, if any)
+ * @endverbatim
+ *
+ * The arguments are the command line options of the program, e.g. "-db",
+ * "nt", "-outfmt", "6". -query and -out are ignored: the query comes with
+ * the request and the report is returned in the response.
+ *
+ * With -bench the application is a client instead: it sends the same
+ * request to a running server repeatedly and reports the latency
+ * distribution.
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbiapp.hpp>
+#include <corelib/ncbifile.hpp>
+#include <corelib/ncbitime.hpp>
+#include <connect/ncbi_conn_stream.hpp>
+#include <connect/ncbi_socket_unix.hpp>
+#include <algo/blast/api/local_blast.hpp>
+#include <algo/blast/blastinput/blast_fasta_input.hpp>
+#include <algo/blast/blastinput/blastn_args.hpp>
+#include <algo/blast/blastinput/blastp_args.hpp>
+#include <algo/blast/blastinput/blastx_args.hpp>
+#include <algo/blast/blastinput/tblastn_args.hpp>
+#include <algo/blast/api/objmgr_query_data.hpp>
+#include <algo/blast/format/blast_format.hpp>
+#include "blast_app_util.hpp"
+
+#include <cmath>
+#include <numeric>
+
+#ifndef SKIP_DOXYGEN_PROCESSING
+USING_NCBI_SCOPE;
+USING_SCOPE(blast);
+USING_SCOPE(objects);
+#endif
+
+/// First word of every request
+static const string kRequestTag("BLAST");
+
+/// Largest query accepted in a request, in bytes; the query is buffered
+/// in memory, so the length announced by the client must be bounded
+static const size_t kMaxQueryLength = 256 * 1024 * 1024;
+
+/// Largest number of command line arguments accepted in a request
+static const size_t kMaxNumArgs = 1024;
+
+/// One search request
+struct SBlastServerRequest {
+    string m_Program;       ///< blastn, blastp, blastx or tblastn
+    vector<string> m_Args;  ///< command line options of the program
+    string m_Query;         ///< query sequences in FASTA format
+};
+
+/// Reads one request from a stream.
+/// @return false at the end of the stream
+/// @throw CInputException if the request is malformed or exceeds the
+/// kMaxNumArgs or kMaxQueryLength limits
+static bool s_ReadRequest(CNcbiIstream& in, SBlastServerRequest& request)
+{
+    string header;
+    if ( !NcbiGetlineEOL(in, header) ) {
+        return false;
+    }
+    vector<string> fields;
+    NStr::Split(header, " \t", fields, NStr::fSplit_Tokenize);
+    if (fields.empty()) {
+        return false;
+    }
+    if (fields.size() != 4 || fields[0] != kRequestTag) {
+        NCBI_THROW(CInputException, eInvalidInput,
+                   "Malformed request header: " + header);
+    }
+    request.m_Program = fields[1];
+    const size_t kNumArgs = NStr::StringToSizet(fields[2]);
+    const size_t kQueryLength = NStr::StringToSizet(fields[3]);
+    if (kNumArgs > kMaxNumArgs) {
+        NCBI_THROW(CInputException, eInvalidInput,
+                   "Too many request arguments: " + fields[2] +
+                   " (at most " + NStr::SizetToString(kMaxNumArgs) + ")");
+    }
+    if (kQueryLength > kMaxQueryLength) {
+        NCBI_THROW(CInputException, eInvalidInput,
+                   "Request query too long: " + fields[3] + " bytes (at most " +
+                   NStr::SizetToString(kMaxQueryLength) + ")");
+    }
+
+    request.m_Args.resize(kNumArgs);
+    for (size_t i = 0; i < kNumArgs; i++) {
+        if ( !NcbiGetlineEOL(in, request.m_Args[i]) ) {
+            NCBI_THROW(CInputException, eInvalidInput,
+                       "Truncated request arguments");
+        }
+    }
+    request.m_Query.resize(kQueryLength);
+    if (kQueryLength > 0 &&
+        !in.read(&request.m_Query[0], kQueryLength)) {
+        NCBI_THROW(CInputException, eInvalidInput, "Truncated request query");
+    }
+    return true;
+}
+
+/// Writes one request to a stream
+static void s_WriteRequest(CNcbiOstream& out,
+                           const SBlastServerRequest& request)
+{
+    out << kRequestTag << ' ' << request.m_Program << ' '
+        << request.m_Args.size() << ' ' << request.m_Query.size() << '\n';
+    ITERATE(vector<string>, arg, request.m_Args) {
+        out << *arg << '\n';
+    }
+    out << request.m_Query;
+    out.flush();
+}
+
+/// Writes one response to a stream
+static void s_WriteResponse(CNcbiOstream& out, int exit_code,
+                            const string& output, const string& messages)
+{
+    out << exit_code << ' ' << output.size() << ' ' << messages.size()
+        << '\n' << output << messages;
+    out.flush();
+}
+
+/// Reads one response from a stream.
+/// @return false if the stream ended before a complete response was read
+static bool s_ReadResponse(CNcbiIstream& in, int& exit_code,
+                           string& output, string& messages)
+{
+    size_t output_length = 0, message_length = 0;
+    if ( !(in >> exit_code >> output_length >> message_length) ||
+         in.get() != '\n' ) {
+        return false;
+    }
+    output.resize(output_length);
+    messages.resize(message_length);
+    if (output_length > 0 && !in.read(&output[0], output_length)) {
+        return false;
+    }
+    if (message_length > 0 && !in.read(&messages[0], message_length)) {
+        return false;
+    }
+    return true;
+}
+
+/// Collects the warnings and errors posted while a request is processed,
+/// so that they are returned to the client rather than logged by the server
+class CRequestDiagHandler : public CDiagHandler
+{
+public:
+    virtual void Post(const SDiagMessage& mess) {
+        if (mess.m_Severity < eDiag_Warning) {
+            return;
+        }
+        m_Messages += CNcbiDiag::SeverityName(mess.m_Severity);
+        m_Messages += ": ";
+        m_Messages.append(mess.m_Buffer, mess.m_BufferLen);
+        m_Messages += '\n';
+    }
+    const string& GetMessages() const { return m_Messages; }
+
+private:
+    string m_Messages;
+};
+
+/// A BLAST database kept open between requests
+struct SOpenDatabase {
+    CRef<CLocalDbAdapter> m_DbAdapter;  ///< used by the searches
+    string m_DataLoader;                ///< used by the formatter
+};
+
+class CBlastServerApp : public CNcbiApplication
+{
+public:
+    /** @inheritDoc */
+    CBlastServerApp() {
+        CRef<CVersion> version(new CVersion());
+        version->SetVersionInfo(new CBlastVersion());
+        SetFullVersion(version);
+    }
+private:
+    /** @inheritDoc */
+    virtual void Init();
+    /** @inheritDoc */
+    virtual int Run();
+
+    /// Serves requests from a stream until it ends
+    void x_Serve(CNcbiIstream& in, CNcbiOstream& out);
+
+    /// Runs one search
+    /// @param request the request [in]
+    /// @param output the formatted report [out]
+    /// @return the exit code blastn/blastp etc. would have returned
+    int x_Search(const SBlastServerRequest& request, string& output);
+
+    /// Sets up the subjects of a search, reusing an open database if
+    /// possible
+    void x_InitializeSubject(CRef<CBlastDatabaseArgs> db_args,
+                             CRef<CBlastOptionsHandle> opts_hndl,
+                             CRef<CLocalDbAdapter>& db_adapter,
+                             CRef<CScope>& scope);
+
+    /// Sends the request described by the command line to a server
+    /// repeatedly and reports the latency distribution
+    int x_RunBenchmark();
+
+    /// Databases opened so far, keyed by name, molecule type and
+    /// masking algorithm
+    map<string, SOpenDatabase> m_Databases;
+};
+
+void CBlastServerApp::Init()
+{
+    HideStdArgs(fHideLogfile | fHideConffile | fHideFullVersion | fHideXmlHelp | fHideDryRun);
+
+    unique_ptr<CArgDescriptions> arg_desc(new CArgDescriptions);
+    arg_desc->SetUsageContext(GetArguments().GetProgramBasename(),
+                  "BLAST search server: runs searches on behalf of clients "
+                  "while keeping BLAST databases open between requests");
+
+    arg_desc->AddOptionalKey("socket", "path",
+                             "UNIX domain socket to listen on (server) or "
+                             "connect to (-bench); without it, requests "
+                             "are read from standard input",
+                             CArgDescriptions::eString);
+
+    arg_desc->SetCurrentGroup("Benchmark client options");
+    arg_desc->AddOptionalKey("bench", "num_requests",
+                             "Send this many identical requests to the "
+                             "server at -socket and report the latency "
+                             "percentiles",
+                             CArgDescriptions::eInteger);
+    arg_desc->SetConstraint("bench", new CArgAllowValuesGreaterThanOrEqual(1));
+    arg_desc->SetDependency("bench", CArgDescriptions::eRequires, "socket");
+    arg_desc->AddDefaultKey("program", "name", "Program to run",
+                            CArgDescriptions::eString, "blastn");
+    arg_desc->SetConstraint("program", &(*new CArgAllow_Strings,
+                            "blastn", "blastp", "blastx", "tblastn"));
+    arg_desc->AddOptionalKey("query", "input_file", "Query file",
+                             CArgDescriptions::eInputFile);
+    arg_desc->AddDefaultKey("search_args", "options",
+                            "Options of the program, e.g. \"-db nt "
+                            "-outfmt 6\"",
+                            CArgDescriptions::eString, kEmptyStr);
+    arg_desc->SetCurrentGroup("");
+
+    SetupArgDescriptions(arg_desc.release());
+}
+
+int CBlastServerApp::Run()
+{
+    const CArgs& args = GetArgs();
+    SetDiagPostPrefix("blast_server");
+
+    if (args["bench"]) {
+        return x_RunBenchmark();
+    }
+
+    if ( !args["socket"] ) {
+        x_Serve(NcbiCin, NcbiCout);
+        return BLAST_EXIT_SUCCESS;
+    }
+
+    const string kSocketPath = args["socket"].AsString();
+    // Only a socket left behind by a server that is gone may be replaced;
+    // never remove a regular file or the socket of a live server
+    CDirEntry socket_entry(kSocketPath);
+    if (socket_entry.Exists()) {
+        if (socket_entry.GetType() != CDirEntry::eSocket) {
+            ERR_POST(Error << kSocketPath << " exists and is not a socket");
+            return BLAST_UNKNOWN_ERROR;
+        }
+        CUNIXSocket probe(kSocketPath);
+        if (probe.GetStatus(eIO_Open) == eIO_Success) {
+            ERR_POST(Error << "Another server is listening on "
+                     << kSocketPath);
+            return BLAST_UNKNOWN_ERROR;
+        }
+        probe.Close();
+        socket_entry.Remove();
+    }
+    CUNIXListeningSocket listener(kSocketPath);
+    if (listener.GetStatus() != eIO_Success) {
+        ERR_POST(Error << "Cannot listen on " << kSocketPath);
+        return BLAST_UNKNOWN_ERROR;
+    }
+    LOG_POST(Info << "Listening on " << kSocketPath);
+
+    // Connections are served one at a time; each search can still use
+    // several threads through -num_threads
+    for (;;) {
+        CSocket client;
+        if (listener.Accept(client, kInfiniteTimeout) != eIO_Success) {
+            continue;
+        }
+        CConn_SocketStream stream(client, kInfiniteTimeout);
+        x_Serve(stream, stream);
+    }
+    return BLAST_EXIT_SUCCESS;
+}
+
+void CBlastServerApp::x_Serve(CNcbiIstream& in, CNcbiOstream& out)
+{
+    for (;;) {
+        SBlastServerRequest request;
+        try {
+            if ( !s_ReadRequest(in, request) ) {
+                return;
+            }
+        } catch (const CException& e) {
+            // the stream cannot be resynchronized after a framing error
+            s_WriteResponse(out, BLAST_INPUT_ERROR, kEmptyStr,
+                            e.GetMsg() + "\n");
+            return;
+        }
+
+        CStopWatch sw(CStopWatch::eStart);
+        CRequestDiagHandler request_diag;
+        bool owns_handler = false;
+        CDiagHandler* server_diag = GetDiagHandler(true, &owns_handler);
+        SetDiagHandler(&request_diag, false);
+
+        string output;
+        const int kExitCode = x_Search(request, output);
+
+        SetDiagHandler(server_diag, owns_handler);
+        s_WriteResponse(out, kExitCode, output, request_diag.GetMessages());
+        LOG_POST(Info << request.m_Program << " request finished with exit "
+                 "code " << kExitCode << " in " << sw.Elapsed() << "s");
+    }
+}
+
+/// Creates the command line arguments of a program, with its query read
+/// from a string and its report written to a string
+static CRef<CBlastAppArgs>
+s_CreateProgramArgs(const string& program, const string& query)
+{
+    CRef<CBlastAppArgs> retval;
+    if (program == "blastn") {
+        retval.Reset(new CBlastnNodeArgs(query));
+    } else if (program == "blastp") {
+        retval.Reset(new CBlastpNodeArgs(query));
+    } else if (program == "blastx") {
+        retval.Reset(new CBlastxNodeArgs(query));
+    } else if (program == "tblastn") {
+        retval.Reset(new CTblastnNodeArgs(query));
+    } else {
+        NCBI_THROW(CInputException, eInvalidInput,
+                   "Unsupported program: " + program);
+    }
+    return retval;
+}
+
+int CBlastServerApp::x_Search(const SBlastServerRequest& request,
+                              string& output)
+{
+    int status = BLAST_EXIT_SUCCESS;
+    CBlastAppDiagHandler bah;
+
+    try {
+        CRef<CBlastAppArgs> cmd_line_args =
+            s_CreateProgramArgs(request.m_Program, request.m_Query);
+
+        // parse the request's options as if they were given on the
+        // command line of the program
+        vector<const char*> argv;
+        argv.push_back(request.m_Program.c_str());
+        ITERATE(vector<string>, arg, request.m_Args) {
+            argv.push_back(arg->c_str());
+        }
+        unique_ptr<CArgDescriptions> arg_desc(cmd_line_args->SetCommandLine());
+        CNcbiArguments ncbi_args((int)argv.size(), &argv[0]);
+        unique_ptr<CArgs> args(arg_desc->CreateArgs(ncbi_args));
+
+        /*** Get the BLAST options ***/
+        CRef<CBlastOptionsHandle> opts_hndl(cmd_line_args->SetOptions(*args));
+        const CBlastOptions& opt = opts_hndl->GetOptions();
+
+        /*** Initialize the database/subject ***/
+        CRef<CBlastDatabaseArgs> db_args(cmd_line_args->GetBlastDatabaseArgs());
+        CRef<CLocalDbAdapter> db_adapter;
+        CRef<CScope> scope;
+        x_InitializeSubject(db_args, opts_hndl, db_adapter, scope);
+        _ASSERT(db_adapter && scope);
+
+        /*** Get the query sequence(s) ***/
+        CRef<CQueryOptionsArgs> query_opts =
+            cmd_line_args->GetQueryOptionsArgs();
+        SDataLoaderConfig dlconfig =
+            InitializeQueryDataLoaderConfiguration(query_opts->QueryIsProtein(),
+                                                   db_adapter);
+        CBlastInputSourceConfig iconfig(dlconfig, query_opts->GetStrand(),
+                                     query_opts->UseLowercaseMasks(),
+                                     query_opts->GetParseDeflines(),
+                                     query_opts->GetRange());
+        if(IsIStreamEmpty(cmd_line_args->GetInputStream())) {
+            ERR_POST(Warning << "Query is Empty!");
+            return BLAST_EXIT_SUCCESS;
+        }
+        CBlastFastaInputSource fasta(cmd_line_args->GetInputStream(), iconfig);
+        CBlastInput input(&fasta, cmd_line_args->GetQueryBatchSize());
+
+        if (opt.GetUseIndex()) {
+            CRef<CBlastOptions> my_options(&(opts_hndl->SetOptions()));
+            CSetupFactory::InitializeMegablastDbIndex(my_options);
+        }
+
+        /*** Get the formatting options ***/
+        CRef<CFormattingArgs> fmt_args(cmd_line_args->GetFormattingArgs());
+        bool isArchiveFormat = fmt_args->ArchiveFormatRequested(*args);
+        if(!isArchiveFormat) {
+            bah.DoNotSaveMessages();
+        }
+        CNcbiOstream& out = cmd_line_args->GetOutputStream();
+        CBlastFormat formatter(opt, *db_adapter,
+                               fmt_args->GetFormattedOutputChoice(),
+                               query_opts->GetParseDeflines(),
+                               out,
+                               fmt_args->GetNumDescriptions(),
+                               fmt_args->GetNumAlignments(),
+                               *scope,
+                               opt.GetMatrixName(),
+                               fmt_args->ShowGis(),
+                               fmt_args->DisplayHtmlOutput(),
+                               opt.GetQueryGeneticCode(),
+                               opt.GetDbGeneticCode(),
+                               opt.GetSumStatisticsMode(),
+                               false,
+                               db_adapter->GetFilteringAlgorithm(),
+                               fmt_args->GetCustomOutputFormatSpec(),
+                               cmd_line_args->GetTask() == "megablast",
+                               opt.GetMBIndexLoaded(),
+                               NULL, NULL,
+                               GetCmdlineArgs(ncbi_args),
+                               GetSubjectFile(*args));
+
+        formatter.SetQueryRange(query_opts->GetRange());
+        formatter.SetLineLength(fmt_args->GetLineLength());
+        formatter.SetHitsSortOption(fmt_args->GetHitsSortOption());
+        formatter.SetHspsSortOption(fmt_args->GetHspsSortOption());
+        formatter.SetCustomDelimiter(fmt_args->GetCustomDelimiter());
+        formatter.PrintProlog();
+
+        /*** Process the input ***/
+        for (; !input.End(); formatter.ResetScopeHistory()) {
+            CRef<CBlastQueryVector> query_batch(input.GetNextSeqBatch(*scope));
+            CRef<IQueryFactory> queries(new CObjMgr_QueryFactory(*query_batch));
+
+            CLocalBlast lcl_blast(queries, opts_hndl, db_adapter);
+            lcl_blast.SetNumberOfThreads(cmd_line_args->GetNumThreads());
+            CRef<CSearchResultSet> results = lcl_blast.Run();
+
+            if (isArchiveFormat) {
+                formatter.WriteArchive(*queries, *opts_hndl, *results, 0, bah.GetMessages());
+                bah.ResetMessages();
+            } else {
+                BlastFormatter_PreFetchSequenceData(*results, scope,
+                                                    fmt_args->GetFormattedOutputChoice());
+                ITERATE(CSearchResultSet, result, *results) {
+                    formatter.PrintOneResultSet(**result, query_batch);
+                }
+            }
+        }
+
+        formatter.PrintEpilog(opt);
+
+        CNcbiStrstream* report = dynamic_cast<CNcbiStrstream*>(&out);
+        _ASSERT(report);
+        output = report->str();
+    } CATCH_ALL(status)
+
+    QueryBatchCleanup();
+    return status;
+}
+
+void
+CBlastServerApp::x_InitializeSubject(CRef<CBlastDatabaseArgs> db_args,
+                                     CRef<CBlastOptionsHandle> opts_hndl,
+                                     CRef<CLocalDbAdapter>& db_adapter,
+                                     CRef<CScope>& scope)
+{
+    CRef<CSearchDatabase> search_db = db_args->GetSearchDatabase();
+
+    // Subject sequences, and databases restricted by a GI/seqid/taxid list
+    // or an Entrez query, are set up anew for each request
+    if (search_db.Empty() ||
+        search_db->GetGiList().NotEmpty() ||
+        search_db->GetNegativeGiList().NotEmpty() ||
+        !search_db->GetEntrezQueryLimitation().empty()) {
+        InitializeSubject(db_args, opts_hndl, false, db_adapter, scope);
+        return;
+    }
+
+    const string kKey = search_db->GetDatabaseName() + "\t" +
+        NStr::IntToString(search_db->GetMoleculeType()) + "\t" +
+        NStr::IntToString(search_db->GetFilteringAlgorithm()) + "\t" +
+        search_db->GetFilteringAlgorithmKey() + "\t" +
+        NStr::IntToString(search_db->GetMaskType());
+
+    map<string, SOpenDatabase>::iterator open_db = m_Databases.find(kKey);
+    if (open_db == m_Databases.end()) {
+        SOpenDatabase db;
+        CRef<CSeqDB> seqdb = search_db->GetSeqDb();
+        db.m_DbAdapter.Reset(new CLocalDbAdapter(*search_db));
+        db.m_DataLoader = RegisterOMDataLoader(seqdb);
+        open_db = m_Databases.insert(make_pair(kKey, db)).first;
+        LOG_POST(Info << "Opened BLAST database " <<
+                 search_db->GetDatabaseName());
+    }
+
+    // The queries of each request are added to a fresh scope, so that
+    // their local IDs do not clash with those of earlier requests
+    db_adapter = open_db->second.m_DbAdapter;
+    scope.Reset(new CScope(*CObjectManager::GetInstance()));
+    scope->AddDataLoader(open_db->second.m_DataLoader,
+                         CBlastDatabaseArgs::kSubjectsDataLoaderPriority);
+}
+
+/// Nearest-rank percentile of a sorted, non-empty set of values
+static double s_Percentile(const vector<double>& sorted_values, int percent)
+{
+    size_t rank = (size_t)ceil(percent / 100.0 * sorted_values.size());
+    return sorted_values[max(rank, (size_t)1) - 1];
+}
+
+int CBlastServerApp::x_RunBenchmark()
+{
+    const CArgs& args = GetArgs();
+
+    SBlastServerRequest request;
+    request.m_Program = args["program"].AsString();
+    NStr::Split(args["search_args"].AsString(), " \t", request.m_Args,
+                NStr::fSplit_Tokenize);
+    if (args["query"]) {
+        CNcbiOstrstream query;
+        query << args["query"].AsInputFile().rdbuf();
+        request.m_Query = CNcbiOstrstreamToString(query);
+    }
+
+    CUNIXSocket socket(args["socket"].AsString());
+    if (socket.GetStatus(eIO_Open) != eIO_Success) {
+        ERR_POST(Error << "Cannot connect to " << args["socket"].AsString());
+        return BLAST_UNKNOWN_ERROR;
+    }
+    CConn_SocketStream stream(socket, kInfiniteTimeout);
+
+    const int kNumRequests = args["bench"].AsInteger();
+    vector<double> latencies;
+    latencies.reserve(kNumRequests);
+    size_t output_bytes = 0;
+    for (int i = 0; i < kNumRequests; i++) {
+        CStopWatch sw(CStopWatch::eStart);
+        s_WriteRequest(stream, request);
+        int exit_code = 0;
+        string output, messages;
+        if ( !s_ReadResponse(stream, exit_code, output, messages) ) {
+            ERR_POST(Error << "Connection to the server was lost");
+            return BLAST_UNKNOWN_ERROR;
+        }
+        latencies.push_back(sw.Elapsed());
+        if (exit_code != BLAST_EXIT_SUCCESS) {
+            ERR_POST(Error << "Request failed with exit code " << exit_code
+                     << ":\n" << messages);
+            return exit_code;
+        }
+        output_bytes += output.size();
+    }
+
+    sort(latencies.begin(), latencies.end());
+    const double kTotal = accumulate(latencies.begin(), latencies.end(), 0.0);
+    NcbiCout << "requests: " << kNumRequests << NcbiEndl
+             << "output bytes per request: " << output_bytes / kNumRequests
+             << NcbiEndl << fixed << setprecision(2)
+             << "mean ms: " << kTotal * 1000.0 / kNumRequests << NcbiEndl
+             << "p50 ms: " << s_Percentile(latencies, 50) * 1000.0 << NcbiEndl
+             << "p99 ms: " << s_Percentile(latencies, 99) * 1000.0 << NcbiEndl
+             << "max ms: " << latencies.back() * 1000.0 << NcbiEndl;
+    return BLAST_EXIT_SUCCESS;
+}
+
+#ifndef SKIP_DOXYGEN_PROCESSING
+int NcbiSys_main(int argc, ncbi::TXChar* argv[])
+{
+    return CBlastServerApp().AppMain(argc, argv);
+}
+#endif /* SKIP_DOXYGEN_PROCESSING */
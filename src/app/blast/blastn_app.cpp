@@ -324,7 +324,7 @@ int CBlastnApp::x_RunMTBySplitQuery()
    		INFO_POST("Batch Size: " << batch_size);
    		CBlastNodeInputReader input(m_CmdLineArgs->GetInputStream(), batch_size, 2000);
 		while (master_node.Processing()) {
-			if (!input.AtEOF()) {
+			if (!input.AtEndOfQueries()) {
 			 	if (!master_node.IsFull()) {
 					string qb;
 					int q_index = 0;
@@ -332,7 +332,7 @@ int CBlastnApp::x_RunMTBySplitQuery()
 					if (num_q > 0) {
 						CBlastNodeMailbox * mb(new CBlastNodeMailbox(chunk_num, master_node.GetBuzzer()));
 						CBlastnNode * t(new CBlastnNode(chunk_num, GetArguments(), args, bah, qb, q_index, num_q, mb));
-						master_node.RegisterNode(t, mb);
+						master_node.RegisterNode(t, mb, input.GetBatchLength());
 						chunk_num ++;
 					}
 				}
@@ -35,6 +35,7 @@
 #include <corelib/ncbiapp.hpp>
 #include <algo/blast/api/local_blast.hpp>
 #include <algo/blast/api/remote_blast.hpp>
+#include <algo/blast/api/blast_prot_options.hpp>
 #include <algo/blast/blastinput/blast_fasta_input.hpp>
 #include <algo/blast/blastinput/blastx_args.hpp>
 #include <algo/blast/api/objmgr_query_data.hpp>
@@ -80,6 +81,77 @@ private:
     CStopWatch m_StopWatch;
 };
 
+/// Runs the traceback stage of a search in its own thread, so that the
+/// preliminary stage of the next query batch can proceed meanwhile
+class CBlastxTracebackThread : public CThread
+{
+public:
+    /// Constructor
+    /// @param search search whose preliminary stage has been run [in]
+    /// @param db_adapter adapter with its own CSeqDB to read the subjects
+    /// from, as the preliminary stage of the next batch uses the search's
+    /// one [in]
+    CBlastxTracebackThread(CRef<CLocalBlast> search,
+                           CRef<CLocalDbAdapter> db_adapter)
+        : m_Search(search), m_DbAdapter(db_adapter) {}
+
+    /// Wait for the traceback to finish
+    /// @return the search results
+    CRef<CSearchResultSet> GetResults() {
+        Join();
+        if (m_Error) {
+            rethrow_exception(m_Error);
+        }
+        return m_Results;
+    }
+
+protected:
+    virtual void* Main(void) {
+        try {
+            m_Results = m_Search->RunTraceback(m_DbAdapter);
+        } catch (...) {
+            m_Error = current_exception();
+        }
+        return NULL;
+    }
+
+private:
+    CRef<CLocalBlast> m_Search;
+    CRef<CLocalDbAdapter> m_DbAdapter;
+    CRef<CSearchResultSet> m_Results;
+    exception_ptr m_Error;
+};
+
+/// Returns true if the traceback of each query batch should overlap the
+/// preliminary stage of the next one (BLAST_PIPELINED_BATCHES is set)
+static bool s_PipelineQueryBatches()
+{
+    const char* pipelined = getenv("BLAST_PIPELINED_BATCHES");
+    return pipelined && !NStr::IsBlank(pipelined) &&
+        NStr::StringToBool(pipelined);
+}
+
+/// Remove the queries of a formatted batch from the scope. Unlike
+/// CBlastFormat::ResetScopeHistory, this keeps the queries of the batch
+/// still being searched.
+static void s_ResetQueryBatchScope(CScope& scope,
+                                   const CBlastQueryVector& query_batch)
+{
+    for (CBlastQueryVector::size_type i = 0; i < query_batch.Size(); i++) {
+        CBioseq_Handle bh =
+            scope.GetBioseqHandle(*query_batch.GetQuerySeqLoc(i));
+        if ( !bh ) {
+            continue;
+        }
+        try {
+            scope.RemoveTopLevelSeqEntry(bh.GetTopLevelEntry());
+        } catch (const CException&) {
+            // Not added by the input reader, ResetHistory releases it
+        }
+    }
+    scope.ResetHistory();
+}
+
 void CBlastxApp::Init()
 {
     // formulate command line arguments
@@ -192,6 +264,72 @@ int CBlastxApp::x_RunMTBySplitDB()
         formatter.PrintProlog();
 
         /*** Process the input ***/
+        if ( !m_CmdLineArgs->ExecuteRemotely() &&
+             !fmt_args->ArchiveFormatRequested(args) &&
+             fmt_args->GetFormattedOutputChoice() != CFormattingArgs::eXml &&
+             db_adapter->IsBlastDb() && s_PipelineQueryBatches() ) {
+            // The traceback of each batch runs while the next batch is read
+            // and its preliminary stage runs; output stays in input order.
+            // The tracebacks read the database through their own CSeqDB,
+            // which the preliminary stages never switch to multi-threaded
+            // mode, and each search has its own copy of the options.
+            CRef<CLocalDbAdapter> tback_db_adapter(new CLocalDbAdapter(
+                *db_adapter->GetSearchDatabase()->CloneWithOwnSeqDb()));
+            CRef<CBlastQueryVector> tback_batch;
+            CRef<CBlastxTracebackThread> tback_thread;
+            try {
+                while ( !input.End() || tback_thread.NotEmpty() ) {
+                    CRef<CBlastQueryVector> query_batch;
+                    CRef<CLocalBlast> lcl_blast;
+                    if ( !input.End() ) {
+                        query_batch.Reset(input.GetNextSeqBatch(*scope));
+                        CRef<IQueryFactory> queries(
+                            new CObjMgr_QueryFactory(*query_batch));
+                        SaveSearchStrategy(args, m_CmdLineArgs, queries,
+                                           opts_hndl);
+                        // Each batch in flight has its own copy of the
+                        // options, which its stages may update while the
+                        // traceback of the previous batch reads its own
+                        CRef<CBlastOptionsHandle> batch_opts_hndl(
+                            new CBlastProteinOptionsHandle(
+                                opts_hndl->GetOptions().Clone()));
+                        lcl_blast.Reset(new CLocalBlast(queries,
+                                                        batch_opts_hndl,
+                                                        db_adapter));
+                        lcl_blast->SetNumberOfThreads(
+                            m_CmdLineArgs->GetNumThreads());
+                        lcl_blast->RunPreliminarySearch();
+                    }
+
+                    if (tback_thread.NotEmpty()) {
+                        CRef<CSearchResultSet> results =
+                            tback_thread->GetResults();
+                        tback_thread.Reset();
+                        BlastFormatter_PreFetchSequenceData(*results, scope,
+                            fmt_args->GetFormattedOutputChoice());
+                        ITERATE(CSearchResultSet, result, *results) {
+                            formatter.PrintOneResultSet(**result, tback_batch);
+                        }
+                        s_ResetQueryBatchScope(*scope, *tback_batch);
+                        QueryBatchCleanup();
+                    }
+
+                    tback_batch = query_batch;
+                    if (lcl_blast.NotEmpty()) {
+                        tback_thread.Reset(
+                            new CBlastxTracebackThread(lcl_blast,
+                                                       tback_db_adapter));
+                        tback_thread->Run();
+                    }
+                }
+            } catch (...) {
+                if (tback_thread.NotEmpty()) {
+                    tback_thread->Join();
+                }
+                throw;
+            }
+        }
+
         for (; !input.End(); formatter.ResetScopeHistory(), QueryBatchCleanup()) {
 
             CRef<CBlastQueryVector> query_batch(input.GetNextSeqBatch(*scope));
@@ -279,7 +417,7 @@ int CBlastxApp::x_RunMTBySplitQuery()
    		INFO_POST("Batch Size: " << batch_size);
    		CBlastNodeInputReader input(m_CmdLineArgs->GetInputStream(), batch_size, 2000);
 		while (master_node.Processing()) {
-			if (!input.AtEOF()) {
+			if (!input.AtEndOfQueries()) {
 			 	if (!master_node.IsFull()) {
 					string qb;
 					int q_index = 0;
@@ -287,7 +425,7 @@ int CBlastxApp::x_RunMTBySplitQuery()
 					if (num_q > 0) {
 						CBlastNodeMailbox * mb(new CBlastNodeMailbox(chunk_num, master_node.GetBuzzer()));
 						CBlastxNode * t(new CBlastxNode(chunk_num, GetArguments(), args, bah, qb, q_index, num_q, mb));
-						master_node.RegisterNode(t, mb);
+						master_node.RegisterNode(t, mb, input.GetBatchLength());
 						chunk_num ++;
 					}
 				}
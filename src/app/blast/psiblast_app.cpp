@@ -112,7 +112,8 @@ private:
                                 CConstRef<CSeq_align_set> sset,
                                 CConstRef<CPSIBlastOptionsHandle> opts_handle,
                                 CRef<CScope> scope,
-                                CRef<CBlastAncillaryData> ancillary_data);
+                                CRef<CBlastAncillaryData> ancillary_data,
+                                CPsiBlastIterationState& itr);
 
     /// This application's command line args
     CRef<CPsiBlastAppArgs> m_CmdLineArgs;
@@ -170,13 +171,16 @@ CPsiBlastApp::ComputePssmForNextIteration(const CBioseq& bioseq,
                               CConstRef<CSeq_align_set> sset,
                               CConstRef<CPSIBlastOptionsHandle> opts_handle,
                               CRef<CScope> scope,
-                              CRef<CBlastAncillaryData> ancillary_data)
+                              CRef<CBlastAncillaryData> ancillary_data,
+                              CPsiBlastIterationState& itr)
 {
     CPSIDiagnosticsRequest
         diags(PSIDiagnosticsRequestNewEx(m_CmdLineArgs->SaveAsciiPssm()));
     m_AncillaryData = ancillary_data;
     return PsiBlastComputePssmFromAlignment(bioseq, sset, scope, *opts_handle,
-                                            m_AncillaryData, diags);
+                                            m_AncillaryData, diags,
+                                            m_CmdLineArgs->GetNumThreads(),
+                                            &itr.GetMsaCache());
 }
 
 /*** Convenience function to make a query factory object */
@@ -306,7 +310,8 @@ CPsiBlastApp::x_RunLocalPsiBlastIterations(CRef<CBlastQueryVector> query,
                          s_GetQueryBioseq(query, scope, pssm);
                         pssm = 
                          ComputePssmForNextIteration(*seq, aln, psi_opts, scope,
-                                     results_1st_query.GetAncillaryData());
+                                     results_1st_query.GetAncillaryData(),
+                                     itr);
                         psiblast->SetPssm(pssm);
                         }
                 }
@@ -283,7 +283,7 @@ int CRPSBlastApp::x_RunMTBySplitQuery(void)
    		LogCmdOptions(m_UsageReport, *m_CmdLineArgs);
    		CBlastNodeInputReader input(m_CmdLineArgs->GetInputStream(), batch_size, 360);
 		while (master_node.Processing()) {
-			if (!input.AtEOF()) {
+			if (!input.AtEndOfQueries()) {
 			 	if (!master_node.IsFull()) {
 					string qb;
 					int q_index = 0;
@@ -291,7 +291,7 @@ int CRPSBlastApp::x_RunMTBySplitQuery(void)
 					if (num_q > 0) {
 						CBlastNodeMailbox * mb(new CBlastNodeMailbox(chunk_num, master_node.GetBuzzer()));
 						CRPSBlastNode * t(new CRPSBlastNode(chunk_num, GetArguments(), args, bah, qb, q_index, num_q, mb));
-						master_node.RegisterNode(t, mb);
+						master_node.RegisterNode(t, mb, input.GetBatchLength());
 						chunk_num ++;
 					}
 				}
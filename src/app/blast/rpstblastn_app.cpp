@@ -276,7 +276,7 @@ int CRPSTBlastnApp::x_RunMTBySplitQuery(void)
    		LogCmdOptions(m_UsageReport, *m_CmdLineArgs);
    		CBlastNodeInputReader input(m_CmdLineArgs->GetInputStream(), batch_size, 4500);
 		while (master_node.Processing()) {
-			if (!input.AtEOF()) {
+			if (!input.AtEndOfQueries()) {
 			 	if (!master_node.IsFull()) {
 			 		int q_index = 0;
 					string qb;
@@ -284,7 +284,7 @@ int CRPSTBlastnApp::x_RunMTBySplitQuery(void)
 					if (num_q > 0) {
 						CBlastNodeMailbox * mb(new CBlastNodeMailbox(chunk_num, master_node.GetBuzzer()));
 						CRPSTBlastnNode * t(new CRPSTBlastnNode(chunk_num, GetArguments(), args, bah, qb, q_index, num_q, mb));
-						master_node.RegisterNode(t, mb);
+						master_node.RegisterNode(t, mb, input.GetBatchLength());
 						chunk_num ++;
 					}
 				}
@@ -62,7 +62,7 @@ class CBlastDBCmdApp : public CNcbiApplication
 {
 public:
     /** @inheritDoc */
-    CBlastDBCmdApp() {
+    CBlastDBCmdApp() : m_NumThreads(1) {
         CRef<CVersion> version(new CVersion());
         version->SetVersionInfo(new CBlastVersion());
         SetFullVersion(version);
@@ -93,6 +93,8 @@ private:
     bool m_GetDuplicates;
     /// should we output target sequence only?
     bool m_TargetOnly;
+    /// Number of threads used to format sequences
+    int m_NumThreads;
 
     CBlastDB_FormatterConfig m_Config;
 
@@ -143,6 +145,10 @@ private:
 
     int x_ProcessBatchPig(CBlastDB_Formatter & fmt);
 
+    /// Write the requested sequences, in order, with m_NumThreads threads
+    void x_WriteRequests(CBlastDB_Formatter & fmt,
+                         const vector<SBlastDB_FormatRequest> & requests);
+
     void x_AddCmdOptions();
 };
 
@@ -359,6 +365,7 @@ CBlastDBCmdApp::x_ProcessBatchEntry_NoDup(CBlastDB_Formatter & fmt)
     CNcbiIstream& input = args["entry_batch"].AsInputFile();
     vector<string> ids, formats;
     vector<CSeqDB::TOID> oids;
+    vector<SBlastDB_FormatRequest> requests;
     while (input) {
         string line;
         NcbiGetlineEOL(input, line);
@@ -407,16 +414,22 @@ CBlastDBCmdApp::x_ProcessBatchEntry_NoDup(CBlastDB_Formatter & fmt)
     		ERR_POST (Error << "Skipped " << ids[i]);
     		continue;
     	}
-    	if(m_TargetOnly) {
-    		fmt.Write(oids[i], m_Config, ids[i]);
-    	}
-    	else {
-    	   	fmt.Write(oids[i], m_Config);
-    	}
+    	requests.push_back(SBlastDB_FormatRequest(oids[i], m_Config,
+    	                                          m_TargetOnly ? ids[i] : kEmptyStr));
     }
+    x_WriteRequests(fmt, requests);
     return (err_found) ? 1 : 0;
 }
 
+void
+CBlastDBCmdApp::x_WriteRequests(CBlastDB_Formatter & fmt,
+                                const vector<SBlastDB_FormatRequest> & requests)
+{
+    CNcbiOstream& out = GetArgs()[kArgOutput].AsOutputFile();
+    CBlastDB_ParallelWriter writer(fmt, *m_BlastDb, out, m_NumThreads);
+    writer.Write(requests);
+}
+
 int
 CBlastDBCmdApp::x_ProcessBatchEntry(CBlastDB_Formatter & fmt)
 {
@@ -699,6 +712,7 @@ CBlastDBCmdApp::x_InitSearchRequest()
    	const CArgs& args = GetArgs();
     m_GetDuplicates = args["get_dups"];
     m_TargetOnly = args["target_only"];
+    m_NumThreads = args[kArgNumThreads].AsInteger();
 
     string outfmt = kEmptyStr;
     if (args["outfmt"].HasValue()) {
@@ -782,7 +796,8 @@ CBlastDBCmdApp::x_ProcessSearchType(CBlastDB_Formatter & fmt)
 {
    	const CArgs& args = GetArgs();
 	if (args["entry"].HasValue() && args["entry"].AsString() == "all") {
-		fmt.DumpAll(m_Config);
+		CBlastDB_ParallelWriter writer(fmt, *m_BlastDb, args[kArgOutput].AsOutputFile(), m_NumThreads);
+		writer.DumpAll(m_Config);
 	}
 	else if (args["entry_batch"].HasValue()) {
 		if(m_GetDuplicates) {
@@ -1047,6 +1062,13 @@ void CBlastDBCmdApp::Init()
     arg_desc->SetDependency("get_dups", CArgDescriptions::eExcludes,
                             "target_only");
 
+    arg_desc->AddDefaultKey(kArgNumThreads, "int_value",
+                            "Number of threads to use to retrieve and format "
+                            "sequences for\n\t'-entry all' and '-entry_batch'",
+                            CArgDescriptions::eInteger, "1");
+    arg_desc->SetConstraint(kArgNumThreads,
+                            new CArgAllowValuesGreaterThanOrEqual(1));
+
     arg_desc->SetCurrentGroup("Output configuration options for FASTA format");
     arg_desc->AddDefaultKey("line_length", "number", "Line length for output",
                         CArgDescriptions::eInteger,
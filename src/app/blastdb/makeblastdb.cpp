@@ -299,6 +299,11 @@ void CMakeBlastDBApp::Init()
     arg_desc->AddDefaultKey("max_file_sz", "number_of_bytes",
                             "Maximum file size for BLAST database files",
                             CArgDescriptions::eString, "3GB");
+    arg_desc->AddDefaultKey(kArgNumThreads, "int_value",
+                            "Number of threads to use to prepare sequences",
+                            CArgDescriptions::eInteger, "1");
+    arg_desc->SetConstraint(kArgNumThreads,
+                            new CArgAllowValuesGreaterThanOrEqual(1));
     arg_desc->AddOptionalKey("metadata_output_prefix", "",
     						"Path prefix for location of database files in metadata", CArgDescriptions::eString);
     arg_desc->AddOptionalKey("logfile", "File_Name",
@@ -1194,6 +1199,12 @@ void CMakeBlastDBApp::x_BuildDatabase()
 
     m_DB->SetMaxFileSize(bytes);
 
+    int num_threads = args[kArgNumThreads].AsInteger();
+    if (num_threads > 1) {
+        *m_LogFile << "Number of threads: " << num_threads << endl;
+    }
+    m_DB->SetNumThreads(num_threads);
+
     if (args["taxid"].HasValue()) {
         _ASSERT( !args["taxid_map"].HasValue() );
         CRef<CTaxIdSet> taxids(new CTaxIdSet(TAX_ID_FROM(int, args["taxid"].AsInteger())));
@@ -68,6 +68,7 @@
 #include <objtools/seqmasks_io/mask_writer_fasta.hpp>
 #include <objtools/seqmasks_io/mask_writer_seqloc.hpp>
 #include <objtools/seqmasks_io/mask_writer_blastdb_maskinfo.hpp>
+#include <objtools/seqmasks_io/mask_batch.hpp>
 
 BEGIN_NCBI_SCOPE
 USING_SCOPE(objects);
@@ -109,6 +110,11 @@ void CDustMaskApplication::Init(void)
                              "Parse Seq-ids in FASTA input", true );
     arg_desc->AddFlag      ( "hard_masking",
                              "Use hard masking for fasta outfmt", true );
+    arg_desc->AddDefaultKey( "num_threads", "int_value",
+                             "Number of threads to use to mask sequences",
+                             CArgDescriptions::eInteger, "1" );
+    arg_desc->SetConstraint( "num_threads", 
+                             new CArgAllow_Integers( 1, kMax_Int ) );
     CArgAllow_Strings* strings_allowed = new CArgAllow_Strings();
     for (size_t i = 0; i < kNumOutputFormats; i++) {
         strings_allowed->Allow(kOutputFormats[i]);
@@ -185,13 +191,13 @@ CMaskReader * CDustMaskApplication::x_GetReader()
     return 0;
 }
 
-CSymDustMasker::TMaskList s_FindSegmentWithLongNs(const unsigned int MAX_Ns, objects::CSeqVector & seq)
+CSymDustMasker::TMaskList s_FindSegmentWithLongNs(const unsigned int MAX_Ns, const string & seq)
 {
 	//Always trim Ns at start and end of seq
 	CSymDustMasker::TMaskList  NsRange;
     unsigned int pos = 0;
 	unsigned int Ns = 0;
-    for(objects::CSeqVector_CI itr=seq.begin();itr!=seq.end(); ++itr) {
+    ITERATE(string, itr, seq) {
         if ((*itr) == 78) {
             Ns++;
         }
@@ -226,7 +232,7 @@ void s_InsertMerge(CSymDustMasker::TMaskList & list, CSymDustMasker::TMaskedInte
 }
 
 std::unique_ptr< CSymDustMasker::TMaskList >
-GetDustMasks_SkipNs(objects::CSeqVector & seq, Uint4 level, Uint4 window, Uint4 linker)
+GetDustMasks_SkipNs(const string & seq, Uint4 level, Uint4 window, Uint4 linker)
 {
     CSymDustMasker duster(level, window, linker);
     CSymDustMasker::TMaskList NsRange = s_FindSegmentWithLongNs(window, seq);
@@ -269,6 +275,29 @@ GetDustMasks_SkipNs(objects::CSeqVector & seq, Uint4 level, Uint4 window, Uint4
     return rv;
 }
 
+/// Masks the sequences of a batch with GetDustMasks_SkipNs
+class CDustMaskBatch : public CMaskBatch
+{
+public:
+    CDustMaskBatch(CMaskWriter & writer, bool parsed_id, int num_threads,
+                   Uint4 level, Uint4 window, Uint4 linker)
+        : CMaskBatch(writer, parsed_id, num_threads, true),
+          m_Level(level), m_Window(window), m_Linker(linker)
+    {}
+
+protected:
+    virtual TMaskList * Mask(const SSeq & seq) const
+    {
+        return GetDustMasks_SkipNs(seq.data, m_Level, m_Window,
+                                   m_Linker).release();
+    }
+
+private:
+    Uint4 m_Level;
+    Uint4 m_Window;
+    Uint4 m_Linker;
+};
+
 //-------------------------------------------------------------------------
 int CDustMaskApplication::Run (void)
 {
@@ -278,21 +307,22 @@ int CDustMaskApplication::Run (void)
     // Set up the object manager.
     CRef<CObjectManager> om(CObjectManager::GetInstance());
 
-    // Set up the duster object.
-    Uint4 level = GetArgs()["level"].AsInteger();
-    duster_type::size_type window = GetArgs()["window"].AsInteger();
-    duster_type::size_type linker = GetArgs()["linker"].AsInteger();
-    duster_type duster( level, window, linker );
-
-    // Now process each input sequence in a loop.
+    // Now process each input sequence in a loop.  The sequences are
+    // masked in batches on num_threads threads.
+    const CArgs & args = GetArgs();
     CRef< CSeq_entry > aSeqEntry( 0 );
     unique_ptr<CMaskWriter> writer(x_GetWriter());
     CMaskReader * reader = x_GetReader();
+    CDustMaskBatch batch(*writer, args["parse_seqids"],
+                         args["num_threads"].AsInteger(),
+                         args["level"].AsInteger(),
+                         args["window"].AsInteger(),
+                         args["linker"].AsInteger());
 
     while( (aSeqEntry = reader->GetNextSequence()).NotEmpty() )
     {
-        CScope scope( *om );
-        CSeq_entry_Handle seh = scope.AddTopLevelSeqEntry( *aSeqEntry );
+        CRef< CScope > scope( new CScope( *om ) );
+        CSeq_entry_Handle seh = scope->AddTopLevelSeqEntry( *aSeqEntry );
 
         CBioseq_CI bs_iter(seh, CSeq_inst::eMol_na);
 
@@ -303,15 +333,12 @@ int CDustMaskApplication::Run (void)
             if (bsh.GetBioseqLength() == 0) 
                 continue;
 
-            CSeqVector data 
-                = bsh.GetSeqVector( CBioseq_Handle::eCoding_Iupac );
-            std::unique_ptr< duster_type::TMaskList > res = GetDustMasks_SkipNs(data, level, window, linker);
-            if (res.get()) {
-                writer->Print(bsh, *res, GetArgs()["parse_seqids"] );
-            }
+            batch.Add(scope, bsh,
+                      bsh.GetSeqVector( CBioseq_Handle::eCoding_Iupac ));
         }
     }
 
+    batch.Flush();
     output_stream << flush;
     return 0;
 }
@@ -0,0 +1,44 @@
+#! /bin/sh
+# $Id$
+#
+# Checks that dustmasker gives the same output on one and on several
+# threads.  The input has more sequences than one batch on two threads
+# holds, with low complexity repeats and runs of N.
+
+input=dustmasker_mt_test.fa
+exit_code=0
+
+awk 'BEGIN {
+    srand(21);
+    for (i = 0; i < 600; i++) {
+        print ">seq" i;
+        len = 50 + int(rand() * 3000);
+        s = "";
+        while (length(s) < len) {
+            r = rand();
+            if (r < 0.05) {
+                unit = substr("ACGT", 1 + int(rand() * 4), 1 + int(rand() * 3));
+                for (j = int(rand() * 40); j > 0; j--) s = s unit;
+            } else if (r < 0.07) {
+                for (j = int(rand() * 100); j > 0; j--) s = s "N";
+            } else {
+                s = s substr("ACGT", 1 + int(rand() * 4), 1);
+            }
+        }
+        for (j = 1; j <= length(s); j += 60) print substr(s, j, 60);
+    }
+}' > $input
+
+for outfmt in interval fasta; do
+    dustmasker -in $input -outfmt $outfmt -num_threads 1 \
+        -out dustmasker_mt_test.1 || exit 1
+    dustmasker -in $input -outfmt $outfmt -num_threads 2 \
+        -out dustmasker_mt_test.2 || exit 1
+    if ! cmp -s dustmasker_mt_test.1 dustmasker_mt_test.2; then
+        echo "dustmasker -outfmt $outfmt output differs on 2 threads"
+        exit_code=1
+    fi
+done
+
+rm -f $input dustmasker_mt_test.1 dustmasker_mt_test.2
+exit $exit_code
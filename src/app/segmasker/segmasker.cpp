@@ -47,6 +47,7 @@
 #include <objtools/seqmasks_io/mask_writer_fasta.hpp>
 #include <objtools/seqmasks_io/mask_writer_seqloc.hpp>
 #include <objtools/seqmasks_io/mask_writer_blastdb_maskinfo.hpp>
+#include <objtools/seqmasks_io/mask_batch.hpp>
 
 // Object manager includes
 #include <objmgr/object_manager.hpp>
@@ -59,6 +60,34 @@ USING_NCBI_SCOPE;
 USING_SCOPE(objects);
 #endif /* SKIP_DOXYGEN_PROCESSING */
 
+/// Masks the sequences of a batch with a SEG masker shared by all threads
+class CSegMaskBatch : public CMaskBatch
+{
+public:
+    /// Residues of sequence data collected per thread before a batch is
+    /// masked
+    static const Uint8 kLettersPerThread = 4 * 1024 * 1024;
+
+    /// Sequences collected per thread before a batch is masked
+    static const size_t kSeqsPerThread = 1024;
+
+    CSegMaskBatch(CMaskWriter& writer, bool parsed_id, int num_threads,
+                  const CSegMasker& masker)
+        : CMaskBatch(writer, parsed_id, num_threads, true,
+                     kLettersPerThread, kSeqsPerThread),
+          m_Masker(masker)
+    {}
+
+protected:
+    virtual TMaskList* Mask(const SSeq& seq) const
+    {
+        return m_Masker(seq.data);
+    }
+
+private:
+    const CSegMasker& m_Masker;
+};
+
 /////////////////////////////////////////////////////////////////////////////
 //  SegMaskerApplication::
 
@@ -145,6 +174,13 @@ void SegMaskerApplication::Init(void)
                             CArgDescriptions::eDouble,
                             NStr::DoubleToString(kSegHicut));
 
+    arg_desc->SetCurrentGroup("Miscellaneous options");
+    arg_desc->AddDefaultKey("num_threads", "int_value",
+                            "Number of threads to use to mask sequences",
+                            CArgDescriptions::eInteger, "1");
+    arg_desc->SetConstraint("num_threads",
+                            new CArgAllow_Integers(1, kMax_Int));
+
     // Setup arg.descriptions for this application
     SetupArgDescriptions(arg_desc.release());
 }
@@ -224,6 +260,8 @@ int SegMaskerApplication::Run(void)
         CRef<CSeq_entry> seq_entry;
         unique_ptr<CMaskReader> reader(x_GetReader());
         unique_ptr<CMaskWriter> writer(x_GetWriter());
+        CSegMaskBatch batch(*writer, args["parse_seqids"],
+                            args["num_threads"].AsInteger(), masker);
 
         while ( (seq_entry = reader->GetNextSequence()).NotEmpty() ) {
 
@@ -231,17 +269,19 @@ int SegMaskerApplication::Run(void)
         	if(seq_entry->Which() == CSeq_entry::e_not_set)
         		continue;
 
-            CScope scope(*objmgr);
-            CSeq_entry_Handle seh = scope.AddTopLevelSeqEntry(*seq_entry);
+            CRef<CScope> scope(new CScope(*objmgr));
+            CSeq_entry_Handle seh = scope->AddTopLevelSeqEntry(*seq_entry);
             CBioseq_Handle bioseq_handle = seh.GetSeq();
             CSeqVector sequence_data = 
                 bioseq_handle.GetSeqVector(CBioseq_Handle::eCoding_Ncbi);
-            unique_ptr<CSegMasker::TMaskList> masks(masker(sequence_data));
-            writer->Print(bioseq_handle, *masks, GetArgs()["parse_seqids"]);
-            // writer->Print(bioseq_handle, *masks);
-
+            if ( !sequence_data.IsProtein() ) {
+                throw logic_error("SEG can only filter protein sequences");
+            }
+            batch.Add(scope, bioseq_handle, sequence_data);
         }
 
+        batch.Flush();
+
     } catch (const CException& e) {
         cerr << e.what() << endl;
         retval = 1;
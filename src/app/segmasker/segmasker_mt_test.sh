@@ -0,0 +1,45 @@
+#! /bin/sh
+# $Id$
+#
+# Checks that segmasker gives the same output on one and on several
+# threads.  The input has more sequences than one batch on two threads
+# holds, with low complexity repeats and runs of X.
+
+input=segmasker_mt_test.fa
+exit_code=0
+
+awk 'BEGIN {
+    srand(24);
+    aa = "ACDEFGHIKLMNPQRSTVWY";
+    for (i = 0; i < 2500; i++) {
+        print ">seq" i;
+        len = 10 + int(rand() * 600);
+        s = "";
+        while (length(s) < len) {
+            r = rand();
+            if (r < 0.03) {
+                unit = substr(aa, 1 + int(rand() * 20), 1 + int(rand() * 2));
+                for (j = int(rand() * 30); j > 0; j--) s = s unit;
+            } else if (r < 0.04) {
+                for (j = int(rand() * 20); j > 0; j--) s = s "X";
+            } else {
+                s = s substr(aa, 1 + int(rand() * 20), 1);
+            }
+        }
+        for (j = 1; j <= length(s); j += 60) print substr(s, j, 60);
+    }
+}' > $input
+
+for outfmt in interval fasta; do
+    segmasker -in $input -outfmt $outfmt -num_threads 1 \
+        -out segmasker_mt_test.1 || exit 1
+    segmasker -in $input -outfmt $outfmt -num_threads 2 \
+        -out segmasker_mt_test.2 || exit 1
+    if ! cmp -s segmasker_mt_test.1 segmasker_mt_test.2; then
+        echo "segmasker -outfmt $outfmt output differs on 2 threads"
+        exit_code=1
+    fi
+done
+
+rm -f $input segmasker_mt_test.1 segmasker_mt_test.2
+exit $exit_code
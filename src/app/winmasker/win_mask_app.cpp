@@ -51,6 +51,7 @@
 #include <objtools/seqmasks_io/mask_reader.hpp>
 #include <objtools/seqmasks_io/mask_fasta_reader.hpp>
 #include <objtools/seqmasks_io/mask_writer.hpp>
+#include <objtools/seqmasks_io/mask_batch.hpp>
 #include <algo/winmask/seq_masker.hpp>
 #include <algo/winmask/win_mask_gen_counts.hpp>
 #include <algo/winmask/win_mask_util.hpp>
@@ -112,6 +113,44 @@ void CWinMaskApplication::Init(void)
     SetupArgDescriptions(arg_desc.release());
 }
 
+/// Masks the sequences of a batch with a window masker shared by all
+/// threads, and dusts them when -dust is on
+class CWinMaskBatch : public CMaskBatch
+{
+public:
+    CWinMaskBatch( CWinMaskConfig & config, const CSeqMasker & masker,
+                   bool parsed_id )
+        : CMaskBatch( config.Writer(), parsed_id, config.NumThreads(), 
+                      false ),
+          m_Config( config ), m_Masker( masker ),
+          m_UseDust( config.AppType() 
+                     == CWinMaskConfig::eGenerateMasksWithDuster )
+    {}
+
+protected:
+    virtual TMaskList * Mask( const SSeq & seq ) const
+    {
+        unique_ptr< CSeqMasker::TMaskList > mask( m_Masker( seq.seq ) );
+
+        if( m_UseDust ) // Dust and merge with the window masker result
+        {
+            CSDustMasker duster( m_Config.DustWindow(),
+                                 m_Config.DustLevel(),
+                                 m_Config.DustLinker() );
+            unique_ptr< CSeqMasker::TMaskList > dust_info( 
+                duster( seq.seq, *mask ) );
+            CSeqMasker::MergeMaskInfo( mask.get(), dust_info.get() );
+        }
+
+        return mask.release();
+    }
+
+private:
+    CWinMaskConfig & m_Config;
+    const CSeqMasker & m_Masker;
+    bool m_UseDust;
+};
+
 //-------------------------------------------------------------------------
 int CWinMaskApplication::Run (void)
 {
@@ -165,7 +204,8 @@ int CWinMaskApplication::Run (void)
                                         aConfig.Ids(),
                                         aConfig.ExcludeIds(),
                                         aConfig.UseBA(),
-                                        aConfig.GetMetaData() );
+                                        aConfig.GetMetaData(),
+                                        aConfig.NumThreads() );
             cg();
         }
         else {
@@ -184,7 +224,8 @@ int CWinMaskApplication::Run (void)
                                         aConfig.Ids(),
                                         aConfig.ExcludeIds(),
                                         aConfig.UseBA(),
-                                        aConfig.GetMetaData() );
+                                        aConfig.GetMetaData(),
+                                        aConfig.NumThreads() );
             cg();
         }
 
@@ -197,7 +238,6 @@ int CWinMaskApplication::Run (void)
     }
 
     CMaskReader & theReader = aConfig.Reader();
-    CMaskWriter & theWriter = aConfig.Writer();
     CSeqMasker theMasker( aConfig.LStatName(),
                           aConfig.WindowSize(),
                           aConfig.WindowStep(),
@@ -219,22 +259,19 @@ int CWinMaskApplication::Run (void)
                           aConfig.Pattern(),
                           aConfig.UseBA() );
     CRef< CSeq_entry > aSeqEntry( 0 );
-    Uint4 total = 0, total_masked = 0;
-    CSDustMasker * duster( 0 );
+    Uint8 total = 0, total_masked = 0;
     const CWinMaskConfig::CIdSet * ids( aConfig.Ids() );
     const CWinMaskConfig::CIdSet * exclude_ids( aConfig.ExcludeIds() );
 
-    if( aConfig.AppType() == CWinMaskConfig::eGenerateMasksWithDuster )
-        duster = new CSDustMasker( aConfig.DustWindow(),
-                                   aConfig.DustLevel(),
-                                   aConfig.DustLinker() );
+    // The masker keeps no per-sequence state, so the sequences of a batch
+    // are masked in parallel with it.
+    CWinMaskBatch batch( aConfig, theMasker, GetArgs()["parse_seqids"] );
 
     while( (aSeqEntry = theReader.GetNextSequence()).NotEmpty() )
     {
         if( aSeqEntry->Which() == CSeq_entry::e_not_set ) continue;
-        CScope scope(*om);
-        CSeq_entry_Handle seh = scope.AddTopLevelSeqEntry(*aSeqEntry);
-        Uint4 masked = 0;
+        CRef< CScope > scope( new CScope( *om ) );
+        CSeq_entry_Handle seh = scope->AddTopLevelSeqEntry(*aSeqEntry);
         CBioseq_CI bs_iter(seh, CSeq_inst::eMol_na);
         for ( ;  bs_iter;  ++bs_iter) {
             CBioseq_Handle bsh = *bs_iter;
@@ -247,31 +284,15 @@ int CWinMaskApplication::Run (void)
                 TSeqPos len = bsh.GetBioseqLength();
                 total += len;
                 _TRACE( "Sequence length " << len );
-                CSeqVector data =
-                    bsh.GetSeqVector(CBioseq_Handle::eCoding_Iupac);
-                unique_ptr< CSeqMasker::TMaskList > mask_info( theMasker( data ) );
-                CSeqMasker::TMaskList dummy;
-
-                if( duster != 0 ) // Dust and merge with mask_info
-                {
-                    unique_ptr< CSeqMasker::TMaskList > dust_info( 
-                        (*duster)( data, *mask_info.get() ) );
-                    CSeqMasker::MergeMaskInfo( mask_info.get(), dust_info.get() );
-                }
-
-                // theWriter.Print( bsh, *mask_info, aConfig.MatchId() );
-                theWriter.Print( bsh, *mask_info, GetArgs()["parse_seqids"] );
-
-                for( CSeqMasker::TMaskList::const_iterator i = mask_info->begin();
-                     i != mask_info->end(); ++i )
-                    masked += i->second - i->first + 1;
-
-                total_masked += masked;
-                _TRACE( "Number of positions masked: " << masked );
+                batch.Add( scope, bsh,
+                           bsh.GetSeqVector(CBioseq_Handle::eCoding_Iupac) );
             }
         }
     }
 
+    batch.Flush();
+    total_masked = batch.GetNumMasked();
+
     _TRACE( "Total number of positions: " << total );
     _TRACE( "Total number of positions masked: " << total_masked );
     return 0;
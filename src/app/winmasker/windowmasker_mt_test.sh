@@ -0,0 +1,52 @@
+#! /bin/sh
+# $Id$
+#
+# Checks that windowmasker gives the same output on one and on several
+# threads, with and without dusting.  The input has more sequences than
+# one batch on two threads holds, with copies of a repeat, low complexity
+# repeats and runs of N.
+
+input=windowmasker_mt_test.fa
+counts=windowmasker_mt_test.counts
+exit_code=0
+
+awk 'BEGIN {
+    srand(23);
+    repeat = "";
+    for (i = 0; i < 300; i++) repeat = repeat substr("ACGT", 1 + int(rand() * 4), 1);
+    for (i = 0; i < 600; i++) {
+        print ">seq" i;
+        len = 50 + int(rand() * 3000);
+        s = "";
+        while (length(s) < len) {
+            r = rand();
+            if (r < 0.01) {
+                s = s substr(repeat, 1 + int(rand() * 100), 200);
+            } else if (r < 0.05) {
+                unit = substr("ACGT", 1 + int(rand() * 4), 1 + int(rand() * 3));
+                for (j = int(rand() * 40); j > 0; j--) s = s unit;
+            } else if (r < 0.07) {
+                for (j = int(rand() * 100); j > 0; j--) s = s "N";
+            } else {
+                s = s substr("ACGT", 1 + int(rand() * 4), 1);
+            }
+        }
+        for (j = 1; j <= length(s); j += 60) print substr(s, j, 60);
+    }
+}' > $input
+
+windowmasker -mk_counts -in $input -out $counts || exit 1
+
+for dust in false true; do
+    windowmasker -ustat $counts -in $input -dust $dust -num_threads 1 \
+        -out windowmasker_mt_test.1 || exit 1
+    windowmasker -ustat $counts -in $input -dust $dust -num_threads 2 \
+        -out windowmasker_mt_test.2 || exit 1
+    if ! cmp -s windowmasker_mt_test.1 windowmasker_mt_test.2; then
+        echo "windowmasker -dust $dust output differs on 2 threads"
+        exit_code=1
+    fi
+done
+
+rm -f $input $counts windowmasker_mt_test.1 windowmasker_mt_test.2
+exit $exit_code
@@ -0,0 +1,30 @@
+#include <ncbi_pch.hpp>
+#include "Affil.cpp"
+#include "ArticleId.cpp"
+#include "ArticleIdSet.cpp"
+#include "Auth_list.cpp"
+#include "Author.cpp"
+#include "CitRetract.cpp"
+#include "Cit_art.cpp"
+#include "Cit_book.cpp"
+#include "Cit_gen.cpp"
+#include "Cit_jour.cpp"
+#include "Cit_let.cpp"
+#include "Cit_pat.cpp"
+#include "Cit_proc.cpp"
+#include "Cit_sub.cpp"
+#include "DOI.cpp"
+#include "Id_pat.cpp"
+#include "Imprint.cpp"
+#include "MedlineUID.cpp"
+#include "Meeting.cpp"
+#include "PII.cpp"
+#include "Patent_priority.cpp"
+#include "PmPid.cpp"
+#include "PmcID.cpp"
+#include "PmcPid.cpp"
+#include "PubMedId.cpp"
+#include "PubStatus.cpp"
+#include "PubStatusDate.cpp"
+#include "PubStatusDateSet.cpp"
+#include "Title.cpp"
@@ -0,0 +1,154 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'blast.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objects/blast/NCBI_Blast4_module.hpp>
+#include <objects/blast/Blas_get_searc_resul_reply.hpp>
+#include <objects/blast/Blas_get_searc_resul_reque.hpp>
+#include <objects/blast/Blas_get_searc_statu_reply.hpp>
+#include <objects/blast/Blas_get_searc_statu_reque.hpp>
+#include <objects/blast/Blas_get_searc_strat_reque.hpp>
+#include <objects/blast/Blas_get_windo_taxid_reply.hpp>
+#include <objects/blast/Blast4_alignment_for_query.hpp>
+#include <objects/blast/Blast4_archive.hpp>
+#include <objects/blast/Blast4_cutoff.hpp>
+#include <objects/blast/Blast4_database.hpp>
+#include <objects/blast/Blast4_database_info.hpp>
+#include <objects/blast/Blast4_error.hpp>
+#include <objects/blast/Blast4_get_databa_ex_reply.hpp>
+#include <objects/blast/Blast4_get_databases_reply.hpp>
+#include <objects/blast/Blast4_get_matrices_reply.hpp>
+#include <objects/blast/Blast4_get_parameter_reply.hpp>
+#include <objects/blast/Blast4_get_paramsets_reply.hpp>
+#include <objects/blast/Blast4_get_programs_reply.hpp>
+#include <objects/blast/Blast4_get_queries_reply.hpp>
+#include <objects/blast/Blast4_get_seq_parts_reply.hpp>
+#include <objects/blast/Blast4_get_sequenc_request.hpp>
+#include <objects/blast/Blast4_get_sequences_reply.hpp>
+#include <objects/blast/Blast4_ka_block.hpp>
+#include <objects/blast/Blast4_mask.hpp>
+#include <objects/blast/Blast4_matrix_id.hpp>
+#include <objects/blast/Blast4_parameter.hpp>
+#include <objects/blast/Blast4_parameter_info.hpp>
+#include <objects/blast/Blast4_parameters.hpp>
+#include <objects/blast/Blast4_phi_alignments.hpp>
+#include <objects/blast/Blast4_program_info.hpp>
+#include <objects/blast/Blast4_queries.hpp>
+#include <objects/blast/Blast4_queue_search_reply.hpp>
+#include <objects/blast/Blast4_queue_search_reques.hpp>
+#include <objects/blast/Blast4_range.hpp>
+#include <objects/blast/Blast4_reply.hpp>
+#include <objects/blast/Blast4_reply_body.hpp>
+#include <objects/blast/Blast4_request.hpp>
+#include <objects/blast/Blast4_request_body.hpp>
+#include <objects/blast/Blast4_seq_part_data.hpp>
+#include <objects/blast/Blast4_simple_alignment.hpp>
+#include <objects/blast/Blast4_simple_results.hpp>
+#include <objects/blast/Blast4_subject.hpp>
+#include <objects/blast/Blast4_task_info.hpp>
+#include <objects/blast/Blast4_value.hpp>
+#include <objects/blast/Blast_finish_params_reques.hpp>
+#include <objects/blast/Blast_get_databa_ex_reques.hpp>
+#include <objects/blast/Blast_get_reque_info_reply.hpp>
+#include <objects/blast/Blast_get_reque_info_reque.hpp>
+#include <objects/blast/Blast_get_searc_info_reply.hpp>
+#include <objects/blast/Blast_get_searc_info_reque.hpp>
+#include <objects/blast/Blast_get_seq_parts_reques.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+void NCBI_Blast4_RegisterModuleClasses(void)
+{
+    ncbi::objects::CBlast4_get_search_results_reply::GetTypeInfo();
+    ncbi::objects::CBlast4_get_search_results_request::GetTypeInfo();
+    ncbi::objects::CBlast4_get_search_status_reply::GetTypeInfo();
+    ncbi::objects::CBlast4_get_search_status_request::GetTypeInfo();
+    ncbi::objects::CBlast4_get_search_strategy_request::GetTypeInfo();
+    ncbi::objects::CBlast4_get_windowmasked_taxids_reply::GetTypeInfo();
+    ncbi::objects::CBlast4_alignments_for_query::GetTypeInfo();
+    ncbi::objects::CBlast4_archive::GetTypeInfo();
+    ncbi::objects::CBlast4_cutoff::GetTypeInfo();
+    ncbi::objects::CBlast4_database::GetTypeInfo();
+    ncbi::objects::CBlast4_database_info::GetTypeInfo();
+    ncbi::objects::CBlast4_error::GetTypeInfo();
+    ncbi::objects::CBlast4_get_databases_ex_reply::GetTypeInfo();
+    ncbi::objects::CBlast4_get_databases_reply::GetTypeInfo();
+    ncbi::objects::CBlast4_get_matrices_reply::GetTypeInfo();
+    ncbi::objects::CBlast4_get_parameters_reply::GetTypeInfo();
+    ncbi::objects::CBlast4_get_paramsets_reply::GetTypeInfo();
+    ncbi::objects::CBlast4_get_programs_reply::GetTypeInfo();
+    ncbi::objects::CBlast4_get_queries_reply::GetTypeInfo();
+    ncbi::objects::CBlast4_get_seq_parts_reply::GetTypeInfo();
+    ncbi::objects::CBlast4_get_sequences_request::GetTypeInfo();
+    ncbi::objects::CBlast4_get_sequences_reply::GetTypeInfo();
+    ncbi::objects::CBlast4_ka_block::GetTypeInfo();
+    ncbi::objects::CBlast4_mask::GetTypeInfo();
+    ncbi::objects::CBlast4_matrix_id::GetTypeInfo();
+    ncbi::objects::CBlast4_parameter::GetTypeInfo();
+    ncbi::objects::CBlast4_parameter_info::GetTypeInfo();
+    ncbi::objects::CBlast4_parameters::GetTypeInfo();
+    ncbi::objects::CBlast4_phi_alignments::GetTypeInfo();
+    ncbi::objects::CBlast4_program_info::GetTypeInfo();
+    ncbi::objects::CBlast4_queries::GetTypeInfo();
+    ncbi::objects::CBlast4_queue_search_reply::GetTypeInfo();
+    ncbi::objects::CBlast4_queue_search_request::GetTypeInfo();
+    ncbi::objects::CBlast4_range::GetTypeInfo();
+    ncbi::objects::CBlast4_reply::GetTypeInfo();
+    ncbi::objects::CBlast4_reply_body::GetTypeInfo();
+    ncbi::objects::CBlast4_request::GetTypeInfo();
+    ncbi::objects::CBlast4_request_body::GetTypeInfo();
+    ncbi::objects::CBlast4_seq_part_data::GetTypeInfo();
+    ncbi::objects::CBlast4_simple_alignment::GetTypeInfo();
+    ncbi::objects::CBlast4_simple_results::GetTypeInfo();
+    ncbi::objects::CBlast4_subject::GetTypeInfo();
+    ncbi::objects::CBlast4_task_info::GetTypeInfo();
+    ncbi::objects::CBlast4_value::GetTypeInfo();
+    ncbi::objects::CBlast4_finish_params_request::GetTypeInfo();
+    ncbi::objects::CBlast4_get_databases_ex_request::GetTypeInfo();
+    ncbi::objects::CBlast4_get_request_info_reply::GetTypeInfo();
+    ncbi::objects::CBlast4_get_request_info_request::GetTypeInfo();
+    ncbi::objects::CBlast4_get_search_info_reply::GetTypeInfo();
+    ncbi::objects::CBlast4_get_search_info_request::GetTypeInfo();
+    ncbi::objects::CBlast4_get_seq_parts_request::GetTypeInfo();
+}
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
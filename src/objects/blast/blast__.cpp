@@ -0,0 +1,63 @@
+#include <ncbi_pch.hpp>
+#include "Blas_get_searc_resul_reply.cpp"
+#include "Blas_get_searc_resul_reque.cpp"
+#include "Blas_get_searc_statu_reply.cpp"
+#include "Blas_get_searc_statu_reque.cpp"
+#include "Blas_get_searc_strat_reply.cpp"
+#include "Blas_get_searc_strat_reque.cpp"
+#include "Blas_get_windo_taxid_reply.cpp"
+#include "Blast4_alignment_for_query.cpp"
+#include "Blast4_archive.cpp"
+#include "Blast4_cutoff.cpp"
+#include "Blast4_database.cpp"
+#include "Blast4_database_info.cpp"
+#include "Blast4_error.cpp"
+#include "Blast4_error_code.cpp"
+#include "Blast4_error_flags.cpp"
+#include "Blast4_finish_params_reply.cpp"
+#include "Blast4_frame_type.cpp"
+#include "Blast4_get_databa_ex_reply.cpp"
+#include "Blast4_get_databases_reply.cpp"
+#include "Blast4_get_matrices_reply.cpp"
+#include "Blast4_get_parameter_reply.cpp"
+#include "Blast4_get_paramsets_reply.cpp"
+#include "Blast4_get_programs_reply.cpp"
+#include "Blast4_get_queries_reply.cpp"
+#include "Blast4_get_seq_parts_reply.cpp"
+#include "Blast4_get_sequenc_request.cpp"
+#include "Blast4_get_sequences_reply.cpp"
+#include "Blast4_ka_block.cpp"
+#include "Blast4_mask.cpp"
+#include "Blast4_matrix_id.cpp"
+#include "Blast4_parameter.cpp"
+#include "Blast4_parameter_info.cpp"
+#include "Blast4_parameters.cpp"
+#include "Blast4_phi_alignments.cpp"
+#include "Blast4_program_info.cpp"
+#include "Blast4_queries.cpp"
+#include "Blast4_queue_search_reply.cpp"
+#include "Blast4_queue_search_reques.cpp"
+#include "Blast4_range.cpp"
+#include "Blast4_reply.cpp"
+#include "Blast4_reply_body.cpp"
+#include "Blast4_request.cpp"
+#include "Blast4_request_body.cpp"
+#include "Blast4_residue_type.cpp"
+#include "Blast4_result_types.cpp"
+#include "Blast4_seq_part_data.cpp"
+#include "Blast4_seqtech.cpp"
+#include "Blast4_simple_alignment.cpp"
+#include "Blast4_simple_results.cpp"
+#include "Blast4_strand_type.cpp"
+#include "Blast4_subject.cpp"
+#include "Blast4_task_info.cpp"
+#include "Blast4_value.cpp"
+#include "Blast_finish_params_reques.cpp"
+#include "Blast_get_databa_ex_reques.cpp"
+#include "Blast_get_proto_info_reply.cpp"
+#include "Blast_get_proto_info_reque.cpp"
+#include "Blast_get_reque_info_reply.cpp"
+#include "Blast_get_reque_info_reque.cpp"
+#include "Blast_get_searc_info_reply.cpp"
+#include "Blast_get_searc_info_reque.cpp"
+#include "Blast_get_seq_parts_reques.cpp"
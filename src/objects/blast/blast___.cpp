@@ -0,0 +1,64 @@
+#include <ncbi_pch.hpp>
+#include "Blas_get_searc_resul_reply_.cpp"
+#include "Blas_get_searc_resul_reque_.cpp"
+#include "Blas_get_searc_statu_reply_.cpp"
+#include "Blas_get_searc_statu_reque_.cpp"
+#include "Blas_get_searc_strat_reply_.cpp"
+#include "Blas_get_searc_strat_reque_.cpp"
+#include "Blas_get_windo_taxid_reply_.cpp"
+#include "Blast4_alignment_for_query_.cpp"
+#include "Blast4_archive_.cpp"
+#include "Blast4_cutoff_.cpp"
+#include "Blast4_database_.cpp"
+#include "Blast4_database_info_.cpp"
+#include "Blast4_error_.cpp"
+#include "Blast4_error_code_.cpp"
+#include "Blast4_error_flags_.cpp"
+#include "Blast4_finish_params_reply_.cpp"
+#include "Blast4_frame_type_.cpp"
+#include "Blast4_get_databa_ex_reply_.cpp"
+#include "Blast4_get_databases_reply_.cpp"
+#include "Blast4_get_matrices_reply_.cpp"
+#include "Blast4_get_parameter_reply_.cpp"
+#include "Blast4_get_paramsets_reply_.cpp"
+#include "Blast4_get_programs_reply_.cpp"
+#include "Blast4_get_queries_reply_.cpp"
+#include "Blast4_get_seq_parts_reply_.cpp"
+#include "Blast4_get_sequenc_request_.cpp"
+#include "Blast4_get_sequences_reply_.cpp"
+#include "Blast4_ka_block_.cpp"
+#include "Blast4_mask_.cpp"
+#include "Blast4_matrix_id_.cpp"
+#include "Blast4_parameter_.cpp"
+#include "Blast4_parameter_info_.cpp"
+#include "Blast4_parameters_.cpp"
+#include "Blast4_phi_alignments_.cpp"
+#include "Blast4_program_info_.cpp"
+#include "Blast4_queries_.cpp"
+#include "Blast4_queue_search_reply_.cpp"
+#include "Blast4_queue_search_reques_.cpp"
+#include "Blast4_range_.cpp"
+#include "Blast4_reply_.cpp"
+#include "Blast4_reply_body_.cpp"
+#include "Blast4_request_.cpp"
+#include "Blast4_request_body_.cpp"
+#include "Blast4_residue_type_.cpp"
+#include "Blast4_result_types_.cpp"
+#include "Blast4_seq_part_data_.cpp"
+#include "Blast4_seqtech_.cpp"
+#include "Blast4_simple_alignment_.cpp"
+#include "Blast4_simple_results_.cpp"
+#include "Blast4_strand_type_.cpp"
+#include "Blast4_subject_.cpp"
+#include "Blast4_task_info_.cpp"
+#include "Blast4_value_.cpp"
+#include "Blast_finish_params_reques_.cpp"
+#include "Blast_get_databa_ex_reques_.cpp"
+#include "Blast_get_proto_info_reply_.cpp"
+#include "Blast_get_proto_info_reque_.cpp"
+#include "Blast_get_reque_info_reply_.cpp"
+#include "Blast_get_reque_info_reque_.cpp"
+#include "Blast_get_searc_info_reply_.cpp"
+#include "Blast_get_searc_info_reque_.cpp"
+#include "Blast_get_seq_parts_reques_.cpp"
+#include "NCBI_Blast4_module.cpp"
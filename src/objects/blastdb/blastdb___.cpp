@@ -0,0 +1,8 @@
+#include <ncbi_pch.hpp>
+#include "Blast_db_mask_info_.cpp"
+#include "Blast_db_metadata_.cpp"
+#include "Blast_def_line_.cpp"
+#include "Blast_def_line_set_.cpp"
+#include "Blast_filter_program_.cpp"
+#include "Blast_mask_list_.cpp"
+#include "NCBI_BlastDL_module.cpp"
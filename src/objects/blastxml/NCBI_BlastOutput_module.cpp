@@ -0,0 +1,64 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'blastxml.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objects/blastxml/NCBI_BlastOutput_module.hpp>
+#include <objects/blastxml/BlastOutput.hpp>
+#include <objects/blastxml/Hit.hpp>
+#include <objects/blastxml/Hsp.hpp>
+#include <objects/blastxml/Iteration.hpp>
+#include <objects/blastxml/Parameters.hpp>
+#include <objects/blastxml/Statistics.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+void NCBI_BlastOutput_RegisterModuleClasses(void)
+{
+    ncbi::objects::CBlastOutput::GetTypeInfo();
+    ncbi::objects::CHit::GetTypeInfo();
+    ncbi::objects::CHsp::GetTypeInfo();
+    ncbi::objects::CIteration::GetTypeInfo();
+    ncbi::objects::CParameters::GetTypeInfo();
+    ncbi::objects::CStatistics::GetTypeInfo();
+}
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,8 @@
+#include <ncbi_pch.hpp>
+#include "BlastOutput_.cpp"
+#include "Hit_.cpp"
+#include "Hsp_.cpp"
+#include "Iteration_.cpp"
+#include "Parameters_.cpp"
+#include "Statistics_.cpp"
+#include "NCBI_BlastOutput_module.cpp"
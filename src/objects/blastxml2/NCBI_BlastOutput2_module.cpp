@@ -0,0 +1,84 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'blastxml2.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objects/blastxml2/NCBI_BlastOutput2_module.hpp>
+#include <objects/blastxml2/BlastOutput2.hpp>
+#include <objects/blastxml2/BlastXML2.hpp>
+#include <objects/blastxml2/Err.hpp>
+#include <objects/blastxml2/Hit.hpp>
+#include <objects/blastxml2/HitDescr.hpp>
+#include <objects/blastxml2/Hsp.hpp>
+#include <objects/blastxml2/Iteration.hpp>
+#include <objects/blastxml2/Parameters.hpp>
+#include <objects/blastxml2/Range.hpp>
+#include <objects/blastxml2/Report.hpp>
+#include <objects/blastxml2/Results.hpp>
+#include <objects/blastxml2/Search.hpp>
+#include <objects/blastxml2/Statistics.hpp>
+#include <objects/blastxml2/Target.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+BEGIN_blastxml2_SCOPE // namespace ncbi::objects::blastxml2::
+
+void NCBI_BlastOutput2_RegisterModuleClasses(void)
+{
+    ncbi::objects::blastxml2::CBlastOutput2::GetTypeInfo();
+    ncbi::objects::blastxml2::CBlastXML2::GetTypeInfo();
+    ncbi::objects::blastxml2::CErr::GetTypeInfo();
+    ncbi::objects::blastxml2::CHit::GetTypeInfo();
+    ncbi::objects::blastxml2::CHitDescr::GetTypeInfo();
+    ncbi::objects::blastxml2::CHsp::GetTypeInfo();
+    ncbi::objects::blastxml2::CIteration::GetTypeInfo();
+    ncbi::objects::blastxml2::CParameters::GetTypeInfo();
+    ncbi::objects::blastxml2::CRange::GetTypeInfo();
+    ncbi::objects::blastxml2::CReport::GetTypeInfo();
+    ncbi::objects::blastxml2::CResults::GetTypeInfo();
+    ncbi::objects::blastxml2::CSearch::GetTypeInfo();
+    ncbi::objects::blastxml2::CStatistics::GetTypeInfo();
+    ncbi::objects::blastxml2::CTarget::GetTypeInfo();
+}
+
+END_blastxml2_SCOPE // namespace ncbi::objects::blastxml2::
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,78 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'gbseq.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objects/gbseq/NCBI_GBSeq_module.hpp>
+#include <objects/gbseq/GBAltSeqData.hpp>
+#include <objects/gbseq/GBAltSeqItem.hpp>
+#include <objects/gbseq/GBComment.hpp>
+#include <objects/gbseq/GBFeature.hpp>
+#include <objects/gbseq/GBFeatureSet.hpp>
+#include <objects/gbseq/GBInterval.hpp>
+#include <objects/gbseq/GBQualifier.hpp>
+#include <objects/gbseq/GBReference.hpp>
+#include <objects/gbseq/GBSeq.hpp>
+#include <objects/gbseq/GBSet.hpp>
+#include <objects/gbseq/GBStrucComment.hpp>
+#include <objects/gbseq/GBStrucCommentItem.hpp>
+#include <objects/gbseq/GBXref.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+void NCBI_GBSeq_RegisterModuleClasses(void)
+{
+    ncbi::objects::CGBAltSeqData::GetTypeInfo();
+    ncbi::objects::CGBAltSeqItem::GetTypeInfo();
+    ncbi::objects::CGBComment::GetTypeInfo();
+    ncbi::objects::CGBFeature::GetTypeInfo();
+    ncbi::objects::CGBFeatureSet::GetTypeInfo();
+    ncbi::objects::CGBInterval::GetTypeInfo();
+    ncbi::objects::CGBQualifier::GetTypeInfo();
+    ncbi::objects::CGBReference::GetTypeInfo();
+    ncbi::objects::CGBSeq::GetTypeInfo();
+    ncbi::objects::CGBSet::GetTypeInfo();
+    ncbi::objects::CGBStrucComment::GetTypeInfo();
+    ncbi::objects::CGBStrucCommentItem::GetTypeInfo();
+    ncbi::objects::CGBXref::GetTypeInfo();
+}
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
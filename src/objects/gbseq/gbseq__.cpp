@@ -0,0 +1,19 @@
+#include <ncbi_pch.hpp>
+#include "GBAltSeqData.cpp"
+#include "GBAltSeqItem.cpp"
+#include "GBAuthor.cpp"
+#include "GBComment.cpp"
+#include "GBCommentParagraph.cpp"
+#include "GBFeature.cpp"
+#include "GBFeatureSet.cpp"
+#include "GBInterval.cpp"
+#include "GBKeyword.cpp"
+#include "GBQualifier.cpp"
+#include "GBReference.cpp"
+#include "GBSecondary_accn.cpp"
+#include "GBSeq.cpp"
+#include "GBSeqid.cpp"
+#include "GBSet.cpp"
+#include "GBStrucComment.cpp"
+#include "GBStrucCommentItem.cpp"
+#include "GBXref.cpp"
@@ -0,0 +1,20 @@
+#include <ncbi_pch.hpp>
+#include "GBAltSeqData_.cpp"
+#include "GBAltSeqItem_.cpp"
+#include "GBAuthor_.cpp"
+#include "GBComment_.cpp"
+#include "GBCommentParagraph_.cpp"
+#include "GBFeature_.cpp"
+#include "GBFeatureSet_.cpp"
+#include "GBInterval_.cpp"
+#include "GBKeyword_.cpp"
+#include "GBQualifier_.cpp"
+#include "GBReference_.cpp"
+#include "GBSecondary_accn_.cpp"
+#include "GBSeq_.cpp"
+#include "GBSeqid_.cpp"
+#include "GBSet_.cpp"
+#include "GBStrucComment_.cpp"
+#include "GBStrucCommentItem_.cpp"
+#include "GBXref_.cpp"
+#include "NCBI_GBSeq_module.cpp"
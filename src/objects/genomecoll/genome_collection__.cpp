@@ -0,0 +1,20 @@
+#include <ncbi_pch.hpp>
+#include "GC_Assemblies.cpp"
+#include "GC_Assembly.cpp"
+#include "GC_AssemblyDesc.cpp"
+#include "GC_AssemblySet.cpp"
+#include "GC_AssemblyUnit.cpp"
+#include "GC_DbTagAlias.cpp"
+#include "GC_External_Seqid.cpp"
+#include "GC_Genome.cpp"
+#include "GC_GenomicPart.cpp"
+#include "GC_Project.cpp"
+#include "GC_Query.cpp"
+#include "GC_Replicon.cpp"
+#include "GC_Scaf_stats.cpp"
+#include "GC_SeqIdAlias.cpp"
+#include "GC_Sequence.cpp"
+#include "GC_SequenceRole.cpp"
+#include "GC_SequenceStats.cpp"
+#include "GC_TaggedSequences.cpp"
+#include "GC_TypedSeqId.cpp"
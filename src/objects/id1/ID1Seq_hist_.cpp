@@ -0,0 +1,99 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'id1.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/id1/ID1Seq_hist.hpp>
+#include <objects/seq/Seq_hist.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CID1Seq_hist_Base::ResetHist(void)
+{
+    if ( !m_Hist ) {
+        m_Hist.Reset(new THist());
+        return;
+    }
+    (*m_Hist).Reset();
+}
+
+void CID1Seq_hist_Base::SetHist(CID1Seq_hist_Base::THist& value)
+{
+    m_Hist.Reset(&value);
+}
+
+void CID1Seq_hist_Base::Reset(void)
+{
+    ResetHist();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("ID1Seq-hist", CID1Seq_hist)
+{
+    SET_CLASS_MODULE("NCBI-ID1Access");
+    ADD_NAMED_REF_MEMBER("hist", m_Hist, CSeq_hist);
+    info->RandomOrder();
+    info->CodeVersion(22100);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CID1Seq_hist_Base::CID1Seq_hist_Base(void)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+    if ( !IsAllocatedInPool() ) {
+        ResetHist();
+    }
+}
+
+// destructor
+CID1Seq_hist_Base::~CID1Seq_hist_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
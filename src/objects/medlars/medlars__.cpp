@@ -0,0 +1,3 @@
+#include <ncbi_pch.hpp>
+#include "Medlars_entry.cpp"
+#include "Medlars_record.cpp"
@@ -0,0 +1,4 @@
+#include <ncbi_pch.hpp>
+#include "Medlars_entry_.cpp"
+#include "Medlars_record_.cpp"
+#include "NCBI_Medlars_module.cpp"
@@ -0,0 +1,9 @@
+#include <ncbi_pch.hpp>
+#include "DocRef_.cpp"
+#include "Medline_entry_.cpp"
+#include "Medline_field_.cpp"
+#include "Medline_mesh_.cpp"
+#include "Medline_qual_.cpp"
+#include "Medline_rn_.cpp"
+#include "Medline_si_.cpp"
+#include "NCBI_Medline_module.cpp"
@@ -0,0 +1,71 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'mla.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/mla/Error_val.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+BEGIN_NAMED_ENUM_INFO("Error-val", EError_val, false)
+{
+    SET_ENUM_MODULE("NCBI-MedArchive");
+    ADD_ENUM_VALUE("not-found", eError_val_not_found);
+    ADD_ENUM_VALUE("operational-error", eError_val_operational_error);
+    ADD_ENUM_VALUE("cannot-connect-jrsrv", eError_val_cannot_connect_jrsrv);
+    ADD_ENUM_VALUE("cannot-connect-pmdb", eError_val_cannot_connect_pmdb);
+    ADD_ENUM_VALUE("journal-not-found", eError_val_journal_not_found);
+    ADD_ENUM_VALUE("citation-not-found", eError_val_citation_not_found);
+    ADD_ENUM_VALUE("citation-ambiguous", eError_val_citation_ambiguous);
+    ADD_ENUM_VALUE("citation-too-many", eError_val_citation_too_many);
+    ADD_ENUM_VALUE("cannot-connect-searchbackend-jrsrv", eError_val_cannot_connect_searchbackend_jrsrv);
+    ADD_ENUM_VALUE("cannot-connect-searchbackend-pmdb", eError_val_cannot_connect_searchbackend_pmdb);
+    ADD_ENUM_VALUE("cannot-connect-docsumbackend", eError_val_cannot_connect_docsumbackend);
+}
+END_ENUM_INFO
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,7 @@
+#include <ncbi_pch.hpp>
+#include "Error_val.cpp"
+#include "Mla_back.cpp"
+#include "Mla_request.cpp"
+#include "Title_msg.cpp"
+#include "Title_msg_list.cpp"
+#include "Title_type.cpp"
@@ -0,0 +1,108 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'scoremat.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/scoremat/BlockProperty.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+BEGIN_NAMED_ENUM_IN_INFO("", CBlockProperty_Base::, EType, true)
+{
+    SET_ENUM_INTERNAL_NAME("BlockProperty", "type");
+    SET_ENUM_MODULE("NCBI-ScoreMat");
+    ADD_ENUM_VALUE("unassigned", eType_unassigned);
+    ADD_ENUM_VALUE("threshold", eType_threshold);
+    ADD_ENUM_VALUE("minscore", eType_minscore);
+    ADD_ENUM_VALUE("maxscore", eType_maxscore);
+    ADD_ENUM_VALUE("meanscore", eType_meanscore);
+    ADD_ENUM_VALUE("variance", eType_variance);
+    ADD_ENUM_VALUE("name", eType_name);
+    ADD_ENUM_VALUE("is-optional", eType_is_optional);
+    ADD_ENUM_VALUE("other", eType_other);
+}
+END_ENUM_INFO
+
+void CBlockProperty_Base::ResetTextvalue(void)
+{
+    m_Textvalue.erase();
+    m_set_State[0] &= ~0x30;
+}
+
+void CBlockProperty_Base::Reset(void)
+{
+    ResetType();
+    ResetIntvalue();
+    ResetTextvalue();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("BlockProperty", CBlockProperty)
+{
+    SET_CLASS_MODULE("NCBI-ScoreMat");
+    ADD_NAMED_ENUM_MEMBER("type", m_Type, EType)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_STD_MEMBER("intvalue", m_Intvalue)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_STD_MEMBER("textvalue", m_Textvalue)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    info->RandomOrder();
+    info->CodeVersion(22100);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CBlockProperty_Base::CBlockProperty_Base(void)
+    : m_Type((EType)(0)), m_Intvalue(0)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CBlockProperty_Base::~CBlockProperty_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,76 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'scoremat.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objects/scoremat/NCBI_ScoreMat_module.hpp>
+#include <objects/scoremat/BlockProperty.hpp>
+#include <objects/scoremat/CoreBlock.hpp>
+#include <objects/scoremat/CoreDef.hpp>
+#include <objects/scoremat/FormatRpsDbParameters.hpp>
+#include <objects/scoremat/LoopConstraint.hpp>
+#include <objects/scoremat/Pssm.hpp>
+#include <objects/scoremat/PssmFinalData.hpp>
+#include <objects/scoremat/PssmIntermediateData.hpp>
+#include <objects/scoremat/PssmParameters.hpp>
+#include <objects/scoremat/PssmWithParameters.hpp>
+#include <objects/scoremat/Site_annot.hpp>
+#include <objects/scoremat/Site_annot_set.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+void NCBI_ScoreMat_RegisterModuleClasses(void)
+{
+    ncbi::objects::CBlockProperty::GetTypeInfo();
+    ncbi::objects::CCoreBlock::GetTypeInfo();
+    ncbi::objects::CCoreDef::GetTypeInfo();
+    ncbi::objects::CFormatRpsDbParameters::GetTypeInfo();
+    ncbi::objects::CLoopConstraint::GetTypeInfo();
+    ncbi::objects::CPssm::GetTypeInfo();
+    ncbi::objects::CPssmFinalData::GetTypeInfo();
+    ncbi::objects::CPssmIntermediateData::GetTypeInfo();
+    ncbi::objects::CPssmParameters::GetTypeInfo();
+    ncbi::objects::CPssmWithParameters::GetTypeInfo();
+    ncbi::objects::CSite_annot::GetTypeInfo();
+    ncbi::objects::CSite_annot_set::GetTypeInfo();
+}
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
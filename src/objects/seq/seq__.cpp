@@ -0,0 +1,44 @@
+#include <ncbi_pch.hpp>
+#include "Align_def.cpp"
+#include "Annot_descr.cpp"
+#include "Annot_id.cpp"
+#include "Annotdesc.cpp"
+#include "Bioseq.cpp"
+#include "Delta_ext.cpp"
+#include "Delta_seq.cpp"
+#include "GIBB_method.cpp"
+#include "GIBB_mod.cpp"
+#include "GIBB_mol.cpp"
+#include "Heterogen.cpp"
+#include "IUPACaa.cpp"
+#include "IUPACna.cpp"
+#include "Linkage_evidence.cpp"
+#include "Map_ext.cpp"
+#include "MolInfo.cpp"
+#include "NCBI2na.cpp"
+#include "NCBI4na.cpp"
+#include "NCBI8aa.cpp"
+#include "NCBI8na.cpp"
+#include "NCBIeaa.cpp"
+#include "NCBIpaa.cpp"
+#include "NCBIpna.cpp"
+#include "NCBIstdaa.cpp"
+#include "Num_cont.cpp"
+#include "Num_enum.cpp"
+#include "Num_real.cpp"
+#include "Num_ref.cpp"
+#include "Numbering.cpp"
+#include "Pubdesc.cpp"
+#include "Ref_ext.cpp"
+#include "Seg_ext.cpp"
+#include "Seq_annot.cpp"
+#include "Seq_data.cpp"
+#include "Seq_descr.cpp"
+#include "Seq_ext.cpp"
+#include "Seq_gap.cpp"
+#include "Seq_hist.cpp"
+#include "Seq_hist_rec.cpp"
+#include "Seq_inst.cpp"
+#include "Seq_literal.cpp"
+#include "Seqdesc.cpp"
+#include "Textannot_id.cpp"
@@ -0,0 +1,88 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'seqalign.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objects/seqalign/NCBI_Seqalign_module.hpp>
+#include <objects/seqalign/Dense_diag.hpp>
+#include <objects/seqalign/Dense_seg.hpp>
+#include <objects/seqalign/Packed_seg.hpp>
+#include <objects/seqalign/Product_pos.hpp>
+#include <objects/seqalign/Prot_pos.hpp>
+#include <objects/seqalign/Score.hpp>
+#include <objects/seqalign/Score_set.hpp>
+#include <objects/seqalign/Seq_align.hpp>
+#include <objects/seqalign/Seq_align_set.hpp>
+#include <objects/seqalign/Sparse_align.hpp>
+#include <objects/seqalign/Sparse_seg.hpp>
+#include <objects/seqalign/Sparse_seg_ext.hpp>
+#include <objects/seqalign/Splice_site.hpp>
+#include <objects/seqalign/Spliced_exon.hpp>
+#include <objects/seqalign/Spliced_exon_chunk.hpp>
+#include <objects/seqalign/Spliced_seg.hpp>
+#include <objects/seqalign/Spliced_seg_modifier.hpp>
+#include <objects/seqalign/Std_seg.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+void NCBI_Seqalign_RegisterModuleClasses(void)
+{
+    ncbi::objects::CDense_diag::GetTypeInfo();
+    ncbi::objects::CDense_seg::GetTypeInfo();
+    ncbi::objects::CPacked_seg::GetTypeInfo();
+    ncbi::objects::CProduct_pos::GetTypeInfo();
+    ncbi::objects::CProt_pos::GetTypeInfo();
+    ncbi::objects::CScore::GetTypeInfo();
+    ncbi::objects::CScore_set::GetTypeInfo();
+    ncbi::objects::CSeq_align::GetTypeInfo();
+    ncbi::objects::CSeq_align_set::GetTypeInfo();
+    ncbi::objects::CSparse_align::GetTypeInfo();
+    ncbi::objects::CSparse_seg::GetTypeInfo();
+    ncbi::objects::CSparse_seg_ext::GetTypeInfo();
+    ncbi::objects::CSplice_site::GetTypeInfo();
+    ncbi::objects::CSpliced_exon::GetTypeInfo();
+    ncbi::objects::CSpliced_exon_chunk::GetTypeInfo();
+    ncbi::objects::CSpliced_seg::GetTypeInfo();
+    ncbi::objects::CSpliced_seg_modifier::GetTypeInfo();
+    ncbi::objects::CStd_seg::GetTypeInfo();
+}
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,19 @@
+#include <ncbi_pch.hpp>
+#include "Dense_diag.cpp"
+#include "Dense_seg.cpp"
+#include "Packed_seg.cpp"
+#include "Product_pos.cpp"
+#include "Prot_pos.cpp"
+#include "Score.cpp"
+#include "Score_set.cpp"
+#include "Seq_align.cpp"
+#include "Seq_align_set.cpp"
+#include "Sparse_align.cpp"
+#include "Sparse_seg.cpp"
+#include "Sparse_seg_ext.cpp"
+#include "Splice_site.cpp"
+#include "Spliced_exon.cpp"
+#include "Spliced_exon_chunk.cpp"
+#include "Spliced_seg.cpp"
+#include "Spliced_seg_modifier.cpp"
+#include "Std_seg.cpp"
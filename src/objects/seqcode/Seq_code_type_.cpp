@@ -0,0 +1,71 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'seqcode.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/seqcode/Seq_code_type.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+BEGIN_NAMED_ENUM_INFO("Seq-code-type", ESeq_code_type, false)
+{
+    SET_ENUM_MODULE("NCBI-SeqCode");
+    ADD_ENUM_VALUE("iupacna", eSeq_code_type_iupacna);
+    ADD_ENUM_VALUE("iupacaa", eSeq_code_type_iupacaa);
+    ADD_ENUM_VALUE("ncbi2na", eSeq_code_type_ncbi2na);
+    ADD_ENUM_VALUE("ncbi4na", eSeq_code_type_ncbi4na);
+    ADD_ENUM_VALUE("ncbi8na", eSeq_code_type_ncbi8na);
+    ADD_ENUM_VALUE("ncbipna", eSeq_code_type_ncbipna);
+    ADD_ENUM_VALUE("ncbi8aa", eSeq_code_type_ncbi8aa);
+    ADD_ENUM_VALUE("ncbieaa", eSeq_code_type_ncbieaa);
+    ADD_ENUM_VALUE("ncbipaa", eSeq_code_type_ncbipaa);
+    ADD_ENUM_VALUE("iupacaa3", eSeq_code_type_iupacaa3);
+    ADD_ENUM_VALUE("ncbistdaa", eSeq_code_type_ncbistdaa);
+}
+END_ENUM_INFO
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,98 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'seqedit.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objects/seqedit/NCBI_SeqEdit_module.hpp>
+#include <objects/seqedit/SeqEdit_Cmd.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_AddAnnot.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_AddDesc.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_AddDescr.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_AddId.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_AttachAnnot.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_AttachSeq.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_AttachSeqEntry.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_AttachSet.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_ChangeSeqAttr.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_ChangeSetAttr.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_RemoveAnnot.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_RemoveDesc.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_RemoveId.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_RemoveSeqEntry.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_ReplaceAnnot.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_ResetDescr.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_ResetIds.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_ResetSeqAttr.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_ResetSeqEntry.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_ResetSetAttr.hpp>
+#include <objects/seqedit/SeqEdit_Cmd_SetDescr.hpp>
+#include <objects/seqedit/SeqEdit_Id.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+void NCBI_SeqEdit_RegisterModuleClasses(void)
+{
+    ncbi::objects::CSeqEdit_Cmd::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Cmd_AddAnnot::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Cmd_AddDesc::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Cmd_AddDescr::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Cmd_AddId::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Cmd_AttachAnnot::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Cmd_AttachSeq::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Cmd_AttachSeqEntry::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Cmd_AttachSet::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Cmd_ChangeSeqAttr::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Cmd_ChangeSetAttr::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Cmd_RemoveAnnot::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Cmd_RemoveDesc::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Cmd_RemoveId::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Cmd_RemoveSeqEntry::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Cmd_ReplaceAnnot::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Cmd_ResetDescr::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Cmd_ResetIds::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Cmd_ResetSeqAttr::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Cmd_ResetSeqEntry::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Cmd_ResetSetAttr::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Cmd_SetDescr::GetTypeInfo();
+    ncbi::objects::CSeqEdit_Id::GetTypeInfo();
+}
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,120 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'seqedit.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/seqedit/SeqEdit_Cmd_ResetSeqAttr.hpp>
+#include <objects/seqedit/SeqEdit_Id.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+BEGIN_NAMED_ENUM_IN_INFO("", CSeqEdit_Cmd_ResetSeqAttr_Base::, EWhat, false)
+{
+    SET_ENUM_INTERNAL_NAME("SeqEdit-Cmd-ResetSeqAttr", "what");
+    SET_ENUM_MODULE("NCBI-SeqEdit");
+    ADD_ENUM_VALUE("not-set", eWhat_not_set);
+    ADD_ENUM_VALUE("inst", eWhat_inst);
+    ADD_ENUM_VALUE("repr", eWhat_repr);
+    ADD_ENUM_VALUE("mol", eWhat_mol);
+    ADD_ENUM_VALUE("length", eWhat_length);
+    ADD_ENUM_VALUE("fuzz", eWhat_fuzz);
+    ADD_ENUM_VALUE("topology", eWhat_topology);
+    ADD_ENUM_VALUE("strand", eWhat_strand);
+    ADD_ENUM_VALUE("ext", eWhat_ext);
+    ADD_ENUM_VALUE("hist", eWhat_hist);
+    ADD_ENUM_VALUE("seq-data", eWhat_seq_data);
+}
+END_ENUM_INFO
+
+void CSeqEdit_Cmd_ResetSeqAttr_Base::ResetId(void)
+{
+    if ( !m_Id ) {
+        m_Id.Reset(new TId());
+        return;
+    }
+    (*m_Id).Reset();
+}
+
+void CSeqEdit_Cmd_ResetSeqAttr_Base::SetId(CSeqEdit_Cmd_ResetSeqAttr_Base::TId& value)
+{
+    m_Id.Reset(&value);
+}
+
+void CSeqEdit_Cmd_ResetSeqAttr_Base::Reset(void)
+{
+    ResetId();
+    ResetWhat();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("SeqEdit-Cmd-ResetSeqAttr", CSeqEdit_Cmd_ResetSeqAttr)
+{
+    SET_CLASS_MODULE("NCBI-SeqEdit");
+    ADD_NAMED_REF_MEMBER("id", m_Id, CSeqEdit_Id);
+    ADD_NAMED_ENUM_MEMBER("what", m_What, EWhat)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    info->RandomOrder();
+    info->CodeVersion(22100);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CSeqEdit_Cmd_ResetSeqAttr_Base::CSeqEdit_Cmd_ResetSeqAttr_Base(void)
+    : m_What((EWhat)(0))
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+    if ( !IsAllocatedInPool() ) {
+        ResetId();
+    }
+}
+
+// destructor
+CSeqEdit_Cmd_ResetSeqAttr_Base::~CSeqEdit_Cmd_ResetSeqAttr_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
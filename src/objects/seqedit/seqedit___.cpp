@@ -0,0 +1,25 @@
+#include <ncbi_pch.hpp>
+#include "SeqEdit_Cmd_.cpp"
+#include "SeqEdit_Cmd_AddAnnot_.cpp"
+#include "SeqEdit_Cmd_AddDesc_.cpp"
+#include "SeqEdit_Cmd_AddDescr_.cpp"
+#include "SeqEdit_Cmd_AddId_.cpp"
+#include "SeqEdit_Cmd_AttachAnnot_.cpp"
+#include "SeqEdit_Cmd_AttachSeq_.cpp"
+#include "SeqEdit_Cmd_AttachSeqEntry_.cpp"
+#include "SeqEdit_Cmd_AttachSet_.cpp"
+#include "SeqEdit_Cmd_ChangeSeqAttr_.cpp"
+#include "SeqEdit_Cmd_ChangeSetAttr_.cpp"
+#include "SeqEdit_Cmd_RemoveAnnot_.cpp"
+#include "SeqEdit_Cmd_RemoveDesc_.cpp"
+#include "SeqEdit_Cmd_RemoveId_.cpp"
+#include "SeqEdit_Cmd_RemoveSeqEntry_.cpp"
+#include "SeqEdit_Cmd_ReplaceAnnot_.cpp"
+#include "SeqEdit_Cmd_ResetDescr_.cpp"
+#include "SeqEdit_Cmd_ResetIds_.cpp"
+#include "SeqEdit_Cmd_ResetSeqAttr_.cpp"
+#include "SeqEdit_Cmd_ResetSeqEntry_.cpp"
+#include "SeqEdit_Cmd_ResetSetAttr_.cpp"
+#include "SeqEdit_Cmd_SetDescr_.cpp"
+#include "SeqEdit_Id_.cpp"
+#include "NCBI_SeqEdit_module.cpp"
@@ -0,0 +1,55 @@
+#include <ncbi_pch.hpp>
+#include "BinomialOrgName.cpp"
+#include "BioSource.cpp"
+#include "Cdregion.cpp"
+#include "Clone_ref.cpp"
+#include "Clone_seq.cpp"
+#include "Clone_seq_set.cpp"
+#include "Code_break.cpp"
+#include "Delta_item.cpp"
+#include "EvidenceBasis.cpp"
+#include "EvidenceCategory.cpp"
+#include "ExperimentSupport.cpp"
+#include "Ext_loc.cpp"
+#include "Feat_id.cpp"
+#include "Gb_qual.cpp"
+#include "Gene_nomenclature.cpp"
+#include "Gene_ref.cpp"
+#include "Genetic_code.cpp"
+#include "Genetic_code_table.cpp"
+#include "Imp_feat.cpp"
+#include "InferenceSupport.cpp"
+#include "ModelEvidenceItem.cpp"
+#include "ModelEvidenceSupport.cpp"
+#include "MultiOrgName.cpp"
+#include "OrgMod.cpp"
+#include "OrgName.cpp"
+#include "Org_ref.cpp"
+#include "PCRPrimer.cpp"
+#include "PCRPrimerName.cpp"
+#include "PCRPrimerSeq.cpp"
+#include "PCRPrimerSet.cpp"
+#include "PCRReaction.cpp"
+#include "PCRReactionSet.cpp"
+#include "PartialOrgName.cpp"
+#include "Phenotype.cpp"
+#include "Population_data.cpp"
+#include "Program_id.cpp"
+#include "Prot_ref.cpp"
+#include "RNA_gen.cpp"
+#include "RNA_qual.cpp"
+#include "RNA_qual_set.cpp"
+#include "RNA_ref.cpp"
+#include "Rsite_ref.cpp"
+#include "SeqFeatData.cpp"
+#include "SeqFeatSupport.cpp"
+#include "SeqFeatXref.cpp"
+#include "Seq_feat.cpp"
+#include "SubSource.cpp"
+#include "TaxElement.cpp"
+#include "Trna_ext.cpp"
+#include "Tx_evidence.cpp"
+#include "Txinit.cpp"
+#include "VariantProperties.cpp"
+#include "Variation_inst.cpp"
+#include "Variation_ref.cpp"
@@ -0,0 +1,64 @@
+#include <ncbi_pch.hpp>
+#include "BinomialOrgName_.cpp"
+#include "BioSource_.cpp"
+#include "Cdregion_.cpp"
+#include "Clone_ref_.cpp"
+#include "Clone_seq_.cpp"
+#include "Clone_seq_set_.cpp"
+#include "Code_break_.cpp"
+#include "Delta_item_.cpp"
+#include "EvidenceBasis_.cpp"
+#include "EvidenceCategory_.cpp"
+#include "ExperimentSupport_.cpp"
+#include "Ext_loc_.cpp"
+#include "Feat_id_.cpp"
+#include "Gb_qual_.cpp"
+#include "Gene_nomenclature_.cpp"
+#include "Gene_ref_.cpp"
+#include "Genetic_code_.cpp"
+#include "Genetic_code_table_.cpp"
+#include "Imp_feat_.cpp"
+#include "InferenceSupport_.cpp"
+#include "ModelEvidenceItem_.cpp"
+#include "ModelEvidenceSupport_.cpp"
+#include "MultiOrgName_.cpp"
+#include "OrgMod_.cpp"
+#include "OrgName_.cpp"
+#include "Org_ref_.cpp"
+#include "PCRPrimer_.cpp"
+#include "PCRPrimerName_.cpp"
+#include "PCRPrimerSeq_.cpp"
+#include "PCRPrimerSet_.cpp"
+#include "PCRReaction_.cpp"
+#include "PCRReactionSet_.cpp"
+#include "PartialOrgName_.cpp"
+#include "Phenotype_.cpp"
+#include "Population_data_.cpp"
+#include "Program_id_.cpp"
+#include "Prot_ref_.cpp"
+#include "RNA_gen_.cpp"
+#include "RNA_qual_.cpp"
+#include "RNA_qual_set_.cpp"
+#include "RNA_ref_.cpp"
+#include "Rsite_ref_.cpp"
+#include "SeqFeatData_.cpp"
+#include "SeqFeatSupport_.cpp"
+#include "SeqFeatXref_.cpp"
+#include "Seq_feat_.cpp"
+#include "SubSource_.cpp"
+#include "TaxElement_.cpp"
+#include "Trna_ext_.cpp"
+#include "Tx_evidence_.cpp"
+#include "Txinit_.cpp"
+#include "VariantProperties_.cpp"
+#include "Variation_inst_.cpp"
+#include "Variation_ref_.cpp"
+#include "NCBI_Organism_module.cpp"
+#include "NCBI_BioSource_module.cpp"
+#include "NCBI_Seqfeat_module.cpp"
+#include "NCBI_Variation_module.cpp"
+#include "NCBI_Gene_module.cpp"
+#include "NCBI_Protein_module.cpp"
+#include "NCBI_RNA_module.cpp"
+#include "NCBI_Rsite_module.cpp"
+#include "NCBI_TxInit_module.cpp"
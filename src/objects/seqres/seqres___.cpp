@@ -0,0 +1,6 @@
+#include <ncbi_pch.hpp>
+#include "Byte_graph_.cpp"
+#include "Int_graph_.cpp"
+#include "Real_graph_.cpp"
+#include "Seq_graph_.cpp"
+#include "NCBI_Seqres_module.cpp"
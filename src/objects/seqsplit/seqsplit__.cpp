@@ -0,0 +1,28 @@
+#include <ncbi_pch.hpp>
+#include "ID2S_Bioseq_Ids.cpp"
+#include "ID2S_Bioseq_Info.cpp"
+#include "ID2S_Bioseq_place_Info.cpp"
+#include "ID2S_Bioseq_set_Ids.cpp"
+#include "ID2S_Bioseqs_Info.cpp"
+#include "ID2S_Chunk.cpp"
+#include "ID2S_Chunk_Content.cpp"
+#include "ID2S_Chunk_Data.cpp"
+#include "ID2S_Chunk_Id.cpp"
+#include "ID2S_Chunk_Info.cpp"
+#include "ID2S_Feat_type_Info.cpp"
+#include "ID2S_Gi_Interval.cpp"
+#include "ID2S_Gi_Ints.cpp"
+#include "ID2S_Gi_Range.cpp"
+#include "ID2S_Interval.cpp"
+#include "ID2S_Seq_annot_Info.cpp"
+#include "ID2S_Seq_annot_place_Info.cpp"
+#include "ID2S_Seq_assembly_Info.cpp"
+#include "ID2S_Seq_data_Info.cpp"
+#include "ID2S_Seq_descr_Info.cpp"
+#include "ID2S_Seq_feat_Ids_Info.cpp"
+#include "ID2S_Seq_id_Interval.cpp"
+#include "ID2S_Seq_id_Ints.cpp"
+#include "ID2S_Seq_loc.cpp"
+#include "ID2S_Seq_map_Info.cpp"
+#include "ID2S_Sequence_Piece.cpp"
+#include "ID2S_Split_Info.cpp"
@@ -0,0 +1,29 @@
+#include <ncbi_pch.hpp>
+#include "ID2S_Bioseq_Ids_.cpp"
+#include "ID2S_Bioseq_Info_.cpp"
+#include "ID2S_Bioseq_place_Info_.cpp"
+#include "ID2S_Bioseq_set_Ids_.cpp"
+#include "ID2S_Bioseqs_Info_.cpp"
+#include "ID2S_Chunk_.cpp"
+#include "ID2S_Chunk_Content_.cpp"
+#include "ID2S_Chunk_Data_.cpp"
+#include "ID2S_Chunk_Id_.cpp"
+#include "ID2S_Chunk_Info_.cpp"
+#include "ID2S_Feat_type_Info_.cpp"
+#include "ID2S_Gi_Interval_.cpp"
+#include "ID2S_Gi_Ints_.cpp"
+#include "ID2S_Gi_Range_.cpp"
+#include "ID2S_Interval_.cpp"
+#include "ID2S_Seq_annot_Info_.cpp"
+#include "ID2S_Seq_annot_place_Info_.cpp"
+#include "ID2S_Seq_assembly_Info_.cpp"
+#include "ID2S_Seq_data_Info_.cpp"
+#include "ID2S_Seq_descr_Info_.cpp"
+#include "ID2S_Seq_feat_Ids_Info_.cpp"
+#include "ID2S_Seq_id_Interval_.cpp"
+#include "ID2S_Seq_id_Ints_.cpp"
+#include "ID2S_Seq_loc_.cpp"
+#include "ID2S_Seq_map_Info_.cpp"
+#include "ID2S_Sequence_Piece_.cpp"
+#include "ID2S_Split_Info_.cpp"
+#include "NCBI_Seq_split_module.cpp"
@@ -0,0 +1,74 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'seqtable.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objects/seqtable/NCBI_SeqTable_module.hpp>
+#include <objects/seqtable/BVector_data.hpp>
+#include <objects/seqtable/CommonBytes_table.hpp>
+#include <objects/seqtable/CommonString_table.hpp>
+#include <objects/seqtable/Scaled_int_multi_data.hpp>
+#include <objects/seqtable/Scaled_real_multi_data.hpp>
+#include <objects/seqtable/SeqTable_column.hpp>
+#include <objects/seqtable/SeqTable_column_info.hpp>
+#include <objects/seqtable/SeqTable_multi_data.hpp>
+#include <objects/seqtable/SeqTable_single_data.hpp>
+#include <objects/seqtable/SeqTable_sparse_index.hpp>
+#include <objects/seqtable/Seq_table.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+void NCBI_SeqTable_RegisterModuleClasses(void)
+{
+    ncbi::objects::CBVector_data::GetTypeInfo();
+    ncbi::objects::CCommonBytes_table::GetTypeInfo();
+    ncbi::objects::CCommonString_table::GetTypeInfo();
+    ncbi::objects::CScaled_int_multi_data::GetTypeInfo();
+    ncbi::objects::CScaled_real_multi_data::GetTypeInfo();
+    ncbi::objects::CSeqTable_column::GetTypeInfo();
+    ncbi::objects::CSeqTable_column_info::GetTypeInfo();
+    ncbi::objects::CSeqTable_multi_data::GetTypeInfo();
+    ncbi::objects::CSeqTable_single_data::GetTypeInfo();
+    ncbi::objects::CSeqTable_sparse_index::GetTypeInfo();
+    ncbi::objects::CSeq_table::GetTypeInfo();
+}
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
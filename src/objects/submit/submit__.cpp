@@ -0,0 +1,4 @@
+#include <ncbi_pch.hpp>
+#include "Contact_info.cpp"
+#include "Seq_submit.cpp"
+#include "Submit_block.cpp"
@@ -0,0 +1,112 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'taxon1.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/taxon1/Taxon2_data.hpp>
+#include <objects/seqfeat/Org_ref.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CTaxon2_data_Base::ResetOrg(void)
+{
+    m_Org.Reset();
+}
+
+void CTaxon2_data_Base::SetOrg(CTaxon2_data_Base::TOrg& value)
+{
+    m_Org.Reset(&value);
+}
+
+CTaxon2_data_Base::TOrg& CTaxon2_data_Base::SetOrg(void)
+{
+    if ( !m_Org )
+        m_Org.Reset(new TOrg());
+    return (*m_Org);
+}
+
+void CTaxon2_data_Base::ResetBlast_name(void)
+{
+    m_Blast_name.clear();
+    m_set_State[0] &= ~0xc;
+}
+
+void CTaxon2_data_Base::Reset(void)
+{
+    ResetOrg();
+    ResetBlast_name();
+    ResetIs_uncultured();
+    ResetIs_species_level();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("Taxon2-data", CTaxon2_data)
+{
+    SET_CLASS_MODULE("NCBI-Taxon1");
+    ADD_NAMED_REF_MEMBER("org", m_Org, COrg_ref)->SetOptional();
+    ADD_NAMED_MEMBER("blast-name", m_Blast_name, STL_list, (STD, (string)))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_STD_MEMBER("is-uncultured", m_Is_uncultured)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_STD_MEMBER("is-species-level", m_Is_species_level)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    info->RandomOrder();
+    info->CodeVersion(22100);
+    info->DataSpec(ncbi::EDataSpec::eASN);
+}
+END_CLASS_INFO
+
+// constructor
+CTaxon2_data_Base::CTaxon2_data_Base(void)
+    : m_Is_uncultured(0), m_Is_species_level(0)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CTaxon2_data_Base::~CTaxon2_data_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,70 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'taxon3.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objects/taxon3/NCBI_Taxon3_module.hpp>
+#include <objects/taxon3/SequenceOfInt.hpp>
+#include <objects/taxon3/T3Data.hpp>
+#include <objects/taxon3/T3Error.hpp>
+#include <objects/taxon3/T3RefreshFlags.hpp>
+#include <objects/taxon3/T3Reply.hpp>
+#include <objects/taxon3/T3Request.hpp>
+#include <objects/taxon3/T3StatusFlags.hpp>
+#include <objects/taxon3/Taxon3_reply.hpp>
+#include <objects/taxon3/Taxon3_request.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+void NCBI_Taxon3_RegisterModuleClasses(void)
+{
+    ncbi::objects::CSequenceOfInt::GetTypeInfo();
+    ncbi::objects::CT3Data::GetTypeInfo();
+    ncbi::objects::CT3Error::GetTypeInfo();
+    ncbi::objects::CT3RefreshFlags::GetTypeInfo();
+    ncbi::objects::CT3Reply::GetTypeInfo();
+    ncbi::objects::CT3Request::GetTypeInfo();
+    ncbi::objects::CT3StatusFlags::GetTypeInfo();
+    ncbi::objects::CTaxon3_reply::GetTypeInfo();
+    ncbi::objects::CTaxon3_request::GetTypeInfo();
+}
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -592,7 +592,7 @@ void CBlastTabularInfo::x_SetTaxInfo(const CBioseq_Handle & handle, const CRef<C
     	}
     }
 
-    if(m_SubjectTaxId == ZERO_TAX_ID) {
+    if(m_SubjectTaxId == ZERO_TAX_ID && handle) {
           m_SubjectTaxId = sequence::GetTaxId(handle);
     }
 
@@ -645,7 +645,7 @@ void CBlastTabularInfo::x_SetTaxInfoAll(const CBioseq_Handle & handle, const CRe
     	}
     }
 
-    if(m_SubjectTaxIds.empty()) {
+    if(m_SubjectTaxIds.empty() && handle) {
             CSeqdesc_CI desc_s(handle, CSeqdesc::e_Source);
             for (;desc_s; ++desc_s) {
                      TTaxId t = desc_s->GetSource().GetOrg().GetTaxId();
@@ -740,6 +740,225 @@ void CBlastTabularInfo::x_SetQueryCovSeqalign(const CSeq_align & align, int quer
 	m_QueryCovSeqalign = (int)tmp;
 }
 
+/// Search for a Seq-id in a list of Seq-ids, stopping at the first Seq-id
+/// of the same type; this mirrors the defline selection CSeqDB makes for a
+/// target Seq-id when building a Bioseq.
+static bool
+s_BlastDbSeqIdIn(const list<CRef<CSeq_id> >& seqids, const CSeq_id& target)
+{
+    ITERATE(list<CRef<CSeq_id> >, iter, seqids) {
+        switch ((*iter)->Compare(target)) {
+        case CSeq_id::e_YES:
+            return true;
+        case CSeq_id::e_NO:
+            return false;
+        default:
+            break;
+        }
+    }
+    return false;
+}
+
+/// Does CShowBlastDefline::GetSeqIdList replace this Seq-id with the first
+/// token of the Bioseq title?
+static bool
+s_IsArtificialSeqId(const CSeq_id& id)
+{
+    return (id.IsGeneral() &&
+            id.AsFastaString().find("gnl|BL_ORD_ID") != string::npos) ||
+           id.AsFastaString().find("lcl|Subject_") != string::npos;
+}
+
+/// Equivalent of CShowBlastDefline::GetSeqIdList for a subject served from
+/// the subject cache
+static void
+s_GetBlastDbSeqIdList(const list<CRef<CSeq_id> >& original_seqids,
+                      const string& title_token,
+                      list<CRef<CSeq_id> >& ids)
+{
+    ids.clear();
+    ITERATE(list<CRef<CSeq_id> >, itr, original_seqids) {
+        CRef<CSeq_id> next_seqid(new CSeq_id());
+        if ( !title_token.empty() && s_IsArtificialSeqId(**itr) ) {
+            CObject_id* obj_id = new CObject_id();
+            obj_id->SetStr(title_token);
+            next_seqid->SetLocal(*obj_id);
+        } else {
+            next_seqid->Assign(**itr);
+        }
+        ids.push_back(next_seqid);
+    }
+}
+
+CBlastTabularSubjectCache::CBlastTabularSubjectCache(CRef<CSeqDB> seqdb,
+                                                     size_t max_entries)
+    : m_SeqDB(seqdb), m_MaxEntries(max(max_entries, (size_t)1))
+{
+    _ASSERT(m_SeqDB.NotEmpty());
+}
+
+CConstRef<CBlastTabularSubjectCache::SSubjectInfo>
+CBlastTabularSubjectCache::GetSubjectInfo(const CSeq_id& id)
+{
+    CConstRef<SSubjectInfo> retval;
+    try {
+        int oid = -1;
+        if ( !m_SeqDB->SeqidToOid(id, oid) ) {
+            return retval;
+        }
+
+        map<int, CRef<SSubjectInfo> >::const_iterator it = m_Cache.find(oid);
+        if (it != m_Cache.end() && it->second->target_id == id.AsFastaString()) {
+            retval = it->second;
+            return retval;
+        }
+
+        CRef<SSubjectInfo> info = x_ReadSubjectInfo(oid, id);
+        if (info.NotEmpty()) {
+            if (m_Cache.size() >= m_MaxEntries) {
+                m_Cache.clear();
+            }
+            m_Cache[oid] = info;
+            retval = info;
+        }
+    } catch (const CException&) {
+        retval.Reset();
+    }
+    return retval;
+}
+
+CRef<CBlastTabularSubjectCache::SSubjectInfo>
+CBlastTabularSubjectCache::x_ReadSubjectInfo(int oid, const CSeq_id& id)
+{
+    CRef<SSubjectInfo> null_result;
+
+    CRef<CBlast_def_line_set> deflines = m_SeqDB->GetHdr(oid);
+    if (deflines.Empty() || !deflines->IsSet() || deflines->Get().empty()) {
+        return null_result;
+    }
+
+    // The data loader gives the subject Bioseq the Seq-ids and title of the
+    // first defline that contains the target Seq-id (or a local id with the
+    // same content); if there is none, the loader cannot resolve the Seq-id.
+    CRef<CSeq_id> id_lcl(new CSeq_id(CSeq_id::e_Local,
+                                     id.GetSeqIdString(true)));
+    CConstRef<CBlast_def_line> target;
+    ITERATE(CBlast_def_line_set::Tdata, itr, deflines->Get()) {
+        if (s_BlastDbSeqIdIn((*itr)->GetSeqid(), id) ||
+            s_BlastDbSeqIdIn((*itr)->GetSeqid(), *id_lcl)) {
+            target = *itr;
+            break;
+        }
+    }
+    if (target.Empty() || !target->IsSetSeqid() ||
+        target->GetSeqid().empty()) {
+        return null_result;
+    }
+
+    CRef<SSubjectInfo> info(new SSubjectInfo);
+    info->oid = oid;
+    info->length = m_SeqDB->GetSeqLength(oid);
+    info->deflines = deflines;
+    info->target_id = id.AsFastaString();
+    info->bioseq_ids = target->GetSeqid();
+
+    bool has_artificial_id = false;
+    ITERATE(CBlast_def_line_set::Tdata, itr, deflines->Get()) {
+        ITERATE(CBlast_def_line::TSeqid, sid, (*itr)->GetSeqid()) {
+            if (s_IsArtificialSeqId(**sid)) {
+                has_artificial_id = true;
+            }
+        }
+    }
+    if ( !has_artificial_id ) {
+        return info;
+    }
+
+    // Artificial Seq-ids are replaced with the first token of the defline
+    // generated for the Bioseq. Only titles for which that token is known to
+    // be the first token of the stored title are served here: CDeflineGenerator
+    // strips trailing punctuation and may rewrite a protein title's organism
+    // suffix, and reconstructs the title when there is none.
+    string title = target->IsSetTitle() ? target->GetTitle() : kEmptyStr;
+    SIZE_TYPE pos = title.find_last_not_of(".,;~ ");
+    if (pos != NPOS) {
+        title.erase(pos + 1);
+    }
+    pos = title.find(' ');
+    if (title.empty() || pos == NPOS || pos == 0 ||
+        (!IsNucleotide() && title[0] == '[')) {
+        return null_result;
+    }
+    info->title_token = title.substr(0, pos);
+    return info;
+}
+
+bool
+CBlastTabularInfo::x_SetSubjectFromCache(const CSeq_id& subject_id,
+                                         bool set_subject_id,
+                                         bool set_subject_ids,
+                                         bool set_tax_info,
+                                         bool set_tax_info_all,
+                                         bool set_title)
+{
+    // Subject deflines are parsed for ids only for sequences which are not
+    // in a BLAST database
+    if (m_SubjectCache.Empty() || m_ParseSubjectDefline) {
+        return false;
+    }
+
+    CConstRef<CBlastTabularSubjectCache::SSubjectInfo> info =
+        m_SubjectCache->GetSubjectInfo(subject_id);
+    if (info.Empty()) {
+        return false;
+    }
+
+    m_SubjectLength = info->length;
+
+    if (set_subject_id) {
+        // Same as SetSubjectId(bh): local ids are taken as they are, since
+        // the subject defline is not parsed
+        list<CRef<CSeq_id> > subject_id_list;
+        ITERATE(list<CRef<CSeq_id> >, itr, info->bioseq_ids) {
+            CRef<CSeq_id> next_id(new CSeq_id());
+            if ((*itr)->IsLocal()) {
+                const CObject_id& obj_id = (*itr)->GetLocal();
+                next_id->SetLocal().SetStr(obj_id.IsStr()
+                                           ? obj_id.GetStr()
+                                           : NStr::IntToString(obj_id.GetId()));
+            } else {
+                next_id->Assign(**itr);
+            }
+            subject_id_list.push_back(next_id);
+        }
+        s_GetBlastDbSeqIdList(subject_id_list, info->title_token, m_SubjectId);
+    }
+
+    if (set_subject_ids) {
+        m_SubjectIds.clear();
+        ITERATE(CBlast_def_line_set::Tdata, itr, info->deflines->Get()) {
+            list<CRef<CSeq_id> > next_seqid_list;
+            s_GetBlastDbSeqIdList((*itr)->GetSeqid(), info->title_token,
+                                  next_seqid_list);
+            m_SubjectIds.push_back(next_seqid_list);
+        }
+    }
+
+    // Subject Bioseqs from a BLAST database carry no taxonomy beyond that of
+    // their deflines, so no Bioseq handle is needed here
+    CRef<CBlast_def_line_set> bdlRef = info->deflines;
+    if (set_tax_info_all) {
+        x_SetTaxInfoAll(CBioseq_Handle(), bdlRef);
+    }
+    if (set_tax_info) {
+        x_SetTaxInfo(CBioseq_Handle(), bdlRef);
+    }
+    if (set_title) {
+        m_SubjectDefline = bdlRef;
+    }
+    return true;
+}
+
 int CBlastTabularInfo::SetFields(const CSeq_align& align, 
                                  CScope& scope, 
                                  CNcbiMatrix<int>* matrix)
@@ -824,8 +1043,25 @@ int CBlastTabularInfo::SetFields(const CSeq_align& align,
     		 	 	 	 x_IsFieldRequested(eSubjectAccession) ||
     		 	 	 	 x_IsFieldRequested(eSubjAccessionVersion));
 
-    if(setSubjectIds || setSubjectTaxInfo || setSubjectTaxInfoAll || setSubjectTitle ||
-       x_IsFieldRequested(eSubjectStrand) || setSubjectId)
+    // A Bioseq already loaded in the scope (such as a query with the same
+    // Seq-id) takes precedence over the BLAST database data loader, so the
+    // subject cache is only used for subjects not loaded yet.
+    bool subject_from_cache = false;
+    if(m_SubjectCache.NotEmpty() &&
+       (setSubjectIds || setSubjectTaxInfo || setSubjectTaxInfoAll || setSubjectTitle ||
+        x_IsFieldRequested(eSubjectStrand) || setSubjectId ||
+        x_IsFieldRequested(eSubjectLength)) &&
+       !scope.GetBioseqHandle(align.GetSeq_id(1), CScope::eGetBioseq_Loaded))
+    {
+        subject_from_cache =
+            x_SetSubjectFromCache(align.GetSeq_id(1), setSubjectId,
+                                  setSubjectIds, setSubjectTaxInfo,
+                                  setSubjectTaxInfoAll, setSubjectTitle);
+    }
+
+    if(!subject_from_cache &&
+       (setSubjectIds || setSubjectTaxInfo || setSubjectTaxInfoAll || setSubjectTitle ||
+        x_IsFieldRequested(eSubjectStrand) || setSubjectId))
     {
         try {
        		const CBioseq_Handle& subject_bh =
@@ -908,7 +1144,8 @@ int CBlastTabularInfo::SetFields(const CSeq_align& align,
     // ungapped, not translated searches.
     const bool kTranslated = align.GetSegs().IsStd();
     bool query_is_na = CSeq_inst::IsNa(scope.GetSequenceType(align.GetSeq_id(0)));
-    bool subject_is_na = CSeq_inst::IsNa(scope.GetSequenceType(align.GetSeq_id(1)));
+    bool subject_is_na = subject_from_cache ? m_SubjectCache->IsNucleotide() :
+        CSeq_inst::IsNa(scope.GetSequenceType(align.GetSeq_id(1)));
     if (kTranslated) {
         CRef<CSeq_align> densegAln = align.CreateDensegFromStdseg();
         // When both query and subject are translated, i.e. tblastx, convert
@@ -169,6 +169,59 @@ BOOST_AUTO_TEST_CASE(QueryAccSubjectAccIdentScoreOutput) {
     scope->GetObjectManager().RevokeAllDataLoaders();                
 }
 
+BOOST_AUTO_TEST_CASE(SubjectCacheOutput) {
+
+    const string seqAlignFileName_in = "data/blastn.vs.ecoli.asn";
+    CRef<CSeq_annot> san(new CSeq_annot);
+
+    ifstream in(seqAlignFileName_in.c_str());
+    in >> MSerial_AsnText >> *san;
+    in.close();
+
+    list<CRef<CSeq_align> > seqalign_list = san->GetData().GetAlign();
+
+    const string kDbName("ecoli");
+    const CBlastDbDataLoader::EDbType kDbType(CBlastDbDataLoader::eNucleotide);
+    TestUtil::CBlastOM tmp_data_loader(kDbName, kDbType, CBlastOM::eLocal);
+    CRef<CScope> scope = tmp_data_loader.NewScope();
+
+    const string kFormat("qseqid sseqid sallseqid sacc saccver sallacc slen "
+                         "staxids stitle salltitles sstrand qstart qend "
+                         "sstart send evalue bitscore");
+
+    // Subjects are read from the database first, so none of them is loaded
+    // in the scope yet, then formatted again through the scope
+    CRef<CSeqDB> seqdb(new CSeqDB(kDbName, CSeqDB::eNucleotide));
+    CRef<CBlastTabularSubjectCache> cache(new CBlastTabularSubjectCache(seqdb));
+    CNcbiOstrstream cache_stream;
+    CBlastTabularInfo cache_tab(cache_stream, kFormat);
+    cache_tab.SetNoFetch(true);
+    cache_tab.SetSubjectCache(cache);
+
+    ITERATE(list<CRef<CSeq_align> >, iter, seqalign_list)
+    {
+       BOOST_REQUIRE(cache->GetSubjectInfo((*iter)->GetSeq_id(1)).NotEmpty());
+       cache_tab.SetFields(**iter, *scope);
+       cache_tab.Print();
+    }
+
+    CNcbiOstrstream scope_stream;
+    CBlastTabularInfo scope_tab(scope_stream, kFormat);
+    scope_tab.SetNoFetch(true);
+
+    ITERATE(list<CRef<CSeq_align> >, iter, seqalign_list)
+    {
+       scope_tab.SetFields(**iter, *scope);
+       scope_tab.Print();
+    }
+
+    string cache_output = CNcbiOstrstreamToString(cache_stream);
+    string scope_output = CNcbiOstrstreamToString(scope_stream);
+    BOOST_REQUIRE(cache_output.find("gi|1786181|gb|AE000111.1|AE000111	gi|1786181|gb|AE000111.1|AE000111") != NPOS);
+    BOOST_REQUIRE_EQUAL(cache_output, scope_output);
+    scope->GetObjectManager().RevokeAllDataLoaders();                
+}
+
 BOOST_AUTO_TEST_CASE(QueryAccSubjectAccIdentBTOPOutput) {
 
     const string seqAlignFileName_in = "data/blastn.vs.ecoli.asn";
@@ -40,6 +40,10 @@
 #include <numeric>      // for std::accumulate
 #include <objmgr/object_manager.hpp>
 #include <objmgr/scope.hpp>
+#include <exception>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 BEGIN_NCBI_SCOPE
 USING_SCOPE(objects);
@@ -376,6 +380,11 @@ void CBlastDB_SeqFormatter::DumpAll(const CBlastDB_FormatterConfig & config)
 	}
 }
 
+CBlastDB_Formatter * CBlastDB_SeqFormatter::Clone(CSeqDB& blastdb, CNcbiOstream& out) const
+{
+	return new CBlastDB_SeqFormatter(m_FmtSpec, blastdb, out);
+}
+
 CBlastDB_FastaFormatter::CBlastDB_FastaFormatter(CSeqDB& blastdb, CNcbiOstream& out, TSeqPos width, bool useLongSeqId)
     :  m_BlastDb(blastdb), m_Out(out), m_fasta(out), m_UseLongSeqIds(useLongSeqId)
 {
@@ -397,7 +406,7 @@ s_GetMaskSeqLoc(const CSeqDB::TSequenceRanges & mask_ranges, CSeq_loc & seq_loc)
 int CBlastDB_FastaFormatter::Write(CSeqDB::TOID oid, const CBlastDB_FormatterConfig & config, string target_id)
 {
 	int status = -1;
-	CRef<CBioseq> bioseq = m_BlastDb.GetBioseq(oid);
+	CRef<CBioseq> bioseq;
 	if(target_id != kEmptyStr) {
 		Int8 num_id = NStr::StringToNumeric<Int8>(target_id, NStr::fConvErr_NoThrow);
 		if(errno) {
@@ -492,6 +501,11 @@ int CBlastDB_FastaFormatter::Write(CSeqDB::TOID oid, const CBlastDB_FormatterCon
    return 0;
 }
 
+CBlastDB_Formatter * CBlastDB_FastaFormatter::Clone(CSeqDB& blastdb, CNcbiOstream& out) const
+{
+	return new CBlastDB_FastaFormatter(blastdb, out, m_fasta.GetWidth(), m_UseLongSeqIds);
+}
+
 void CBlastDB_FastaFormatter::DumpAll(const CBlastDB_FormatterConfig & config)
 {
     if(config.m_Strand == eNa_strand_minus) {
@@ -514,7 +528,7 @@ CBlastDB_BioseqFormatter::CBlastDB_BioseqFormatter(CSeqDB& blastdb, CNcbiOstream
 int CBlastDB_BioseqFormatter::Write(CSeqDB::TOID oid, const CBlastDB_FormatterConfig & config, string target_id)
 {
 	int status = -1;
-	CRef<CBioseq> bioseq = m_BlastDb.GetBioseq(oid);
+	CRef<CBioseq> bioseq;
 	if(target_id != kEmptyStr) {
 		CSeq_id seq_id(target_id);
 		Int8 num_id;
@@ -547,6 +561,132 @@ void CBlastDB_BioseqFormatter::DumpAll(const CBlastDB_FormatterConfig & config)
     }
 }
 
+CBlastDB_Formatter * CBlastDB_BioseqFormatter::Clone(CSeqDB& blastdb, CNcbiOstream& out) const
+{
+	return new CBlastDB_BioseqFormatter(blastdb, out);
+}
+
+/// Number of requests or OIDs formatted by a thread at a time
+static const int kFormatChunkSize = 128;
+
+CBlastDB_ParallelWriter::CBlastDB_ParallelWriter(CBlastDB_Formatter & fmt, CSeqDB & blastdb,
+                                                 CNcbiOstream & out, int num_threads)
+    : m_Formatter(fmt), m_BlastDb(blastdb), m_Out(out), m_NumThreads(num_threads)
+{
+}
+
+void CBlastDB_ParallelWriter::Write(const vector<SBlastDB_FormatRequest> & requests)
+{
+	if (m_NumThreads > 1 && requests.size() > (size_t) kFormatChunkSize) {
+		x_Run(&requests, NULL, (int) requests.size());
+		return;
+	}
+	x_FormatItems(m_Formatter, m_BlastDb, &requests, NULL, 0, (int) requests.size());
+}
+
+void CBlastDB_ParallelWriter::DumpAll(const CBlastDB_FormatterConfig & config)
+{
+	if (m_NumThreads > 1) {
+		x_Run(NULL, &config, m_BlastDb.GetNumOIDs());
+		return;
+	}
+	m_Formatter.DumpAll(config);
+}
+
+void CBlastDB_ParallelWriter::x_FormatItems(CBlastDB_Formatter & fmt, CSeqDB & db,
+                                            const vector<SBlastDB_FormatRequest> * requests,
+                                            const CBlastDB_FormatterConfig * config,
+                                            int begin, int end)
+{
+	if (requests) {
+		for (int i = begin; i < end; i++) {
+			const SBlastDB_FormatRequest & r = (*requests)[i];
+			fmt.Write(r.m_Oid, r.m_Config, r.m_TargetId);
+		}
+	}
+	else {
+		for (int oid = begin; db.CheckOrFindOID(oid) && oid < end; oid++) {
+			fmt.Write(oid, *config);
+		}
+	}
+}
+
+void CBlastDB_ParallelWriter::x_Run(const vector<SBlastDB_FormatRequest> * requests,
+                                    const CBlastDB_FormatterConfig * config,
+                                    int num_items)
+{
+	// The per-thread handles are opened by name only, so a database
+	// filtered by a user supplied ID list is formatted serially.
+	unique_ptr<CBlastDB_Formatter> probe(m_Formatter.Clone(m_BlastDb, m_Out));
+	if ( !probe || !m_BlastDb.GetIdSet().Blank()) {
+		if (requests) {
+			x_FormatItems(m_Formatter, m_BlastDb, requests, NULL, 0, num_items);
+		}
+		else {
+			m_Formatter.DumpAll(*config);
+		}
+		return;
+	}
+	probe.reset();
+
+	const int num_chunks = (num_items + kFormatChunkSize - 1) / kFormatChunkSize;
+	bool stop = false;
+	exception_ptr error;
+
+#ifdef _OPENMP
+	#pragma omp parallel num_threads(m_NumThreads)
+#endif
+	{
+		// Thread 0 uses the caller's handle, the others open their own.
+		CSeqDB * db = &m_BlastDb;
+		CRef<CSeqDB> own_db;
+		exception_ptr open_error;
+#ifdef _OPENMP
+		if (omp_get_thread_num() != 0) {
+			try {
+				own_db.Reset(new CSeqDB(m_BlastDb.GetDBNameList(), m_BlastDb.GetSequenceType()));
+				db = own_db.GetPointer();
+			}
+			catch (...) {
+				open_error = current_exception();
+			}
+		}
+		#pragma omp for schedule(dynamic) ordered
+#endif
+		for (int chunk = 0; chunk < num_chunks; chunk++) {
+			CNcbiOstrstream buffer;
+			exception_ptr chunk_error = open_error;
+			if ( !chunk_error ) {
+				try {
+					unique_ptr<CBlastDB_Formatter> fmt(m_Formatter.Clone(*db, buffer));
+					int begin = chunk * kFormatChunkSize;
+					int end = min(begin + kFormatChunkSize, num_items);
+					x_FormatItems(*fmt, *db, requests, config, begin, end);
+				}
+				catch (...) {
+					chunk_error = current_exception();
+				}
+			}
+#ifdef _OPENMP
+			#pragma omp ordered
+#endif
+			{
+				if ( !stop ) {
+					m_Out << (string) CNcbiOstrstreamToString(buffer);
+					if (chunk_error) {
+						error = chunk_error;
+						stop = true;
+					}
+				}
+			}
+		}
+	}
+
+	if (error) {
+		rethrow_exception(error);
+	}
+}
+
 
 /// Auxiliary functor to compute the length of a string
 struct StrLenAdd
@@ -421,4 +421,34 @@ BOOST_AUTO_TEST_CASE(TestPDBIds)
 
 }
 
+BOOST_AUTO_TEST_CASE(TestParallelWriter)
+{
+    CSeqDB db("data/seqp", CSeqDB::eProtein);
+    CBlastDB_FormatterConfig config;
+
+    // Enough requests to span several chunks
+    vector<SBlastDB_FormatRequest> requests;
+    for (int i = 0; i < 4; i++) {
+        for (int oid = 0; db.CheckOrFindOID(oid); oid++) {
+            requests.push_back(SBlastDB_FormatRequest(oid, config));
+        }
+    }
+
+    CNcbiOstrstream serial_out;
+    CBlastDB_FastaFormatter serial_fmt(db, serial_out, 80);
+    CBlastDB_ParallelWriter serial(serial_fmt, db, serial_out, 1);
+    serial.Write(requests);
+    serial.DumpAll(config);
+
+    CNcbiOstrstream parallel_out;
+    CBlastDB_FastaFormatter parallel_fmt(db, parallel_out, 80);
+    CBlastDB_ParallelWriter parallel(parallel_fmt, db, parallel_out, 4);
+    parallel.Write(requests);
+    parallel.DumpAll(config);
+
+    const string expected = CNcbiOstrstreamToString(serial_out);
+    BOOST_REQUIRE( !expected.empty() );
+    BOOST_REQUIRE_EQUAL(expected, (string) CNcbiOstrstreamToString(parallel_out));
+}
+
 BOOST_AUTO_TEST_SUITE_END();
@@ -555,6 +555,23 @@ int CSeqDB::GetAmbigSeq(int oid, const char ** buffer, int nucl_code) const
     return rv;
 }
 
+int CSeqDB::GetCachedAmbigSeq(int           oid,
+                              const char ** buffer,
+                              int           nucl_code) const
+{
+    return m_Impl->GetCachedAmbigSeq(oid, buffer, nucl_code);
+}
+
+void CSeqDB::SetSubjectCacheLimit(Int8 bytes)
+{
+    CSeqDBSubjectCache::SetMemoryLimit(bytes);
+}
+
+void CSeqDB::GetSubjectCacheStats(Int8 & hits, Int8 & misses, Int8 & bytes)
+{
+    CSeqDBSubjectCache::GetStats(hits, misses, bytes);
+}
+
 void CSeqDB::RetAmbigSeq(const char ** buffer) const
 {
     //m_Impl->Verify();
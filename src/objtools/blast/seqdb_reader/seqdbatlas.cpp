@@ -50,6 +50,11 @@
 #include <unistd.h>
 #endif
 
+#if defined(NCBI_OS_LINUX)
+#include <sys/syscall.h>
+#include <linux/mempolicy.h>
+#endif
+
 BEGIN_NCBI_SCOPE
 
 // Further optimizations:
@@ -98,32 +103,406 @@ TOut SeqDB_CheckLength(TIn value)
     return result;
 }
 
+/// Largest number of NUMA nodes the atlas distributes memory over; node
+/// masks passed to the kernel are a single unsigned long.
+static const int kMaxNumaNodes = (int) (sizeof(unsigned long) * 8);
+
+vector<int> CSeqDBAtlas::ParseNodeList(const string & nodes)
+{
+    set<int> node_set;
+    vector<string> ranges;
+    NStr::Split(nodes, ", \n", ranges, NStr::fSplit_Tokenize);
+    ITERATE(vector<string>, range, ranges) {
+        string first, last;
+        if ( !NStr::SplitInTwo(*range, "-", first, last) ) {
+            last = first;
+        }
+        int from = NStr::StringToInt(first, NStr::fConvErr_NoThrow);
+        bool valid = (errno == 0);
+        int to = NStr::StringToInt(last, NStr::fConvErr_NoThrow);
+        if ( !valid  ||  errno != 0  ||  from < 0 ) {
+            ERR_POST(Warning << "Ignoring malformed NUMA node range '"
+                     << *range << "'");
+            continue;
+        }
+        for (int node = from; node <= to; node++) {
+            if (node >= kMaxNumaNodes) {
+                ERR_POST(Warning << "Ignoring NUMA node " << node
+                         << " beyond " << kMaxNumaNodes - 1);
+                break;
+            }
+            node_set.insert(node);
+        }
+    }
+    return vector<int>(node_set.begin(), node_set.end());
+}
+
+/// Get the NUMA nodes to distribute memory over.
+static vector<int> s_GetNumaNodes()
+{
+    CNcbiEnvironment env;
+    vector<int> nodes = CSeqDBAtlas::ParseNodeList(
+        env.Get("BLASTDB_ATLAS_NODES"));
+#if defined(NCBI_OS_LINUX)
+    // Only nodes with memory can hold copies or page cache pages; the
+    // "possible" list also has nodes that are absent or have only CPUs.
+    static const char * const kNodeLists[] = {
+        "/sys/devices/system/node/has_memory",
+        "/sys/devices/system/node/online"
+    };
+    for (size_t i = 0; nodes.empty()  &&  i < ArraySize(kNodeLists); i++) {
+        CNcbiIfstream in(kNodeLists[i]);
+        string line;
+        if (in && NcbiGetlineEOL(in, line)) {
+            nodes = CSeqDBAtlas::ParseNodeList(line);
+        }
+    }
+#endif
+    if (nodes.empty()) {
+        nodes.push_back(0);
+    }
+    return nodes;
+}
+
+/// Read the mapping mode from the environment or configuration file.
+static string s_GetMapModeString()
+{
+    CNcbiEnvironment env;
+    string mode = env.Get("BLASTDB_ATLAS_MODE");
+    if (mode.empty()) {
+        CNcbiApplicationAPI* app = CNcbiApplicationAPI::Instance();
+        if (app) {
+            const CNcbiRegistry& registry = app->GetConfig();
+            mode = registry.Get("BLAST", "ATLAS_MODE");
+        }
+    }
+    return mode;
+}
+
+CSeqDBAtlas::TMapMode CSeqDBAtlas::ParseMapMode(const string & mode)
+{
+    static const struct {
+        const char * name;
+        TMapMode flag;
+    } kModeNames[] = {
+        { "sequential", fMapSequential },
+        { "hugepage",   fMapHugePage   },
+        { "populate",   fMapPopulate   },
+        { "interleave", fMapInterleave },
+        { "replicate",  fMapReplicate  }
+    };
+
+    TMapMode flags = 0;
+    vector<string> tokens;
+    NStr::Split(mode, ", ", tokens, NStr::fSplit_Tokenize);
+    ITERATE(vector<string>, token, tokens) {
+        bool found = false;
+        for (size_t i = 0; i < ArraySize(kModeNames); i++) {
+            if (NStr::EqualNocase(*token, kModeNames[i].name)) {
+                flags |= kModeNames[i].flag;
+                found = true;
+                break;
+            }
+        }
+        if ( !found ) {
+            ERR_POST(Warning << "Ignoring unknown BLAST database mapping "
+                     "mode '" << *token << "'");
+        }
+    }
+    return flags;
+}
+
 CSeqDBAtlas::CSeqDBAtlas(bool use_atlas_lock)
      :m_UseLock           (use_atlas_lock),
       m_MaxFileSize       (0),      
-      m_SearchPath        (GenerateSearchPath())
+      m_SearchPath        (GenerateSearchPath()),
+      m_MapMode           (ParseMapMode(s_GetMapModeString())),
+      m_Nodes             (s_GetNumaNodes())
 {
     m_OpenedFilesCount = 0;
     m_MaxOpenedFilesCount = 0;
+    SNodeMapStats zero = { 0, 0 };
+    m_NodeStats.assign(m_Nodes.back() + 1, zero);
 }
 
 CSeqDBAtlas::~CSeqDBAtlas()
 {
+    if (m_MapMode & (fMapPopulate | fMapInterleave | fMapReplicate)) {
+        ITERATE(vector<int>, it, m_Nodes) {
+            int node = *it;
+            _TRACE("NUMA node " << node << ": "
+                   << m_NodeStats[node].bytes_mapped << " bytes mapped, "
+                   << m_NodeStats[node].page_faults << " page faults");
+        }
+    }
 }
 
-CMemoryFile* CSeqDBAtlas::GetMemoryFile(const string& fileName)
+CSeqDBAtlas::CAtlasMappedFile::~CAtlasMappedFile()
+{
+    _ASSERT(m_Count == 0);
+#if defined(NCBI_OS_UNIX)
+    ITERATE(vector<char*>, replica, m_Replicas) {
+        munmap(*replica, GetSize());
+    }
+#endif
+}
+
+int CSeqDBAtlas::GetCurrentNumaNode()
+{
+#if defined(NCBI_OS_LINUX) && defined(SYS_getcpu)
+    static thread_local int s_Node = -1;
+    if (s_Node < 0) {
+        unsigned int cpu = 0, node = 0;
+        if (syscall(SYS_getcpu, &cpu, &node, NULL) != 0  ||
+            node >= (unsigned int) kMaxNumaNodes) {
+            node = 0;
+        }
+        s_Node = (int) node;
+    }
+    return s_Node;
+#else
+    return 0;
+#endif
+}
+
+vector<CSeqDBAtlas::SNodeMapStats> CSeqDBAtlas::GetNodeMapStats()
 {
     std::lock_guard<std::mutex> guard(m_FileMemMapMutex);
+    return m_NodeStats;
+}
+
+const char * const * CSeqDBAtlas::GetReplicas(CMemoryFile * file)
+{
+    CAtlasMappedFile * mapped = static_cast<CAtlasMappedFile*>(file);
+    return mapped->m_ReplicaByNode.empty() ? NULL : &mapped->m_ReplicaByNode[0];
+}
+
+#if defined(NCBI_OS_UNIX)
+
+/// Page faults taken so far by the calling thread.
+static Uint8 s_GetPageFaults()
+{
+    struct rusage usage;
+#if defined(RUSAGE_THREAD)
+    if (getrusage(RUSAGE_THREAD, &usage) != 0)
+#else
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+#endif
+        return 0;
+    return (Uint8) usage.ru_minflt + (Uint8) usage.ru_majflt;
+}
+
+/// Touch every page of a memory area so that it is resident.
+static void s_PrefaultPages(const char * ptr, size_t size, size_t page_size)
+{
+    volatile char sink = 0;
+    for (size_t offset = 0; offset < size; offset += page_size) {
+        sink ^= ptr[offset];
+    }
+    (void) sink;
+}
+
+#endif
+
+#if defined(NCBI_OS_LINUX)
+
+/// Add the resident pages of a memory area to the per-node counters,
+/// sharing the given number of page faults out in proportion.
+/// @return false if page locations cannot be queried
+static bool s_CountResidentPages(const char * ptr, size_t size,
+                                 size_t page_size, Uint8 faults,
+                                 vector<CSeqDBAtlas::SNodeMapStats> & stats)
+{
+#if defined(SYS_move_pages)
+    const size_t kBatchSize = 1024;
+    vector<void*> pages(kBatchSize);
+    vector<int> status(kBatchSize);
+    vector<Uint8> pages_on_node(stats.size(), 0);
+    Uint8 total_pages = 0;
+
+    for (size_t offset = 0; offset < size; ) {
+        size_t count = 0;
+        for (; count < kBatchSize && offset < size;
+             count++, offset += page_size) {
+            pages[count] = (void*) (ptr + offset);
+        }
+        // With no target nodes, move_pages only reports where pages are.
+        if (syscall(SYS_move_pages, 0, count, &pages[0], NULL, &status[0],
+                    0) != 0) {
+            return false;
+        }
+        for (size_t i = 0; i < count; i++) {
+            if (status[i] >= 0  &&  (size_t) status[i] < stats.size()) {
+                pages_on_node[status[i]]++;
+                total_pages++;
+            }
+        }
+    }
+
+    for (size_t node = 0; node < stats.size(); node++) {
+        if (pages_on_node[node] == 0) {
+            continue;
+        }
+        stats[node].bytes_mapped += pages_on_node[node] * page_size;
+        stats[node].page_faults +=
+            faults * pages_on_node[node] / total_pages;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+#endif
+
+void CSeqDBAtlas::x_ApplyMapMode(CAtlasMappedFile & file,
+                                 vector<SNodeMapStats> & stats)
+{
+#if defined(NCBI_OS_UNIX)
+    char * ptr = (char *) file.GetPtr();
+    size_t size = file.GetSize();
+    if ( !ptr  ||  size == 0 ) {
+        return;
+    }
+    const size_t page_size = CSystemInfo::GetVirtualMemoryPageSize();
+
+    if (m_MapMode & fMapSequential) {
+        file.MemMapAdvise(CMemoryFile::eMMA_Sequential);
+    }
+#if defined(MADV_HUGEPAGE)
+    if (m_MapMode & fMapHugePage) {
+        // Only honored for files if the kernel supports huge pages in the
+        // page cache; replicas below are anonymous memory and always can.
+        madvise(ptr, size, MADV_HUGEPAGE);
+    }
+#endif
+
+#if defined(NCBI_OS_LINUX) && defined(SYS_mbind)
+    if ((m_MapMode & fMapReplicate)  &&  m_Nodes.size() > 1) {
+        vector<char*> replicas;
+        ITERATE(vector<int>, it, m_Nodes) {
+            const int node = *it;
+            void * copy = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (copy == MAP_FAILED) {
+                break;
+            }
+            replicas.push_back((char *) copy);
+            unsigned long mask = 1UL << node;
+            // Without memory on a node (or NUMA support) the pages are
+            // placed by the default policy; the copy is still usable.
+            syscall(SYS_mbind, copy, size, MPOL_BIND, &mask,
+                    (unsigned long) kMaxNumaNodes, 0);
+#if defined(MADV_HUGEPAGE)
+            if (m_MapMode & fMapHugePage) {
+                madvise(copy, size, MADV_HUGEPAGE);
+            }
+#endif
+            Uint8 faults = s_GetPageFaults();
+            memcpy(copy, ptr, size);
+            stats[node].page_faults += s_GetPageFaults() - faults;
+            stats[node].bytes_mapped += size;
+            mprotect(copy, size, PROT_READ);
+        }
+        if (replicas.size() == m_Nodes.size()) {
+            file.m_ReplicaByNode.assign(kMaxNumaNodes, replicas.front());
+            for (size_t i = 0; i < m_Nodes.size(); i++) {
+                file.m_ReplicaByNode[m_Nodes[i]] = replicas[i];
+            }
+            file.m_Replicas.swap(replicas);
+            return;
+        }
+        ERR_POST(Warning << "Cannot replicate " << file.GetFileName()
+                 << " on every NUMA node; using a single mapping");
+        ITERATE(vector<char*>, replica, replicas) {
+            munmap(*replica, size);
+        }
+    }
+#endif
+
+    if (m_MapMode & (fMapPopulate | fMapInterleave | fMapReplicate)) {
+#if defined(NCBI_OS_LINUX) && defined(SYS_set_mempolicy)
+        // Page cache pages are placed by the policy of the thread that
+        // reads them in, so interleave by reading the file under an
+        // interleave policy.  Pages that are already cached stay where
+        // they are.
+        int old_policy = MPOL_DEFAULT;
+        unsigned long old_mask = 0;
+        bool interleave = (m_MapMode & fMapInterleave)  &&
+            m_Nodes.size() > 1  &&
+            syscall(SYS_get_mempolicy, &old_policy, &old_mask,
+                    (unsigned long) kMaxNumaNodes, NULL, 0) == 0;
+        if (interleave) {
+            unsigned long mask = 0;
+            ITERATE(vector<int>, node, m_Nodes) {
+                mask |= 1UL << *node;
+            }
+            interleave = syscall(SYS_set_mempolicy, MPOL_INTERLEAVE, &mask,
+                                 (unsigned long) kMaxNumaNodes) == 0;
+        }
+#endif
+        file.MemMapAdvise(CMemoryFile::eMMA_WillNeed);
+        Uint8 faults = s_GetPageFaults();
+        s_PrefaultPages(ptr, size, page_size);
+        faults = s_GetPageFaults() - faults;
+#if defined(NCBI_OS_LINUX)
+#if defined(SYS_set_mempolicy)
+        if (interleave) {
+            syscall(SYS_set_mempolicy, old_policy,
+                    old_policy == MPOL_DEFAULT ? NULL : &old_mask,
+                    (unsigned long) kMaxNumaNodes);
+        }
+#endif
+        if (s_CountResidentPages(ptr, size, page_size, faults, stats)) {
+            return;
+        }
+#endif
+        stats[m_Nodes.front()].bytes_mapped += size;
+        stats[m_Nodes.front()].page_faults += faults;
+    }
+#endif
+}
+
+CMemoryFile* CSeqDBAtlas::GetMemoryFile(const string& fileName)
+{
+    std::unique_lock<std::mutex> guard(m_FileMemMapMutex);
     auto it = m_FileMemMap.find(fileName);
     if (it != m_FileMemMap.end()) {
-    	it->second.get()->m_Count++;
-    	//LOG_POST(Info << "File: " << fileName << " count " << it->second.get()->m_Count);
-        return it->second.get();
+        CAtlasMappedFile* file = it->second.get();
+    	file->m_Count++;
+    	//LOG_POST(Info << "File: " << fileName << " count " << file->m_Count);
+        // Another thread may still be applying the mapping mode
+        m_FileReadyCond.wait(guard, [file] { return file->m_Ready; });
+        return file;
     }
     CAtlasMappedFile* file(new CAtlasMappedFile(fileName));
     m_FileMemMap[fileName].reset(file);
    	_TRACE("Open File: " << fileName);
     ChangeOpenedFilseCount(CSeqDBAtlas::eFileCounterIncrement);
+
+    if (m_MapMode  &&  (NStr::EndsWith(fileName, ".psq")  ||
+                        NStr::EndsWith(fileName, ".nsq"))) {
+        // Populating or copying a volume takes long, so do it without
+        // holding up threads that access other files.  The entry cannot
+        // be removed meanwhile, as this thread holds a reference to it.
+        file->m_Ready = false;
+        guard.unlock();
+        SNodeMapStats zero = { 0, 0 };
+        vector<SNodeMapStats> stats(m_NodeStats.size(), zero);
+        try {
+            x_ApplyMapMode(*file, stats);
+        } catch (...) {
+            ERR_POST(Warning << "Cannot apply the mapping mode to "
+                     << fileName);
+        }
+        guard.lock();
+        for (size_t node = 0; node < stats.size(); node++) {
+            m_NodeStats[node].bytes_mapped += stats[node].bytes_mapped;
+            m_NodeStats[node].page_faults += stats[node].page_faults;
+        }
+        file->m_Ready = true;
+        m_FileReadyCond.notify_all();
+    }
     return file;
 }
 
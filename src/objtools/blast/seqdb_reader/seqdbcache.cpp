@@ -0,0 +1,234 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file seqdbcache.cpp
+/// Implementation of the process-wide subject sequence cache.
+#include <ncbi_pch.hpp>
+#include <corelib/ncbiapp_api.hpp>
+#include <corelib/ncbienv.hpp>
+#include <corelib/ncbireg.hpp>
+#include <corelib/ncbi_safe_static.hpp>
+#include <objtools/blast/seqdb_reader/impl/seqdbcache.hpp>
+
+BEGIN_NCBI_SCOPE
+
+/// Sizes of the blocks cached sequences are packed into; blocks grow
+/// from the minimum to the maximum size as a cache fills.
+static const size_t kMinBlockSize = 1024 * 1024;
+static const size_t kMaxBlockSize = 16 * 1024 * 1024;
+
+/// Alignment of each cached sequence.
+static const size_t kAlignment = 16;
+
+/// Caches by key.  A cache stays here while any CSeqDB object holds it;
+/// references are taken and dropped under s_CachesMutex only.
+typedef map< string, CRef<CSeqDBSubjectCache> > TSubjectCaches;
+static CSafeStatic<TSubjectCaches> s_Caches;
+DEFINE_STATIC_FAST_MUTEX(s_CachesMutex);
+
+/// Process-wide limit (-1 until read from the configuration) and counters.
+static std::atomic<Int8> s_MemoryLimit(-1);
+static std::atomic<Int8> s_Bytes(0);
+static std::atomic<Int8> s_Hits(0);
+static std::atomic<Int8> s_Misses(0);
+
+/// Read the memory limit from the environment or configuration file.
+static Int8 s_GetConfiguredLimit()
+{
+    CNcbiEnvironment env;
+    string limit = env.Get("BLASTDB_SUBJECT_CACHE_MB");
+    if (limit.empty()) {
+        CNcbiApplicationAPI* app = CNcbiApplicationAPI::Instance();
+        if (app) {
+            const CNcbiRegistry& registry = app->GetConfig();
+            limit = registry.Get("BLAST", "SUBJECT_CACHE_MB");
+        }
+    }
+    if (limit.empty()) {
+        return 0;
+    }
+    return NStr::StringToInt8(limit, NStr::fConvErr_NoThrow) * 1024 * 1024;
+}
+
+void CSeqDBSubjectCache::SetMemoryLimit(Int8 bytes)
+{
+    s_MemoryLimit = bytes;
+}
+
+Int8 CSeqDBSubjectCache::GetMemoryLimit()
+{
+    Int8 limit = s_MemoryLimit;
+    if (limit < 0) {
+        limit = s_GetConfiguredLimit();
+        Int8 unset = -1;
+        if (! s_MemoryLimit.compare_exchange_strong(unset, limit)) {
+            limit = unset;
+        }
+    }
+    return limit;
+}
+
+void CSeqDBSubjectCache::GetStats(Int8 & hits, Int8 & misses, Int8 & bytes)
+{
+    hits = s_Hits;
+    misses = s_Misses;
+    bytes = s_Bytes;
+}
+
+CRef<CSeqDBSubjectCache>
+CSeqDBSubjectCache::GetCache(const string & key, int num_oids)
+{
+    CRef<CSeqDBSubjectCache> cache;
+    if (GetMemoryLimit() <= 0 || num_oids <= 0) {
+        return cache;
+    }
+
+    CFastMutexGuard guard(s_CachesMutex);
+    CRef<CSeqDBSubjectCache> & entry = s_Caches.Get()[key];
+    if (entry.Empty()) {
+        entry.Reset(new CSeqDBSubjectCache(num_oids));
+    }
+    cache = entry;
+    return cache;
+}
+
+void CSeqDBSubjectCache::Release(CRef<CSeqDBSubjectCache> & cache)
+{
+    if (cache.Empty()) {
+        return;
+    }
+
+    CRef<CSeqDBSubjectCache> last_user;
+    {
+        CFastMutexGuard guard(s_CachesMutex);
+        const CSeqDBSubjectCache * released = cache.GetPointer();
+        cache.Reset();
+        TSubjectCaches & caches = s_Caches.Get();
+        NON_CONST_ITERATE(TSubjectCaches, it, caches) {
+            if (it->second.GetPointer() == released) {
+                if (it->second->ReferencedOnlyOnce()) {
+                    // Freed when last_user goes, outside the lock.
+                    last_user = it->second;
+                    caches.erase(it);
+                }
+                break;
+            }
+        }
+    }
+}
+
+CSeqDBSubjectCache::~CSeqDBSubjectCache()
+{
+    s_Bytes -= m_BlockBytes;
+}
+
+CSeqDBSubjectCache::CSeqDBSubjectCache(int num_oids)
+    : m_NumOIDs(num_oids),
+      m_Data(new std::atomic<const char *>[num_oids]),
+      m_Lengths(new int[num_oids]),
+      m_BlockBytes(0),
+      m_Full(false),
+      m_Free(NULL),
+      m_End(NULL)
+{
+    for (int i = 0; i < num_oids; i++) {
+        m_Data[i] = NULL;
+        m_Lengths[i] = 0;
+    }
+}
+
+int CSeqDBSubjectCache::Find(int oid, const char ** buffer) const
+{
+    if (oid < 0 || oid >= m_NumOIDs) {
+        return -1;
+    }
+    const char * data = m_Data[oid].load(std::memory_order_acquire);
+    if (data == NULL) {
+        s_Misses++;
+        return -1;
+    }
+    s_Hits++;
+    *buffer = data;
+    return m_Lengths[oid];
+}
+
+const char *
+CSeqDBSubjectCache::Insert(int oid, const char * data, int data_length, int length)
+{
+    if (oid < 0 || oid >= m_NumOIDs || data_length < 0) {
+        return NULL;
+    }
+
+    CFastMutexGuard guard(m_Mutex);
+
+    // Another thread may have added it since the lookup.
+    const char * cached = m_Data[oid].load(std::memory_order_relaxed);
+    if (cached) {
+        return cached;
+    }
+
+    size_t needed = (size_t) data_length + kAlignment;
+    if (m_Free == NULL || (size_t)(m_End - m_Free) < needed) {
+        size_t block_size = kMaxBlockSize;
+        if (m_Blocks.size() < 4) {
+            block_size = kMinBlockSize << m_Blocks.size();
+        }
+        block_size = max(block_size, needed);
+
+        // Reserve the block in the process-wide count first, so that
+        // caches filling at the same time cannot overshoot the limit.
+        const Int8 kLimit = GetMemoryLimit();
+        Int8 used = s_Bytes;
+        do {
+            if (used + (Int8) block_size > kLimit) {
+                m_Full = true;
+                return NULL;
+            }
+        } while (! s_Bytes.compare_exchange_weak(used, used + (Int8) block_size));
+
+        unique_ptr<char[]> block(new (std::nothrow) char[block_size]);
+        if ( !block ) {
+            s_Bytes -= block_size;
+            m_Full = true;
+            return NULL;
+        }
+        m_Blocks.push_back(std::move(block));
+        m_BlockBytes += block_size;
+        m_Free = m_Blocks.back().get();
+        m_End = m_Free + block_size;
+    }
+
+    char * dest = (char *)(((size_t) m_Free + kAlignment - 1) & ~(kAlignment - 1));
+    memcpy(dest, data, data_length);
+    m_Free = dest + data_length;
+
+    m_Lengths[oid] = length;
+    m_Data[oid].store(dest, std::memory_order_release);
+    return dest;
+}
+
+END_NCBI_SCOPE
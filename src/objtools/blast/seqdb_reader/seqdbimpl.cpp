@@ -84,6 +84,8 @@ CSeqDBImpl::CSeqDBImpl(const string       & db_name_list,
 {
     INIT_CLASS_MARK();
 
+    m_SubjectCacheSetup[0] = m_SubjectCacheSetup[1] = false;
+
     if (m_UseGiMask) {
         vector <string> mask_list;
         m_Aliases.GetMaskList(mask_list);
@@ -174,6 +176,8 @@ CSeqDBImpl::CSeqDBImpl(bool use_atlas_lock)
 {
     INIT_CLASS_MARK();
 
+    m_SubjectCacheSetup[0] = m_SubjectCacheSetup[1] = false;
+
     reusable_inpstr =  new CObjectIStreamAsnBinary ; 
     CHECK_MARKER();
 }
@@ -211,6 +215,9 @@ CSeqDBImpl::~CSeqDBImpl()
     }
     SetNumberOfThreads(0);
 
+    CSeqDBSubjectCache::Release(m_SubjectCaches[0]);
+    CSeqDBSubjectCache::Release(m_SubjectCaches[1]);
+
     CSeqDBLockHold locked(m_Atlas);
     m_Atlas.Lock(locked);
 
@@ -695,7 +702,7 @@ void CSeqDBImpl::x_FillSeqBuffer(SSeqResBuffer  *buffer,
     if (const CSeqDBVol * vol = m_VolSet.FindVol(oid, vol_oid)) {
         SSeqRes res;
         const char * seq;
-        Int8 tot_length = m_Atlas.GetSliceSize() / (4*m_NumThreads) + 1;
+        Int8 tot_length = x_GetChunkResidueBudget(oid);
 
         res.length = vol->GetSequence(vol_oid++, &seq);
         if (res.length < 0) return;
@@ -713,6 +720,48 @@ void CSeqDBImpl::x_FillSeqBuffer(SSeqResBuffer  *buffer,
     NCBI_THROW(CSeqDBException, eArgErr, CSeqDB::kOidNotFound);
 }
 
+Int8 CSeqDBImpl::x_GetChunkResidueBudget(int oid) const
+{
+    // Smallest budget used near the end of the iteration; below this the
+    // per-chunk locking cost outweighs any gain in balance.
+    static const Int8 kMinChunkResidues = 1 << 16;
+
+    Int8 budget = m_Atlas.GetSliceSize() / (4*m_NumThreads) + 1;
+
+    // Guided self-scheduling: never hand out more than a share of what
+    // is left, so idle threads pick up the remainder instead of waiting
+    // on one thread that took the tail in a single chunk.
+    Int8 share = (Int8) (x_EstimateRemainingLength(oid) / (2*m_NumThreads));
+
+    return max(kMinChunkResidues, min(budget, share));
+}
+
+Uint8 CSeqDBImpl::x_EstimateRemainingLength(int oid) const
+{
+    Uint8 remaining = 0;
+
+    for (int i = 0; i < m_VolSet.GetNumVols(); i++) {
+        const CSeqDBVolEntry * entry = m_VolSet.GetVolEntry(i);
+        int start = max(entry->OIDStart(), oid);
+        int end   = min(entry->OIDEnd(), m_RestrictEnd);
+
+        if (start >= end) {
+            continue;
+        }
+
+        int num_oids = entry->OIDEnd() - entry->OIDStart();
+        Uint8 vol_length = entry->Vol()->GetVolumeLength();
+
+        if (start == entry->OIDStart() && end == entry->OIDEnd()) {
+            remaining += vol_length;
+        } else {
+            remaining += (Uint8) ((double) vol_length * (end - start) / num_oids);
+        }
+    }
+
+    return remaining;
+}
+
 int CSeqDBImpl::GetSequence(int oid, const char ** buffer) const
 {
     CHECK_MARKER();
@@ -792,6 +841,61 @@ int CSeqDBImpl::GetAmbigPartialSeq(int                oid,
 	    NCBI_THROW(CSeqDBException, eArgErr, CSeqDB::kOidNotFound);
 }
 
+CSeqDBSubjectCache * CSeqDBImpl::x_GetSubjectCache(int nucl_code) const
+{
+    CFastMutexGuard guard(const_cast<CFastMutex &>(m_SubjectCacheLock));
+
+    if (! m_SubjectCacheSetup[nucl_code]) {
+        m_SubjectCacheSetup[nucl_code] = true;
+
+        // The volume paths and sizes identify the database, so that all
+        // CSeqDB objects opened on it in this process share one cache.
+        string key = NStr::IntToString(nucl_code) + " "
+            + NStr::IntToString(m_VolSet.GetNumOIDs()) + " "
+            + NStr::UInt8ToString(m_VolumeLength);
+        ITERATE(vector<string>, vol, m_Aliases.GetVolumeNames()) {
+            key += " " + *vol;
+        }
+        m_SubjectCaches[nucl_code] =
+            CSeqDBSubjectCache::GetCache(key, m_VolSet.GetNumOIDs());
+    }
+    return m_SubjectCaches[nucl_code].GetPointerOrNull();
+}
+
+int CSeqDBImpl::GetCachedAmbigSeq(int           oid,
+                                  const char ** buffer,
+                                  int           nucl_code) const
+{
+    CHECK_MARKER();
+
+    if (m_SeqType != 'n' ||
+        (nucl_code != kSeqDBNuclNcbiNA8 && nucl_code != kSeqDBNuclBlastNA8)) {
+        return -1;
+    }
+
+    CSeqDBSubjectCache * cache = x_GetSubjectCache(nucl_code);
+    if (cache == NULL) {
+        return -1;
+    }
+
+    int length = cache->Find(oid, buffer);
+    if (length >= 0 || cache->IsFull()) {
+        return length;
+    }
+
+    char * data = NULL;
+    length = GetAmbigSeq(oid, & data, nucl_code, NULL, eMalloc);
+    int data_length = length + (nucl_code == kSeqDBNuclBlastNA8 ? 2 : 0);
+    const char * cached = cache->Insert(oid, data, data_length, length);
+    free(data);
+
+    if (cached == NULL) {
+        return -1;
+    }
+    *buffer = cached;
+    return length;
+}
+
 list< CRef<CSeq_id> > CSeqDBImpl::GetSeqIDs(int oid)
 {
     CHECK_MARKER();
@@ -1357,16 +1461,63 @@ void CSeqDBImpl::AccessionsToOids(const vector<string>& accs, vector<blastdb::TO
     	}
     }
     else {
-    	for(unsigned int i=0; i < accs.size(); i++) {
-    		vector<blastdb::TOid> tmp;
-    		AccessionToOids(accs[i], tmp);
-    		if(tmp.empty()) {
-    			oids[i] = kSeqDBEntryNotFound;
-    		}
-    		else {
-    			oids[i] = tmp[0];
-    		}
-    	}
+        CSeqDBLockHold locked(m_Atlas);
+
+        if (! m_OidListSetup) {
+            x_GetOidList(locked);
+        }
+
+        // Each volume resolves the accessions not found in an earlier
+        // volume in one batch; the first OID that passes the filters
+        // is kept, as AccessionToOids() would report it first.
+
+        vector<size_t> pending;
+        vector<string> pending_accs;
+
+        for(size_t i = 0; i < accs.size(); i++) {
+            oids[i] = kSeqDBEntryNotFound;
+            pending.push_back(i);
+        }
+
+        vector< vector<int> > vol_oids;
+
+        for(int vol_idx = 0; vol_idx < m_VolSet.GetNumVols(); vol_idx++) {
+            if (pending.empty()) {
+                break;
+            }
+
+            pending_accs.clear();
+
+            ITERATE(vector<size_t>, iter, pending) {
+                pending_accs.push_back(accs[*iter]);
+            }
+
+            m_VolSet.GetVol(vol_idx)->AccessionsToOids(pending_accs,
+                                                       vol_oids,
+                                                       locked);
+
+            int vol_start = m_VolSet.GetVolOIDStart(vol_idx);
+
+            vector<size_t> unresolved;
+
+            for(size_t j = 0; j < pending.size(); j++) {
+                ITERATE(vector<int>, iter, vol_oids[j]) {
+                    int oid1 = ((*iter) + vol_start);
+                    int oid2 = oid1;
+
+                    if (x_CheckOrFindOID(oid2, locked) && (oid1 == oid2)) {
+                        oids[pending[j]] = oid1;
+                        break;
+                    }
+                }
+
+                if (oids[pending[j]] == kSeqDBEntryNotFound) {
+                    unresolved.push_back(pending[j]);
+                }
+            }
+
+            pending.swap(unresolved);
+        }
     }
     return;
 }
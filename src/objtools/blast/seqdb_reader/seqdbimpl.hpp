@@ -43,6 +43,7 @@
 #include "seqdbalias.hpp"
 #include "seqdboidlist.hpp"
 #include <objtools/blast/seqdb_reader/impl/seqdbcol.hpp>
+#include <objtools/blast/seqdb_reader/impl/seqdbcache.hpp>
 #include "seqdbgimask.hpp"
 #include "seqdblmdbset.hpp"
 
@@ -389,6 +390,19 @@ public:
                            CSeqDB::TSequenceRanges  * partial_ranges,
                            CSeqDB::TSequenceRanges  * masks) const;
 
+    /// Get a decoded nucleotide sequence from the subject cache.
+    ///
+    /// @param oid
+    ///   The ordinal id of the sequence.
+    /// @param buffer
+    ///   A returned pointer to the cached data.
+    /// @param nucl_code
+    ///   The encoding to use for the returned sequence data.
+    /// @return
+    ///   The sequence length, or -1 if the sequence is not cached and
+    ///   could not be added.
+    int GetCachedAmbigSeq(int oid, const char ** buffer, int nucl_code) const;
+
     /// Returns any resources associated with the sequence.
     ///
     /// Calls to GetSequence (but not GetBioseq())
@@ -1409,6 +1423,33 @@ private:
     /// Fill up the buffer
     void x_FillSeqBuffer(SSeqResBuffer * buffer, int oid) const;
 
+    /// Get the subject cache for an encoding, or NULL if disabled.
+    CSeqDBSubjectCache * x_GetSubjectCache(int nucl_code) const;
+
+    /// Shared subject caches, indexed by nucleotide encoding.
+    mutable CRef<CSeqDBSubjectCache> m_SubjectCaches[2];
+
+    /// True once the subject cache for an encoding has been looked up.
+    mutable bool m_SubjectCacheSetup[2];
+
+    /// Mutex which synchronizes subject cache setup.
+    CFastMutex m_SubjectCacheLock;
+
+    /// Residue budget for the next MT chunk starting at oid.
+    ///
+    /// The budget starts at a fraction of the atlas slice and shrinks
+    /// as the unsearched part of the restricted OID range drains, so
+    /// the last chunks handed out are small and threads finish close
+    /// together even when a few sequences hold most of the residues.
+    /// @param oid First OID of the chunk. [in]
+    /// @return Number of residues to gather into the chunk.
+    Int8 x_GetChunkResidueBudget(int oid) const;
+
+    /// Estimate residues in OIDs [oid, m_RestrictEnd).
+    /// @param oid First OID of the range. [in]
+    /// @return Approximate residue count, based on volume lengths.
+    Uint8 x_EstimateRemainingLength(int oid) const;
+
     /// Get sequence from buffer
     int x_GetSeqBuffer(SSeqResBuffer * buffer, int oid, const char ** seq) const;
 
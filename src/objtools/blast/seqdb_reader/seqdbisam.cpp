@@ -1121,7 +1121,8 @@ CSeqDBIsam::CSeqDBIsam(CSeqDBAtlas  & atlas,
       m_FirstOffset    (0),
       m_LastOffset     (0),
       m_LongId         (false),
-      m_TermSize       (8)
+      m_TermSize       (8),
+      m_SamplesLoaded  (false)
 {
     // These are the types that readdb.c seems to use.
 
@@ -1232,6 +1233,59 @@ bool CSeqDBIsam::x_IdentToOid(Int8 ident, TOid & oid)
     return false;
 }
 
+/// Remove the version from an accession.
+///
+/// @param acc
+///   An accession, possibly ending in a version.
+/// @return
+///   The accession without its version, or an empty string if it
+///   does not end in a version of one to three digits.
+static string s_SeqDBIsam_StripVersion(const string & acc)
+{
+    size_t pos = acc.find(".");
+
+    bool is_version = false;
+
+    if (pos != string::npos) {
+        int ver_len = acc.size() - pos - 1;
+
+        is_version = (ver_len <= 3 && ver_len >= 1);
+
+        for(size_t vp = pos+1; vp < acc.size(); vp++) {
+            if (! isdigit(acc[vp])) {
+                is_version = false;
+                break;
+            }
+        }
+    }
+
+    return is_version ? string(acc, 0, pos) : string();
+}
+
+/// Reformat an identifier as a FASTA style Seq-id string.
+///
+/// Use CSeq_id to parse the id string and build a replacement, FASTA
+/// type string.  This allows some IDs, such as PDBs with chains, such
+/// as '1qcfA' to be parsed.
+///
+/// @param acc
+///   The identifier to parse.
+/// @return
+///   The FASTA string, or an empty string if acc could not be parsed.
+static string s_SeqDBIsam_FastaString(const string & acc)
+{
+    string id;
+
+    try {
+        CSeq_id seqid(acc, CSeq_id::fParse_RawText | CSeq_id::fParse_AnyLocal);
+        id = seqid.AsFastaString();
+    }
+    catch(CSeqIdException &) {
+    }
+
+    return id;
+}
+
 void CSeqDBIsam::StringToOids(const string   & acc,
                               vector<TOid>   & oids,
                               bool             adjusted,
@@ -1299,26 +1353,9 @@ void CSeqDBIsam::StringToOids(const string   & acc,
     }
 
     if ((! found) && strip_version) {
-        size_t pos = acc.find(".");
-
-        bool is_version = false;
-
-        if (pos != string::npos) {
-            int ver_len = acc.size() - pos - 1;
-
-            is_version = (ver_len <= 3 && ver_len >= 1);
-
-            for(size_t vp = pos+1; vp < acc.size(); vp++) {
-                if (! isdigit(acc[vp])) {
-                    is_version = false;
-                    break;
-                }
-            }
-        }
-
-        if (is_version) {
-            string nover(acc, 0, pos);
+        string nover = s_SeqDBIsam_StripVersion(acc);
 
+        if (nover.size()) {
             err = x_StringSearch(nover,
                                  keys_out,
                                  data_out,
@@ -1340,18 +1377,7 @@ void CSeqDBIsam::StringToOids(const string   & acc,
     }
 
     if (! found) {
-        // Use CSeq_id to parse the id string and build a replacement,
-        // FASTA type string.  This allows some IDs, such as PDBs with
-        // chains, such as '1qcfA' to be parsed.
-
-        string id;
-
-        try {
-            CSeq_id seqid(acc, CSeq_id::fParse_RawText | CSeq_id::fParse_AnyLocal);
-            id = seqid.AsFastaString();
-        }
-        catch(CSeqIdException &) {
-        }
+        string id = s_SeqDBIsam_FastaString(acc);
 
         if (id.size() &&
             ((err = x_StringSearch(id,
@@ -1457,6 +1483,332 @@ void CSeqDBIsam::IdsToOids(int                  vol_start,
     }
 }
 
+void CSeqDBIsam::IdsToOids(const vector<Int8> & ids,
+                           vector<TOid>       & oids)
+{
+    _ASSERT(m_IdentType == eGiId || m_IdentType == eTiId || m_IdentType == ePigId);
+
+    oids.assign(ids.size(), -1);
+
+    if (m_Initialized == false) {
+        return;
+    }
+
+    x_LoadSamples();
+
+    typedef vector< pair<Int8, size_t> > TOrder;
+
+    TOrder order;
+    order.reserve(ids.size());
+
+    for(size_t i = 0; i < ids.size(); i++) {
+        order.push_back(make_pair(ids[i], i));
+    }
+
+    sort(order.begin(), order.end());
+
+    // The identifiers arrive in ascending order, so each search for a
+    // page can start at the page used for the previous identifier.
+
+    vector<Int8>::const_iterator samples_begin = m_NumericSamples.begin();
+    vector<Int8>::const_iterator samples_end   = m_NumericSamples.end();
+    vector<Int8>::const_iterator low           = samples_begin;
+
+    ITERATE(TOrder, iter, order) {
+        Int8 id = iter->first;
+
+        if (x_OutOfBounds(id)) {
+            continue;
+        }
+
+        vector<Int8>::const_iterator next = upper_bound(low, samples_end, id);
+
+        if (next == samples_begin) {
+            continue;
+        }
+
+        low = next - 1;
+
+        int data(-1);
+
+        if (x_SearchDataNumeric(id, & data, 0, int(low - samples_begin)) == eNoError) {
+            oids[iter->second] = data;
+        }
+    }
+}
+
+void CSeqDBIsam::StringsToOids(const vector<string>   & accs,
+                               const vector<bool>     & adjusted,
+                               vector<bool>           & version_check,
+                               vector< vector<TOid> > & oids)
+{
+    _ASSERT(m_IdentType == eStringId);
+    _ASSERT(adjusted.size() == accs.size());
+    _ASSERT(version_check.size() == accs.size());
+
+    vector<bool> strip_version(version_check);
+    version_check.assign(accs.size(), false);
+
+    oids.clear();
+    oids.resize(accs.size());
+
+    if (m_Initialized == false) {
+        return;
+    }
+
+    // Each round tries one of the key forms used by StringToOids(), in
+    // the same order, for every accession not resolved by an earlier
+    // round.
+
+    enum ERound {
+        eGenBankAccession,
+        eGenBankLocus,
+        eRawString,
+        eNoVersion,
+        eFastaString,
+        eNumRounds
+    };
+
+    vector< vector<string> > found(accs.size());
+
+    for(int round = 0; round < eNumRounds; round++) {
+        vector<string> terms;
+        vector<size_t> which;
+
+        for(size_t i = 0; i < accs.size(); i++) {
+            if (found[i].size()) {
+                continue;
+            }
+
+            string term;
+
+            switch(round) {
+            case eGenBankAccession:
+                if (! adjusted[i]) {
+                    term = string("gb|") + accs[i] + "|";
+                }
+                break;
+
+            case eGenBankLocus:
+                if (! adjusted[i]) {
+                    term = string("gb||") + accs[i];
+                }
+                break;
+
+            case eRawString:
+                term = accs[i];
+                break;
+
+            case eNoVersion:
+                if (strip_version[i]) {
+                    term = s_SeqDBIsam_StripVersion(accs[i]);
+                }
+                break;
+
+            case eFastaString:
+                term = s_SeqDBIsam_FastaString(accs[i]);
+                break;
+            }
+
+            if (term.size()) {
+                terms.push_back(term);
+                which.push_back(i);
+            }
+        }
+
+        if (terms.empty()) {
+            continue;
+        }
+
+        vector< vector<string> > values;
+        x_StringSearchBatch(terms, values);
+
+        for(size_t j = 0; j < which.size(); j++) {
+            if (values[j].size()) {
+                found[which[j]].swap(values[j]);
+
+                if (round == eNoVersion) {
+                    version_check[which[j]] = true;
+                }
+            }
+        }
+    }
+
+    for(size_t i = 0; i < accs.size(); i++) {
+        ITERATE(vector<string>, iter, found[i]) {
+            oids[i].push_back(atoi((*iter).c_str()));
+        }
+    }
+}
+
+void CSeqDBIsam::x_LoadSamples()
+{
+    CFastMutexGuard guard(m_SampleLock);
+
+    if (m_SamplesLoaded) {
+        return;
+    }
+
+    if (m_Type == eString) {
+        x_LoadIndex(m_IndexLease, m_StringSamples, m_PageOffsets);
+
+        NON_CONST_ITERATE(vector<string>, iter, m_StringSamples) {
+            x_Lower(*iter);
+        }
+    } else {
+        m_NumericSamples.reserve(m_NumSamples);
+
+        for(int i = 0; i < m_NumSamples; i++) {
+            TIndx offset = m_KeySampleOffset + (TIndx) m_TermSize * i;
+
+            const void * keydatap =
+                m_IndexLease.GetFileDataPtr(m_IndexFname, offset);
+
+            m_NumericSamples.push_back(x_GetNumericKey(keydatap));
+        }
+    }
+
+    m_SamplesLoaded = true;
+}
+
+void CSeqDBIsam::x_DecodeStringPage(int               sample_num,
+                                    SIsamStringPage & page)
+{
+    if (page.m_SampleNum == sample_num) {
+        return;
+    }
+
+    page.m_SampleNum = sample_num;
+    page.m_Keys.clear();
+    page.m_Values.clear();
+
+    const char * beginp(0);
+    const char * endp(0);
+
+    x_LoadPage(sample_num, sample_num + 1, & beginp, & endp);
+
+    const char * p = beginp;
+
+    while(p < endp) {
+        const char * key_start = p;
+
+        while((p < endp) && (! ENDS_ISAM_KEY(*p))) {
+            p++;
+        }
+
+        // Trailing blanks are not significant to x_DiffChar().
+
+        const char * key_end = p;
+
+        while((key_end > key_start) && (key_end[-1] == ' ')) {
+            key_end--;
+        }
+
+        const char * value_start = p;
+
+        if ((p < endp) && (*p == ISAM_DATA_CHAR)) {
+            value_start = ++p;
+
+            while((p < endp) && s_SeqDBIsam_NullifyEOLs(*p)) {
+                p++;
+            }
+        }
+
+        page.m_Keys.push_back(string(key_start, key_end));
+        x_Lower(page.m_Keys.back());
+        page.m_Values.push_back(string(value_start, p));
+
+        // Skip the record terminator and any nulls after it.
+
+        while((p < endp) && (! s_SeqDBIsam_NullifyEOLs(*p))) {
+            p++;
+        }
+    }
+}
+
+void CSeqDBIsam::x_StringSearchBatch(const vector<string>     & terms,
+                                     vector< vector<string> > & values_out)
+{
+    values_out.clear();
+    values_out.resize(terms.size());
+
+    if (m_PageSize == MEMORY_ONLY_PAGE_SIZE) {
+        // Memory-only indices have no page table to sweep.
+
+        vector<string> keys_out;
+        vector<TIndx>  indices_out;
+
+        for(size_t i = 0; i < terms.size(); i++) {
+            x_StringSearch(terms[i], keys_out, values_out[i], indices_out);
+        }
+
+        return;
+    }
+
+    x_LoadSamples();
+
+    typedef vector< pair<string, size_t> > TOrder;
+
+    TOrder order;
+    order.reserve(terms.size());
+
+    for(size_t i = 0; i < terms.size(); i++) {
+        order.push_back(make_pair(terms[i], i));
+        x_Lower(order.back().first);
+    }
+
+    sort(order.begin(), order.end());
+
+    vector<string>::const_iterator samples_begin = m_StringSamples.begin();
+    vector<string>::const_iterator samples_end   = m_StringSamples.end();
+    vector<string>::const_iterator low           = samples_begin;
+
+    SIsamStringPage page;
+
+    ITERATE(TOrder, iter, order) {
+        const string & term = iter->first;
+
+        if (x_OutOfBounds(term)) {
+            continue;
+        }
+
+        // Matching entries run from the page before the first sample
+        // equal to the term (which may end with the term) through the
+        // page of the last sample not greater than the term.
+
+        vector<string>::const_iterator first =
+            lower_bound(low, samples_end, term);
+
+        vector<string>::const_iterator last =
+            upper_bound(first, samples_end, term);
+
+        low = first;
+
+        if (last == samples_begin) {
+            continue;
+        }
+
+        int first_page = int(first - samples_begin);
+        int last_page  = int(last - samples_begin) - 1;
+
+        if (first_page > 0) {
+            first_page--;
+        }
+
+        vector<string> & values = values_out[iter->second];
+
+        for(int sample_num = first_page; sample_num <= last_page; sample_num++) {
+            x_DecodeStringPage(sample_num, page);
+
+            for(size_t k = 0; k < page.m_Keys.size(); k++) {
+                if (page.m_Keys[k] == term) {
+                    values.push_back(page.m_Values[k]);
+                }
+            }
+        }
+    }
+}
+
 void CSeqDBIsam::x_FindIndexBounds()
 {
     Int4 Start (0);
@@ -2755,6 +2755,140 @@ void CSeqDBVol::AccessionToOids(const string         & acc,
 
 }
 
+/// Translate numeric identifiers with one ISAM file.
+///
+/// @param isam
+///   The ISAM file to search. [in]
+/// @param idents
+///   The identifiers to look up. [in]
+/// @param which
+///   The index in oids of the result for each identifier. [in]
+/// @param oids
+///   The OID found for each identifier is appended here. [in|out]
+static void s_IdentsToOids(CSeqDBIsam            & isam,
+                           const vector<Int8>    & idents,
+                           const vector<size_t>  & which,
+                           vector< vector<int> > & oids)
+{
+    vector<int> found;
+    isam.IdsToOids(idents, found);
+
+    for(size_t j = 0; j < which.size(); j++) {
+        if (found[j] != -1) {
+            oids[which[j]].push_back(found[j]);
+        }
+    }
+}
+
+void CSeqDBVol::AccessionsToOids(const vector<string>  & accs,
+                                 vector< vector<int> > & oids,
+                                 CSeqDBLockHold        & locked) const
+{
+    oids.clear();
+    oids.resize(accs.size());
+
+    // Group the identifiers by the ISAM file that resolves them.
+
+    vector<string> str_ids;
+    vector<bool>   str_simpler;
+    vector<size_t> str_which;
+
+    vector<Int8>   gi_ids,   ti_ids,   pig_ids;
+    vector<size_t> gi_which, ti_which, pig_which;
+
+    for(size_t i = 0; i < accs.size(); i++) {
+        Int8   ident   (-1);
+        string str_id;
+        bool   simpler (false);
+
+        ESeqDBIdType id_type =
+            SeqDB_SimplifyAccession(accs[i], ident, str_id, simpler);
+
+        if ((ident != -1) && (ident >> 32)) {
+            NCBI_THROW(CSeqDBException,
+                       eArgErr,
+                       "ID overflows range of specified type.");
+        }
+
+        switch(id_type) {
+        case eStringId:
+            str_ids.push_back(str_id);
+            str_simpler.push_back(simpler);
+            str_which.push_back(i);
+            break;
+
+        case eGiId:
+            gi_ids.push_back(ident);
+            gi_which.push_back(i);
+            break;
+
+        case eTiId:
+            ti_ids.push_back(ident);
+            ti_which.push_back(i);
+            break;
+
+        case ePigId:
+            pig_ids.push_back((int) ident);
+            pig_which.push_back(i);
+            break;
+
+        default:
+            x_StringToOids(accs[i], id_type, ident, str_id, simpler, oids[i]);
+        }
+    }
+
+    if (gi_ids.size()) {
+        x_OpenGiFile();
+        if (m_IsamGi.NotEmpty()) {
+            s_IdentsToOids(*m_IsamGi, gi_ids, gi_which, oids);
+            x_UnleaseGiFile();
+        }
+    }
+
+    if (pig_ids.size()) {
+        x_OpenPigFile();
+        if (m_IsamPig.NotEmpty()) {
+            s_IdentsToOids(*m_IsamPig, pig_ids, pig_which, oids);
+            x_UnleasePigFile();
+        }
+    }
+
+    if (ti_ids.size()) {
+        x_OpenTiFile();
+        if (m_IsamTi.NotEmpty()) {
+            s_IdentsToOids(*m_IsamTi, ti_ids, ti_which, oids);
+            x_UnleaseTiFile();
+        } else {
+            // Fall back to the string index, one TI at a time.
+            for(size_t j = 0; j < ti_which.size(); j++) {
+                x_StringToOids(accs[ti_which[j]], eTiId, ti_ids[j],
+                               kEmptyStr, true, oids[ti_which[j]]);
+            }
+        }
+    }
+
+    if (str_ids.size()) {
+        x_OpenStrFile();
+        if (m_IsamStr.NotEmpty()) {
+            // Not simplified
+            vector<bool> vcheck(str_ids.size(), true);
+            vector< vector<int> > str_oids;
+
+            m_IsamStr->StringsToOids(str_ids, str_simpler, vcheck, str_oids);
+            x_UnleaseStrFile();
+
+            for(size_t j = 0; j < str_which.size(); j++) {
+                vector<int> & acc_oids = oids[str_which[j]];
+                acc_oids.swap(str_oids[j]);
+
+                if (vcheck[j]) {
+                    x_CheckVersions(accs[str_which[j]], acc_oids);
+                }
+            }
+        }
+    }
+}
+
 void CSeqDBVol::SeqidToOids(CSeq_id              & seqid,
                             vector<int>          & oids,
                             CSeqDBLockHold       & locked) const
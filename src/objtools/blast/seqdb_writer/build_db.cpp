@@ -1571,6 +1571,11 @@ void CBuildDatabase::SetMaxFileSize(Uint8 max_file_size)
     m_OutputDb->SetMaxFileSize(max_file_size);
 }
 
+void CBuildDatabase::SetNumThreads(int num_threads)
+{
+    m_OutputDb->SetNumThreads(num_threads);
+}
+
 int
 CBuildDatabase::RegisterMaskingAlgorithm(EBlast_filter_program program,
                                          const string        & options,
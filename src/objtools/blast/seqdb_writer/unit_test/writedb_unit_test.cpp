@@ -1315,6 +1315,95 @@ BOOST_AUTO_TEST_CASE(MultiVolume)
     s_WrapUpFiles(f);
 }
 
+static void
+s_BuildProtWithThreads(const string   & dbname,
+                       int              num_threads,
+                       bool             parse_ids,
+                       vector<string> & files)
+{
+    CNcbiIfstream fasta("data/some_prots.fsa");
+    CFastaReader fr(fasta, CFastaReader::fAssumeProt);
+
+    CWriteDB db(dbname,
+                CWriteDB::eProtein,
+                "title",
+                parse_ids ? CWriteDB::eFullIndex : CWriteDB::eNoIndex,
+                parse_ids);
+
+    // Several volumes, so that OIDs restart within a batch.
+    db.SetMaxVolumeLetters(2000);
+    db.SetMaskedLetters("PQ");
+    db.SetNumThreads(num_threads);
+
+    while (! fr.AtEOF()) {
+        CRef<CSeq_entry> entry = fr.ReadOneSeq();
+        db.AddSequence(entry->GetSeq());
+    }
+
+    db.Close();
+    db.ListFiles(files);
+}
+
+static string s_ReadFile(const string & fname)
+{
+    CNcbiIfstream in(fname.c_str(), IOS_BASE::binary);
+    CNcbiOstrstream oss;
+    oss << in.rdbuf();
+    return CNcbiOstrstreamToString(oss);
+}
+
+// Check that two builds of the same database produced the same files.
+
+static void s_CompareDbFiles(const vector<string> & f1,
+                             const vector<string> & f2)
+{
+    BOOST_REQUIRE_EQUAL(f1.size(), f2.size());
+    BOOST_REQUIRE(f1.size() > 8);
+
+    for(unsigned i = 0; i < f1.size(); i++) {
+        string ext = s_ExtractLast(f1[i], ".");
+
+        // The index and alias files carry the creation time.
+        if (ext == "pin" || ext == "pal") {
+            continue;
+        }
+        BOOST_REQUIRE_EQUAL(ext, s_ExtractLast(f2[i], "."));
+        BOOST_REQUIRE(s_ReadFile(f1[i]) == s_ReadFile(f2[i]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(MultiThreadedBuild)
+{
+    for(int parse_ids = 0; parse_ids < 2; parse_ids++) {
+        vector<string> f1, f2;
+        s_BuildProtWithThreads("mt_serial", 1, parse_ids != 0, f1);
+        s_BuildProtWithThreads("mt_parallel", 4, parse_ids != 0, f2);
+
+        s_CompareDbFiles(f1, f2);
+
+        s_WrapUpFiles(f1);
+        s_WrapUpFiles(f2);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(IsamExternalSort)
+{
+    vector<string> f1, f2;
+    s_BuildProtWithThreads("isam_memory", 1, true, f1);
+
+    // A tiny budget makes every volume's ISAM keys spill to runs.
+    CNcbiApplication::Instance()->SetEnvironment("BLASTDB_ISAM_SORT_MEMORY",
+                                                 "1KB");
+    s_BuildProtWithThreads("isam_runs", 1, true, f2);
+    CNcbiApplication::Instance()->SetEnvironment().Unset(
+                                                 "BLASTDB_ISAM_SORT_MEMORY");
+
+    s_CompareDbFiles(f1, f2);
+
+    s_WrapUpFiles(f1);
+    s_WrapUpFiles(f2);
+}
+
 BOOST_AUTO_TEST_CASE(UsPatId)
 {
 
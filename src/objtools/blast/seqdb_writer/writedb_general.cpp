@@ -39,8 +39,23 @@ USING_SCOPE(std);
 
 void CWriteDB_PackedSemiTree::Sort()
 {
+    // Each prefix has its own list, so the lists can be sorted in
+    // parallel.
+
+    vector<TPacked *> lists;
+    lists.reserve(m_Packed.size());
+
     NON_CONST_ITERATE(TPackedMap, iter, m_Packed) {
-        iter->second->Sort();
+        lists.push_back(iter->second.GetPointer());
+    }
+
+    int num_lists = (int) lists.size();
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic) if(m_Size >= (1 << 16))
+#endif
+    for(int i = 0; i < num_lists; i++) {
+        lists[i]->Sort();
     }
 }
 
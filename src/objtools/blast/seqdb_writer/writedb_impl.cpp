@@ -78,7 +78,8 @@ CWriteDB_Impl::CWriteDB_Impl(const string & dbname,
       m_HaveSequence     (false),
       m_LongSeqId        (long_ids),
       m_LmdbOid          (0),
-      m_limitDefline     (protein? limit_defline: false)
+      m_limitDefline     (protein? limit_defline: false),
+      m_NumThreads       (1)
 {
     CTime now(CTime::eCurrent);
 
@@ -324,6 +325,7 @@ void CWriteDB_Impl::Close()
     m_Closed = true;
 
     x_Publish();
+    x_FlushPending();
     m_Sequence.erase();
     m_Ambig.erase();
 
@@ -907,21 +909,28 @@ void CWriteDB_Impl::x_CookHeader()
 
 void CWriteDB_Impl::x_CookIds()
 {
-    if (! m_Ids.empty()) {
+    x_CookIds(m_Deflines, m_BinHdr, m_Ids);
+}
+
+void CWriteDB_Impl::x_CookIds(CConstRef<CBlast_def_line_set> & deflines,
+                              const string                   & bin_hdr,
+                              vector< CRef<CSeq_id> >        & ids_out)
+{
+    if (! ids_out.empty()) {
         return;
     }
 
-    if (m_Deflines.Empty()) {
-        if (m_BinHdr.empty()) {
+    if (deflines.Empty()) {
+        if (bin_hdr.empty()) {
             NCBI_THROW(CWriteDBException,
                        eArgErr,
                        "Error: Cannot find IDs or deflines.");
         }
 
-        x_SetDeflinesFromBinary(m_BinHdr, m_Deflines);
+        x_SetDeflinesFromBinary(bin_hdr, deflines);
     }
 
-    ITERATE(list< CRef<CBlast_def_line> >, iter, m_Deflines->Get()) {
+    ITERATE(list< CRef<CBlast_def_line> >, iter, deflines->Get()) {
         const list< CRef<CSeq_id> > & ids = (**iter).GetSeqid();
         // m_Ids.insert(m_Ids.end(), ids.begin(), ids.end());
         // Spelled out for WorkShop. :-/
@@ -929,17 +938,22 @@ void CWriteDB_Impl::x_CookIds()
         // the following line is, on the contrary, very inefficient. 
         // m_Ids.reserve(m_Ids.size() + ids.size());
         ITERATE (list<CRef<CSeq_id> >, it, ids) {
-            m_Ids.push_back(*it);
+            ids_out.push_back(*it);
         }
     }
 }
 
 void CWriteDB_Impl::x_MaskSequence()
+{
+    x_MaskSequence(m_Sequence);
+}
+
+void CWriteDB_Impl::x_MaskSequence(string & sequence) const
 {
     // Scan and mask the sequence itself.
-    for(unsigned i = 0; i < m_Sequence.size(); i++) {
-        if (m_MaskLookup[m_Sequence[i] & 0xFF] != 0) {
-            m_Sequence[i] = m_MaskByte[0];
+    for(unsigned i = 0; i < sequence.size(); i++) {
+        if (m_MaskLookup[sequence[i] & 0xFF] != 0) {
+            sequence[i] = m_MaskByte[0];
         }
     }
 }
@@ -983,44 +997,7 @@ void CWriteDB_Impl::x_CookSequence()
     const CSeq_inst & si = m_Bioseq->GetInst();
 
     if (m_Bioseq->GetInst().CanGetSeq_data()) {
-        const CSeq_data & sd = si.GetSeq_data();
-
-        string msg;
-
-        switch(sd.Which()) {
-        case CSeq_data::e_Ncbistdaa:
-            WriteDB_StdaaToBinary(si, m_Sequence);
-            break;
-
-        case CSeq_data::e_Ncbieaa:
-            WriteDB_EaaToBinary(si, m_Sequence);
-            break;
-
-        case CSeq_data::e_Iupacaa:
-            WriteDB_IupacaaToBinary(si, m_Sequence);
-            break;
-
-        case CSeq_data::e_Ncbi2na:
-            WriteDB_Ncbi2naToBinary(si, m_Sequence);
-            break;
-
-        case CSeq_data::e_Ncbi4na:
-            WriteDB_Ncbi4naToBinary(si, m_Sequence, m_Ambig);
-            break;
-
-        case CSeq_data::e_Iupacna:
-             WriteDB_IupacnaToBinary(si, m_Sequence, m_Ambig);
-             break;
-
-        default:
-            msg = "Unable to process sequence for entry [";
-            msg += (m_Bioseq->GetId().front())->GetSeqIdString(false);
-            msg += "].";
-        }
-
-        if (! msg.empty()) {
-            NCBI_THROW(CWriteDBException, eArgErr, msg);
-        }
+        x_CookSeqData(*m_Bioseq, m_Sequence, m_Ambig);
     } else {
         int sz = m_SeqVector.size();
 
@@ -1062,6 +1039,51 @@ void CWriteDB_Impl::x_CookSequence()
     }
 }
 
+void CWriteDB_Impl::x_CookSeqData(const CBioseq & bioseq,
+                                  string        & seq,
+                                  string        & ambig)
+{
+    const CSeq_inst & si = bioseq.GetInst();
+    const CSeq_data & sd = si.GetSeq_data();
+
+    string msg;
+
+    switch(sd.Which()) {
+    case CSeq_data::e_Ncbistdaa:
+        WriteDB_StdaaToBinary(si, seq);
+        break;
+
+    case CSeq_data::e_Ncbieaa:
+        WriteDB_EaaToBinary(si, seq);
+        break;
+
+    case CSeq_data::e_Iupacaa:
+        WriteDB_IupacaaToBinary(si, seq);
+        break;
+
+    case CSeq_data::e_Ncbi2na:
+        WriteDB_Ncbi2naToBinary(si, seq);
+        break;
+
+    case CSeq_data::e_Ncbi4na:
+        WriteDB_Ncbi4naToBinary(si, seq, ambig);
+        break;
+
+    case CSeq_data::e_Iupacna:
+         WriteDB_IupacnaToBinary(si, seq, ambig);
+         break;
+
+    default:
+        msg = "Unable to process sequence for entry [";
+        msg += (bioseq.GetId().front())->GetSeqIdString(false);
+        msg += "].";
+    }
+
+    if (! msg.empty()) {
+        NCBI_THROW(CWriteDBException, eArgErr, msg);
+    }
+}
+
 void CWriteDB_Impl::x_CookColumns()
 {
 }
@@ -1115,7 +1137,18 @@ void CWriteDB_Impl::x_Publish()
         return;
     }
 
+    if (m_NumThreads > 1) {
+        x_QueueSequence();
+        return;
+    }
+
+    x_CreateLmdb();
+    x_CookData();
+    x_WriteSequence();
+}
 
+void CWriteDB_Impl::x_CreateLmdb()
+{
     if(m_DbVersion == eBDB_Version5 && m_Lmdbdb.Empty()) {
         const string lmdb_fname_w_path = BuildLMDBFileName(m_Dbname, m_Protein);
         Uint8 map_size = 0;
@@ -1135,9 +1168,10 @@ void CWriteDB_Impl::x_Publish()
         		          GetFileNameFromExistingLMDBFile(lmdb_fname_w_path, ELMDBFileType::eTaxId2Offsets)));
         }
     }
+}
 
-    x_CookData();
-
+void CWriteDB_Impl::x_WriteSequence()
+{
     bool done = false;
 
     if (! m_Volume.Empty()) {
@@ -1221,6 +1255,153 @@ void CWriteDB_Impl::x_Publish()
     }
 }
 
+/// Number of queued sequences per thread that triggers a flush.
+static const int kPendingPerThread = 256;
+
+void CWriteDB_Impl::x_SwapSequenceData(SPendingSequence & pending)
+{
+    m_Bioseq.Swap(pending.bioseq);
+    swap(m_SeqVector, pending.seq_vector);
+    m_Deflines.Swap(pending.deflines);
+    m_Ids.swap(pending.ids);
+    m_Linkouts.swap(pending.linkouts);
+    m_Memberships.swap(pending.memberships);
+    swap(m_Pig, pending.pig);
+    swap(m_Hash, pending.hash);
+    swap(m_SeqLength, pending.seq_length);
+    m_Sequence.swap(pending.sequence);
+    m_Ambig.swap(pending.ambig);
+    m_BinHdr.swap(pending.bin_hdr);
+    m_TaxIds.swap(pending.tax_ids);
+    m_Blobs.swap(pending.blobs);
+    m_HaveBlob.swap(pending.have_blob);
+}
+
+void CWriteDB_Impl::x_QueueSequence()
+{
+    m_Pending.push_back(SPendingSequence());
+    SPendingSequence & pending = m_Pending.back();
+
+    x_SwapSequenceData(pending);
+    pending.orig_deflines = pending.deflines;
+
+    // The blobs now belong to the queued sequence, so the next
+    // sequence needs a set of its own.
+    for(size_t i = 0; i < pending.blobs.size(); i++) {
+        m_Blobs.push_back(CRef<CBlastDbBlob>(new CBlastDbBlob));
+    }
+    m_HaveBlob.resize(pending.have_blob.size(), 0);
+
+    if ((int) m_Pending.size() >= m_NumThreads * kPendingPerThread) {
+        x_FlushPending();
+    }
+}
+
+void CWriteDB_Impl::x_CookPending(SPendingSequence & pending) const
+{
+    // Sequence data only reachable through a CSeqVector goes through
+    // the object manager, so it is converted when the sequence is
+    // written instead.
+    bool need_seq = pending.sequence.empty();
+
+    if (need_seq &&
+        ! (pending.bioseq.NotEmpty() &&
+           pending.bioseq->CanGetInst() &&
+           pending.bioseq->GetInst().CanGetSeq_data())) {
+        return;
+    }
+
+    try {
+        x_ExtractDeflines(pending.bioseq,
+                          pending.deflines,
+                          pending.bin_hdr,
+                          pending.memberships,
+                          pending.linkouts,
+                          pending.pig,
+                          pending.tax_ids,
+                          pending.oid,
+                          m_ParseIDs,
+                          m_LongSeqId,
+                          m_limitDefline);
+
+        x_CookIds(pending.deflines, pending.bin_hdr, pending.ids);
+
+        if (need_seq) {
+            x_CookSeqData(*pending.bioseq, pending.sequence, pending.ambig);
+        }
+
+        if (m_Protein && m_MaskedLetters.size()) {
+            x_MaskSequence(pending.sequence);
+        }
+
+        pending.cooked = true;
+    }
+    catch (...) {
+        // Leave the sequence as it was queued; cooking it again when
+        // it is written reports the error in order.
+        pending.deflines = pending.orig_deflines;
+        pending.bin_hdr.erase();
+        pending.ids.clear();
+        pending.tax_ids.clear();
+        if (need_seq) {
+            pending.sequence.erase();
+            pending.ambig.erase();
+        }
+    }
+}
+
+void CWriteDB_Impl::x_FlushPending()
+{
+    if (m_Pending.empty()) {
+        return;
+    }
+
+    vector<SPendingSequence> pending;
+    pending.swap(m_Pending);
+
+    // Without parsed IDs the header embeds the OID; predict it here
+    // and cook the header again below if a new volume is started.
+    int num_pending = (int) pending.size();
+    int first_oid = m_Volume.NotEmpty() ? m_Volume->GetOID() : 0;
+
+    for(int i = 0; i < num_pending; i++) {
+        pending[i].oid = m_ParseIDs ? -1 : first_oid + i;
+    }
+
+#ifdef _OPENMP
+    #pragma omp parallel for num_threads(m_NumThreads) schedule(dynamic, 16)
+#endif
+    for(int i = 0; i < num_pending; i++) {
+        x_CookPending(pending[i]);
+    }
+
+    NON_CONST_ITERATE(vector<SPendingSequence>, iter, pending) {
+        x_SwapSequenceData(*iter);
+
+        x_CreateLmdb();
+
+        if (! iter->cooked) {
+            x_CookData();
+        } else if (! m_ParseIDs &&
+                   iter->oid != (m_Volume.NotEmpty() ? m_Volume->GetOID() : 0)) {
+            m_Deflines = iter->orig_deflines;
+            m_BinHdr.erase();
+            m_Ids.clear();
+            m_TaxIds.clear();
+            x_CookHeader();
+        }
+
+        x_WriteSequence();
+        x_SwapSequenceData(*iter);
+    }
+}
+
+void CWriteDB_Impl::SetNumThreads(int num_threads)
+{
+    x_FlushPending();
+    m_NumThreads = max(num_threads, 1);
+}
+
 void CWriteDB_Impl::SetDeflines(const CBlast_def_line_set & deflines)
 {
     CRef<CBlast_def_line_set>
@@ -1476,6 +1657,8 @@ int CWriteDB_Impl::CreateColumn(const string & title, bool mbo)
 {
     _ASSERT(FindColumn(title) == -1);
 
+    x_FlushPending();
+
     size_t col_id = m_Blobs.size() / 2;
 
     _ASSERT(m_HaveBlob.size()     == col_id);
@@ -1544,11 +1727,13 @@ void CWriteDB_Impl::SetPig(int pig)
 
 void CWriteDB_Impl::SetMaxFileSize(Uint8 sz)
 {
+    x_FlushPending();
     m_MaxFileSize = sz;
 }
 
 void CWriteDB_Impl::SetMaxVolumeLetters(Uint8 sz)
 {
+    x_FlushPending();
     m_MaxVolumeLetters = sz;
 }
 
@@ -1634,6 +1819,8 @@ void CWriteDB_Impl::SetMaskedLetters(const string & masked)
 
 void CWriteDB_Impl::ListVolumes(vector<string> & vols)
 {
+    x_FlushPending();
+
     vols.clear();
 
     ITERATE(vector< CRef<CWriteDB_Volume> >, iter, m_VolumeList) {
@@ -1643,6 +1830,8 @@ void CWriteDB_Impl::ListVolumes(vector<string> & vols)
 
 void CWriteDB_Impl::ListFiles(vector<string> & files)
 {
+    x_FlushPending();
+
     files.clear();
 
     ITERATE(vector< CRef<CWriteDB_Volume> >, iter, m_VolumeList) {
@@ -206,6 +206,17 @@ public:
     /// @param sz Maximum sequence letters per volume.
     void SetMaxVolumeLetters(Uint8 sz);
 
+    /// Set the number of threads used to prepare sequences.
+    ///
+    /// With more than one thread, published sequences are queued and
+    /// their headers and sequence data are converted to the on-disk
+    /// format in parallel batches; the converted sequences are then
+    /// appended to the volumes in their original order, so the files
+    /// produced are the same as with a single thread.
+    ///
+    /// @param num_threads Number of threads to use.
+    void SetNumThreads(int num_threads);
+
     /// Extract deflines from a CBioseq.
     ///
     /// Given a CBioseq, this method extracts and returns header info
@@ -432,6 +443,74 @@ private:
     /// Replace masked input letters with m_MaskByte value.
     void x_MaskSequence();
 
+    /// Replace masked input letters in a sequence with m_MaskByte value.
+    /// @param sequence Sequence data in the on-disk format. [in|out]
+    void x_MaskSequence(string & sequence) const;
+
+    /// Convert the Seq-data of a Bioseq into the on-disk format.
+    /// @param bioseq Bioseq with Seq-data. [in]
+    /// @param seq Sequence data in the on-disk format. [out]
+    /// @param ambig Nucleotide ambiguities in the on-disk format. [out]
+    static void x_CookSeqData(const CBioseq & bioseq,
+                              string        & seq,
+                              string        & ambig);
+
+    /// Collect ids for ISAM files from a defline set.
+    /// @param deflines Deflines, built from bin_hdr if empty. [in|out]
+    /// @param bin_hdr Binary header. [in]
+    /// @param ids Ids of all deflines. [out]
+    static void x_CookIds(CConstRef<CBlast_def_line_set> & deflines,
+                          const string                   & bin_hdr,
+                          vector< CRef<CSeq_id> >        & ids);
+
+    /// Create the LMDB and taxonomy writers if they are needed.
+    void x_CreateLmdb();
+
+    /// Append the cooked sequence data to the current volume.
+    ///
+    /// A new volume is started if the current one is full.
+    void x_WriteSequence();
+
+    /// Queue the accumulated sequence data for batched publication.
+    void x_QueueSequence();
+
+    /// Cook the queued sequences in parallel and write them in order.
+    void x_FlushPending();
+
+    /// Sequence data accumulated for a queued sequence.
+    struct SPendingSequence {
+        SPendingSequence() : pig(0), hash(0), seq_length(0), oid(-1),
+                             cooked(false) {}
+
+        CConstRef<CBioseq> bioseq;               ///< Bioseq object.
+        CSeqVector seq_vector;                   ///< SeqVector, if any.
+        CConstRef<CBlast_def_line_set> deflines; ///< Deflines.
+        CConstRef<CBlast_def_line_set> orig_deflines; ///< Uncooked deflines.
+        vector< CRef<CSeq_id> > ids;             ///< Ids for ISAM files.
+        vector< vector<int> > linkouts;          ///< Linkout bits.
+        vector< vector<int> > memberships;       ///< Membership bits.
+        int pig;                                 ///< PIG for headers.
+        int hash;                                ///< Sequence hash.
+        int seq_length;                          ///< Sequence length.
+        string sequence;                         ///< On-disk sequence.
+        string ambig;                            ///< On-disk ambiguities.
+        string bin_hdr;                          ///< Binary header.
+        set<TTaxId> tax_ids;                     ///< Taxids of deflines.
+        vector< CRef<CBlastDbBlob> > blobs;      ///< Column blobs.
+        vector<int> have_blob;                   ///< Active blob columns.
+        int oid;                                 ///< OID the header assumed.
+        bool cooked;                             ///< True if cooked.
+    };
+
+    /// Exchange the accumulated sequence data with a queued sequence.
+    /// @param pending Queued sequence. [in|out]
+    void x_SwapSequenceData(SPendingSequence & pending);
+
+    /// Cook a queued sequence; called concurrently for different
+    /// sequences, so it only reads the state of this object.
+    /// @param pending Queued sequence. [in|out]
+    void x_CookPending(SPendingSequence & pending) const;
+
     /// Get binary version of deflines from 'user' data in Bioseq.
     ///
     /// Some CBioseq objects (e.g. those from CSeqDB) have an ASN.1
@@ -643,6 +722,12 @@ private:
     int m_LmdbOid;
 
     bool m_limitDefline;
+
+    /// Number of threads used to cook queued sequences.
+    int m_NumThreads;
+
+    /// Sequences published but not yet written, in OID order.
+    vector<SPendingSequence> m_Pending;
 };
 
 END_NCBI_SCOPE
@@ -41,6 +41,11 @@
 #include <objects/general/general__.hpp>
 #include <stdio.h>
 #include <sstream>
+#include <queue>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 BEGIN_NCBI_SCOPE
 
@@ -95,6 +100,201 @@ s_IsamExtension(EWriteDBIsamType itype,
     return extn;
 }
 
+/// Default memory budget for the keys of one ISAM index.
+static const Uint8 kDefaultSortMemory = NCBI_CONST_UINT8(2) << 30;
+
+/// Minimum number of keys for which sorting is done in parallel.
+static const int kMinParallelSort = 1 << 16;
+
+/// Key ordering used by CWriteDB_PackedSemiTree.
+///
+/// The first PREFIX bytes are compared as CArrayString does and the
+/// rest with strcmp, so that merged runs come out in the same order
+/// as keys sorted in memory.
+struct SWriteDB_IsamKeyLess {
+    /// Compare two string keys.
+    bool operator()(const string & a, const string & b) const
+    {
+        const size_t kPrefix = CWriteDB_PackedSemiTree::PREFIX;
+        size_t la = min(a.size(), kPrefix), lb = min(b.size(), kPrefix);
+
+        int c = CArrayString<kPrefix>(a.data(), (int) la).Cmp(
+                CArrayString<kPrefix>(b.data(), (int) lb));
+        if (c != 0) {
+            return c < 0;
+        }
+        return strcmp(a.c_str() + la, b.c_str() + lb) < 0;
+    }
+
+    /// Compare two numeric keys.
+    bool operator()(const pair<Int8, int> & a,
+                    const pair<Int8, int> & b) const
+    {
+        return a < b;
+    }
+};
+
+/// Write a string key to a run file.
+static void s_WriteRunKey(CNcbiOstream & out, const string & key)
+{
+    Int4 size = (Int4) key.size();
+    out.write((const char *) & size, sizeof(size));
+    out.write(key.data(), size);
+}
+
+/// Write a numeric key to a run file.
+static void s_WriteRunKey(CNcbiOstream & out, const pair<Int8, int> & key)
+{
+    out.write((const char *) & key.first, sizeof(key.first));
+    out.write((const char *) & key.second, sizeof(key.second));
+}
+
+/// Read a string key from a run file.
+static bool s_ReadRunKey(CNcbiIstream & in, string & key)
+{
+    Int4 size = 0;
+    if (! in.read((char *) & size, sizeof(size))) {
+        return false;
+    }
+    key.resize(size);
+    return (bool) in.read(& key[0], size);
+}
+
+/// Read a numeric key from a run file.
+static bool s_ReadRunKey(CNcbiIstream & in, pair<Int8, int> & key)
+{
+    in.read((char *) & key.first, sizeof(key.first));
+    in.read((char *) & key.second, sizeof(key.second));
+    return (bool) in;
+}
+
+/// K-way merge of sorted runs of ISAM keys.
+///
+/// Each run file holds keys in sorted order; keys are returned in
+/// sorted order across all runs.  Duplicate keys are returned once
+/// per run that contains them, as the caller removes duplicates.
+template<class TKey>
+class CWriteDB_IsamRunMerge {
+public:
+    /// Open the run files.
+    /// @param runs Names of the run files. [in]
+    CWriteDB_IsamRunMerge(const vector<string> & runs)
+    {
+        for(size_t i = 0; i < runs.size(); i++) {
+            CRef<CRunFile> file(new CRunFile(runs[i]));
+
+            if (! file->m_Stream) {
+                NCBI_THROW(CWriteDBException, eFileErr,
+                           "Cannot open ISAM sort run " + runs[i]);
+            }
+            m_Files.push_back(file);
+            x_Advance(i);
+        }
+    }
+
+    /// Get the next key.
+    /// @param key The next key in sorted order. [out]
+    /// @return False if all runs are exhausted.
+    bool Next(TKey & key)
+    {
+        if (m_Heap.empty()) {
+            return false;
+        }
+
+        size_t run = m_Heap.top().second;
+        key = m_Heap.top().first;
+        m_Heap.pop();
+        x_Advance(run);
+
+        return true;
+    }
+
+private:
+    /// A run file being merged.
+    struct CRunFile : public CObject {
+        CRunFile(const string & fname)
+            : m_Stream(fname.c_str(), IOS_BASE::in | IOS_BASE::binary)
+        {
+        }
+
+        CNcbiIfstream m_Stream;
+    };
+
+    /// The next key of a run, with the index of the run.
+    typedef pair<TKey, size_t> THead;
+
+    /// Orders the heap so that the smallest key is on top.
+    struct SHeadGreater {
+        bool operator()(const THead & a, const THead & b) const
+        {
+            SWriteDB_IsamKeyLess less;
+
+            if (less(b.first, a.first)) {
+                return true;
+            }
+            if (less(a.first, b.first)) {
+                return false;
+            }
+            return a.second > b.second;
+        }
+    };
+
+    /// Read the next key of a run into the heap.
+    void x_Advance(size_t run)
+    {
+        THead head;
+        head.second = run;
+
+        if (s_ReadRunKey(m_Files[run]->m_Stream, head.first)) {
+            m_Heap.push(head);
+        }
+    }
+
+    /// Open run files.
+    vector< CRef<CRunFile> > m_Files;
+
+    /// The next key of each run that is not exhausted.
+    priority_queue< THead, vector<THead>, SHeadGreater > m_Heap;
+};
+
+/// Sort a table of numeric keys.
+///
+/// Large tables are split into one chunk per thread; the chunks are
+/// sorted in parallel and then merged pairwise.
+template<class TElem>
+static void s_SortNumbers(vector<TElem> & table)
+{
+#ifdef _OPENMP
+    int size = (int) table.size();
+    int nchunks = omp_get_max_threads();
+
+    if (size >= kMinParallelSort  &&  nchunks > 1) {
+        int chunk = s_DivideRoundUp(size, nchunks);
+
+        #pragma omp parallel for
+        for(int i = 0; i < nchunks; i++) {
+            int b = min(i * chunk, size), e = min(b + chunk, size);
+            sort(table.begin() + b, table.begin() + e);
+        }
+
+        for(int width = chunk; width < size; width *= 2) {
+            int npairs = s_DivideRoundUp(size, 2 * width);
+
+            #pragma omp parallel for
+            for(int i = 0; i < npairs; i++) {
+                int b = i * 2 * width;
+                int m = min(b + width, size), e = min(b + 2 * width, size);
+                inplace_merge(table.begin() + b,
+                              table.begin() + m,
+                              table.begin() + e);
+            }
+        }
+        return;
+    }
+#endif
+    sort(table.begin(), table.end());
+}
+
 CWriteDB_Isam::CWriteDB_Isam(EIsamType      itype,
                              const string & dbname,
                              bool           protein,
@@ -176,8 +376,23 @@ CWriteDB_IsamIndex::CWriteDB_IsamIndex(EWriteDBIsamType        itype,
       m_DataFileSize (0),
       m_UseInt8      (false),
       m_DataFile     (datafile),
-      m_Oid          (-1)
+      m_Oid          (-1),
+      m_SortMemory   (kDefaultSortMemory),
+      m_StringBytes  (0),
+      m_NumSpilled   (0)
 {
+    const char * sort_mem = getenv("BLASTDB_ISAM_SORT_MEMORY");
+    if (sort_mem) {
+        Uint8 bytes = NStr::StringToUInt8_DataSize(sort_mem,
+                                                   NStr::fConvErr_NoThrow);
+        if (errno == 0) {
+            m_SortMemory = bytes;
+        } else {
+            ERR_POST(Warning << "Ignoring invalid BLASTDB_ISAM_SORT_MEMORY "
+                     "value '" << sort_mem << "'");
+        }
+    }
+
     // This is the one case where I don't worry about file size; if
     // the data file can hold the relevant data, the index file can
     // too.  The index file can be larger than the data file, but only
@@ -209,6 +424,7 @@ CWriteDB_IsamIndex::CWriteDB_IsamIndex(EWriteDBIsamType        itype,
 CWriteDB_IsamIndex::~CWriteDB_IsamIndex()
 {
     m_OidStringData.clear();
+    x_RemoveRuns();
 }
 
 void CWriteDB_IsamIndex::x_WriteHeader()
@@ -224,7 +440,7 @@ void CWriteDB_IsamIndex::x_WriteHeader()
     case eTrace:
         // numeric w/ int4 data or numeric w/ int8 data.
         isam_type = m_UseInt8 ? eIsamNumericLong : eIsamNumericType;
-        num_terms = (int) m_NumberTable.size();
+        num_terms = (int) m_NumberTable.size() + m_NumSpilled;
         max_line_size = 0;
         break;
 
@@ -232,7 +448,7 @@ void CWriteDB_IsamIndex::x_WriteHeader()
     case eHash:
         isam_type = eIsamStringType; // string w/ data
         max_line_size = eMaxStringLine;
-        num_terms = m_StringSort.Size();
+        num_terms = m_StringSort.Size() + m_NumSpilled;
         break;
 
     default:
@@ -261,7 +477,7 @@ void CWriteDB_IsamIndex::x_WriteHeader()
 
 void CWriteDB_IsamIndex::x_FlushStringIndex()
 {
-    _ASSERT(m_StringSort.Size());
+    _ASSERT(m_StringSort.Size() || m_Runs.size());
 
     // Note: This function can take a noticeable portion of the
     // database dumping time.  For some databases, the length of the
@@ -274,7 +490,7 @@ void CWriteDB_IsamIndex::x_FlushStringIndex()
     // index file, then finally the list of keys.
 
     int data_pos = 0;
-    unsigned count = m_StringSort.Size();
+    unsigned count = m_StringSort.Size() + m_NumSpilled;
 
     unsigned nsamples = s_DivideRoundUp(count, m_PageSize);
 
@@ -297,7 +513,17 @@ void CWriteDB_IsamIndex::x_FlushStringIndex()
     int output_count = 0;
     int index = 0;
 
-    m_StringSort.Sort();
+    // If some keys were spilled to disk, the rest are spilled too and
+    // the keys are read back by merging the runs.
+
+    AutoPtr< CWriteDB_IsamRunMerge<string> > merge;
+
+    if (m_Runs.size()) {
+        x_SpillRun();
+        merge.reset(new CWriteDB_IsamRunMerge<string>(m_Runs));
+    } else {
+        m_StringSort.Sort();
+    }
 
     CWriteDB_PackedSemiTree::Iterator iter = m_StringSort.Begin();
     CWriteDB_PackedSemiTree::Iterator end_iter = m_StringSort.End();
@@ -310,12 +536,22 @@ void CWriteDB_IsamIndex::x_FlushStringIndex()
     element.resize(1);
     element[0] = char(0);
 
-    while(iter != end_iter) {
+    for(;;) {
         prev_elem.swap(element);
-        iter.Get(element);
 
-        if (prev_elem == element) {
+        if (merge.get()) {
+            if (! merge->Next(element)) {
+                break;
+            }
+        } else {
+            if (iter == end_iter) {
+                break;
+            }
+            iter.Get(element);
             ++iter;
+        }
+
+        if (prev_elem == element) {
             continue;
         }
 
@@ -349,8 +585,6 @@ void CWriteDB_IsamIndex::x_FlushStringIndex()
 
         data_pos = m_DataFile->Write(element);
         index ++;
-
-        ++iter;
     }
 
     // Write the final data position.
@@ -376,15 +610,26 @@ void CWriteDB_IsamIndex::x_FlushStringIndex()
 
 void CWriteDB_IsamIndex::x_FlushNumericIndex()
 {
-    _ASSERT(m_NumberTable.size());
+    _ASSERT(m_NumberTable.size() || m_Runs.size());
 
     int row_index = 0;
 
-    sort(m_NumberTable.begin(), m_NumberTable.end());
+    // If some keys were spilled to disk, the rest are spilled too and
+    // the keys are read back by merging the runs.
+
+    AutoPtr< CWriteDB_IsamRunMerge< pair<Int8, int> > > merge;
+
+    if (m_Runs.size()) {
+        x_SpillRun();
+        merge.reset(new CWriteDB_IsamRunMerge< pair<Int8, int> >(m_Runs));
+    } else {
+        s_SortNumbers(m_NumberTable);
+    }
 
     int count = (int) m_NumberTable.size();
 
-    const SIdOid * prevp = 0;
+    SIdOid elem(0, 0), prev(0, 0);
+    bool have_prev = false;
 
     // Note: could strip out code for 8/4 detection; then reorder this
     // to sort the table first.  At that point, 8 byte detection could
@@ -398,13 +643,16 @@ void CWriteDB_IsamIndex::x_FlushNumericIndex()
     // used for numeric or just for TI indices.
 
     if (m_UseInt8) {
-        for(int i = 0; i < count; i++) {
-            const SIdOid & elem = m_NumberTable[i];
+        for(int i = 0; merge.get() ? merge->Next(elem) : i < count; i++) {
+            if (! merge.get()) {
+                elem = m_NumberTable[i];
+            }
 
-            if (prevp && (*prevp == elem)) {
+            if (have_prev && (prev == elem)) {
                 continue;
             } else {
-                prevp = & elem;
+                prev = elem;
+                have_prev = true;
             }
 
             if ((row_index & (m_PageSize-1)) == 0) {
@@ -422,13 +670,16 @@ void CWriteDB_IsamIndex::x_FlushNumericIndex()
         WriteInt8(-1);
         WriteInt4(0);
     } else {
-        for(int i = 0; i < count; i++) {
-            const SIdOid & elem = m_NumberTable[i];
+        for(int i = 0; merge.get() ? merge->Next(elem) : i < count; i++) {
+            if (! merge.get()) {
+                elem = m_NumberTable[i];
+            }
 
-            if (prevp && (*prevp == elem)) {
+            if (have_prev && (prev == elem)) {
                 continue;
             } else {
-                prevp = & elem;
+                prev = elem;
+                have_prev = true;
             }
 
             if ((row_index & (m_PageSize-1)) == 0) {
@@ -450,7 +701,7 @@ void CWriteDB_IsamIndex::x_FlushNumericIndex()
 
 void CWriteDB_IsamIndex::x_Flush()
 {
-    if (m_NumberTable.size() || m_StringSort.Size()) {
+    if (m_NumberTable.size() || m_StringSort.Size() || m_Runs.size()) {
         Create();
         m_DataFile->Create();
 
@@ -485,6 +736,8 @@ void CWriteDB_IsamIndex::AddIds(int oid, const TIdList & idlist)
                    eArgErr,
                    "Cannot call AddIds() for this index type.");
     }
+
+    x_CheckSortMemory();
 }
 
 void CWriteDB_IsamIndex::AddPig(int oid, int pig)
@@ -492,6 +745,8 @@ void CWriteDB_IsamIndex::AddPig(int oid, int pig)
     SIdOid row(pig, oid);
     m_NumberTable.push_back(row);
     m_DataFileSize += 8;
+
+    x_CheckSortMemory();
 }
 
 void CWriteDB_IsamIndex::AddHash(int oid, int hash)
@@ -500,6 +755,8 @@ void CWriteDB_IsamIndex::AddHash(int oid, int hash)
     int sz = sprintf(buf, "%u", (unsigned)hash);
 
     x_AddStringData(oid, buf, sz);
+
+    x_CheckSortMemory();
 }
 
 void CWriteDB_IsamIndex::x_AddGis(int oid, const TIdList & idlist)
@@ -760,6 +1017,7 @@ void CWriteDB_IsamIndex::x_AddStringData(int oid, const char * sbuf, int ssize)
     if (rv.second) {
         m_StringSort.Insert(buf, sz);
         m_DataFileSize += sz;
+        m_StringBytes += sz + 1 + sizeof(const char *);
     }
 }
 
@@ -807,8 +1065,85 @@ bool CWriteDB_IsamIndex::CanFit(int num)
 void CWriteDB_IsamIndex::x_Free()
 {
     m_StringSort.Clear();
+    m_StringBytes = 0;
     vector<SIdOid> tmp;
     m_NumberTable.swap(tmp);
+    x_RemoveRuns();
+}
+
+void CWriteDB_IsamIndex::x_CheckSortMemory()
+{
+    Uint8 used = m_StringBytes + m_NumberTable.capacity() * sizeof(SIdOid);
+
+    if (m_SortMemory  &&  used > m_SortMemory) {
+        x_SpillRun();
+    }
+}
+
+void CWriteDB_IsamIndex::x_SpillRun()
+{
+    // Runs can be as large as the index, so keep them next to the
+    // database rather than in the temporary directory, which is often
+    // small
+    string dir = CDirEntry(GetFilename()).GetDir();
+    string fname = CFile::GetTmpNameEx(dir, CDirEntry(GetFilename()).GetName()
+                                       + ".", CFile::eTmpFileCreate);
+    if (fname.empty()) {
+        NCBI_THROW(CWriteDBException, eFileErr,
+                   "Cannot create a sort run file in " + dir);
+    }
+    m_Runs.push_back(fname);
+
+    CNcbiOfstream out(fname.c_str(), IOS_BASE::out | IOS_BASE::binary);
+
+    if (m_Type == eAcc || m_Type == eHash) {
+        m_StringSort.Sort();
+
+        CWriteDB_PackedSemiTree::Iterator iter = m_StringSort.Begin();
+        CWriteDB_PackedSemiTree::Iterator end_iter = m_StringSort.End();
+
+        string element, prev_elem;
+
+        for(; iter != end_iter; ++iter) {
+            iter.Get(element);
+
+            if (element != prev_elem) {
+                s_WriteRunKey(out, element);
+                prev_elem.swap(element);
+            }
+        }
+
+        m_NumSpilled += m_StringSort.Size();
+        m_StringSort.Clear();
+        m_StringBytes = 0;
+    } else {
+        s_SortNumbers(m_NumberTable);
+
+        for(size_t i = 0; i < m_NumberTable.size(); i++) {
+            if (i == 0 || m_NumberTable[i] != m_NumberTable[i-1]) {
+                s_WriteRunKey(out, m_NumberTable[i]);
+            }
+        }
+
+        m_NumSpilled += (int) m_NumberTable.size();
+        vector<SIdOid> tmp;
+        m_NumberTable.swap(tmp);
+    }
+
+    out.flush();
+
+    if (! out) {
+        NCBI_THROW(CWriteDBException, eFileErr,
+                   "Cannot write ISAM sort run " + fname);
+    }
+}
+
+void CWriteDB_IsamIndex::x_RemoveRuns()
+{
+    ITERATE(vector<string>, iter, m_Runs) {
+        CFile(*iter).Remove();
+    }
+    m_Runs.clear();
 }
 
 void CWriteDB_Isam::ListFiles(vector<string> & files) const
@@ -826,6 +1161,7 @@ bool CWriteDB_IsamIndex::Empty() const
 
     return ! (m_StringSort.Size() ||
               m_NumberTable.size() ||
+              m_Runs.size() ||
               m_Created);
 }
 
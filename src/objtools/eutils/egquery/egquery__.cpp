@@ -0,0 +1,4 @@
+#include <ncbi_pch.hpp>
+#include "EGQueryResult.cpp"
+#include "Result.cpp"
+#include "ResultItem.cpp"
@@ -0,0 +1,5 @@
+#include <ncbi_pch.hpp>
+#include "EGQueryResult_.cpp"
+#include "Result_.cpp"
+#include "ResultItem_.cpp"
+#include "egquery_module.cpp"
@@ -0,0 +1,3 @@
+#include <ncbi_pch.hpp>
+#include "EHistoryItem.cpp"
+#include "EHistoryResult.cpp"
@@ -0,0 +1,4 @@
+#include <ncbi_pch.hpp>
+#include "EHistoryItem_.cpp"
+#include "EHistoryResult_.cpp"
+#include "ehistory_module.cpp"
@@ -0,0 +1,163 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'einfo.dtd'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objtools/eutils/einfo/Field.hpp>
+BEGIN_einfo_SCOPE // namespace einfo::
+
+
+// generated classes
+
+void CField_Base::ResetName(void)
+{
+    m_Name.erase();
+    m_set_State[0] &= ~0x3;
+}
+
+void CField_Base::ResetFullName(void)
+{
+    m_FullName.erase();
+    m_set_State[0] &= ~0xc;
+}
+
+void CField_Base::ResetDescription(void)
+{
+    m_Description.erase();
+    m_set_State[0] &= ~0x30;
+}
+
+void CField_Base::ResetTermCount(void)
+{
+    m_TermCount.erase();
+    m_set_State[0] &= ~0xc0;
+}
+
+void CField_Base::ResetIsDate(void)
+{
+    m_IsDate.erase();
+    m_set_State[0] &= ~0x300;
+}
+
+void CField_Base::ResetIsNumerical(void)
+{
+    m_IsNumerical.erase();
+    m_set_State[0] &= ~0xc00;
+}
+
+void CField_Base::ResetSingleToken(void)
+{
+    m_SingleToken.erase();
+    m_set_State[0] &= ~0x3000;
+}
+
+void CField_Base::ResetHierarchy(void)
+{
+    m_Hierarchy.erase();
+    m_set_State[0] &= ~0xc000;
+}
+
+void CField_Base::ResetIsHidden(void)
+{
+    m_IsHidden.erase();
+    m_set_State[0] &= ~0x30000;
+}
+
+void CField_Base::ResetIsRangable(void)
+{
+    m_IsRangable.erase();
+    m_set_State[0] &= ~0xc0000;
+}
+
+void CField_Base::ResetIsTruncatable(void)
+{
+    m_IsTruncatable.erase();
+    m_set_State[0] &= ~0x300000;
+}
+
+void CField_Base::Reset(void)
+{
+    ResetName();
+    ResetFullName();
+    ResetDescription();
+    ResetTermCount();
+    ResetIsDate();
+    ResetIsNumerical();
+    ResetSingleToken();
+    ResetHierarchy();
+    ResetIsHidden();
+    ResetIsRangable();
+    ResetIsTruncatable();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("Field", CField)
+{
+    SET_CLASS_MODULE("einfo");
+    ADD_NAMED_STD_MEMBER("Name", m_Name)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_STD_MEMBER("FullName", m_FullName)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_STD_MEMBER("Description", m_Description)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_STD_MEMBER("TermCount", m_TermCount)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_STD_MEMBER("IsDate", m_IsDate)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_STD_MEMBER("IsNumerical", m_IsNumerical)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_STD_MEMBER("SingleToken", m_SingleToken)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_STD_MEMBER("Hierarchy", m_Hierarchy)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_STD_MEMBER("IsHidden", m_IsHidden)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_STD_MEMBER("IsRangable", m_IsRangable)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_STD_MEMBER("IsTruncatable", m_IsTruncatable)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    info->RandomOrder();
+    info->CodeVersion(22100);
+    info->DataSpec(ncbi::EDataSpec::eDTD);
+}
+END_CLASS_INFO
+
+// constructor
+CField_Base::CField_Base(void)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CField_Base::~CField_Base(void)
+{
+}
+
+
+
+END_einfo_SCOPE // namespace einfo::
+
@@ -0,0 +1,8 @@
+#include <ncbi_pch.hpp>
+#include "DbInfo.cpp"
+#include "DbList.cpp"
+#include "EInfoResult.cpp"
+#include "Field.cpp"
+#include "FieldList.cpp"
+#include "Link.cpp"
+#include "LinkList.cpp"
@@ -0,0 +1,9 @@
+#include <ncbi_pch.hpp>
+#include "DbInfo_.cpp"
+#include "DbList_.cpp"
+#include "EInfoResult_.cpp"
+#include "Field_.cpp"
+#include "FieldList_.cpp"
+#include "Link_.cpp"
+#include "LinkList_.cpp"
+#include "einfo_module.cpp"
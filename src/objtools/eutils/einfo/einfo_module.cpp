@@ -0,0 +1,62 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'einfo.dtd'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objtools/eutils/einfo/einfo_module.hpp>
+#include <objtools/eutils/einfo/DbInfo.hpp>
+#include <objtools/eutils/einfo/DbList.hpp>
+#include <objtools/eutils/einfo/EInfoResult.hpp>
+#include <objtools/eutils/einfo/Field.hpp>
+#include <objtools/eutils/einfo/FieldList.hpp>
+#include <objtools/eutils/einfo/Link.hpp>
+#include <objtools/eutils/einfo/LinkList.hpp>
+
+
+BEGIN_einfo_SCOPE // namespace einfo::
+
+void einfo_RegisterModuleClasses(void)
+{
+    einfo::CDbInfo::GetTypeInfo();
+    einfo::CDbList::GetTypeInfo();
+    einfo::CEInfoResult::GetTypeInfo();
+    einfo::CField::GetTypeInfo();
+    einfo::CFieldList::GetTypeInfo();
+    einfo::CLink::GetTypeInfo();
+    einfo::CLinkList::GetTypeInfo();
+}
+
+END_einfo_SCOPE // namespace einfo::
+
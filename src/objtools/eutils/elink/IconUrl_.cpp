@@ -0,0 +1,152 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'elink.dtd'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objtools/eutils/elink/IconUrl.hpp>
+BEGIN_elink_SCOPE // namespace elink::
+
+
+// generated classes
+
+BEGIN_NAMED_ENUM_IN_INFO("", CIconUrl_Base::C_Attlist::, EAttlist_LNG, false)
+{
+    SET_ENUM_INTERNAL_NAME("IconUrl.Attlist", "LNG");
+    SET_ENUM_MODULE("elink");
+    ADD_ENUM_VALUE("DA", eAttlist_LNG_DA);
+    ADD_ENUM_VALUE("DE", eAttlist_LNG_DE);
+    ADD_ENUM_VALUE("EN", eAttlist_LNG_EN);
+    ADD_ENUM_VALUE("EL", eAttlist_LNG_EL);
+    ADD_ENUM_VALUE("ES", eAttlist_LNG_ES);
+    ADD_ENUM_VALUE("FR", eAttlist_LNG_FR);
+    ADD_ENUM_VALUE("IT", eAttlist_LNG_IT);
+    ADD_ENUM_VALUE("IW", eAttlist_LNG_IW);
+    ADD_ENUM_VALUE("JA", eAttlist_LNG_JA);
+    ADD_ENUM_VALUE("NL", eAttlist_LNG_NL);
+    ADD_ENUM_VALUE("NO", eAttlist_LNG_NO);
+    ADD_ENUM_VALUE("RU", eAttlist_LNG_RU);
+    ADD_ENUM_VALUE("SV", eAttlist_LNG_SV);
+    ADD_ENUM_VALUE("ZH", eAttlist_LNG_ZH);
+}
+END_ENUM_INFO
+
+void CIconUrl_Base::C_Attlist::Reset(void)
+{
+    ResetLNG();
+}
+
+BEGIN_NAMED_CLASS_INFO("", CIconUrl_Base::C_Attlist)
+{
+    SET_INTERNAL_NAME("IconUrl", "Attlist");
+    SET_CLASS_MODULE("elink");
+    ADD_NAMED_ENUM_MEMBER("LNG", m_LNG, EAttlist_LNG)->SetDefault(new TLNG(eAttlist_LNG_EN))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional()->SetNsQualified(false);
+    info->SetRandomOrder(true);
+    info->CodeVersion(22100);
+    info->DataSpec(ncbi::EDataSpec::eDTD);
+}
+END_CLASS_INFO
+
+// constructor
+CIconUrl_Base::C_Attlist::C_Attlist(void)
+    : m_LNG(eAttlist_LNG_EN)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CIconUrl_Base::C_Attlist::~C_Attlist(void)
+{
+}
+
+
+void CIconUrl_Base::ResetAttlist(void)
+{
+    if ( !m_Attlist ) {
+        m_Attlist.Reset(new TAttlist());
+        return;
+    }
+    (*m_Attlist).Reset();
+}
+
+void CIconUrl_Base::SetAttlist(CIconUrl_Base::TAttlist& value)
+{
+    m_Attlist.Reset(&value);
+}
+
+void CIconUrl_Base::ResetIconUrl(void)
+{
+    m_IconUrl.erase();
+    m_set_State[0] &= ~0xc;
+}
+
+void CIconUrl_Base::Reset(void)
+{
+    ResetAttlist();
+    ResetIconUrl();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("IconUrl", CIconUrl)
+{
+    SET_CLASS_MODULE("elink");
+    ADD_NAMED_REF_MEMBER("Attlist", m_Attlist, C_Attlist)->SetAttlist();
+    ADD_NAMED_STD_MEMBER("IconUrl", m_IconUrl)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetNotag();
+    info->RandomOrder();
+    info->CodeVersion(22100);
+    info->DataSpec(ncbi::EDataSpec::eDTD);
+}
+END_CLASS_INFO
+
+// constructor
+CIconUrl_Base::CIconUrl_Base(void)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+    if ( !IsAllocatedInPool() ) {
+        ResetAttlist();
+    }
+}
+
+// destructor
+CIconUrl_Base::~CIconUrl_Base(void)
+{
+}
+
+
+
+END_elink_SCOPE // namespace elink::
+
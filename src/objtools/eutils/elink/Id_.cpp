@@ -0,0 +1,151 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'elink.dtd'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objtools/eutils/elink/Id.hpp>
+BEGIN_elink_SCOPE // namespace elink::
+
+
+// generated classes
+
+BEGIN_NAMED_ENUM_IN_INFO("", CId_Base::C_Attlist::, EAttlist_HasLinkOut, false)
+{
+    SET_ENUM_INTERNAL_NAME("Id.Attlist", "HasLinkOut");
+    SET_ENUM_MODULE("elink");
+    ADD_ENUM_VALUE("Y", eAttlist_HasLinkOut_Y);
+    ADD_ENUM_VALUE("N", eAttlist_HasLinkOut_N);
+}
+END_ENUM_INFO
+
+BEGIN_NAMED_ENUM_IN_INFO("", CId_Base::C_Attlist::, EAttlist_HasNeighbor, false)
+{
+    SET_ENUM_INTERNAL_NAME("Id.Attlist", "HasNeighbor");
+    SET_ENUM_MODULE("elink");
+    ADD_ENUM_VALUE("Y", eAttlist_HasNeighbor_Y);
+    ADD_ENUM_VALUE("N", eAttlist_HasNeighbor_N);
+}
+END_ENUM_INFO
+
+void CId_Base::C_Attlist::Reset(void)
+{
+    ResetHasLinkOut();
+    ResetHasNeighbor();
+}
+
+BEGIN_NAMED_CLASS_INFO("", CId_Base::C_Attlist)
+{
+    SET_INTERNAL_NAME("Id", "Attlist");
+    SET_CLASS_MODULE("elink");
+    ADD_NAMED_ENUM_MEMBER("HasLinkOut", m_HasLinkOut, EAttlist_HasLinkOut)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional()->SetNsQualified(false);
+    ADD_NAMED_ENUM_MEMBER("HasNeighbor", m_HasNeighbor, EAttlist_HasNeighbor)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional()->SetNsQualified(false);
+    info->SetRandomOrder(true);
+    info->CodeVersion(22100);
+    info->DataSpec(ncbi::EDataSpec::eDTD);
+}
+END_CLASS_INFO
+
+// constructor
+CId_Base::C_Attlist::C_Attlist(void)
+    : m_HasLinkOut((EAttlist_HasLinkOut)(0)), m_HasNeighbor((EAttlist_HasNeighbor)(0))
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CId_Base::C_Attlist::~C_Attlist(void)
+{
+}
+
+
+void CId_Base::ResetAttlist(void)
+{
+    if ( !m_Attlist ) {
+        m_Attlist.Reset(new TAttlist());
+        return;
+    }
+    (*m_Attlist).Reset();
+}
+
+void CId_Base::SetAttlist(CId_Base::TAttlist& value)
+{
+    m_Attlist.Reset(&value);
+}
+
+void CId_Base::ResetId(void)
+{
+    m_Id.erase();
+    m_set_State[0] &= ~0xc;
+}
+
+void CId_Base::Reset(void)
+{
+    ResetAttlist();
+    ResetId();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("Id", CId)
+{
+    SET_CLASS_MODULE("elink");
+    ADD_NAMED_REF_MEMBER("Attlist", m_Attlist, C_Attlist)->SetAttlist();
+    ADD_NAMED_STD_MEMBER("Id", m_Id)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetNotag();
+    info->RandomOrder();
+    info->CodeVersion(22100);
+    info->DataSpec(ncbi::EDataSpec::eDTD);
+}
+END_CLASS_INFO
+
+// constructor
+CId_Base::CId_Base(void)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+    if ( !IsAllocatedInPool() ) {
+        ResetAttlist();
+    }
+}
+
+// destructor
+CId_Base::~CId_Base(void)
+{
+}
+
+
+
+END_elink_SCOPE // namespace elink::
+
@@ -0,0 +1,140 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'elink.dtd'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objtools/eutils/elink/LinkInfo.hpp>
+#include <objtools/eutils/elink/Url.hpp>
+BEGIN_elink_SCOPE // namespace elink::
+
+
+// generated classes
+
+void CLinkInfo_Base::ResetDbTo(void)
+{
+    m_DbTo.erase();
+    m_set_State[0] &= ~0x3;
+}
+
+void CLinkInfo_Base::ResetLinkName(void)
+{
+    m_LinkName.erase();
+    m_set_State[0] &= ~0xc;
+}
+
+void CLinkInfo_Base::ResetMenuTag(void)
+{
+    m_MenuTag.erase();
+    m_set_State[0] &= ~0x30;
+}
+
+void CLinkInfo_Base::ResetHtmlTag(void)
+{
+    m_HtmlTag.erase();
+    m_set_State[0] &= ~0xc0;
+}
+
+void CLinkInfo_Base::ResetUrl(void)
+{
+    m_Url.Reset();
+}
+
+void CLinkInfo_Base::SetUrl(CLinkInfo_Base::TUrl& value)
+{
+    m_Url.Reset(&value);
+}
+
+CLinkInfo_Base::TUrl& CLinkInfo_Base::SetUrl(void)
+{
+    if ( !m_Url )
+        m_Url.Reset(new TUrl());
+    return (*m_Url);
+}
+
+void CLinkInfo_Base::SetUrl(const NCBI_NS_STD::string& value)
+{
+    SetUrl() = value;
+}
+
+void CLinkInfo_Base::ResetPriority(void)
+{
+    m_Priority.erase();
+    m_set_State[0] &= ~0xc00;
+}
+
+void CLinkInfo_Base::Reset(void)
+{
+    ResetDbTo();
+    ResetLinkName();
+    ResetMenuTag();
+    ResetHtmlTag();
+    ResetUrl();
+    ResetPriority();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("LinkInfo", CLinkInfo)
+{
+    SET_CLASS_MODULE("elink");
+    ADD_NAMED_STD_MEMBER("DbTo", m_DbTo)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_STD_MEMBER("LinkName", m_LinkName)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_STD_MEMBER("MenuTag", m_MenuTag)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_STD_MEMBER("HtmlTag", m_HtmlTag)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_REF_MEMBER("Url", m_Url, CUrl)->SetOptional()->SetNsQualified(true);
+    ADD_NAMED_STD_MEMBER("Priority", m_Priority)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    info->RandomOrder();
+    info->CodeVersion(22100);
+    info->DataSpec(ncbi::EDataSpec::eDTD);
+}
+END_CLASS_INFO
+
+// constructor
+CLinkInfo_Base::CLinkInfo_Base(void)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CLinkInfo_Base::~CLinkInfo_Base(void)
+{
+}
+
+
+
+END_elink_SCOPE // namespace elink::
+
@@ -0,0 +1,18 @@
+#include <ncbi_pch.hpp>
+#include "ELinkResult.cpp"
+#include "FirstChars.cpp"
+#include "IconUrl.cpp"
+#include "Id.cpp"
+#include "IdCheckList.cpp"
+#include "IdLinkSet.cpp"
+#include "IdList.cpp"
+#include "IdUrlList.cpp"
+#include "IdUrlSet.cpp"
+#include "Link.cpp"
+#include "LinkInfo.cpp"
+#include "LinkSet.cpp"
+#include "LinkSetDb.cpp"
+#include "LinkSetDbHistory.cpp"
+#include "ObjUrl.cpp"
+#include "Provider.cpp"
+#include "Url.cpp"
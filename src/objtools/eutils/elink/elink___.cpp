@@ -0,0 +1,19 @@
+#include <ncbi_pch.hpp>
+#include "ELinkResult_.cpp"
+#include "FirstChars_.cpp"
+#include "IconUrl_.cpp"
+#include "Id_.cpp"
+#include "IdCheckList_.cpp"
+#include "IdLinkSet_.cpp"
+#include "IdList_.cpp"
+#include "IdUrlList_.cpp"
+#include "IdUrlSet_.cpp"
+#include "Link_.cpp"
+#include "LinkInfo_.cpp"
+#include "LinkSet_.cpp"
+#include "LinkSetDb_.cpp"
+#include "LinkSetDbHistory_.cpp"
+#include "ObjUrl_.cpp"
+#include "Provider_.cpp"
+#include "Url_.cpp"
+#include "elink_module.cpp"
@@ -0,0 +1,3 @@
+#include <ncbi_pch.hpp>
+#include "EPostResult.cpp"
+#include "InvalidIdList.cpp"
@@ -0,0 +1,4 @@
+#include <ncbi_pch.hpp>
+#include "EPostResult_.cpp"
+#include "InvalidIdList_.cpp"
+#include "epost_module.cpp"
@@ -0,0 +1,64 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'esearch.dtd'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objtools/eutils/esearch/esearch_module.hpp>
+#include <objtools/eutils/esearch/ESearchResult.hpp>
+#include <objtools/eutils/esearch/ErrorList.hpp>
+#include <objtools/eutils/esearch/IdList.hpp>
+#include <objtools/eutils/esearch/TermSet.hpp>
+#include <objtools/eutils/esearch/Translation.hpp>
+#include <objtools/eutils/esearch/TranslationSet.hpp>
+#include <objtools/eutils/esearch/TranslationStack.hpp>
+#include <objtools/eutils/esearch/WarningList.hpp>
+
+
+BEGIN_esearch_SCOPE // namespace esearch::
+
+void esearch_RegisterModuleClasses(void)
+{
+    esearch::CESearchResult::GetTypeInfo();
+    esearch::CErrorList::GetTypeInfo();
+    esearch::CIdList::GetTypeInfo();
+    esearch::CTermSet::GetTypeInfo();
+    esearch::CTranslation::GetTypeInfo();
+    esearch::CTranslationSet::GetTypeInfo();
+    esearch::CTranslationStack::GetTypeInfo();
+    esearch::CWarningList::GetTypeInfo();
+}
+
+END_esearch_SCOPE // namespace esearch::
+
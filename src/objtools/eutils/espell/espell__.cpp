@@ -0,0 +1,3 @@
+#include <ncbi_pch.hpp>
+#include "ESpellResult.cpp"
+#include "SpelledQuery.cpp"
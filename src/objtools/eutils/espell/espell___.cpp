@@ -0,0 +1,4 @@
+#include <ncbi_pch.hpp>
+#include "ESpellResult_.cpp"
+#include "SpelledQuery_.cpp"
+#include "espell_module.cpp"
@@ -0,0 +1,4 @@
+#include <ncbi_pch.hpp>
+#include "DocSum.cpp"
+#include "ESummaryResult.cpp"
+#include "Item.cpp"
@@ -0,0 +1,5 @@
+#include <ncbi_pch.hpp>
+#include "DocSum_.cpp"
+#include "ESummaryResult_.cpp"
+#include "Item_.cpp"
+#include "esummary_module.cpp"
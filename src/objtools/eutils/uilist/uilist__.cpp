@@ -0,0 +1,2 @@
+#include <ncbi_pch.hpp>
+#include "IdList.cpp"
@@ -0,0 +1,3 @@
+#include <ncbi_pch.hpp>
+#include "IdList_.cpp"
+#include "uilist_module.cpp"
@@ -0,0 +1,134 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   CMaskBatch class member and method definitions.
+ *
+ */
+#include <ncbi_pch.hpp>
+
+#include <algorithm>
+#include <exception>
+
+#include <objtools/seqmasks_io/mask_batch.hpp>
+
+BEGIN_NCBI_SCOPE
+USING_SCOPE(objects);
+
+//-------------------------------------------------------------------------
+CMaskBatch::CMaskBatch( CMaskWriter & writer,
+                        bool parsed_id,
+                        int num_threads,
+                        bool copy_data,
+                        Uint8 letters_per_thread,
+                        size_t seqs_per_thread )
+    : m_Writer( writer ), m_ParsedId( parsed_id ),
+      m_NumThreads( max( num_threads, 1 ) ), m_CopyData( copy_data ),
+      m_NumLetters( 0 ), m_NumMasked( 0 )
+{
+#ifndef _OPENMP
+    m_NumThreads = 1;
+#endif
+    m_MaxLetters = m_NumThreads * letters_per_thread;
+    m_MaxSeqs = m_NumThreads * seqs_per_thread;
+}
+
+//-------------------------------------------------------------------------
+void CMaskBatch::Add( CRef< CScope > scope,
+                      const CBioseq_Handle & bsh,
+                      const CSeqVector & seq )
+{
+    m_Seqs.push_back( SSeq() );
+    SSeq & s = m_Seqs.back();
+    s.scope = scope;
+    s.bsh = bsh;
+    s.seq = seq;
+
+    // The data is copied here, on the reading thread, when Mask() should
+    // not go through the object manager.
+    if( m_CopyData ) {
+        s.seq.GetSeqData( 0, s.seq.size(), s.data );
+    }
+
+    m_NumLetters += s.seq.size();
+
+    if( m_NumThreads == 1 ||
+        m_NumLetters >= m_MaxLetters || m_Seqs.size() >= m_MaxSeqs ) {
+        Flush();
+    }
+}
+
+//-------------------------------------------------------------------------
+void CMaskBatch::Flush()
+{
+    const int num_seqs = (int) m_Seqs.size();
+
+    // Longest sequences first, so that they do not hold up the end of
+    // the batch.
+    vector< pair< TSeqPos, int > > order;
+    order.reserve( num_seqs );
+    for( int i = 0; i < num_seqs; ++i ) {
+        order.push_back( make_pair( m_Seqs[i].seq.size(), i ) );
+    }
+    sort( order.rbegin(), order.rend() );
+
+    exception_ptr error;
+#ifdef _OPENMP
+    #pragma omp parallel for num_threads(m_NumThreads) schedule(dynamic, 1)
+#endif
+    for( int i = 0; i < num_seqs; ++i ) {
+        SSeq & s = m_Seqs[order[i].second];
+        try {
+            s.mask.reset( Mask( s ) );
+        }
+        catch( ... ) {
+#ifdef _OPENMP
+            #pragma omp critical(mask_batch_error)
+#endif
+            if( !error ) {
+                error = current_exception();
+            }
+        }
+    }
+
+    if( error ) {
+        m_Seqs.clear();
+        m_NumLetters = 0;
+        rethrow_exception( error );
+    }
+
+    NON_CONST_ITERATE( vector< SSeq >, s, m_Seqs ) {
+        m_Writer.Print( s->bsh, *s->mask, m_ParsedId );
+
+        ITERATE( TMaskList, i, *s->mask ) {
+            m_NumMasked += i->second - i->first + 1;
+        }
+    }
+
+    m_Seqs.clear();
+    m_NumLetters = 0;
+}
+
+END_NCBI_SCOPE